@@ -29,12 +29,18 @@
 #include "cJSON.h"
 #include <ctype.h>
 
+#define AIOCONTBUF_MAX_TRANSFERS    64
+#define AIOCONTBUF_USB_FAIL_COUNT   5
+#define AIOCONTBUF_TRANSFER_TIMEOUT 3000
+
 #ifdef __cplusplus
 namespace AIOUSB {
 #endif
 
 void *ConvertCountsToVoltsFunction( void *object );
 void *RawCountsWorkFunction( void *object );
+void *AsyncRawCountsWorkFunction( void *object );
+static void aiocontbuf_free_ring( struct aiocontbuf_ring *ring );
 AIORET_TYPE _AIOContinuousBufResizeFifo( AIOContinuousBuf *buf );
 AIORET_TYPE  AIOContinuousBufForceTerminateAcqusitionOverrun( AIOContinuousBuf *buf );
 AIORET_TYPE  AIOContinuousBufForceTerminateAcqusition( AIOContinuousBuf *buf );
@@ -318,6 +324,7 @@ AIORET_TYPE DeleteAIOContinuousBuf( AIOContinuousBuf *buf )
         free( buf->buffer );
     if ( buf->fifo  )
         DeleteAIOFifoCounts( (AIOFifoCounts *)buf->fifo );
+    aiocontbuf_free_ring( buf->ring );
     free( buf );
     return AIOUSB_SUCCESS;
 }
@@ -358,6 +365,51 @@ AIORET_TYPE AIOContinuousBufGetStreamingBlockSize( AIOContinuousBuf *buf )
     return buf->block_size;
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief Sets how many asynchronous bulk transfers are kept in flight during
+ *        an acquisition, each reading one streaming block. Setting 0 goes back
+ *        to the blocking RawCountsWorkFunction, which reads one block at a time.
+ * @param buf 
+ * @param num_transfers 
+ * @return 
+ */
+AIORET_TYPE AIOContinuousBufSetNumberTransfers( AIOContinuousBuf *buf, unsigned num_transfers )
+{
+    AIO_ASSERT_AIOCONTBUF( buf );
+    AIO_ERROR_VALID_DATA( -AIOUSB_ERROR_INVALID_PARAMETER, num_transfers <= AIOCONTBUF_MAX_TRANSFERS );
+    AIO_ERROR_VALID_DATA( -AIOUSB_ERROR_INVALID_THREAD, !( buf->status & RUNNING ) );
+
+    buf->num_transfers = num_transfers;
+    return AIOContinuousBufSetCallback( buf, num_transfers ? AsyncRawCountsWorkFunction : RawCountsWorkFunction );
+}
+
+/*----------------------------------------------------------------------------*/
+AIORET_TYPE AIOContinuousBufGetNumberTransfers( AIOContinuousBuf *buf )
+{
+    AIO_ASSERT_AIOCONTBUF( buf );
+    return buf->num_transfers;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief Hands each block from an asynchronous acquisition to the callback
+ *        in its transfer buffer, without copying it into the fifo. Passing
+ *        NULL goes back to filling the fifo for the Read functions.
+ * @param buf 
+ * @param callback 
+ * @return 
+ */
+AIORET_TYPE AIOContinuousBufSetBlockCallback( AIOContinuousBuf *buf, AIOUSB_BlockFn callback )
+{
+    AIO_ASSERT_AIOCONTBUF( buf );
+    AIOContinuousBufLock( buf );
+    buf->BlockCallback = callback;
+    AIOContinuousBufUnlock( buf );
+
+    return AIOUSB_SUCCESS;
+}
+
 /*----------------------------------------------------------------------------*/
 ADCConfigBlock *AIOContinuousBufGetADCConfigBlock( AIOContinuousBuf *buf )
 {
@@ -1033,6 +1085,237 @@ void *RawCountsWorkFunction( void *object )
   
 }
 
+/*----------------------------------------------------------------------------*/
+/** @cond INTERNAL_DOCUMENTATION */
+/**
+ * @brief The transfers for an asynchronous acquisition, each with its own
+ * block of the data buffer. They are allocated once and kept with the
+ * AIOContinuousBuf until the number of transfers or the block size changes.
+ */
+struct aiocontbuf_ring {
+    AIOContinuousBuf *buf;
+    USBDevice *usb;
+    struct libusb_transfer **transfers;
+    unsigned char *data;
+    unsigned num_transfers;
+    unsigned block_size;
+    int pending;                /**< Transfers submitted and not yet completed */
+    int usbfail;
+    AIORET_TYPE result;
+};
+
+static void aiocontbuf_free_ring( struct aiocontbuf_ring *ring )
+{
+    if ( !ring )
+        return;
+
+    if ( ring->transfers ) {
+        for ( unsigned i = 0; i < ring->num_transfers; i ++ )
+            libusb_free_transfer( ring->transfers[i] );
+        free( ring->transfers );
+    }
+    free( ring->data );
+    free( ring );
+}
+
+static struct aiocontbuf_ring *aiocontbuf_get_ring( AIOContinuousBuf *buf )
+{
+    struct aiocontbuf_ring *ring = buf->ring;
+    if ( ring && ring->num_transfers == buf->num_transfers && ring->block_size == buf->block_size )
+        return ring;
+
+    aiocontbuf_free_ring( ring );
+    buf->ring = ring = (struct aiocontbuf_ring *)calloc( 1, sizeof(struct aiocontbuf_ring) );
+    AIO_ERROR_VALID_DATA( NULL, ring );
+
+    ring->buf           = buf;
+    ring->num_transfers = buf->num_transfers;
+    ring->block_size    = buf->block_size;
+    ring->transfers     = (struct libusb_transfer **)calloc( ring->num_transfers, sizeof(struct libusb_transfer *) );
+    ring->data          = (unsigned char *)malloc( (size_t)ring->num_transfers * ring->block_size );
+
+    AIOUSB_BOOL ok = ( ring->transfers && ring->data ? AIOUSB_TRUE : AIOUSB_FALSE );
+    for ( unsigned i = 0; ok && i < ring->num_transfers; i ++ ) {
+        ring->transfers[i] = libusb_alloc_transfer( 0 );
+        ok = ( ring->transfers[i] ? AIOUSB_TRUE : AIOUSB_FALSE );
+    }
+
+    if ( !ok ) {
+        aiocontbuf_free_ring( ring );
+        buf->ring = ring = NULL;
+    }
+    return ring;
+}
+
+static int aiocontbuf_transfer_result( enum libusb_transfer_status status )
+{
+    switch ( status ) {
+    case LIBUSB_TRANSFER_COMPLETED:
+        return LIBUSB_SUCCESS;
+    case LIBUSB_TRANSFER_TIMED_OUT:
+        return LIBUSB_ERROR_TIMEOUT;
+    case LIBUSB_TRANSFER_STALL:
+        return LIBUSB_ERROR_PIPE;
+    case LIBUSB_TRANSFER_NO_DEVICE:
+        return LIBUSB_ERROR_NO_DEVICE;
+    case LIBUSB_TRANSFER_OVERFLOW:
+        return LIBUSB_ERROR_OVERFLOW;
+    case LIBUSB_TRANSFER_CANCELLED:
+        return LIBUSB_ERROR_INTERRUPTED;
+    default:
+        return LIBUSB_ERROR_IO;
+    }
+}
+
+static void aiocontbuf_ring_terminate( struct aiocontbuf_ring *ring, int usbresult )
+{
+    AIOContinuousBuf *buf = ring->buf;
+    ring->result = -(AIORET_TYPE)LIBUSB_RESULT_TO_AIOUSB_RESULT(usbresult);
+    AIOContinuousBufLock(buf);
+    buf->status = TERMINATED;
+    AIOContinuousBufUnlock(buf);
+    buf->exitcode = ring->result;
+}
+
+/**
+ * @brief Hands a completed block straight from its transfer buffer to the
+ * block callback, or else pushes it into the fifo
+ */
+static void aiocontbuf_deliver( AIOContinuousBuf *buf, unsigned char *data, int bytes )
+{
+    int64_t total = AIOContinuousBufGetTotalSamplesExpected(buf)*AIOContinuousBufGetUnitSize(buf);
+    int64_t nbytes = MIN( total - buf->bytes_processed, (int64_t)bytes );
+    if ( nbytes <= 0 )
+        return;
+
+    if ( buf->BlockCallback ) {
+        if ( buf->BlockCallback( buf, (uint16_t *)data, nbytes / sizeof(unsigned short) ) < 0 )
+            AIOContinuousBufForceTerminateAcqusition( buf );
+    } else if ( AIOContinuousBufPushN( buf, data, nbytes / sizeof(unsigned short) ) <= 0 ) {
+        AIOUSB_ERROR("Buffer overflow error: tried to add %ld with size=%ld available\n",
+                     (long)nbytes / 2, (long)AIOFifoWriteSizeRemainingNumElements(buf->fifo ) );
+        AIOContinuousBufForceTerminateAcqusitionOverrun( buf );
+    }
+    buf->bytes_processed += nbytes;
+
+    if ( buf->bytes_processed >= total ) {
+        AIOContinuousBufLock(buf);
+        if ( buf->status & RUNNING )
+            buf->status = TERMINATED;
+        AIOContinuousBufUnlock(buf);
+    }
+}
+
+static int aiocontbuf_submit( struct aiocontbuf_ring *ring, struct libusb_transfer *transfer )
+{
+    int usbresult = ring->usb->usb_submit_transfer( ring->usb, transfer );
+    if ( usbresult == LIBUSB_SUCCESS ) {
+        ring->pending ++;
+    } else {
+        AIOUSB_ERROR("Unable to submit usb transfer: %d\n", usbresult );
+        aiocontbuf_ring_terminate( ring, usbresult );
+    }
+    return usbresult;
+}
+
+/**
+ * @brief Runs from usb_handle_events() on the acquisition thread. The block
+ * is delivered before the transfer is resubmitted, so its buffer is not
+ * overwritten while the consumer is using it.
+ */
+static void LIBUSB_CALL aiocontbuf_transfer_complete( struct libusb_transfer *transfer )
+{
+    struct aiocontbuf_ring *ring = (struct aiocontbuf_ring *)transfer->user_data;
+    AIOContinuousBuf *buf = ring->buf;
+
+    ring->pending --;
+    if ( transfer->status == LIBUSB_TRANSFER_CANCELLED )
+        return;
+
+    if ( transfer->actual_length > 0 ) {
+        aiocontbuf_deliver( buf, transfer->buffer, transfer->actual_length );
+    } else if ( transfer->status != LIBUSB_TRANSFER_COMPLETED && ( buf->status & RUNNING ) ) {
+        int usbresult = aiocontbuf_transfer_result( transfer->status );
+        if ( ++ring->usbfail >= AIOCONTBUF_USB_FAIL_COUNT ) {
+            AIOUSB_ERROR("Erroring out. too many usb failures: %d\n", AIOCONTBUF_USB_FAIL_COUNT );
+            aiocontbuf_ring_terminate( ring, usbresult );
+        } else {
+            AIOUSB_ERROR("Error with usb: %d\n", usbresult );
+        }
+    }
+
+    if ( buf->status & RUNNING )
+        aiocontbuf_submit( ring, transfer );
+}
+/** @endcond */
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief Work function for collecting counts with num_transfers bulk reads
+ *        in flight at once. Each block is handed on from the ring buffer it
+ *        was read into and its transfer is resubmitted straight away, so the
+ *        device always has a read waiting while a block is being consumed.
+ * @param object 
+ * @return 
+ */
+void *AsyncRawCountsWorkFunction( void *object )
+{
+    static AIORET_TYPE retval = AIOUSB_SUCCESS;
+    AIOContinuousBuf *buf = (AIOContinuousBuf*)object;
+    AIO_ASSERT_RET( NULL, object );
+    AIOUSB_BOOL cancelled = AIOUSB_FALSE;
+    USBDevice *usb = AIODeviceTableGetUSBDeviceAtIndex( AIOContinuousBufGetDeviceIndex( buf ), (AIORESULT*)&retval );
+    AIO_ERROR_VALID_DATA( &retval, retval == AIOUSB_SUCCESS );
+
+    struct aiocontbuf_ring *ring = aiocontbuf_get_ring( buf );
+    if ( !ring ) {
+        AIOUSB_ERROR("Unable to allocate %u usb transfers\n", buf->num_transfers );
+        retval = buf->exitcode = -AIOUSB_ERROR_NOT_ENOUGH_MEMORY;
+        AIOContinuousBufForceTerminateAcqusition( buf );
+        AIOContinuousBufCleanup( buf );
+        pthread_exit((void*)&retval);
+    }
+
+    ring->usb      = usb;
+    ring->usbfail  = 0;
+    ring->result   = AIOUSB_SUCCESS;
+    buf->start_scanning = AIOUSB_TRUE;
+
+    for ( unsigned i = 0; i < ring->num_transfers && ( buf->status & RUNNING ); i ++ ) {
+        libusb_fill_bulk_transfer( ring->transfers[i], usb->deviceHandle, 0x86,
+                                   ring->data + (size_t)i * ring->block_size, ring->block_size,
+                                   aiocontbuf_transfer_complete, ring, AIOCONTBUF_TRANSFER_TIMEOUT );
+        aiocontbuf_submit( ring, ring->transfers[i] );
+    }
+
+    while ( ring->pending > 0 ) {
+        struct timeval timeout = { 0, 100000 };
+
+        if ( !( buf->status & RUNNING ) && !cancelled ) {
+            AIOUSB_DEVEL("Cancelling %d usb transfers\n", ring->pending );
+            for ( unsigned i = 0; i < ring->num_transfers; i ++ )
+                usb->usb_cancel_transfer( usb, ring->transfers[i] );
+            cancelled = AIOUSB_TRUE;
+        }
+
+        int usbresult = usb->usb_handle_events( usb, &timeout );
+        if ( usbresult < 0 && usbresult != LIBUSB_ERROR_INTERRUPTED ) {
+            AIOUSB_ERROR("Error handling usb events: %d\n", (int)usbresult );
+            if ( cancelled ) {
+                /* The transfers still belong to libusb, so they can not be reused or freed */
+                buf->ring = NULL;
+                break;
+            }
+            aiocontbuf_ring_terminate( ring, usbresult );
+        }
+    }
+
+    retval = ring->result;
+    AIOUSB_DEVEL("Stopping\n");
+    AIOContinuousBufCleanup( buf );
+    pthread_exit((void*)&retval);
+}
+
 /*----------------------------------------------------------------------------*/
 /**
  * @brief Main work function for collecting data. Also performs copies from 
@@ -2128,6 +2411,7 @@ char *AIOContinuousBufToJSON( AIOContinuousBuf *buf )
 
 
 #include "AIOUSBDevice.h"
+#include "mocks/MockUSBDevice.h"
 #include "gtest/gtest.h"
 
 #include <iostream>
@@ -2661,6 +2945,185 @@ TEST(AIOContinuousBuf,CorrectCountScansAvailable)
 }
 
 
+/**
+ * @brief Runs acquisitions against a MockUSBDevice, so the USB side of the
+ * work functions can be tested without any hardware
+ */
+class AIOContinuousBufMockAcquisition : public ::testing::Test
+{
+ protected:
+    virtual void SetUp() {
+        numDevices = 0;
+        AIODeviceTableInit();
+        usb = NewMockUSBDevice( 0 );
+        AIODeviceTableAddDeviceToDeviceTableWithUSBDevice( &numDevices, USB_AI16_16E, usb );
+    }
+
+    virtual void TearDown() {
+        /* Frees the mock device */
+        AIODeviceTableInit();
+    }
+
+    AIORET_TYPE acquire( AIOContinuousBuf *buf ) {
+        AIORET_TYPE *retval = NULL;
+        AIOContinuousBufStart( buf );
+        pthread_join( buf->worker, (void **)&retval );
+        return retval ? *retval : -AIOUSB_ERROR_INVALID_THREAD;
+    }
+
+    int numDevices;
+    USBDevice *usb;
+};
+
+static uint16_t next_block_count;
+static int64_t block_counts;
+static unsigned block_delay;
+static USBDevice *block_usb;
+static int block_in_flight_min, block_in_flight_max;
+
+AIORET_TYPE check_block( AIOContinuousBuf *buf, uint16_t *counts, unsigned num_counts )
+{
+    if ( block_usb ) {
+        int in_flight = (int)MockUSBDeviceGetPendingTransfers( block_usb );
+        block_in_flight_min = MIN( block_in_flight_min, in_flight );
+        block_in_flight_max = MAX( block_in_flight_max, in_flight );
+    }
+    for ( unsigned i = 0; i < num_counts; i ++ ) {
+        if ( counts[i] != next_block_count++ )
+            return -AIOUSB_ERROR_INVALID_DATA;
+    }
+    block_counts += num_counts;
+    if ( block_delay )
+        usleep( block_delay );
+    return AIOUSB_SUCCESS;
+}
+
+TEST_F(AIOContinuousBufMockAcquisition, AsyncTransfersReadEveryCount )
+{
+    int num_scans = 10000, num_channels = 16;
+    AIOContinuousBuf *buf = NewAIOContinuousBufForCounts( 0, num_scans, num_channels );
+    AIOContinuousBufSetStreamingBlockSize( buf, 8*512 );
+
+    EXPECT_EQ( -AIOUSB_ERROR_INVALID_PARAMETER, AIOContinuousBufSetNumberTransfers( buf, 1000 ) );
+    ASSERT_EQ( AIOUSB_SUCCESS, AIOContinuousBufSetNumberTransfers( buf, 4 ) );
+    EXPECT_EQ( 4, AIOContinuousBufGetNumberTransfers( buf ) );
+    EXPECT_EQ( (AIOUSB_WorkFn)AsyncRawCountsWorkFunction, AIOContinuousBufGetCallback( buf ) );
+
+    /* The ring is kept for the next acquisition */
+    for ( int run = 0; run < 2; run ++ ) {
+        AIOContinuousBufReset( buf );
+        EXPECT_EQ( AIOUSB_SUCCESS, acquire( buf ) );
+        EXPECT_EQ( TERMINATED, AIOContinuousBufGetRunStatus( buf ) );
+        EXPECT_EQ( 0, MockUSBDeviceGetPendingTransfers( usb ) );
+        ASSERT_EQ( num_scans, AIOContinuousBufCountScansAvailable( buf ) );
+
+        uint16_t *counts = (uint16_t *)malloc( num_scans*num_channels*sizeof(uint16_t) );
+        ASSERT_GE( AIOContinuousBufPopN( buf, counts, num_scans*num_channels ), AIOUSB_SUCCESS );
+        uint16_t first = counts[0];
+        for ( int i = 0; i < num_scans*num_channels; i ++ )
+            ASSERT_EQ( (uint16_t)(first + i), counts[i] ) << "at count " << i;
+        free( counts );
+    }
+
+    ASSERT_EQ( AIOUSB_SUCCESS, AIOContinuousBufSetNumberTransfers( buf, 0 ) );
+    EXPECT_EQ( (AIOUSB_WorkFn)RawCountsWorkFunction, AIOContinuousBufGetCallback( buf ) );
+    DeleteAIOContinuousBuf( buf );
+}
+
+TEST_F(AIOContinuousBufMockAcquisition, BlockCallbackSkipsTheFifo )
+{
+    int num_scans = 5000, num_channels = 4;
+    AIOContinuousBuf *buf = NewAIOContinuousBufForCounts( 0, num_scans, num_channels );
+    AIOContinuousBufSetStreamingBlockSize( buf, 2*512 );
+    AIOContinuousBufSetNumberTransfers( buf, 8 );
+    AIOContinuousBufSetBlockCallback( buf, check_block );
+
+    next_block_count = 0;
+    block_counts = 0;
+    block_delay = 0;
+    EXPECT_EQ( AIOUSB_SUCCESS, acquire( buf ) );
+    EXPECT_EQ( TERMINATED, AIOContinuousBufGetRunStatus( buf ) );
+    EXPECT_EQ( num_scans*num_channels, block_counts );
+    EXPECT_EQ( 0, AIOContinuousBufCountScansAvailable( buf ) );
+
+    DeleteAIOContinuousBuf( buf );
+}
+
+TEST_F(AIOContinuousBufMockAcquisition, RetriesFailedTransfers )
+{
+    int num_scans = 2000, num_channels = 16;
+    AIOContinuousBuf *buf = NewAIOContinuousBufForCounts( 0, num_scans, num_channels );
+    AIOContinuousBufSetNumberTransfers( buf, 4 );
+    AIOContinuousBufSetBlockCallback( buf, check_block );
+
+    next_block_count = 0;
+    block_counts = 0;
+    block_delay = 0;
+    MockUSBDeviceSetFailures( usb, 2 );
+    EXPECT_EQ( AIOUSB_SUCCESS, acquire( buf ) );
+    EXPECT_EQ( num_scans*num_channels, block_counts );
+
+    AIOContinuousBufReset( buf );
+    MockUSBDeviceSetFailures( usb, 1000 );
+    EXPECT_LT( acquire( buf ), AIOUSB_SUCCESS );
+    EXPECT_EQ( TERMINATED, AIOContinuousBufGetRunStatus( buf ) );
+    EXPECT_LT( AIOContinuousBufGetExitCode( buf ), AIOUSB_SUCCESS );
+    EXPECT_EQ( 0, MockUSBDeviceGetPendingTransfers( usb ) );
+
+    DeleteAIOContinuousBuf( buf );
+}
+
+TEST_F(AIOContinuousBufMockAcquisition, StopCancelsTransfers )
+{
+    AIOContinuousBuf *buf = NewAIOContinuousBufForCounts( 0, 1000, 16 );
+    AIOContinuousBufSetNumberScans( buf, LONG_MAX );
+    AIOContinuousBufSetNumberTransfers( buf, 4 );
+    AIOContinuousBufSetBlockCallback( buf, check_block );
+
+    next_block_count = 0;
+    block_counts = 0;
+    block_delay = 100;
+    AIOContinuousBufStart( buf );
+    usleep( 20000 );
+    AIOContinuousBufStopAcquisition( buf );
+    pthread_join( buf->worker, NULL );
+
+    EXPECT_FALSE( AIOContinuousBufGetRunStatus( buf ) & RUNNING );
+    EXPECT_EQ( 0, MockUSBDeviceGetPendingTransfers( usb ) );
+    EXPECT_GT( block_counts, 0 );
+
+    DeleteAIOContinuousBuf( buf );
+}
+
+/**
+ * @brief While each block is consumed, the other num_transfers - 1 reads are
+ * still waiting on the device, so the ring never lets the bus go idle
+ */
+TEST_F(AIOContinuousBufMockAcquisition, KeepsTransfersInFlight )
+{
+    int num_blocks = 50, num_channels = 16;
+    for ( unsigned num_transfers = 1; num_transfers <= 8; num_transfers *= 2 ) {
+        AIOContinuousBuf *buf = NewAIOContinuousBufForCounts( 0, num_blocks * 64*1024 / ( num_channels * 2 ), num_channels );
+        AIOContinuousBufSetNumberTransfers( buf, num_transfers );
+        AIOContinuousBufSetBlockCallback( buf, check_block );
+
+        next_block_count = (uint16_t)( MockUSBDeviceGetBytesSent( usb ) / 2 );
+        block_counts = 0;
+        block_usb = usb;
+        block_delay = 0;
+        block_in_flight_min = AIOCONTBUF_MAX_TRANSFERS;
+        block_in_flight_max = -1;
+
+        EXPECT_EQ( AIOUSB_SUCCESS, acquire( buf ) );
+        EXPECT_EQ( (int64_t)num_blocks * 32*1024, block_counts );
+        EXPECT_EQ( (int)num_transfers - 1, block_in_flight_min ) << num_transfers << " transfers";
+        EXPECT_EQ( (int)num_transfers - 1, block_in_flight_max ) << num_transfers << " transfers";
+        EXPECT_EQ( 0, MockUSBDeviceGetPendingTransfers( usb ) );
+
+        block_usb = NULL;
+        DeleteAIOContinuousBuf( buf );
+    }
+}
 
 #include <unistd.h>
 #include <stdio.h>
@@ -35,6 +35,17 @@ namespace AIOUSB
 
 typedef void *(*AIOUSB_WorkFn)( void *obj );
 
+struct AIOContinuousBuf;
+struct aiocontbuf_ring;
+
+/**
+ * @brief Receives each block of counts read by an asynchronous acquisition, in the
+ * transfer buffer it was read into. The counts are only valid until the callback
+ * returns, and a block may end part way through a scan. Returning a negative
+ * value stops the acquisition.
+ */
+typedef AIORET_TYPE (*AIOUSB_BlockFn)( struct AIOContinuousBuf *buf, uint16_t *counts, unsigned num_counts );
+
  typedef enum {
      AIO_CONT_BUF_TYPE_COUNTS = 2,
      AIO_CONT_BUF_TYPE_VOLTS = 8,
@@ -97,6 +108,10 @@ typedef struct AIOContinuousBuf {
     AIO_CONT_BUF_TYPE type;
     AIORET_TYPE (*PushN)( struct AIOContinuousBuf *buf, void *frombuf, unsigned int N );
     AIORET_TYPE (*PopN)( struct AIOContinuousBuf *buf, void *frombuf, unsigned int N );
+
+    unsigned num_transfers;             /**< Asynchronous transfers kept in flight, 0 for blocking reads */
+    struct aiocontbuf_ring *ring;       /**< Transfers and block buffers reused by each acquisition */
+    AIOUSB_BlockFn BlockCallback;       /**< Takes the blocks in place of the fifo, if set */
 } AIOContinuousBuf;
 
 #define ROOTCLOCK 10000000
@@ -126,6 +141,10 @@ PUBLIC_EXTERN AIORET_TYPE AIOContinuousBufSetCallback(AIOContinuousBuf *buf , vo
 PUBLIC_EXTERN AIORET_TYPE AIOContinuousBufSetStreamingBlockSize( AIOContinuousBuf *buf, unsigned sblksize);
 PUBLIC_EXTERN AIORET_TYPE AIOContinuousBufGetStreamingBlockSize( AIOContinuousBuf *buf );
 
+PUBLIC_EXTERN AIORET_TYPE AIOContinuousBufSetNumberTransfers( AIOContinuousBuf *buf, unsigned num_transfers );
+PUBLIC_EXTERN AIORET_TYPE AIOContinuousBufGetNumberTransfers( AIOContinuousBuf *buf );
+PUBLIC_EXTERN AIORET_TYPE AIOContinuousBufSetBlockCallback( AIOContinuousBuf *buf, AIOUSB_BlockFn callback );
+
 PUBLIC_EXTERN ADCConfigBlock *AIOContinuousBufGetADCConfigBlock( AIOContinuousBuf *buf );
 
 
@@ -130,6 +130,9 @@ AIOEither InitializeUSBDevice( USBDevice *usb, LIBUSBArgs *args )
     usb->usb_reset_device      = usb_reset_device;
     usb->usb_put_config        = USBDevicePutADCConfigBlock;
     usb->usb_get_config        = USBDeviceFetchADCConfigBlock;
+    usb->usb_submit_transfer   = usb_submit_transfer;
+    usb->usb_cancel_transfer   = usb_cancel_transfer;
+    usb->usb_handle_events     = usb_handle_events;
 
     return retval;
  error:
@@ -446,6 +449,42 @@ int usb_reset_device( USBDevice *usb )
     return libusbResult;
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+ * @details Submits an asynchronous transfer that has been filled in for
+ * this device. The transfer's callback is run from usb_handle_events()
+ * once it completes, fails or is cancelled
+ */
+int usb_submit_transfer( USBDevice *usb, struct libusb_transfer *transfer )
+{
+    AIO_ASSERT_USB( usb );
+    AIO_ASSERT( transfer );
+
+    return libusb_submit_transfer( transfer );
+}
+
+/*----------------------------------------------------------------------------*/
+int usb_cancel_transfer( USBDevice *usb, struct libusb_transfer *transfer )
+{
+    AIO_ASSERT_USB( usb );
+    AIO_ASSERT( transfer );
+
+    return libusb_cancel_transfer( transfer );
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @details Waits up to timeout for asynchronous transfer events on the
+ * default libusb context, running the callbacks of any transfers that
+ * have finished
+ */
+int usb_handle_events( USBDevice *usb, struct timeval *timeout )
+{
+    AIO_ASSERT_USB( usb );
+
+    return libusb_handle_events_timeout_completed( NULL, timeout, NULL );
+}
+
 
 
 #ifdef __cplusplus
@@ -30,6 +30,9 @@ struct USBDevice {
     int (*usb_reset_device)(USBDevice *usbdev );
     int (*usb_put_config)( USBDevice *usb, ADCConfigBlock *configBlock );
     int (*usb_get_config)( USBDevice *usb, ADCConfigBlock *configBlock );
+    int (*usb_submit_transfer)( USBDevice *usb, struct libusb_transfer *transfer );
+    int (*usb_cancel_transfer)( USBDevice *usb, struct libusb_transfer *transfer );
+    int (*usb_handle_events)( USBDevice *usb, struct timeval *timeout );
 
 
 
@@ -75,6 +78,9 @@ PUBLIC_EXTERN int usb_request(USBDevice *dev_handle,
                         uint8_t request_type, uint8_t bRequest, uint16_t wValue, uint16_t wIndex,
                         unsigned char *data, uint16_t wLength, unsigned int timeout);
 PUBLIC_EXTERN int usb_reset_device( USBDevice *usb );
+PUBLIC_EXTERN int usb_submit_transfer( USBDevice *usb, struct libusb_transfer *transfer );
+PUBLIC_EXTERN int usb_cancel_transfer( USBDevice *usb, struct libusb_transfer *transfer );
+PUBLIC_EXTERN int usb_handle_events( USBDevice *usb, struct timeval *timeout );
 
  
 PUBLIC_EXTERN libusb_device_handle *get_usb_device( USBDevice *dev );
@@ -0,0 +1,311 @@
+/**
+ * @file   MockUSBDevice.c
+ * @author $Format: %an <%ae>$
+ * @date   $Format: %ad$
+ * @version $Format: %h$
+ * @brief  A USBDevice that streams counts without any hardware attached
+ *
+ */
+
+#include "mocks/MockUSBDevice.h"
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+namespace AIOUSB {
+#endif
+
+#define MOCK_USB_MAX_TRANSFERS 64
+
+typedef struct mock_usb_request {
+    struct libusb_transfer *transfer;
+    int64_t due;                /**< Time the transfer finishes on the bus, in microseconds */
+    AIOUSB_BOOL cancelled;
+} mock_usb_request;
+
+typedef struct MockUSBDevice {
+    USBDevice usb;              /**< Must be first, so the mock is freed as a USBDevice */
+    unsigned latency;
+    uint16_t next_count;
+    int64_t bytes_sent;
+    int failures;
+    int64_t bus_free;           /**< Time the last submitted transfer finishes */
+    mock_usb_request queue[MOCK_USB_MAX_TRANSFERS];
+    unsigned head;
+    unsigned count;
+} MockUSBDevice;
+
+/*----------------------------------------------------------------------------*/
+static int64_t mock_usb_now(void)
+{
+    struct timespec now;
+    clock_gettime( CLOCK_MONOTONIC, &now );
+    return (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+/*----------------------------------------------------------------------------*/
+static int mock_usb_fill( MockUSBDevice *mock, unsigned char *data, int length )
+{
+    if ( mock->failures > 0 ) {
+        mock->failures --;
+        return 0;
+    }
+
+    uint16_t *counts = (uint16_t *)data;
+    int num_counts = length / sizeof(uint16_t);
+    for ( int i = 0; i < num_counts; i ++ )
+        counts[i] = mock->next_count ++;
+
+    mock->bytes_sent += num_counts * sizeof(uint16_t);
+    return num_counts * sizeof(uint16_t);
+}
+
+/*----------------------------------------------------------------------------*/
+static int mock_usb_control_transfer( USBDevice *usb, uint8_t request_type, uint8_t bRequest, uint16_t wValue,
+                                      uint16_t wIndex, unsigned char *data, uint16_t wLength, unsigned int timeout )
+{
+    if ( ( request_type & LIBUSB_ENDPOINT_IN ) && data )
+        memset( data, 0, wLength );
+    return wLength;
+}
+
+/*----------------------------------------------------------------------------*/
+static int mock_usb_bulk_transfer( USBDevice *usb, unsigned char endpoint, unsigned char *data, int length,
+                                   int *actual_length, unsigned int timeout )
+{
+    MockUSBDevice *mock = (MockUSBDevice *)usb;
+
+    if ( mock->latency )
+        usleep( mock->latency );
+
+    *actual_length = mock_usb_fill( mock, data, length );
+    return *actual_length ? LIBUSB_SUCCESS : LIBUSB_ERROR_TIMEOUT;
+}
+
+/*----------------------------------------------------------------------------*/
+static int mock_usb_reset_device( USBDevice *usb )
+{
+    return LIBUSB_SUCCESS;
+}
+
+/*----------------------------------------------------------------------------*/
+static int mock_usb_config( USBDevice *usb, ADCConfigBlock *configBlock )
+{
+    return AIOUSB_SUCCESS;
+}
+
+/*----------------------------------------------------------------------------*/
+static int mock_usb_submit_transfer( USBDevice *usb, struct libusb_transfer *transfer )
+{
+    MockUSBDevice *mock = (MockUSBDevice *)usb;
+    AIO_ERROR_VALID_DATA( LIBUSB_ERROR_BUSY, mock->count < MOCK_USB_MAX_TRANSFERS );
+
+    /* The bus reads one transfer at a time, so each finishes a latency after the one before it */
+    mock->bus_free = MAX( mock_usb_now(), mock->bus_free ) + mock->latency;
+
+    mock_usb_request *req = &mock->queue[( mock->head + mock->count ) % MOCK_USB_MAX_TRANSFERS];
+    req->transfer  = transfer;
+    req->due       = mock->bus_free;
+    req->cancelled = AIOUSB_FALSE;
+    mock->count ++;
+
+    return LIBUSB_SUCCESS;
+}
+
+/*----------------------------------------------------------------------------*/
+static int mock_usb_cancel_transfer( USBDevice *usb, struct libusb_transfer *transfer )
+{
+    MockUSBDevice *mock = (MockUSBDevice *)usb;
+
+    for ( unsigned i = 0; i < mock->count; i ++ ) {
+        mock_usb_request *req = &mock->queue[( mock->head + i ) % MOCK_USB_MAX_TRANSFERS];
+        if ( req->transfer == transfer && !req->cancelled ) {
+            req->cancelled = AIOUSB_TRUE;
+            return LIBUSB_SUCCESS;
+        }
+    }
+    return LIBUSB_ERROR_NOT_FOUND;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @details Like libusb_handle_events_timeout_completed(), waits up to
+ * timeout for the next transfer, then runs the callbacks of every transfer
+ * that has finished, in the order they were submitted
+ */
+static int mock_usb_handle_events( USBDevice *usb, struct timeval *timeout )
+{
+    MockUSBDevice *mock = (MockUSBDevice *)usb;
+    int64_t deadline = mock_usb_now() + (int64_t)timeout->tv_sec * 1000000 + timeout->tv_usec;
+    int completed = 0;
+
+    while ( mock->count > 0 ) {
+        mock_usb_request req = mock->queue[mock->head];
+        int64_t now = mock_usb_now();
+
+        if ( !req.cancelled && req.due > now ) {
+            if ( completed || now >= deadline )
+                break;
+            usleep( MIN( req.due, deadline ) - now );
+            continue;
+        }
+
+        mock->head = ( mock->head + 1 ) % MOCK_USB_MAX_TRANSFERS;
+        mock->count --;
+
+        struct libusb_transfer *transfer = req.transfer;
+        if ( req.cancelled ) {
+            transfer->actual_length = 0;
+            transfer->status = LIBUSB_TRANSFER_CANCELLED;
+        } else {
+            transfer->actual_length = mock_usb_fill( mock, transfer->buffer, transfer->length );
+            transfer->status = transfer->actual_length ? LIBUSB_TRANSFER_COMPLETED : LIBUSB_TRANSFER_TIMED_OUT;
+        }
+
+        /* The callback may resubmit the transfer to the back of the queue */
+        transfer->callback( transfer );
+        completed ++;
+    }
+
+    return LIBUSB_SUCCESS;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @param latency Microseconds for each bulk read to finish on the simulated bus
+ * @return A new mock device, or NULL
+ */
+USBDevice *NewMockUSBDevice( unsigned latency )
+{
+    MockUSBDevice *mock = (MockUSBDevice *)calloc( 1, sizeof(MockUSBDevice) );
+    AIO_ERROR_VALID_DATA( NULL, mock );
+
+    mock->latency = latency;
+
+    USBDevice *usb = &mock->usb;
+#if !defined(__cplusplus) || !defined(mocktesting)
+    usb->usb_control_transfer  = mock_usb_control_transfer;
+#endif
+    usb->usb_bulk_transfer     = mock_usb_bulk_transfer;
+    usb->usb_request           = mock_usb_control_transfer;
+    usb->usb_reset_device      = mock_usb_reset_device;
+    usb->usb_put_config        = mock_usb_config;
+    usb->usb_get_config        = mock_usb_config;
+    usb->usb_submit_transfer   = mock_usb_submit_transfer;
+    usb->usb_cancel_transfer   = mock_usb_cancel_transfer;
+    usb->usb_handle_events     = mock_usb_handle_events;
+
+    return usb;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief The next num_failures bulk reads return no data and time out
+ */
+AIORET_TYPE MockUSBDeviceSetFailures( USBDevice *usb, int num_failures )
+{
+    AIO_ASSERT_USB( usb );
+    ((MockUSBDevice *)usb)->failures = num_failures;
+    return AIOUSB_SUCCESS;
+}
+
+/*----------------------------------------------------------------------------*/
+AIORET_TYPE MockUSBDeviceGetBytesSent( USBDevice *usb )
+{
+    AIO_ASSERT_USB( usb );
+    return ((MockUSBDevice *)usb)->bytes_sent;
+}
+
+/*----------------------------------------------------------------------------*/
+AIORET_TYPE MockUSBDeviceGetPendingTransfers( USBDevice *usb )
+{
+    AIO_ASSERT_USB( usb );
+    return ((MockUSBDevice *)usb)->count;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef SELF_TEST
+
+#include "gtest/gtest.h"
+
+using namespace AIOUSB;
+
+static int completions[8];
+static int num_completions;
+
+static void LIBUSB_CALL record_completion( struct libusb_transfer *transfer )
+{
+    completions[num_completions++] = (int)(intptr_t)transfer->user_data;
+}
+
+TEST(MockUSBDevice,BulkReadsStreamCounts)
+{
+    USBDevice *usb = NewMockUSBDevice( 0 );
+    uint16_t counts[100];
+    int bytes;
+
+    for ( int block = 0; block < 3; block ++ ) {
+        ASSERT_EQ( LIBUSB_SUCCESS, usb->usb_bulk_transfer( usb, 0x86, (unsigned char *)counts, sizeof(counts), &bytes, 1000 ) );
+        ASSERT_EQ( (int)sizeof(counts), bytes );
+        for ( int i = 0; i < 100; i ++ )
+            EXPECT_EQ( block * 100 + i, counts[i] );
+    }
+
+    MockUSBDeviceSetFailures( usb, 1 );
+    EXPECT_EQ( LIBUSB_ERROR_TIMEOUT, usb->usb_bulk_transfer( usb, 0x86, (unsigned char *)counts, sizeof(counts), &bytes, 1000 ) );
+    EXPECT_EQ( 0, bytes );
+    EXPECT_EQ( 3 * (int)sizeof(counts), MockUSBDeviceGetBytesSent( usb ) );
+
+    DeleteUSBDevice( usb );
+}
+
+TEST(MockUSBDevice,TransfersCompleteInOrder)
+{
+    USBDevice *usb = NewMockUSBDevice( 100 );
+    struct libusb_transfer *transfers[4];
+    uint16_t data[4][16];
+    struct timeval timeout = { 1, 0 };
+
+    num_completions = 0;
+    for ( int i = 0; i < 4; i ++ ) {
+        transfers[i] = libusb_alloc_transfer( 0 );
+        libusb_fill_bulk_transfer( transfers[i], NULL, 0x86, (unsigned char *)data[i], sizeof(data[i]),
+                                   record_completion, (void *)(intptr_t)i, 1000 );
+        ASSERT_EQ( LIBUSB_SUCCESS, usb->usb_submit_transfer( usb, transfers[i] ) );
+    }
+    EXPECT_EQ( 4, MockUSBDeviceGetPendingTransfers( usb ) );
+
+    ASSERT_EQ( LIBUSB_SUCCESS, usb->usb_cancel_transfer( usb, transfers[2] ) );
+    EXPECT_EQ( LIBUSB_ERROR_NOT_FOUND, usb->usb_cancel_transfer( usb, transfers[2] ) );
+
+    while ( MockUSBDeviceGetPendingTransfers( usb ) > 0 )
+        usb->usb_handle_events( usb, &timeout );
+
+    ASSERT_EQ( 4, num_completions );
+    for ( int i = 0; i < 4; i ++ )
+        EXPECT_EQ( i, completions[i] );
+
+    EXPECT_EQ( LIBUSB_TRANSFER_CANCELLED, transfers[2]->status );
+    EXPECT_EQ( data[1][15] + 1, data[3][0] );
+    for ( int i = 0; i < 4; i ++ )
+        libusb_free_transfer( transfers[i] );
+
+    DeleteUSBDevice( usb );
+}
+
+int main(int argc, char *argv[] )
+{
+  testing::InitGoogleTest(&argc, argv);
+  testing::TestEventListeners & listeners = testing::UnitTest::GetInstance()->listeners();
+#ifdef GTEST_TAP_PRINT_TO_STDOUT
+  delete listeners.Release(listeners.default_result_printer());
+#endif
+
+  return RUN_ALL_TESTS();  
+}
+
+#endif
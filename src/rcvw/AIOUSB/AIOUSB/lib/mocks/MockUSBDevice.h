@@ -0,0 +1,43 @@
+/**
+ * @file   MockUSBDevice.h
+ * @author $Format: %an <%ae>$
+ * @date   $Format: %ad$
+ * @version $Format: %h$
+ * @brief  A USBDevice that streams counts without any hardware attached, for
+ *         testing and benchmarking continuous acquisitions
+ *
+ */
+
+#ifndef _MOCK_USB_DEVICE_H
+#define _MOCK_USB_DEVICE_H
+
+#include "AIOTypes.h"
+#include "USBDevice.h"
+
+#ifdef __aiousb_cplusplus
+namespace AIOUSB {
+#endif
+
+/**
+ * @brief The mock answers every control transfer, and fills each bulk read
+ * with a running uint16_t count, so a reader can check that no counts were
+ * dropped or reordered. Each bulk read takes latency microseconds on the
+ * simulated bus, one read after another, and asynchronous transfers
+ * complete in the order they were submitted from usb_handle_events().
+ *
+ * The mock is freed with DeleteUSBDevice(), so it can be handed to the device
+ * table with AIODeviceTableAddDeviceToDeviceTableWithUSBDevice().
+ */
+
+/* BEGIN AIOUSB_API */
+PUBLIC_EXTERN USBDevice *NewMockUSBDevice( unsigned latency );
+PUBLIC_EXTERN AIORET_TYPE MockUSBDeviceSetFailures( USBDevice *usb, int num_failures );
+PUBLIC_EXTERN AIORET_TYPE MockUSBDeviceGetBytesSent( USBDevice *usb );
+PUBLIC_EXTERN AIORET_TYPE MockUSBDeviceGetPendingTransfers( USBDevice *usb );
+/* END AIOUSB_API */
+
+#ifdef __aiousb_cplusplus
+}
+#endif
+
+#endif
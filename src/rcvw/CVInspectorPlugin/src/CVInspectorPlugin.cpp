@@ -7,14 +7,14 @@
 #include <tmx/common/TmxLogger.hpp>
 #include <tmx/message/codec/TmxCodec.hpp>
 #include <tmx/message/TmxData.hpp>
+#include <tmx/plugin/utils/XerJsonWriter.hpp>
 
 #include <tmx/message/j2735/202007/MessageFrame.h>
 
 #include <boost/property_tree/ptree.hpp>
-#include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/xml_parser.hpp>
 
-#define HELPER_TREE_ROOT "TreeRepair."
+#define HELPER_TREE_ROOT "TreeRepair"
 
 using namespace tmx::common;
 
@@ -23,62 +23,8 @@ namespace plugin {
 namespace rcvw {
 namespace cvi {
 
-/**
- * Converter function to change XML arrays to JSON arrays, removing the extra key
- */
-struct fix_xml_arrays {
-    template<typename Tree>
-    void operator()(Tree &pt) {
-        Tree copy(pt);
-
-        pt.clear();
-        for (typename Tree::iterator i = copy.begin(); i != copy.end(); i++) {
-            pt.push_back(
-                    std::pair<typename Tree::key_type, Tree>("", i->second));
-        }
-    }
-};
-
-/**
- * Converter function to take an entire sub-tree up one level, effectively deleting unnecessary keys
- */
-struct del_unnecessary_nodes {
-    template<typename Tree>
-    void operator()(Tree &pt) {
-        Tree copy(pt);
-
-        pt.clear();
-        for (typename Tree::iterator i = copy.begin(); i != copy.end(); i++) {
-            for (typename Tree::iterator j = i->second.begin();
-                 j != i->second.end(); j++) {
-                pt.push_back(
-                        std::pair<typename Tree::key_type, Tree>(j->first,
-                                                                 j->second));
-            }
-        }
-
-    }
-};
-
-/**
- * Converter function to take make the key of a sub-tree a new value in the parent level,
- * effectively deleting unnecessary sub-objects
- */
-struct flatten_node {
-    template<typename Tree>
-    void operator()(Tree &pt) {
-        Tree copy(pt);
-        pt.clear();
-        pt.put_value(copy.begin()->first);
-    }
-};
-
 class CVInspectorPlugin: public TmxPlugin {
     typedef boost::property_tree::basic_ptree<std::string, std::string> tree_type;
-    typedef typename tree_type::iterator it_type;
-    typedef typename tree_type::key_type key_type;
-    typedef typename tree_type::value_type value_type;
-    typedef typename tree_type::path_type path_type;
 
 public:
     CVInspectorPlugin(): TmxPlugin() {
@@ -107,8 +53,21 @@ public:
         TmxPlugin::init();
 
         TLOG(INFO) << "Reading in repair file " << this->get_config("repair-file").to_string();
-        boost::property_tree::read_xml(this->get_config("repair-file").to_string(), this->repair_tree,
+
+        tree_type repairTree;
+        boost::property_tree::read_xml(this->get_config("repair-file").to_string(), repairTree,
                                        boost::property_tree::xml_parser::trim_whitespace);
+
+        // Each repair path already starts with the message type
+        static const tree_type _empty;
+        for (auto const &msgType: repairTree.get_child(HELPER_TREE_ROOT, _empty)) {
+            for (auto const &path: msgType.second.get_child("fix_xml_arrays", _empty))
+                this->writer.add_repair(utils::XerJsonWriter::FixArrays, path.second.data());
+            for (auto const &path: msgType.second.get_child("del_unnecessary_nodes", _empty))
+                this->writer.add_repair(utils::XerJsonWriter::DeleteNodes, path.second.data());
+            for (auto const &path: msgType.second.get_child("flatten_node", _empty))
+                this->writer.add_repair(utils::XerJsonWriter::FlattenNode, path.second.data());
+        }
     }
 
     void on_message_received(const message::TmxMessage &msg) override {
@@ -140,133 +99,34 @@ public:
             return;
         }
 
-        // Now dump to XML
-
-        char *buffer = nullptr;
-        size_t bufSize;
-        const_string xml;
-
-        FILE *mStream = open_memstream(&buffer, &bufSize);
-        if (mStream) {
-            if (xer_fprint(mStream, &asn_DEF_MessageFrame, frame) == 0)
-                xml = to_char_sequence(buffer, bufSize);
-
-            fclose(mStream);
+        // Now dump the message frame value straight to JSON
+        static auto const &_value = asn_DEF_MessageFrame.elements[1];
+
+        std::string content;
+        if (this->writer.write(content, *_value.type, (char const *)frame + _value.memb_offset)) {
+            // Using previous TMX forwarding format
+            std::ostringstream os;
+            os << "{\"typeId\":\"" << topic;
+            if (topic == "MAP" || topic == "SPAT")
+                os << "_P";
+            os << "\",\"contentType\":\"JSON\"";
+            os << ",\"contentLength\":" << content.length();
+            os << ",\"content\":" << content << "}}";
+
+            message::TmxMessage newMsg { msg };
+            newMsg.set_id("Properties<any>");
+            newMsg.set_encoding("json");
+            newMsg.set_topic("Decoded/" + topic);
+            newMsg.set_payload(os.str());
+
+            this->broadcast(newMsg);
         }
 
-        if (xml.length()) {
-            std::istringstream is { std::string(xml) };
-
-            tree_type msgTree;
-            boost::property_tree::xml_parser::read_xml(is, msgTree,
-                                                       boost::property_tree::xml_parser::trim_whitespace);
-            auto subTree = msgTree.get_child_optional("MessageFrame.value");
-            if (subTree.has_value()) {
-                this->cleanupTree(subTree.value());
-
-                std::ostringstream content;
-                boost::property_tree::json_parser::write_json(content, subTree.value(), false);
-
-                // Using previous TMX forwarding format
-                std::ostringstream os;
-                os.str().clear();
-                os << "{\"typeId\":\"" << topic;
-                if (topic == "MAP" || topic == "SPAT")
-                    os << "_P";
-                os << "\",\"contentType\":\"JSON\"";
-                os << ",\"contentLength\":" << content.str().length();
-                os << ",\"content\":" << content.str() << "}}";
-
-                message::TmxMessage newMsg { msg };
-                newMsg.set_id("Properties<any>");
-                newMsg.set_encoding("json");
-                newMsg.set_topic("Decoded/" + topic);
-                newMsg.set_payload(os.str());
-
-                this->broadcast(newMsg);
-            }
-        }
-
-        free(buffer);
-        buffer = nullptr;
-
         ASN_STRUCT_FREE(asn_DEF_MessageFrame, frame);
     }
 
 private:
-    template<typename Functor>
-    void repairAlongTree(Functor &fn, tree_type &pt, path_type path)
-    {
-        if (path.empty())
-        {
-            return;
-        }
-
-        if (path.single())
-        {
-            boost::optional<tree_type &> child = pt.get_child_optional(path);
-            if (child)
-                fn(child.get());
-        }
-        else
-        {
-            key_type head = path.reduce();
-            for (it_type i = pt.begin(); i != pt.end(); i++)
-            {
-                if (i->first == head)
-                {
-                    repairAlongTree<Functor>(fn, i->second, path);
-                }
-            }
-        }
-    }
-
-    std::string get_value(tree_type &msgTree, std::string field, bool *found = 0)
-    {
-        value_type &root = msgTree.front();
-        auto id = this->repair_tree.get_optional<std::string>(
-                path_type(HELPER_TREE_ROOT + root.first + "." + field));
-
-        if (found)
-            *found = (id.has_value() ? true : false);
-
-        if (id.has_value())
-            return id.value();
-        else
-            return root.first;
-    }
-
-    template <typename AttrType>
-    std::string get_value(tree_type &msgTree)
-    {
-        return get_value(msgTree, common::type_short_name<AttrType>().data());
-    }
-
-    template<typename Functor>
-    void cleanupTree(tree_type &msgTree)
-    {
-        Functor fn;
-        value_type &root = msgTree.front();
-        it_type i;
-
-        boost::optional<tree_type &> subTree = this->repair_tree.get_child_optional(
-                path_type(HELPER_TREE_ROOT + root.first + "." + common::type_short_name(fn).data()));
-        if (subTree.has_value())
-        {
-            for (i = subTree.value().begin(); i != subTree.value().end(); i++)
-                repairAlongTree(fn, msgTree,
-                                path_type(i->second.template get_value<std::string>()));
-        }
-    }
-
-    virtual void cleanupTree(tree_type &msgTree)
-    {
-        cleanupTree<fix_xml_arrays>(msgTree);
-        cleanupTree<del_unnecessary_nodes>(msgTree);
-        cleanupTree<flatten_node>(msgTree);
-    }
-
-    tree_type repair_tree;
+    utils::XerJsonWriter writer;
 };
 
 }
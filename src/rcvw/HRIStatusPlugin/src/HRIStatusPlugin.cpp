@@ -39,6 +39,8 @@
 #include <tmx/plugin/utils/Clock.hpp>
 #include <tmx/plugin/utils/FrequencyThrottle.hpp>
 #include <tmx/plugin/utils/System.hpp>
+#include <tmx/plugin/utils/io/InputSource.hpp>
+#include <tmx/plugin/utils/interxn/SpatTemplate.hpp>
 
 #include <MessageFrame.h>
 #include <SPAT.h>
@@ -58,6 +60,7 @@ using namespace tmx::common;
 using namespace tmx::message::codec::serializer;
 using namespace tmx::plugin;
 using namespace tmx::plugin::utils;
+using namespace tmx::plugin::utils::interxn;
 
 namespace tmx {
 namespace plugin {
@@ -113,6 +116,22 @@ private:
     std::atomic<bool> _serialPinState{ false };
     std::atomic<bool> _stopThreads{ false };
 
+    // Config values read in the data path, which are refreshed when the config changes
+    std::atomic<bool> _alwaysSend{ false };
+    std::atomic<int> _railPinNumber{ 0 };
+    std::atomic<std::uint32_t> _serialDataTimeoutMS{ 0 };
+
+    // Edges of the crossing state, which wake the SPAT loop to publish right away
+    io::EdgeInputSource _crossing{ [this](bool, io::input_clock::time_point when) {
+        this->_lastEdgeTime = when;
+        this->_publishNow = true;
+    }, true };
+    io::input_clock::time_point _lastEdgeTime;
+    std::atomic<bool> _publishNow{ false };
+
+    io::InputMonitor _spatInputs;
+    io::InputMonitor _serialInputs;
+
     //Digital I/O Functions
     bool DioSetup();
 
@@ -122,8 +141,12 @@ private:
 
     void MonitorRailSignal();
 
+    void SetRailSignal(bool pinState, io::input_clock::time_point when);
+
     void SerialPortReader();
 
+    void ProcessSerialData(uint8_t const *data, std::size_t length, io::input_clock::time_point when);
+
     FrequencyThrottle<int> _throttle;
 
     std::atomic<int> _serialPortFd{ -1 };
@@ -250,6 +273,11 @@ HRIStatusPlugin::HRIStatusPlugin() : _isReceivingBsms(false), _newConfigValues(f
     _trainComing = true;
 
     _throttle.set_Frequency(std::chrono::milliseconds(1000));
+    _spatInputs.add(_crossing);
+
+    this->bind_config("AlwaysSend", _alwaysSend);
+    this->bind_config("RailPinNumber", _railPinNumber);
+    this->bind_config("SerialDataTimeout", _serialDataTimeoutMS);
 
     this->register_handler<on_bsm_received>("J2735/BSM", this, &HRIStatusPlugin::handle_bsm);
 }
@@ -467,43 +495,54 @@ int HRIStatusPlugin::GetBufferPosition(int pin) {
 }
 
 /**
- * Function to monitor the rail signal on a separate thread. If the pin
- * is voltage low the train is coming.
+ * Function to monitor the rail signal on a separate thread. The digital
+ * inputs cannot signal a change, so they are sampled often and any edge
+ * wakes up the SPAT loop. With a serial port, the reader sets the state instead.
  */
 void HRIStatusPlugin::MonitorRailSignal() {
     while (this->is_running()) {
-        // Get the pin number, which will automatically default to zero
-        if (!GetPinState(this->get_config("RailPinNumber", &this->_dataLock))) {
-            // sets a global variable. Should it send an Application Message?
-            _trainComing = true; //Atomic wrapper does not need mutex locked.
-
-            if (_trainComing != _previousState) {
-                TLOG(INFO) << "Train is present at the crossing.";
-                this->set_status("Train", "Train present at crossing.");
-                _previousState = _trainComing;
-            }
-        } else {
-            _trainComing = false;
+        if (_serialPortFd < 0) {
+            auto when = io::input_clock::now();
 
-            if (_trainComing != _previousState) {
-                TLOG(INFO) << "Crossing is clear.";
-                this->set_status("Train", "Crossing is clear");
-                _previousState = _trainComing;
-            }
+            // Get the pin number, which will automatically default to zero
+            SetRailSignal(GetPinState(_railPinNumber), when);
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10)); // check 100 times per second
+    }
+}
+
+/**
+ * Function to set the rail signal state. If the pin
+ * is voltage low the train is coming.
+ *
+ * @param pinState The state of the pin
+ * @param when The time the pin state was read
+ */
+void HRIStatusPlugin::SetRailSignal(bool pinState, io::input_clock::time_point when) {
+    // sets a global variable. Should it send an Application Message?
+    _trainComing = !pinState; //Atomic wrapper does not need mutex locked.
+
+    if (_trainComing != _previousState) {
+        if (_trainComing) {
+            TLOG(INFO) << "Train is present at the crossing.";
+            this->set_status("Train", "Train present at crossing.");
+        } else {
+            TLOG(INFO) << "Crossing is clear.";
+            this->set_status("Train", "Crossing is clear");
         }
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(100)); // check 10 times per second
+        _previousState = _trainComing;
     }
+
+    // Publish the new state now rather than at the next SPAT interval
+    _crossing.set_level(!pinState, when);
 }
 
 /**
  * Function to read serial port and set train present state
  */
 void HRIStatusPlugin::SerialPortReader() {
-    int i;
-    stringstream ss;
-    string ss_string;
-
     memset(crccheck_table, 0, 256);
     memset(crctemp_table, 0, 256);
 
@@ -511,78 +550,115 @@ void HRIStatusPlugin::SerialPortReader() {
     if (!_portName || _portName.to_string().empty())
         return;
 
+    std::unique_ptr<io::FdInputSource> source;
+
     while (this->is_running()) {
-        auto _serialDataTimeoutMS = message::TmxData(this->get_config("SerialDataTimeout", &this->_dataLock)).to_uint();
-        if (!_serialDataTimeoutMS)
-            _serialDataTimeoutMS = 1500;
-
-        if (_serialPortFd >= 0) {
-            //read serial port
-            //PLOG(logDEBUG) << "Read open port";
-            unsigned char buf[1024];
-            uint64_t currentTime = Clock::GetMillisecondsSinceEpoch();
-            if (currentTime - _lastSerialDataTime > _serialDataTimeoutMS) {
+        std::uint32_t _timeoutMS = this->_serialDataTimeoutMS;
+        if (!_timeoutMS)
+            _timeoutMS = 1500;
+
+        int fd = _serialPortFd;
+        if (source && source->get_fd() < 0) {
+            // The port could not be read, so it must be opened again
+            source.reset();
+            if (_serialPortFd.compare_exchange_strong(fd, -1))
+                fd = -1;
+        }
+
+        if (fd >= 0 && (!source || source->get_fd() != fd)) {
+            if (source)
+                _serialInputs.remove(*source);
+
+            source = std::make_unique<io::FdInputSource>(fd,
+                    [this](uint8_t const *data, std::size_t length, io::input_clock::time_point when) {
+                        this->ProcessSerialData(data, length, when);
+                    });
+            _serialInputs.add(*source);
+        }
+
+        // Wait for serial data, or until the last data would time out
+        std::chrono::milliseconds wait { 1000 };
+        if (fd >= 0) {
+            uint64_t elapsed = Clock::GetMillisecondsSinceEpoch() - _lastSerialDataTime;
+            if (elapsed > _timeoutMS) {
                 _sendSPAT = false;
                 _serialPinState = false;
+                SetRailSignal(_serialPinState, io::input_clock::now());
+            } else {
+                wait = std::min(wait, std::chrono::milliseconds(_timeoutMS - elapsed + 1));
             }
-            int n = read(_serialPortFd, buf, sizeof buf);  // read up to 1024 characters if ready to read
-            if (n == -1)
-                _serialPortFd = -1;
-
-            while (n > 0) {
-                //PLOG(logDEBUG) << "Read " << n << " characters on serial port";
-
-                if (_serialDataLength + n > _serialBuffer.size()) {
-                    if (((_serialDataLength + n) / 2048) > 1000)
-                        _serialDataLength = 0;
-                    else
-                        _serialBuffer.resize((((_serialDataLength + n) / 2048) + 1) * 2048);
-                }
+        }
+
+        _serialInputs.wait(wait);
+    }
+
+    if (source)
+        _serialInputs.remove(*source);
+}
 
-                memcpy(&(_serialBuffer[_serialDataLength]), buf, n);
-                _serialDataLength += n;
-
-                //process data
-                int length = _serialDataLength;
-                int messageLength;
-                for (i = 0; i < length; i++) {
-                    //possible start of frame
-                    if (_serialBuffer[i] == 255) {
-                        //check if we have at least 6 bytes
-                        if (_serialDataLength - i >= 6) {
-                            //check for header
-                            if (_serialBuffer[i + 1] == 255 && _serialBuffer[i + 2] == 245 &&
-                                _serialBuffer[i + 3] == 255) {
-                                //get length
-                                messageLength = (_serialBuffer[i + 4] * 256) + _serialBuffer[i + 5];
-                                if ((_serialDataLength - i) >= (messageLength + 4)) {
-                                    //process message
-                                    //get address lengths
-                                    //PLOG(logDEBUG) << "Message length:" << messageLength;
-                                    uint8_t sourceAddressLen = _serialBuffer[i + 10] >> 4;
-                                    uint8_t destAddressLen = _serialBuffer[i + 10] & 0x0f;
-                                    uint8_t totalAddressLen = (sourceAddressLen / 2) + (destAddressLen / 2);
-                                    if (sourceAddressLen % 2 == 1)
-                                        totalAddressLen++;
-                                    if (destAddressLen % 2 == 1)
-                                        totalAddressLen++;
-                                    int label = (_serialBuffer[i + totalAddressLen + 15] * 256) +
-                                                _serialBuffer[i + totalAddressLen + 16];
-                                    if (label == 4904) {
-                                        //get crc of 42 byte message
-                                        uint32_t calculatedCrc = 0;
+/**
+ * Function to process the data read from the serial port
+ *
+ * @param data The bytes read
+ * @param length The number of bytes read
+ * @param when The time the bytes were read
+ */
+void HRIStatusPlugin::ProcessSerialData(uint8_t const *data, std::size_t length, io::input_clock::time_point when) {
+    int i;
+
+    //PLOG(logDEBUG) << "Read " << n << " characters on serial port";
+
+    if (_serialDataLength + length > _serialBuffer.size()) {
+        if (((_serialDataLength + length) / 2048) > 1000)
+            _serialDataLength = 0;
+        else
+            _serialBuffer.resize((((_serialDataLength + length) / 2048) + 1) * 2048);
+    }
+
+    memcpy(&(_serialBuffer[_serialDataLength]), data, length);
+    _serialDataLength += length;
+
+    //process data
+    int dataLength = _serialDataLength;
+    int messageLength;
+    for (i = 0; i < dataLength; i++) {
+        //possible start of frame
+        if (_serialBuffer[i] == 255) {
+            //check if we have at least 6 bytes
+            if (_serialDataLength - i >= 6) {
+                //check for header
+                if (_serialBuffer[i + 1] == 255 && _serialBuffer[i + 2] == 245 &&
+                    _serialBuffer[i + 3] == 255) {
+                    //get length
+                    messageLength = (_serialBuffer[i + 4] * 256) + _serialBuffer[i + 5];
+                    if ((_serialDataLength - i) >= (messageLength + 4)) {
+                        //process message
+                        //get address lengths
+                        //PLOG(logDEBUG) << "Message length:" << messageLength;
+                        uint8_t sourceAddressLen = _serialBuffer[i + 10] >> 4;
+                        uint8_t destAddressLen = _serialBuffer[i + 10] & 0x0f;
+                        uint8_t totalAddressLen = (sourceAddressLen / 2) + (destAddressLen / 2);
+                        if (sourceAddressLen % 2 == 1)
+                            totalAddressLen++;
+                        if (destAddressLen % 2 == 1)
+                            totalAddressLen++;
+                        int label = (_serialBuffer[i + totalAddressLen + 15] * 256) +
+                                    _serialBuffer[i + totalAddressLen + 16];
+                        if (label == 4904) {
+                            //get crc of 42 byte message
+                            uint32_t calculatedCrc = 0;
 //										memset(crctemp_table, 0, 256);
-                                        calculatedCrc = GetCrc32(calculatedCrc, &(_serialBuffer[i + 10]),
-                                                                 messageLength - 10);
-                                        uint32_t messageCrc = *((uint32_t *) (&(_serialBuffer[i + messageLength])));
+                            calculatedCrc = GetCrc32(calculatedCrc, &(_serialBuffer[i + 10]),
+                                                     messageLength - 10);
+                            uint32_t messageCrc = *((uint32_t *) (&(_serialBuffer[i + messageLength])));
 //										ss.str("");
 //										for (int j = 0; j < messageLength + 4; j++)
 //											ss << hex << setfill('0') << setw(2) << (unsigned int)_serialBuffer[i + j] << " ";
 //										ss_string = ss.str();
-                                        TLOG(DEBUG) << "Got 4904 message, vital crc:" << messageCrc
-                                                    << ", calculated crc:" << calculatedCrc;
+                            TLOG(DEBUG) << "Got 4904 message, vital crc:" << messageCrc
+                                        << ", calculated crc:" << calculatedCrc;
 //										PLOG(logDEBUG) << ss_string;
-                                        if (calculatedCrc == messageCrc) {
+                            if (calculatedCrc == messageCrc) {
 //											for (int j = 0; j < 256; j++)
 //											{
 //												if (crctemp_table[j] == 1)
@@ -596,7 +672,7 @@ void HRIStatusPlugin::SerialPortReader() {
 //											}
 //											ss_string = ss.str();
 //											PLOG(logDEBUG) << ss_string;
-                                            //get WSA bit for crossing 1
+                                //get WSA bit for crossing 1
 
 //											using std::chrono::system_clock;
 //											std::time_t tt;
@@ -605,51 +681,44 @@ void HRIStatusPlugin::SerialPortReader() {
 //											auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(current_time.time_since_epoch()) -
 //											          std::chrono::duration_cast<std::chrono::seconds>(current_time.time_since_epoch());
 
-                                            unsigned char tpd = _serialBuffer[i + totalAddressLen + 33] & 0x04;
-                                            if (tpd > 0) {
-                                                TLOG(DEBUG) << "Got 4904 message, HRI Active";
-                                                //PLOG(logDEBUG) << "  milliseconds: " << ms.count();
-                                                _serialPinState = false;
-                                                _lastSerialDataTime = Clock::GetMillisecondsSinceEpoch();
-                                            } else {
-                                                TLOG(DEBUG) << "Got 4904 message, HRI NOT Active";
-                                                //PLOG(logDEBUG) << "  milliseconds: " << ms.count();
-                                                _serialPinState = true;
-                                                _lastSerialDataTime = Clock::GetMillisecondsSinceEpoch();
-                                            }
-                                            _sendSPAT = true;
-                                        }
-                                    }
-                                    //increment index past message
-                                    i += (messageLength + 4);
-                                    if (i >= _serialDataLength)
-                                        _serialDataLength = 0;
+                                unsigned char tpd = _serialBuffer[i + totalAddressLen + 33] & 0x04;
+                                if (tpd > 0) {
+                                    TLOG(DEBUG) << "Got 4904 message, HRI Active";
+                                    //PLOG(logDEBUG) << "  milliseconds: " << ms.count();
+                                    _serialPinState = false;
+                                    _lastSerialDataTime = Clock::GetMillisecondsSinceEpoch();
                                 } else {
-                                    //have header but not enough bytes, copy and exit loop
-                                    memcpy(&_serialBuffer[0], &(_serialBuffer[i]), _serialDataLength - i);
-                                    _serialDataLength = _serialDataLength - i;
-                                    i = length;
+                                    TLOG(DEBUG) << "Got 4904 message, HRI NOT Active";
+                                    //PLOG(logDEBUG) << "  milliseconds: " << ms.count();
+                                    _serialPinState = true;
+                                    _lastSerialDataTime = Clock::GetMillisecondsSinceEpoch();
                                 }
+                                _sendSPAT = true;
+                                SetRailSignal(_serialPinState, when);
                             }
-                        } else {
-                            //not enough bytes left, copy and exit loop
-                            memcpy(&_serialBuffer[0], &(_serialBuffer[i]), _serialDataLength - i);
-                            _serialDataLength = _serialDataLength - i;
-                            i = length;
                         }
-                    } else {
-                        //check if last byte and no header start
-                        if (i == _serialDataLength - 1)
+                        //increment index past message
+                        i += (messageLength + 4);
+                        if (i >= _serialDataLength)
                             _serialDataLength = 0;
+                    } else {
+                        //have header but not enough bytes, copy and exit loop
+                        memcpy(&_serialBuffer[0], &(_serialBuffer[i]), _serialDataLength - i);
+                        _serialDataLength = _serialDataLength - i;
+                        i = dataLength;
                     }
                 }
-                n = read(_serialPortFd, buf, sizeof buf);
-                if (n == -1)
-                    _serialPortFd = -1;
+            } else {
+                //not enough bytes left, copy and exit loop
+                memcpy(&_serialBuffer[0], &(_serialBuffer[i]), _serialDataLength - i);
+                _serialDataLength = _serialDataLength - i;
+                i = dataLength;
             }
+        } else {
+            //check if last byte and no header start
+            if (i == _serialDataLength - 1)
+                _serialDataLength = 0;
         }
-
-        std::this_thread::sleep_for(std::chrono::milliseconds(100)); // check 10 times per second
     }
 }
 
@@ -770,6 +839,9 @@ TmxError HRIStatusPlugin::main() {
     std::string _portName;
     bool _initPort = false;
 
+    // The pre-encoded SPAT, which is rebuilt whenever the static intersection information changes
+    std::unique_ptr<SpatTemplate> spatTemplate;
+
     while (this->is_running()) {
         auto now = std::chrono::system_clock::now().time_since_epoch();
         auto secSinceEpoch = std::chrono::duration_cast<std::chrono::seconds>(now);
@@ -820,6 +892,8 @@ TmxError HRIStatusPlugin::main() {
                 else
                     lane.signalGroup = mapping[i]["signalGroup"];
             }
+
+            spatTemplate.reset();
         }
 
         if (_initPort) {
@@ -836,6 +910,7 @@ TmxError HRIStatusPlugin::main() {
                     SetInterfaceAttribs(_serialPortFd, B115200, 0);  // set speed to 115200 bps, 8n1 (no parity)
                     //SetInterfaceAttribs (_serialPortFd, B9600, 0);  // set speed to 9600 bps, 8n1 (no parity)
                     SetBlocking(_serialPortFd, 0);                // set no blocking
+                    _serialInputs.wake();
                 }
             }
 
@@ -870,14 +945,28 @@ TmxError HRIStatusPlugin::main() {
         }
 
         // By default, the RSU is listening for BSMs, but that can be overridden by the config parameter
-        const message::TmxData _alwaysSend{ this->get_config("AlwaysSend", &this->_dataLock) };
-        if (_send.Monitor(intxn->id.id) && (_alwaysSend.to_bool() || _isReceivingBsms)) {
+        // A change in the crossing state is sent immediately, instead of at the next interval
+        const bool publishNow = _publishNow.exchange(false);
+        if ((_send.Monitor(intxn->id.id) || publishNow) && (_alwaysSend || _isReceivingBsms)) {
             //always send spat if using analog input method
             //if using serial data only send SPAT if we got a valid serial message
             if (_sendSPAT) {
 //                std::thread([this, &msg]() {
-                    unsigned char *bytes;
-                    auto result = uper_encode_to_new_buffer(&asn_DEF_MessageFrame, nullptr, &msg, (void **) &bytes);
+                    if (!spatTemplate)
+                        spatTemplate = std::make_unique<SpatTemplate>(msg);
+
+                    // Only the time and signal states change between messages, so just patch those bits
+                    bool patched = spatTemplate->IsLoaded() &&
+                                   spatTemplate->SetMinuteOfTheYear(0, minOfYear) &&
+                                   spatTemplate->SetTimeStamp(0, msOfMin) &&
+                                   spatTemplate->SetStatus(0, (statusBuf[0] << 8) | statusBuf[1]) &&
+                                   spatTemplate->SetEventState(0, 0, 0, trackMovement.eventState) &&
+                                   spatTemplate->SetEventState(0, 1, 0, laneMovement.eventState);
+
+                    unsigned char *bytes = nullptr;
+                    ssize_t result = patched ? (ssize_t) spatTemplate->GetBytes().length() :
+                            uper_encode_to_new_buffer(&asn_DEF_MessageFrame, nullptr, &msg, (void **) &bytes);
+                    const unsigned char *payload = patched ? spatTemplate->GetBytes().data() : bytes;
 
                     if (result < 0) {
                         this->broadcast<TmxError>({ 2, "Unable to encode SPAT" }, this->get_topic("error"),
@@ -889,10 +978,14 @@ TmxError HRIStatusPlugin::main() {
                         if (_spat.intersections.list.count)
                             encMsg.set_source(std::to_string(_spat.intersections.list.array[0]->id.id));
                         encMsg.set_timepoint();
-                        encMsg.set_payload(byte_string_encode(to_byte_sequence(bytes, result)));
+                        encMsg.set_payload(byte_string_encode(to_byte_sequence(payload, result)));
                         encMsg.set_encoding("asn.1-uper");
 
                         this->broadcast(encMsg);
+
+                        if (publishNow)
+                            TLOG(DEBUG) << "Sent SPAT " << std::chrono::duration_cast<std::chrono::microseconds>(
+                                    io::input_clock::now() - _lastEdgeTime).count() << "us after the crossing changed";
                     }
 
                     free(bytes);
@@ -958,8 +1051,8 @@ TmxError HRIStatusPlugin::main() {
 
         }
 
-        // Rerun the loop 10 times per interval
-        std::this_thread::sleep_for(_send.get_Frequency() / 10);
+        // Rerun the loop 10 times per interval, or as soon as the crossing state changes
+        _spatInputs.wait(_send.get_Frequency<std::chrono::milliseconds>() / 10);
     }
 
     trainWatch.join();
@@ -21,6 +21,7 @@
 #include <tmx/plugin/utils/Uuid.hpp>
 #include <tmx/plugin/utils/geo/Conversions.hpp>
 #include <tmx/plugin/utils/geo/GeoVector.hpp>
+#include <tmx/plugin/utils/interxn/CompiledMap.hpp>
 #include <tmx/plugin/utils/interxn/Intersection.hpp>
 #include <tmx/plugin/utils/interxn/MapSupport.hpp>
 #include <tmx/plugin/utils/interxn/ParsedMap.hpp>
@@ -41,6 +42,7 @@
 #include <boost/algorithm/string.hpp>
 #include <cmath>
 #include <iostream>
+#include <memory>
 #include <thread>
 #include <mutex>
 
@@ -137,7 +139,8 @@ private:
 
     //Map Data
     std::atomic<uint64_t> _lastMap;
-    std::shared_ptr<MapData> _mapData;
+    // Published atomically, so the readers never need the data lock
+    std::shared_ptr<const CompiledMap> _mapData;
 
     //SPAT Data
     std::atomic<uint64_t> _lastSpat;
@@ -498,42 +501,39 @@ void RCVWPlugin::handle_map(TmxData const &, TmxMessage const &msg) {
     if (frame->value.present != MessageFrame__value_PR_MapData) {
         this->broadcast<TmxError>({ EINVAL, std::string("Received invalid MessageFrame of type ") +
             enum_choice_name(frame->value.present).data() }, this->get_topic("error"), __FUNCTION__);
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, frame);
+        return;
     }
 
-    std::shared_ptr<MapData_t> copy;
-    {
-        std::lock_guard<std::mutex> lock(this->_dataLock);
-        this->_mapData.reset(&frame->value.choice.MapData, [frame](auto *) {
-            ASN_STRUCT_FREE(asn_DEF_MessageFrame, frame);
-        });
+    std::shared_ptr<MapData_t> copy { &frame->value.choice.MapData, [frame](auto *) {
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, frame);
+    } };
 
-        copy = this->_mapData;
+    if (!copy->intersections || copy->intersections->list.count <= 0) {
+        this->broadcast<TmxError>({ EINVAL, "Received MAP with no intersections" }, this->get_topic("error"), __FUNCTION__);
+        return;
     }
 
     int newIntersectionId = copy->intersections->list.array[0]->id.id;
     TLOG(DEBUG1) << "MAP Received, IntersectionID: " << newIntersectionId;
 
-    if (!_mapReceived) {
-        Intersection intersection;
+    auto current = std::atomic_load(&this->_mapData);
 
-        intersection.LoadMap(copy);
-
-        WGS84Point location(_lat, _long);
+    // The MAP is re-broadcast continuously, so only compile the geometry when it actually changes
+    if (!current || current->GetMapId() != newIntersectionId || current->GetMapRevision() != copy->msgIssueRevision) {
+        auto compiled = std::make_shared<const CompiledMap>(copy);
+        if (!compiled->IsLoaded()) {
+            TLOG(ERR) << "Problem reading in the current map message.";
+            return;
+        }
 
-        //MapSupport mapSupp;
-        //MapMatchResult r = mapSupp.FindVehicleLaneForPoint(location, intersection.Map);
+        std::atomic_store(&this->_mapData, std::shared_ptr<const CompiledMap>(compiled));
+    }
 
-        if (!_mapReceived.exchange(true))
-            this->set_status("Map Received", true);
+    if (!_mapReceived.exchange(true))
+        this->set_status("Map Received", true);
 
-        _lastMap = GetMsTimeSinceEpoch();
-    } else {
-        //int oldIntersectionId = _mapData.get<int>("MapData.intersections.IntersectionGeometry.id.id", -1);
-        int oldIntersectionId = copy->intersections->list.array[0]->id.id;
-        if (newIntersectionId == oldIntersectionId) {
-            _lastMap = GetMsTimeSinceEpoch();
-        }
-    }
+    _lastMap = GetMsTimeSinceEpoch();
 }
 
 void RCVWPlugin::handle_spat(TmxData const &, TmxMessage const &msg) {
@@ -875,24 +875,17 @@ bool RCVWPlugin::InHRI(double lat, double lon, double speed, double heading) {
     WGS84Point back;
     double backwardsHeading;
 
-    std::shared_ptr<MapData_t> mapCopy;
-    {
-        std::lock_guard<mutex> lock(_dataLock);
-        mapCopy = _mapData;
-    }
+    auto mapCopy = std::atomic_load(&this->_mapData);
 
-    Intersection intersection;
-    if (!intersection.LoadMap(mapCopy)) {
+    if (!mapCopy || !mapCopy->IsLoaded()) {
         TLOG(ERR) << "Problem reading in the current map message.";
         return false;
     }
 
     WGS84Point location(lat, lon);
+    double irExtent = _irExtent;
 
-    MapSupport mapSupp;
-    mapSupp.SetExtendedIntersectionPercentage(_irExtent);
-
-    MapMatchResult r = mapSupp.FindVehicleLaneForPoint(location, intersection.Map);
+    MapMatchResult r = mapCopy->FindVehicleLaneForPoint(location, irExtent);
 
     if (r.LaneNumber == 0) {
         return true;
@@ -906,11 +899,11 @@ bool RCVWPlugin::InHRI(double lat, double lon, double speed, double heading) {
         backwardsHeading -= 360.0;
     back = GeoVector::DestinationPoint(location, backwardsHeading, _v2vehicleLength - _v2AntennaPlacementYMeters);
     //check points
-    r = mapSupp.FindVehicleLaneForPoint(front, intersection.Map);
+    r = mapCopy->FindVehicleLaneForPoint(front, irExtent);
     if (r.LaneNumber == 0) {
         return true;
     }
-    r = mapSupp.FindVehicleLaneForPoint(back, intersection.Map);
+    r = mapCopy->FindVehicleLaneForPoint(back, irExtent);
     if (r.LaneNumber == 0) {
         return true;
     }
@@ -971,23 +964,19 @@ bool RCVWPlugin::InHRI(double lat, double lon, double speed, double heading) {
  * @return distance to the crossing in meters, -1 indicates that the vehicle is not in a lane.
  */
 double RCVWPlugin::GetDistanceToCrossing(double lat, double lon, double heading, double &grade) {
-    std::shared_ptr<MapData_t> mapCopy;
+    auto mapCopy = std::atomic_load(&this->_mapData);
     std::shared_ptr<SPAT_t> spatCopy;
     {
         std::lock_guard<mutex> lock(_dataLock);
-        mapCopy = _mapData;
         spatCopy = _spatData;
     }
 
-    Intersection intersection;
-
-    intersection.LoadMap(mapCopy);
+    if (!mapCopy)
+        return -1;
 
     WGS84Point location(lat, lon);
 
-    MapSupport mapSupp;
-
-    MapMatchResult r = mapSupp.FindVehicleLaneForPoint(location, heading, intersection.Map);
+    MapMatchResult r = mapCopy->FindApproachLaneForPoint(location, heading);
     //check if not in map
     if (r.LaneNumber == -1) {
         //not in lane or map
@@ -1004,16 +993,16 @@ double RCVWPlugin::GetDistanceToCrossing(double lat, double lon, double heading,
     }
 
     // Check to see if SPAT and MAP intersection Ids match.
-    if (!intersection.DoesSpatMatchMap(*spatCopy)) {
+    if (!spatCopy || !mapCopy->GetIntersection().DoesSpatMatchMap(*spatCopy)) {
         return -1;
     }
 
-    int signalGroup = mapSupp.GetSignalGroupForVehicleLane(r.LaneNumber, intersection.Map);
+    int signalGroup = mapCopy->GetSignalGroupForVehicleLane(r.LaneNumber);
 
     TLOG(DEBUG) << "Lane, SignalGroup = " << r.LaneNumber << ", " << signalGroup;
     std::string spatSeg = "";
 
-    if (!intersection.IsSignalForGroupRedLight(*spatCopy, signalGroup)) {
+    if (!mapCopy->GetIntersection().IsSignalForGroupRedLight(*spatCopy, signalGroup)) {
         if (_preemption)
             this->set_status("HRI", "Not Present");
         _preemption = false;
@@ -1047,25 +1036,8 @@ double RCVWPlugin::GetDistanceToCrossing(double lat, double lon, double heading,
     // Calculate the distance to the crossing on a node by node basis
     // to account for curves when approaching the intersection.
 
-    double distance = 0.0;
-    int nodeIndex = 0;
-    WGS84Point point1;
-    WGS84Point point2;
-    std::list<LaneNode>::iterator it;
-    std::list<LaneNode> t_nodes = intersection.GetLaneNodes(*mapCopy, r.LaneNumber, 0.0, 0.0);
-    for (it = t_nodes.begin(); it != t_nodes.end() && nodeIndex < laneSegment; ++it) {
-        point1 = point2;
-        point2 = it->Point;
-        TLOG(DEBUG1) << "node: " << point2.Latitude << ", " << point2.Longitude;
-        if (nodeIndex > 0) {
-            //TLOG(DEBUG1) << "point1: " << point1.Latitude << ", " << point1.Longitude;
-            //TLOG(DEBUG1) << "point2: " << point2.Latitude << ", " << point2.Longitude;
-            distance += Conversions::DistanceMeters(point1, point2);
-            //TLOG(DEBUG1) << "distance: " << distance;
-        }
-        nodeIndex++;
-    }
-    distance += Conversions::DistanceMeters(point2, location);
+    // The node distances are already summed in the compiled MAP
+    double distance = mapCopy->GetDistanceToCrossing(r.LaneNumber, laneSegment, location);
     TLOG(DEBUG1) << "final distance: " << distance;
 
 //the code below causes seg fault, not sure why, about the same as code above that replaces it
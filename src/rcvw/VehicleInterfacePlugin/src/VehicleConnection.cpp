@@ -10,6 +10,7 @@
 #include <map>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include <Clock.h>
 #include <tmx/messages/routeable_message.hpp>
@@ -112,7 +113,8 @@ void VehicleConnection::Start()
 
 			PLOG(logINFO) << "Initializing " << task << " " << iter->get_type() << " connection tasks.";
 
-			// Break apart each request into a new thread of this task type
+			// Break apart each request for this task type
+			std::vector<message> requests;
 			for (auto request : data.get_array<message>(iter->get_type()))
 			{
 				PLOG(logDEBUG2) << request;
@@ -137,9 +139,18 @@ void VehicleConnection::Start()
 				if (changed)
 					request.set_contents(reqTree);
 
-				PLOG(logDEBUG) << "Starting new " << task << " " << iter->get_type() << " task for " << request;
+				PLOG(logDEBUG) << "Adding " << task << " " << iter->get_type() << " request " << request;
 
-				int i = this->push_back(taskAllocators()[task]->Allocate(request));
+				requests.push_back(request);
+			}
+
+			// Each allocated task gets its own thread
+			for (auto *worker : taskAllocators()[task]->AllocateAll(requests))
+			{
+				if (!worker)
+					continue;
+
+				int i = this->push_back(worker);
 
 				auto *t = this->operator [](i);
 				if (t)
@@ -14,6 +14,7 @@
 #include <PluginLog.h>
 #include <ThreadGroup.h>
 #include <VehicleBasicMessage.h>
+#include <vector>
 
 namespace VehicleInterfacePlugin {
 
@@ -44,6 +45,19 @@ public:
 		virtual tmx::utils::ThreadWorker *Allocate(tmx::message config) = 0;
 		virtual std::string GetName() = 0;
 
+		/**
+		 * Allocate the tasks for all the requests of this type.  By default, each
+		 * request gets its own task, but a task type may combine requests that
+		 * can be serviced together, such as all the data read from one device.
+		 */
+		virtual std::vector<tmx::utils::ThreadWorker *> AllocateAll(const std::vector<tmx::message> &configs)
+		{
+			std::vector<tmx::utils::ThreadWorker *> tasks;
+			for (auto &config : configs)
+				tasks.push_back(this->Allocate(config));
+			return tasks;
+		}
+
 		void Register();
 	};
 
@@ -7,17 +7,16 @@
 
 #include "../workers/SocketCanInterface.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <map>
 #include <mutex>
 
 #include <PluginLog.h>
 #include <tmx/TmxException.hpp>
 
-#include <sys/types.h>
-#include <sys/socket.h>
-#include <sys/ioctl.h>
-#include <net/if.h>
-#include <linux/can/raw.h>
-
 using namespace std;
 using namespace tmx;
 using namespace tmx::messages;
@@ -28,132 +27,112 @@ namespace VehicleInterfacePlugin {
 namespace Can {
 
 // Create and register an allocator for the socket CAN interface
-static VehicleConnection::TaskAllocatorImpl<SocketCanInterface> _socketCanAllocator;
+class SocketCanAllocator: public VehicleConnection::TaskAllocatorImpl<SocketCanInterface> {
+public:
+	std::vector<ThreadWorker *> AllocateAll(const std::vector<message> &configs)
+	{
+		// All the CAN data on a bus is read by the same thread
+		map<string, std::vector<message> > buses;
+		for (auto config : configs)
+		{
+			CanDataAdaptor canData(config.get_container());
+			string bus = canData.get_untyped("bus", "can0");
 
-SocketCanInterface::SocketCanInterface(const message &config): _socket(0), _canData(config.get_container())
+			if (!SocketCanInterface::IsMonitored(canData))
+			{
+				PLOG(logINFO) << "Skipping CAN data " << canData.get_name() << " on " << bus << ", which is not enabled.";
+				continue;
+			}
+
+			buses[bus].push_back(config);
+		}
+
+		// A bus with nothing to read would only start a thread that exits right away
+		std::vector<ThreadWorker *> tasks;
+		for (auto &bus : buses)
+			tasks.push_back(new SocketCanInterface(bus.second));
+
+		return tasks;
+	}
+};
+
+static SocketCanAllocator _socketCanAllocator;
+
+// The bus of the first CAN data, since all the CAN data given to a reader is on the same bus
+static string BusOf(const std::vector<message> &configs)
 {
+	if (configs.empty())
+		return "can0";
+
+	message config = configs.front();
+	return config.get_untyped("bus", "can0");
 }
 
-SocketCanInterface::~SocketCanInterface()
+SocketCanInterface::SocketCanInterface(const message &config):
+		SocketCanInterface(std::vector<message> { config })
 {
-	if (this->_socket > 0)
-		::close(this->_socket);
 }
 
-int SocketCanInterface::InitializeSocketCan(const char* ifname)
+SocketCanInterface::SocketCanInterface(const std::vector<message> &configs):
+		_reader(BusOf(configs))
 {
-	int receiveOwnMessages = 0;
-	struct sockaddr_can addr;
-	struct ifreq ifr;
-
-	PLOG(logDEBUG) << this_thread::get_id() << ": Creating socketCAN interface to " << ifname;
-
-	int sock = ::socket(PF_CAN, SOCK_RAW, CAN_RAW);
-
-	if (sock > 0)
+	for (auto &config : configs)
 	{
-		PLOG(logDEBUG) << "Socket Initialized Successfully";
-	}
-	else
-	{
-		PLOG(logERROR) << "Error initializing the socket.";
-		return sock;
-	}
-
-	memset(&ifr.ifr_name, 0, sizeof(ifr.ifr_name));
-	strncpy(ifr.ifr_name, ifname, IFNAMSIZ);
-	if(ioctl(sock, SIOCGIFINDEX, &ifr) < 0)
-	{
-		PLOG(logERROR) << "Could not find interface index.";
-		return -1;
-	}
-	else
-	{
-		PLOG(logDEBUG) << "Interface index found.";
-	}
+		CanDataAdaptor canData(config.get_container());
+		if (!IsMonitored(canData))
+			continue;
 
-	memset(&addr, 0, sizeof(addr));
-	addr.can_family = AF_CAN;
-	addr.can_ifindex = ifr.ifr_ifindex;
-	if(bind(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0)
-	{
-		PLOG(logERROR) << "Error binding the socket.";
-		return -1;
-	}
-	else
-	{
-		PLOG(logDEBUG) << "Socket binded successfully.";
+		_reader.AddFilter(strtol(canData.get_id().c_str(), NULL, 0), MaskByName(canData.get_mask()), _canData.size());
+		_canData.push_back(canData);
 	}
+}
 
-	setsockopt(sock, SOL_CAN_RAW, CAN_RAW_RECV_OWN_MSGS, &receiveOwnMessages, sizeof(receiveOwnMessages));
-	PLOG(logDEBUG) << "Socket configured to capture CAN Bus data.";
+SocketCanInterface::~SocketCanInterface()
+{
+}
 
-	return sock;
+bool SocketCanInterface::IsMonitored(CanDataAdaptor &canData)
+{
+	return !canData.is_empty() && canData.get_enabled();
 }
 
 void SocketCanInterface::DoWork()
 {
 	int threadId = VehicleConnection::GetConnection()->this_thread();
 
-	string bus = _canData.get_untyped("bus", "can0");
+	auto handler = [this](const struct can_frame &frm, size_t index) { this->HandleFrame(frm, index); };
 
-	while (!_canData.is_empty() && IsRunning())
+	while (!_canData.empty() && IsRunning())
 	{
-		struct can_frame frm;
-		struct sockaddr_can addr;
-		struct can_filter filter;
-
-		socklen_t len;
-
-		memset(frm.data, 0, 8);
-
-		if (this->_socket <= 0)
+		if (!_reader.IsOpen())
 		{
-			// TODO: Obtain the request information for this thread
-
-			filter.can_id = strtol(_canData.get_id().c_str(), NULL, 0);
-			filter.can_mask = MaskByName(_canData.get_mask());
-
-			this->_socket = InitializeSocketCan(bus.c_str());
+			PLOG(logDEBUG) << this_thread::get_id() << ": Creating socketCAN interface to " << _reader.GetBus();
 
-			if (this->_socket <= 0)
+			if (_reader.Open() < 0)
 			{
+				PLOG(logERROR) << "Unable to open " << _reader.GetBus() << " socket: " << strerror(errno);
 				PLOG(logDEBUG) << "Thread " << threadId << " (" << this_thread::get_id() << ") failed to start.";
-
-				this->_socket = 0;
 				break;
 			}
 
-			setsockopt(this->_socket, SOL_CAN_RAW, CAN_RAW_FILTER, &filter, sizeof(filter));
-
 			PLOG(logINFO) << "Thread " << threadId << " (" << this_thread::get_id() << ") for monitoring " <<
-					(_canData.get_comment().empty() ? _canData.get_name() : _canData.get_comment()) << " has been started.";
+					_canData.size() << " CAN data elements on " << _reader.GetBus() << " has been started.";
 		}
 
-		int ret = recvfrom(this->_socket, &frm, sizeof(struct can_frame), 0, (struct sockaddr*)&addr, &len);
+		int ret = _reader.Receive(handler);
 
-		if(ret < 0)
+		if (ret < 0)
 		{
-			PLOG(logERROR) << _canData.get_name() << ": Problem receiving from " << bus << " socket";
+			PLOG(logERROR) << "Problem receiving from " << _reader.GetBus() << " socket: " << strerror(errno);
 
-			// Try again after a few milliseconds
-			this_thread::sleep_for(std::chrono::milliseconds(200));
-			return;
-		}
+			// Try again with a new socket after a few milliseconds
+			_reader.Close();
 
-		PLOG(logDEBUG2) << this_thread::get_id() << ": Received " << frm.can_id << " frame of " << (int)frm.can_dlc << " bytes.";
-
-		// Make sure this is the correct set of bytes
-		/*if (frm.can_id != filter.can_id) {
-			PLOG(logDEBUG4) << _canData.get_name() << "Dropping mismatch CAN ID " << frm.can_id;
+			this_thread::sleep_for(std::chrono::milliseconds(200));
 			continue;
-		}*/
-
-		byte_stream frameBytes{frm.data[0],frm.data[1],frm.data[2],frm.data[3],frm.data[4],frm.data[5],frm.data[6],frm.data[7]};
-		frameBytes.resize(frm.can_dlc);
+		}
 
-		auto vbm = _canData.decode_VBM(frameBytes);
-		VehicleConnection::GetConnection()->BroadcastMessage(vbm);
+		PLOG(logDEBUG3) << this_thread::get_id() << ": Received " << ret << " frames from " << _reader.GetBus();
 	}
 
 	PLOG(logINFO) << "Thread " << threadId << " (" << this_thread::get_id() << ") is exiting.";
@@ -161,5 +140,15 @@ void SocketCanInterface::DoWork()
 	this->_active = false;
 }
 
+void SocketCanInterface::HandleFrame(const struct can_frame &frm, size_t index)
+{
+	PLOG(logDEBUG2) << this_thread::get_id() << ": Received " << frm.can_id << " frame of " << (int)frm.can_dlc << " bytes.";
+
+	byte_stream frameBytes(frm.data, frm.data + std::min<size_t>(frm.can_dlc, CAN_MAX_DLEN));
+
+	auto vbm = _canData[index].decode_VBM(frameBytes);
+	VehicleConnection::GetConnection()->BroadcastMessage(vbm);
+}
+
 } /* End namespace Can */
 } /* End namespace VehicleInterfacePlugin */
@@ -10,30 +10,47 @@
 
 #include "../VehicleConnection.h"
 #include "../workers/CanData.hpp"
+#include "../workers/SocketCanReader.hpp"
+
+#include <linux/can.h>
+#include <vector>
 
 namespace VehicleInterfacePlugin {
 namespace Can {
 
+/**
+ * A single reader for all the CAN data configured on one bus.  Each frame
+ * is handed to its CAN data by a look-up on the CAN ID.
+ *
+ * CAN data that is empty or not enabled is never read, just as with the
+ * WDT DIO interface, so a bus with only that CAN data gets no thread.
+ */
 class SocketCanInterface: public tmx::utils::ThreadWorker {
 public:
 	static constexpr const char *TaskName = "socketCAN";
 
 	SocketCanInterface(const tmx::message &config);
+	SocketCanInterface(const std::vector<tmx::message> &configs);
 	virtual ~SocketCanInterface();
 
 	/**
-	 * Initialize the socket to the given CAN interface
+	 * @return True if the CAN data should be read
 	 */
-	int InitializeSocketCan(const char* ifname);
+	static bool IsMonitored(CanDataAdaptor &canData);
 
 	/**
 	 * Main thread function that connects to the socket and processes messages.
 	 */
 	void DoWork();
 
+	/**
+	 * Decode and broadcast the frame for the CAN data at the given index
+	 */
+	void HandleFrame(const struct can_frame &frm, size_t index);
+
 private:
-	int _socket;
-	CanDataAdaptor _canData;
+	SocketCanReader _reader;
+	std::vector<CanDataAdaptor> _canData;
 };
 
 } /* End namespace Can */
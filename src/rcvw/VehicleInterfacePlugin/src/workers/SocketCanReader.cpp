@@ -0,0 +1,148 @@
+/*
+ * SocketCanReader.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include "../workers/SocketCanReader.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <linux/can/raw.h>
+
+namespace VehicleInterfacePlugin {
+namespace Can {
+
+SocketCanReader::SocketCanReader(const std::string &bus): _bus(bus), _socket(0)
+{
+	memset(_msgs, 0, sizeof(_msgs));
+	for (size_t i = 0; i < SOCKETCAN_BATCH_SIZE; i++)
+	{
+		_iov[i].iov_base = &_frames[i];
+		_iov[i].iov_len = sizeof(struct can_frame);
+		_msgs[i].msg_hdr.msg_iov = &_iov[i];
+		_msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+}
+
+SocketCanReader::~SocketCanReader()
+{
+	Close();
+}
+
+void SocketCanReader::AddFilter(canid_t id, canid_t mask, size_t index)
+{
+	struct can_filter filter;
+	filter.can_id = id;
+	filter.can_mask = mask;
+
+	// Each distinct mask gets its own table, which is typically just EFF and SFF
+	auto table = std::find_if(_dispatch.begin(), _dispatch.end(),
+			[mask](const DispatchTable &t) { return t.mask == mask; });
+	if (table == _dispatch.end())
+		table = _dispatch.insert(_dispatch.end(), DispatchTable { mask, { } });
+
+	// Keep the table sorted, with equal IDs in the order they were added
+	std::pair<canid_t, size_t> entry(id & mask, index);
+	table->entries.insert(std::upper_bound(table->entries.begin(), table->entries.end(), entry), entry);
+
+	_filters.push_back(filter);
+}
+
+int SocketCanReader::Open()
+{
+	int receiveOwnMessages = 0;
+	struct sockaddr_can addr;
+	struct ifreq ifr;
+
+	Close();
+
+	int sock = ::socket(PF_CAN, SOCK_RAW, CAN_RAW);
+	if (sock < 0)
+		return -1;
+
+	memset(&ifr, 0, sizeof(ifr));
+	strncpy(ifr.ifr_name, _bus.c_str(), IFNAMSIZ - 1);
+	if (ioctl(sock, SIOCGIFINDEX, &ifr) < 0)
+		return Fail(sock);
+
+	memset(&addr, 0, sizeof(addr));
+	addr.can_family = AF_CAN;
+	addr.can_ifindex = ifr.ifr_ifindex;
+	if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+		return Fail(sock);
+
+	setsockopt(sock, SOL_CAN_RAW, CAN_RAW_RECV_OWN_MSGS, &receiveOwnMessages, sizeof(receiveOwnMessages));
+
+	// Do not block forever, so the caller can be stopped
+	struct timeval timeout;
+	timeout.tv_sec = SOCKETCAN_RECV_TIMEOUT_MS / 1000;
+	timeout.tv_usec = (SOCKETCAN_RECV_TIMEOUT_MS % 1000) * 1000;
+	if (setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) < 0)
+		return Fail(sock);
+
+	// One socket receives every CAN ID needed from this bus
+	if (setsockopt(sock, SOL_CAN_RAW, CAN_RAW_FILTER, _filters.data(), _filters.size() * sizeof(struct can_filter)) < 0)
+		return Fail(sock);
+
+	_socket = sock;
+	return _socket;
+}
+
+int SocketCanReader::Fail(int sock)
+{
+	int err = errno;
+	::close(sock);
+	errno = err;
+	return -1;
+}
+
+void SocketCanReader::Close()
+{
+	if (_socket > 0)
+		::close(_socket);
+
+	_socket = 0;
+}
+
+int SocketCanReader::Receive(const handler_type &handler)
+{
+	// Wait for the first frame, then take any others that are already queued
+	int ret = recvmmsg(_socket, _msgs, SOCKETCAN_BATCH_SIZE, MSG_WAITFORONE, NULL);
+
+	if (ret < 0)
+		return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+
+	for (int i = 0; i < ret; i++)
+	{
+		if (_msgs[i].msg_len >= CAN_MTU)
+			Dispatch(_frames[i], handler);
+	}
+
+	return ret;
+}
+
+void SocketCanReader::Dispatch(const struct can_frame &frm, const handler_type &handler) const
+{
+	for (auto &table : _dispatch)
+	{
+		canid_t id = frm.can_id & table.mask;
+
+		auto iter = std::lower_bound(table.entries.begin(), table.entries.end(), id,
+				[](const std::pair<canid_t, size_t> &entry, canid_t id) { return entry.first < id; });
+
+		for (; iter != table.entries.end() && iter->first == id; iter++)
+			handler(frm, iter->second);
+	}
+}
+
+} /* End namespace Can */
+} /* End namespace VehicleInterfacePlugin */
@@ -0,0 +1,116 @@
+/*
+ * SocketCanReader.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#ifndef WORKERS_SOCKETCANREADER_HPP_
+#define WORKERS_SOCKETCANREADER_HPP_
+
+#include <linux/can.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// The most frames to take from the socket in one call
+#ifndef SOCKETCAN_BATCH_SIZE
+#define SOCKETCAN_BATCH_SIZE 32
+#endif
+
+// How long to wait for a frame before returning to the caller
+#ifndef SOCKETCAN_RECV_TIMEOUT_MS
+#define SOCKETCAN_RECV_TIMEOUT_MS 250
+#endif
+
+namespace VehicleInterfacePlugin {
+namespace Can {
+
+/**
+ * Reads the frames for a set of CAN IDs from one bus.  The full filter list
+ * is installed on a single raw socket, frames are received in batches with
+ * recvmmsg and each frame is matched to its entries through flat tables, one
+ * per mask, sorted by the masked CAN ID.
+ *
+ * The reader has no ties to the plugin, so it can be tested on a vcan bus.
+ */
+class SocketCanReader {
+public:
+	typedef std::function<void(const struct can_frame &, size_t)> handler_type;
+
+	SocketCanReader(const std::string &bus);
+	virtual ~SocketCanReader();
+
+	SocketCanReader(const SocketCanReader &) = delete;
+	SocketCanReader &operator=(const SocketCanReader &) = delete;
+
+	/**
+	 * Add a filter for the CAN ID under the mask.  Matching frames are handed
+	 * to the handler with the given index.
+	 */
+	void AddFilter(canid_t id, canid_t mask, size_t index);
+
+	const std::string &GetBus() const { return _bus; }
+	size_t GetFilterCount() const { return _filters.size(); }
+	bool IsOpen() const { return _socket > 0; }
+
+	/**
+	 * Open the socket to the bus and install the filters
+	 *
+	 * @return The socket, or -1 with errno set
+	 */
+	int Open();
+
+	/**
+	 * Close the socket, if it is open
+	 */
+	void Close();
+
+	/**
+	 * Wait up to SOCKETCAN_RECV_TIMEOUT_MS for a frame, then take any others
+	 * that are already queued, up to SOCKETCAN_BATCH_SIZE.  Each frame is
+	 * dispatched to the handler.
+	 *
+	 * @return The number of frames received, zero on a timeout or -1 with errno set
+	 */
+	int Receive(const handler_type &handler);
+
+	/**
+	 * Call the handler for every entry that matches the CAN ID of the frame,
+	 * in the order the entries were added
+	 */
+	void Dispatch(const struct can_frame &frm, const handler_type &handler) const;
+
+private:
+	/**
+	 * Close a socket that could not be set up, keeping the errno
+	 */
+	static int Fail(int sock);
+
+	/**
+	 * The entry indexes for a given mask, sorted by the masked CAN ID
+	 */
+	struct DispatchTable {
+		canid_t mask;
+		std::vector<std::pair<canid_t, size_t> > entries;
+	};
+
+	std::string _bus;
+	int _socket;
+	std::vector<struct can_filter> _filters;
+	std::vector<DispatchTable> _dispatch;
+
+	struct can_frame _frames[SOCKETCAN_BATCH_SIZE];
+	struct iovec _iov[SOCKETCAN_BATCH_SIZE];
+	struct mmsghdr _msgs[SOCKETCAN_BATCH_SIZE];
+};
+
+} /* End namespace Can */
+} /* End namespace VehicleInterfacePlugin */
+
+#endif /* WORKERS_SOCKETCANREADER_HPP_ */
@@ -0,0 +1,200 @@
+/*
+ * SocketCanReader_Test.cpp
+ *
+ * The tests that need a bus use a vcan interface, which can be set up with:
+ *
+ *     ip link add dev vcan0 type vcan && ip link set up vcan0
+ *
+ * Set TMX_TEST_CAN_BUS to use a different interface.  Those tests are
+ * skipped when the interface can not be opened.
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "../src/workers/SocketCanReader.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+using namespace VehicleInterfacePlugin::Can;
+
+typedef std::vector<std::pair<canid_t, size_t> > calls_type;
+
+BOOST_TEST_DONT_PRINT_LOG_VALUE(calls_type::value_type)
+
+static std::string test_bus()
+{
+	const char *bus = std::getenv("TMX_TEST_CAN_BUS");
+	return bus ? bus : "vcan0";
+}
+
+static boost::test_tools::assertion_result bus_available(boost::unit_test::test_unit_id)
+{
+	SocketCanReader reader(test_bus());
+	boost::test_tools::assertion_result result(reader.Open() > 0);
+	result.message() << "Unable to open " << test_bus() << ": " << strerror(errno);
+	return result;
+}
+
+static int open_sender(const std::string &bus)
+{
+	int sock = ::socket(PF_CAN, SOCK_RAW, CAN_RAW);
+	if (sock < 0)
+		return -1;
+
+	struct ifreq ifr;
+	memset(&ifr, 0, sizeof(ifr));
+	strncpy(ifr.ifr_name, bus.c_str(), IFNAMSIZ - 1);
+
+	if (ioctl(sock, SIOCGIFINDEX, &ifr) < 0)
+	{
+		::close(sock);
+		return -1;
+	}
+
+	struct sockaddr_can addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.can_family = AF_CAN;
+	addr.can_ifindex = ifr.ifr_ifindex;
+	if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+	{
+		::close(sock);
+		return -1;
+	}
+
+	return sock;
+}
+
+static bool send_frame(int sock, canid_t id, uint16_t value)
+{
+	struct can_frame frm;
+	memset(&frm, 0, sizeof(frm));
+	frm.can_id = id;
+	frm.can_dlc = 2;
+	frm.data[0] = value >> 8;
+	frm.data[1] = value & 0xFF;
+
+	return ::write(sock, &frm, sizeof(frm)) == (ssize_t)sizeof(frm);
+}
+
+static uint16_t value_of(const struct can_frame &frm)
+{
+	return (frm.data[0] << 8) | frm.data[1];
+}
+
+/**
+ * The filters used by the tests, with two CAN data on the same SFF ID
+ */
+static void add_filters(SocketCanReader &reader)
+{
+	reader.AddFilter(0x123, CAN_SFF_MASK, 0);
+	reader.AddFilter(0x18FEF100, CAN_EFF_MASK, 1);
+	reader.AddFilter(0x123, CAN_SFF_MASK, 2);
+}
+
+BOOST_AUTO_TEST_SUITE( socketcan_reader_test_suite )
+
+BOOST_AUTO_TEST_CASE( dispatch_by_masked_id )
+{
+	SocketCanReader reader(test_bus());
+	add_filters(reader);
+	BOOST_TEST(reader.GetFilterCount() == 3u);
+
+	calls_type calls;
+	auto handler = [&calls](const struct can_frame &frm, size_t index) { calls.emplace_back(frm.can_id, index); };
+
+	struct can_frame frm;
+	memset(&frm, 0, sizeof(frm));
+
+	frm.can_id = 0x123;
+	reader.Dispatch(frm, handler);
+	frm.can_id = 0x18FEF100 | CAN_EFF_FLAG;
+	reader.Dispatch(frm, handler);
+	frm.can_id = 0x456;
+	reader.Dispatch(frm, handler);
+
+	calls_type expected { { 0x123, 0 }, { 0x123, 2 }, { 0x18FEF100 | CAN_EFF_FLAG, 1 } };
+	BOOST_TEST(calls == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE( open_unknown_bus_fails )
+{
+	SocketCanReader reader("nocan99");
+	add_filters(reader);
+
+	BOOST_TEST(reader.Open() == -1);
+	BOOST_TEST(!reader.IsOpen());
+}
+
+BOOST_AUTO_TEST_CASE( bus_filters_frames, * boost::unit_test::precondition(bus_available) )
+{
+	SocketCanReader reader(test_bus());
+	add_filters(reader);
+	BOOST_REQUIRE(reader.Open() > 0);
+
+	int sender = open_sender(test_bus());
+	BOOST_REQUIRE(sender > 0);
+
+	BOOST_TEST(send_frame(sender, 0x456, 1));
+	BOOST_TEST(send_frame(sender, 0x123, 2));
+	BOOST_TEST(send_frame(sender, 0x18FEF100 | CAN_EFF_FLAG, 3));
+	BOOST_TEST(send_frame(sender, 0x124, 4));
+
+	calls_type calls;
+	auto handler = [&calls](const struct can_frame &frm, size_t index) { calls.emplace_back(value_of(frm), index); };
+
+	// Only the filtered frames are received, so a timeout means there are no more
+	int received = 0;
+	for (int ret = 1; ret > 0; received += ret)
+		ret = reader.Receive(handler);
+
+	BOOST_TEST(received == 2);
+
+	calls_type expected { { 2, 0 }, { 2, 2 }, { 3, 1 } };
+	BOOST_TEST(calls == expected, boost::test_tools::per_element());
+
+	::close(sender);
+}
+
+BOOST_AUTO_TEST_CASE( bus_receives_in_batches, * boost::unit_test::precondition(bus_available) )
+{
+	const uint16_t count = 100;
+
+	SocketCanReader reader(test_bus());
+	reader.AddFilter(0x123, CAN_SFF_MASK, 0);
+	BOOST_REQUIRE(reader.Open() > 0);
+
+	int sender = open_sender(test_bus());
+	BOOST_REQUIRE(sender > 0);
+
+	for (uint16_t i = 0; i < count; i++)
+		BOOST_REQUIRE(send_frame(sender, 0x123, i));
+
+	std::vector<uint16_t> values;
+	auto handler = [&values](const struct can_frame &frm, size_t) { values.push_back(value_of(frm)); };
+
+	// Every frame is already queued, so the first call takes a full batch
+	int ret = reader.Receive(handler);
+	BOOST_TEST(ret == SOCKETCAN_BATCH_SIZE);
+
+	while (ret > 0 && values.size() < count)
+		ret = reader.Receive(handler);
+
+	BOOST_REQUIRE(values.size() == count);
+	for (uint16_t i = 0; i < count; i++)
+		BOOST_TEST(values[i] == i);
+
+	::close(sender);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,10 @@
+/*
+ * test_main.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#define BOOST_TEST_MODULE test-VehicleInterfacePlugin
+
+#include <boost/test/unit_test.hpp>
@@ -0,0 +1,82 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxBenchmarkSamples.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#ifndef TMX_BENCHMARK_TMXBENCHMARKSAMPLES_HPP_
+#define TMX_BENCHMARK_TMXBENCHMARKSAMPLES_HPP_
+
+#include <tmx/common/types/Any.hpp>
+#include <tmx/message/TmxMessage.hpp>
+#include <tmx/message/j2735/202007/MessageFrame.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace tmx {
+namespace benchmark {
+
+/*!
+ * @brief The sample J2735 messages available to the benchmarks
+ *
+ * The values can be used directly as a benchmark argument, so
+ * that each benchmark runs once per sample message.
+ */
+enum TmxBenchmarkSample: std::int64_t {
+    MAP,
+    SPAT,
+    BSM,
+    RTCM
+};
+
+static constexpr std::int64_t TMX_BENCHMARK_FIRST_SAMPLE = TmxBenchmarkSample::MAP;
+static constexpr std::int64_t TMX_BENCHMARK_LAST_SAMPLE = TmxBenchmarkSample::RTCM;
+
+/*!
+ * @param[in] sample The sample message
+ * @return The J2735 message name for the sample
+ */
+const char *get_sample_name(std::int64_t);
+
+/*!
+ * @param[in] sample The sample message
+ * @return The UPER encoded bytes of the sample message frame
+ */
+std::basic_string<std::uint8_t> const &get_sample_bytes(std::int64_t);
+
+/*!
+ * @brief Decode a new copy of the sample message frame
+ *
+ * @param[in] sample The sample message
+ * @return The message frame, which is freed when released
+ */
+std::shared_ptr<MessageFrame> get_sample_frame(std::int64_t);
+
+/*!
+ * @param[in] sample The sample message
+ * @return The sample message frame converted to TMX data
+ */
+common::types::Any const &get_sample_data(std::int64_t);
+
+/*!
+ * @brief Build a TMX message that carries the sample message frame
+ *
+ * This is the same as the J2735 message that would be received from
+ * or sent to a radio, i.e. the hex encoded UPER bytes.
+ *
+ * @param[in] sample The sample message
+ * @return The TMX message for the sample
+ */
+message::TmxMessage get_sample_message(std::int64_t);
+
+} /* End namespace benchmark */
+} /* End namespace tmx */
+
+#endif /* TMX_BENCHMARK_TMXBENCHMARKSAMPLES_HPP_ */
@@ -0,0 +1,107 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file MapSupport_Benchmark.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/benchmark/TmxBenchmarkSamples.hpp>
+
+#include <tmx/plugin/utils/interxn/CompiledMap.hpp>
+#include <tmx/plugin/utils/interxn/Intersection.hpp>
+#include <tmx/plugin/utils/interxn/MapSupport.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+using namespace tmx::plugin::utils::geo;
+using namespace tmx::plugin::utils::interxn;
+
+namespace tmx {
+namespace benchmark {
+
+static std::shared_ptr<MapData> get_map() {
+    auto frame = get_sample_frame(TmxBenchmarkSample::MAP);
+    return { frame, &frame->value.choice.MapData };
+}
+
+// Vehicle positions over the whole MAP bounding box, plus some just outside
+static std::vector<WGS84Point> get_points(ParsedMap const &map) {
+    std::vector<WGS84Point> points;
+
+    double dLat = (map.MaxLat - map.MinLat) * 1.2;
+    double dLong = (map.MaxLong - map.MinLong) * 1.2;
+    for (int i = 0; i <= 20; i++) {
+        for (int j = 0; j <= 20; j++)
+            points.emplace_back(map.MinLat - dLat * 0.1 + dLat * i / 20, map.MinLong - dLong * 0.1 + dLong * j / 20);
+    }
+
+    return points;
+}
+
+static void Intersection_LoadMap(::benchmark::State &state) {
+    auto map = get_map();
+
+    for (auto _: state) {
+        Intersection intersection;
+        if (!intersection.LoadMap(map)) {
+            state.SkipWithError("Unable to load the MAP");
+            break;
+        }
+
+        ::benchmark::DoNotOptimize(intersection.Map);
+    }
+}
+
+BENCHMARK(Intersection_LoadMap);
+
+static void MapSupport_FindVehicleLane(::benchmark::State &state) {
+    Intersection intersection;
+    if (!intersection.LoadMap(get_map())) {
+        state.SkipWithError("Unable to load the MAP");
+        return;
+    }
+
+    auto points = get_points(intersection.Map);
+
+    MapSupport mapSupp;
+    for (auto _: state) {
+        for (auto &point: points)
+            ::benchmark::DoNotOptimize(mapSupp.FindVehicleLaneForPoint(point, 90.0, intersection.Map));
+    }
+
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+
+BENCHMARK(MapSupport_FindVehicleLane);
+
+static void CompiledMap_FindVehicleLane(::benchmark::State &state) {
+    auto map = get_map();
+
+    Intersection intersection;
+    if (!intersection.LoadMap(map)) {
+        state.SkipWithError("Unable to load the MAP");
+        return;
+    }
+
+    auto points = get_points(intersection.Map);
+
+    CompiledMap compiled { map };
+    for (auto _: state) {
+        for (auto &point: points)
+            ::benchmark::DoNotOptimize(compiled.FindApproachLaneForPoint(point, 90.0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+
+BENCHMARK(CompiledMap_FindVehicleLane);
+
+} /* End namespace benchmark */
+} /* End namespace tmx */
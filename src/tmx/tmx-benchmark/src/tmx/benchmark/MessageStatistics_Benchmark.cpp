@@ -0,0 +1,79 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file MessageStatistics_Benchmark.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/plugin/utils/stats/MessageStatistics.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+
+using namespace tmx::plugin::utils::stats;
+
+namespace tmx {
+namespace benchmark {
+
+static MessageStatistics _statistics;
+
+/*!
+ * @brief Count messages from many receiving threads at once
+ *
+ * Each thread is its own source, and the messages alternate between BSM
+ * and SPAT, like a busy radio. Since nothing on this path takes a lock,
+ * the total rate should scale with the threads, rather than collapse.
+ */
+static void MessageStatistics_Count(::benchmark::State &state) {
+    const std::string source = "radio" + std::to_string(state.thread_index());
+
+    std::uint16_t id = 20;
+    for (auto _: state) {
+        _statistics.count(id, 40, source);
+        id ^= 0x07;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(MessageStatistics_Count)->ThreadRange(1, 16)->UseRealTime();
+
+/*!
+ * @brief The mutex protected, string keyed map that the statistics replaced, for comparison
+ */
+static void MessageStatistics_MutexMap(::benchmark::State &state) {
+    static std::mutex lock;
+    static std::map<std::string, std::atomic<std::uint32_t> > counts;
+
+    std::string topic = "BSM";
+    for (auto _: state) {
+        std::lock_guard<std::mutex> guard(lock);
+        counts[topic]++;
+        topic = (topic == "BSM" ? "SPAT" : "BSM");
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(MessageStatistics_MutexMap)->ThreadRange(1, 16)->UseRealTime();
+
+/*!
+ * @brief Take the periodic snapshot of the counts
+ */
+static void MessageStatistics_Snapshot(::benchmark::State &state) {
+    MessageStatistics::Snapshot snap;
+    for (auto _: state) {
+        _statistics.snapshot(snap);
+        ::benchmark::DoNotOptimize(snap.totalBytes);
+    }
+}
+BENCHMARK(MessageStatistics_Snapshot);
+
+} /* End namespace benchmark */
+} /* End namespace tmx */
@@ -0,0 +1,105 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file Rtcm3_Benchmark.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/plugin/utils/gnss/Crc24q.hpp>
+#include <tmx/plugin/utils/gnss/Rtcm3FrameParser.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+
+using namespace tmx::common;
+using namespace tmx::plugin::utils::gnss;
+
+namespace tmx {
+namespace benchmark {
+
+/*!
+ * @brief A correction stream of back to back MSM7 frames for GPS, GLONASS, Galileo and BeiDou
+ */
+static std::basic_string<byte_t> const &get_msm7_stream() {
+    static const auto _stream = []() {
+        static constexpr std::uint16_t msm7[] = { 1077, 1087, 1097, 1127 };
+
+        std::mt19937 rng { 1077 };
+        std::uniform_int_distribution<int> byte { 0, 255 };
+        std::uniform_int_distribution<std::size_t> length { 300, Rtcm3FrameParser::MAX_MESSAGE_SIZE };
+
+        std::basic_string<byte_t> stream;
+        for (std::size_t i = 0; stream.length() < 1024 * 1024; i++) {
+            auto start = stream.length();
+            auto len = length(rng);
+            auto num = msm7[i % std::size(msm7)];
+
+            stream.push_back(static_cast<byte_t>(Rtcm3FrameParser::PREAMBLE));
+            stream.push_back(static_cast<byte_t>(len >> 8));
+            stream.push_back(static_cast<byte_t>(len & 0xFF));
+            stream.push_back(static_cast<byte_t>(num >> 4));
+            stream.push_back(static_cast<byte_t>((num & 0x0F) << 4));
+            while (stream.length() - start < Rtcm3FrameParser::HEADER_SIZE + len)
+                stream.push_back(static_cast<byte_t>(byte(rng)));
+
+            auto crc = crc24q(stream.data() + start, stream.length() - start);
+            stream.push_back(static_cast<byte_t>(crc >> 16));
+            stream.push_back(static_cast<byte_t>(crc >> 8));
+            stream.push_back(static_cast<byte_t>(crc));
+        }
+
+        return stream;
+    }();
+
+    return _stream;
+}
+
+static void Rtcm3_Crc24qBytewise(::benchmark::State &state) {
+    auto const &stream = get_msm7_stream();
+    for (auto _: state)
+        ::benchmark::DoNotOptimize(crc24q_bytewise(stream.data(), state.range(0)));
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Rtcm3_Crc24qBytewise)->Arg(22)->Arg(1029);
+
+static void Rtcm3_Crc24q(::benchmark::State &state) {
+    auto const &stream = get_msm7_stream();
+    for (auto _: state)
+        ::benchmark::DoNotOptimize(crc24q(stream.data(), state.range(0)));
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Rtcm3_Crc24q)->Arg(22)->Arg(1029);
+
+/*!
+ * @brief Find the frames in the stream as read in pieces of the given size
+ */
+static void Rtcm3_FrameParser(::benchmark::State &state) {
+    auto const &stream = get_msm7_stream();
+    std::size_t chunk = state.range(0);
+    std::uint64_t frames = 0;
+
+    for (auto _: state) {
+        Rtcm3FrameParser parser;
+        for (std::size_t i = 0; i < stream.length(); i += chunk) {
+            parser.parse(byte_sequence(stream.data() + i, std::min(chunk, stream.length() - i)),
+                         [](byte_sequence const &frame) { ::benchmark::DoNotOptimize(frame.data()); });
+        }
+
+        frames += parser.get_frame_count();
+    }
+
+    state.SetBytesProcessed(state.iterations() * stream.length());
+    state.SetItemsProcessed(frames);
+}
+BENCHMARK(Rtcm3_FrameParser)->Arg(1)->Arg(64)->Arg(1460)->Arg(65536);
+
+} /* End namespace benchmark */
+} /* End namespace tmx */
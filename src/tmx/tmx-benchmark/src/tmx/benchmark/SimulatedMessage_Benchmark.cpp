@@ -0,0 +1,105 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file SimulatedMessage_Benchmark.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/plugin/utils/sim/SimulatedMessageEncoder.hpp>
+
+#include <tmx/common/platform/types/byte_string.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+using namespace tmx::common;
+using namespace tmx::plugin::utils::sim;
+
+namespace tmx {
+namespace benchmark {
+
+/*!
+ * @brief Build the simulator input for the vehicle, as it would arrive
+ */
+static std::basic_string<byte_t> get_sim_input(std::uint32_t vehicle, std::size_t size) {
+    // Vehicle heading 90.5, speed 12.25 m/s, at 38.95, -77.15 and 120.5 m
+    const std::uint32_t values[] = { vehicle, 90500000, 12250, 218950000, 102850000, 620500 };
+
+    std::basic_string<byte_t> bytes;
+    for (auto v: values) {
+        for (int shift = 24; shift >= 0; shift -= 8)
+            bytes.push_back(static_cast<byte_t>((v >> shift) & 0xFF));
+    }
+
+    bytes.resize(size);
+    return bytes;
+}
+
+/*!
+ * @brief Generate simulated messages, cycling through the vehicles given by the argument
+ *
+ * The second argument selects the hex text output, which is how the
+ * message is forwarded, instead of only the raw bytes.
+ */
+template <typename _Encode>
+static void run_simulated(::benchmark::State &state, std::size_t size, _Encode encode) {
+    std::vector<std::basic_string<byte_t> > inputs;
+    for (std::uint32_t i = 0; i < (std::uint32_t) state.range(0); i++)
+        inputs.push_back(get_sim_input(i, size));
+
+    auto &encoder = SimulatedMessageEncoder::get_thread_encoder();
+    std::string hex;
+    std::size_t i = 0;
+
+    for (auto _: state) {
+        auto const &in = inputs[i++ % inputs.size()];
+        auto bytes = encode(encoder, byte_sequence(in.data(), in.length()));
+
+        if (state.range(1)) {
+            hex.clear();
+            byte_string_encode(hex, bytes, TMX_DEFAULT_BYTE_ENCODING);
+            ::benchmark::DoNotOptimize(hex.data());
+        } else {
+            ::benchmark::DoNotOptimize(bytes.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void SimulatedMessage_BSM(::benchmark::State &state) {
+    run_simulated(state, 24, [](SimulatedMessageEncoder &encoder, byte_sequence const &in) {
+        SimulatedVehicle vehicle;
+        SimulatedMessageEncoder::parse_bsm(in, vehicle);
+        return encoder.encode_bsm(vehicle, std::chrono::system_clock::now());
+    });
+}
+BENCHMARK(SimulatedMessage_BSM)->ArgsProduct({ { 1, 500 }, { 0, 1 } });
+
+static void SimulatedMessage_SRM(::benchmark::State &state) {
+    run_simulated(state, 24, [](SimulatedMessageEncoder &encoder, byte_sequence const &in) {
+        SimulatedVehicle vehicle;
+        SimulatedMessageEncoder::parse_srm(in, vehicle);
+        return encoder.encode_srm(vehicle, std::chrono::system_clock::now());
+    });
+}
+BENCHMARK(SimulatedMessage_SRM)->ArgsProduct({ { 1, 500 }, { 0, 1 } });
+
+// There is no J2735 encoding of the vehicle basics, so this only covers reading the input
+static void SimulatedMessage_VBM(::benchmark::State &state) {
+    run_simulated(state, 15, [](SimulatedMessageEncoder &, byte_sequence const &in) {
+        SimulatedVehicleBasics vehicle;
+        SimulatedMessageEncoder::parse_vbm(in, vehicle);
+        ::benchmark::DoNotOptimize(vehicle);
+        return in;
+    });
+}
+BENCHMARK(SimulatedMessage_VBM)->ArgsProduct({ { 1, 500 }, { 0, 1 } });
+
+} /* End namespace benchmark */
+} /* End namespace tmx */
@@ -0,0 +1,193 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxAsnDot1_Benchmark.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/benchmark/TmxBenchmarkSamples.hpp>
+
+#include <tmx/common/types/String.hpp>
+#include <tmx/message/codec/TmxCodec.hpp>
+#include <tmx/message/codec/asn/TmxAsnDot1Schema.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+using namespace tmx::common;
+using namespace tmx::common::types;
+using namespace tmx::message::codec;
+
+namespace tmx {
+namespace benchmark {
+
+// Count the encoded bytes without keeping them, which is how the TMX ASN.1 encoder streams the chunks
+static int count_chunk(const void *, std::size_t size, void *key) {
+    *static_cast<std::size_t *>(key) += size;
+    return 0;
+}
+
+// Encode the whole J2735 message frame with the given transfer syntax
+static void TmxAsnDot1_EncodeFrame(::benchmark::State &state, asn_transfer_syntax syntax) {
+    auto frame = get_sample_frame(state.range(0));
+
+    std::size_t bytes = 0;
+    for (auto _: state) {
+        auto ret = asn_encode(nullptr, syntax, &asn_DEF_MessageFrame, frame.get(), &count_chunk, &bytes);
+        if (ret.encoded < 0) {
+            state.SkipWithError((std::string("Unable to encode ") +
+                                 (ret.failed_type ? ret.failed_type->name : "MessageFrame")).c_str());
+            break;
+        }
+    }
+
+    state.SetLabel(get_sample_name(state.range(0)));
+    state.SetBytesProcessed(bytes);
+}
+
+// There is no OER case, since the J2735 open types are generated without OER support
+BENCHMARK_CAPTURE(TmxAsnDot1_EncodeFrame, uper, ATS_UNALIGNED_BASIC_PER)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE,
+                                                                                      TMX_BENCHMARK_LAST_SAMPLE);
+BENCHMARK_CAPTURE(TmxAsnDot1_EncodeFrame, ber, ATS_DER)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE,
+                                                                     TMX_BENCHMARK_LAST_SAMPLE);
+BENCHMARK_CAPTURE(TmxAsnDot1_EncodeFrame, xer, ATS_BASIC_XER)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE,
+                                                                           TMX_BENCHMARK_LAST_SAMPLE);
+
+static void TmxAsnDot1_DecodeFrame(::benchmark::State &state, asn_transfer_syntax syntax) {
+    auto frame = get_sample_frame(state.range(0));
+
+    auto enc = asn_encode_to_new_buffer(nullptr, syntax, &asn_DEF_MessageFrame, frame.get());
+    if (enc.result.encoded < 0 || !enc.buffer) {
+        state.SkipWithError("Encoding failed");
+        return;
+    }
+
+    std::basic_string<std::uint8_t> bytes { static_cast<const std::uint8_t *>(enc.buffer),
+                                            static_cast<std::size_t>(enc.result.encoded) };
+    std::free(enc.buffer);
+
+    for (auto _: state) {
+        MessageFrame *copy = nullptr;
+        auto ret = asn_decode(nullptr, syntax, &asn_DEF_MessageFrame, (void **)&copy, bytes.data(), bytes.length());
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, copy);
+        if (ret.code != RC_OK) {
+            state.SkipWithError("Decoding failed");
+            break;
+        }
+    }
+
+    state.SetLabel(get_sample_name(state.range(0)));
+    state.SetBytesProcessed(state.iterations() * bytes.length());
+}
+
+BENCHMARK_CAPTURE(TmxAsnDot1_DecodeFrame, uper, ATS_UNALIGNED_BASIC_PER)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE,
+                                                                                      TMX_BENCHMARK_LAST_SAMPLE);
+BENCHMARK_CAPTURE(TmxAsnDot1_DecodeFrame, ber, ATS_DER)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE,
+                                                                     TMX_BENCHMARK_LAST_SAMPLE);
+BENCHMARK_CAPTURE(TmxAsnDot1_DecodeFrame, xer, ATS_BASIC_XER)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE,
+                                                                           TMX_BENCHMARK_LAST_SAMPLE);
+
+// The conversion from the J2735 structure to TMX data, which is used for every message handled as data
+static void TmxAsnDot1_DumpFrame(::benchmark::State &state) {
+    auto frame = get_sample_frame(state.range(0));
+
+    for (auto _: state) {
+        Any data;
+        auto err = asn::schema::dump(&asn_DEF_MessageFrame, frame.get(), data);
+        if (err) {
+            state.SkipWithError(err.get_message().c_str());
+            break;
+        }
+
+        ::benchmark::DoNotOptimize(data);
+    }
+
+    state.SetLabel(get_sample_name(state.range(0)));
+}
+
+BENCHMARK(TmxAsnDot1_DumpFrame)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE, TMX_BENCHMARK_LAST_SAMPLE);
+
+// The original conversion to TMX data, through XER and the XML decoder, for comparison with the dump
+static void TmxAsnDot1_DumpFrameByXer(::benchmark::State &state) {
+    auto frame = get_sample_frame(state.range(0));
+
+    auto decoder = TmxDecoder::get_decoder("xml");
+    if (!decoder) {
+        state.SkipWithError("No decoder registered");
+        return;
+    }
+
+    for (auto _: state) {
+        auto ret = asn_encode_to_new_buffer(nullptr, ATS_BASIC_XER, &asn_DEF_MessageFrame, frame.get());
+        if (ret.result.encoded < 0 || !ret.buffer) {
+            state.SkipWithError("XER encoding failed");
+            break;
+        }
+
+        Any data;
+        auto err = decoder->decode(data, to_char_sequence(static_cast<const char *>(ret.buffer), ret.result.encoded));
+        std::free(ret.buffer);
+        if (err) {
+            state.SkipWithError(err.get_message().c_str());
+            break;
+        }
+
+        ::benchmark::DoNotOptimize(data);
+    }
+
+    state.SetLabel(get_sample_name(state.range(0)));
+}
+
+BENCHMARK(TmxAsnDot1_DumpFrameByXer)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE, TMX_BENCHMARK_LAST_SAMPLE);
+
+static void TmxAsnDot1_LoadFrame(::benchmark::State &state) {
+    auto const &data = get_sample_data(state.range(0));
+
+    for (auto _: state) {
+        void *ptr = nullptr;
+        auto err = asn::schema::load(&asn_DEF_MessageFrame, data, &ptr);
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, static_cast<MessageFrame *>(ptr));
+        if (err) {
+            state.SkipWithError(err.get_message().c_str());
+            break;
+        }
+    }
+
+    state.SetLabel(get_sample_name(state.range(0)));
+}
+
+BENCHMARK(TmxAsnDot1_LoadFrame)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE, TMX_BENCHMARK_LAST_SAMPLE);
+
+// The TMX ASN.1 encoders, which currently only handle the scalar types
+static void TmxAsnDot1_Encode(::benchmark::State &state, const char *encoding) {
+    auto encoder = TmxEncoder::get_encoder(encoding);
+    if (!encoder) {
+        state.SkipWithError("No encoder registered");
+        return;
+    }
+
+    const Any data { String8("5th and Perry") };
+
+    std::string buffer;
+    for (auto _: state) {
+        buffer.clear();
+        auto err = encoder->encode(data, buffer);
+        if (err) {
+            state.SkipWithError(err.get_message().c_str());
+            break;
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * buffer.length());
+}
+
+BENCHMARK_CAPTURE(TmxAsnDot1_Encode, ber, "asn.1-ber");
+BENCHMARK_CAPTURE(TmxAsnDot1_Encode, xer, "asn.1-xer");
+
+} /* End namespace benchmark */
+} /* End namespace tmx */
@@ -0,0 +1,129 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxAsynchronousSocketBridge_Benchmark.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/broker/TmxBrokerClient.hpp>
+#include <tmx/broker/TmxBrokerContext.hpp>
+#include <tmx/common/TmxFunctor.hpp>
+#include <tmx/common/TmxTypeRegistrar.hpp>
+#include <tmx/message/TmxMessage.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <string>
+#include <thread>
+
+using namespace tmx::broker;
+using namespace tmx::common;
+using namespace tmx::message;
+
+namespace tmx {
+namespace benchmark {
+
+// Roughly the size of a J2735 BSM with a Part II extension
+#define UDP_BENCHMARK_DATAGRAM_SIZE 200
+
+static std::atomic<std::uint64_t> _udp_received { 0 };
+
+class TmxBenchmarkDatagramCounter: public TmxFunctor<types::Any const &, TmxMessage const &> {
+public:
+    TmxError execute(types::Any const &, TmxMessage const &) const override {
+        _udp_received++;
+        return { };
+    }
+};
+
+static TmxTypeRegistrar<TmxBenchmarkDatagramCounter> _udp_counter;
+
+template <typename _Pred>
+static bool wait_until(_Pred &&pred, std::chrono::milliseconds timeout) {
+    auto end = std::chrono::steady_clock::now() + timeout;
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > end)
+            return false;
+
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+/*!
+ * @brief Send bursts of datagrams over the UDP loopback and wait for each to arrive
+ *
+ * Each iteration publishes one burst of the given number of datagrams,
+ * which is kept small enough to not overflow the socket buffers. The
+ * packets/s are reported as the items processed, and the CPU time of the
+ * whole process, across both the client and server threads, is reported
+ * per packet received. Any datagram lost on the loopback is also counted.
+ */
+static void TmxAsynchronousSocketBridge_UdpLoopback(::benchmark::State &state) {
+    const std::size_t burst = state.range(0);
+
+    TmxBrokerContext server { "udp-d://127.0.0.1:24611", "udp-benchmark-server" };
+    TmxBrokerContext client { "udp://127.0.0.1:24611", "udp-benchmark-client" };
+
+    auto serverBroker = TmxBrokerClient::get_broker(server);
+    auto clientBroker = TmxBrokerClient::get_broker(client);
+    if (!serverBroker || !clientBroker) {
+        state.SkipWithError("The UDP broker is not available");
+        return;
+    }
+
+    serverBroker->initialize(server);
+    serverBroker->subscribe(server, "UNKNOWN", _udp_counter.descriptor());
+    serverBroker->connect(server);
+    clientBroker->initialize(client);
+    clientBroker->connect(client);
+
+    const std::chrono::seconds timeout { 5 };
+    if (!wait_until([&]() { return server.get_state() >= TmxBrokerState::connected &&
+                                   client.get_state() >= TmxBrokerState::connected; }, timeout)) {
+        state.SkipWithError("Could not connect over the UDP loopback");
+    } else {
+        TmxMessage msg;
+        msg.set_payload(std::string(UDP_BENCHMARK_DATAGRAM_SIZE, '\x5A'));
+
+        std::uint64_t sent = 0;
+        const auto start = _udp_received.load();
+        const auto cpuStart = std::clock();
+
+        for (auto _: state) {
+            for (std::size_t i = 0; i < burst; i++, sent++)
+                clientBroker->publish(client, msg);
+
+            // Wait for the burst to arrive, unless some were dropped
+            wait_until([&]() { return _udp_received.load() - start >= sent; }, std::chrono::milliseconds(100));
+        }
+
+        const auto received = _udp_received.load() - start;
+        const auto cpu = (double)(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+        state.SetItemsProcessed(received);
+        state.counters["cpu_us_per_packet"] = received ? cpu * 1e6 / received : 0.0;
+        state.counters["lost"] = (double)sent - (double)received;
+    }
+
+    clientBroker->disconnect(client);
+    serverBroker->disconnect(server);
+    wait_until([&]() { return client.get_state() == TmxBrokerState::disconnected &&
+                              server.get_state() == TmxBrokerState::disconnected; }, timeout);
+
+    clientBroker->destroy(client);
+    serverBroker->destroy(server);
+}
+
+BENCHMARK(TmxAsynchronousSocketBridge_UdpLoopback)->Arg(1)->Arg(64)->Arg(512)->UseRealTime();
+
+} /* End namespace benchmark */
+} /* End namespace tmx */
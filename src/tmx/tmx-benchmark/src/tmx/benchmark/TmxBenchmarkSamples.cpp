@@ -0,0 +1,200 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxBenchmarkSamples.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/benchmark/TmxBenchmarkSamples.hpp>
+
+#include <tmx/message/codec/TmxCodec.hpp>
+#include <tmx/message/codec/asn/TmxAsnDot1Schema.hpp>
+
+#include <array>
+#include <cstdlib>
+#include <mutex>
+#include <stdexcept>
+
+using namespace tmx::common;
+using namespace tmx::common::types;
+using namespace tmx::message;
+
+namespace tmx {
+namespace benchmark {
+
+// A MAP message for the 5th and Perry intersection, taken from the MapPlugin manifest
+static const char *SAMPLE_MAP_BYTES =
+        "0012810B380130002073BE054D75DCBE9CAAC13A198C02DC0AC814657CBCFA20C3C3872DF871E8140000003124C5B9014140179B"
+        "608AA6EE20A365F21998DA91042363E886BC34DA43765A3411E5AF9844424E51732C0814143352B02064A75CB0C4E2AE00D85C00"
+        "0E77C04059078C8B879F44187870E5BF0E3D06800000010B1EAD349E424FB2BD42CC7C0A0A0E26A3A1B1F8001CEF80808805D900"
+        "0000042CF88FB17784D90B88A6983EDE83880FE900000004918F55C0A0A006CB604D0B2719F99BE6E85054EDFCBA6841D3961C7A"
+        "C89804004000B4EF6457503A0480C94C000E77C09C0A4AA7BFAF4D083A72C38F5A230080080A0C282E0E430600ECC650E9949C2C"
+        "917C71E7962DA4CF262460";
+
+// A SPAT for the same intersection, with eight signal groups
+static std::string sample_spat_xer() {
+    std::string xer {
+        "<SPAT>"
+        "<timeStamp>412312</timeStamp>"
+        "<intersections><IntersectionState>"
+        "<name>5th and Perry</name><id><id>1301</id></id><revision>7</revision>"
+        "<status>0010000000000000</status><moy>412312</moy><timeStamp>35176</timeStamp>"
+        "<states>" };
+
+    for (int group = 1; group <= 8; group++) {
+        xer.append("<MovementState><signalGroup>").append(std::to_string(group)).append("</signalGroup>");
+        xer.append("<state-time-speed><MovementEvent><eventState>");
+        xer.append(group % 2 ? "<protected-Movement-Allowed/>" : "<stop-And-Remain/>");
+        xer.append("</eventState><timing><minEndTime>").append(std::to_string(22000 + group * 10));
+        xer.append("</minEndTime><maxEndTime>").append(std::to_string(22500 + group * 10));
+        xer.append("</maxEndTime></timing></MovementEvent></state-time-speed></MovementState>");
+    }
+
+    xer.append("</states></IntersectionState></intersections></SPAT>");
+    return xer;
+}
+
+// A BSM for a vehicle approaching the intersection
+static const char *SAMPLE_BSM_XER =
+        "<BasicSafetyMessage><coreData>"
+        "<msgCnt>12</msgCnt><id>A1B2C3D4</id><secMark>35176</secMark>"
+        "<lat>399652654</lat><long>-830296342</long><elev>2140</elev>"
+        "<accuracy><semiMajor>40</semiMajor><semiMinor>30</semiMinor><orientation>12000</orientation></accuracy>"
+        "<transmission><forwardGears/></transmission><speed>650</speed><heading>4520</heading><angle>5</angle>"
+        "<accelSet><long>20</long><lat>-3</lat><vert>0</vert><yaw>12</yaw></accelSet>"
+        "<brakes><wheelBrakes>00000</wheelBrakes><traction><off/></traction><abs><on/></abs><scs><on/></scs>"
+        "<brakeBoost><unavailable/></brakeBoost><auxBrakes><unavailable/></auxBrakes></brakes>"
+        "<size><width>190</width><length>480</length></size>"
+        "</coreData></BasicSafetyMessage>";
+
+// RTCM corrections carrying the RTCM 3 station coordinates (1005) example frame
+static const char *SAMPLE_RTCM_XER =
+        "<RTCMcorrections>"
+        "<msgCnt>3</msgCnt><rev><rtcmRev3/></rev><timeStamp>412312</timeStamp>"
+        "<msgs><RTCMmessage>D300133ED7D30202980EDEEF34B4BD62AC0941986F33360B98</RTCMmessage></msgs>"
+        "</RTCMcorrections>";
+
+static constexpr std::array<const char *, TMX_BENCHMARK_LAST_SAMPLE + 1> SAMPLE_NAMES { "MAP", "SPAT", "BSM", "RTCM" };
+
+struct TmxBenchmarkSampleData {
+    std::basic_string<std::uint8_t> bytes;
+    Any data;
+};
+
+static std::basic_string<std::uint8_t> from_hex(const_string hex) {
+    std::basic_string<std::uint8_t> bytes;
+    for (std::size_t i = 0; i + 1 < hex.length(); i += 2)
+        bytes.push_back(std::stoi(std::string(hex.substr(i, 2)), nullptr, 16));
+
+    return bytes;
+}
+
+typedef decltype(MessageFrame::value.choice) MessageFrame_value_t;
+
+// The XER decoder skips over the open type value, so the message is decoded on its own and then framed
+template <typename _T>
+static std::basic_string<std::uint8_t> from_xer(std::string const &xer, asn_TYPE_descriptor_t *td, DSRCmsgID_t id,
+                                                MessageFrame__value_PR present, _T MessageFrame_value_t::*member) {
+    _T *value = nullptr;
+    auto ret = asn_decode(nullptr, ATS_BASIC_XER, td, (void **)&value, xer.data(), xer.length());
+    if (ret.code != RC_OK) {
+        ASN_STRUCT_FREE(*td, value);
+        throw std::runtime_error("Unable to decode sample " + xer);
+    }
+
+    std::shared_ptr<MessageFrame> frame { static_cast<MessageFrame *>(std::calloc(1, sizeof(MessageFrame))),
+                                          [](auto *ptr) { ASN_STRUCT_FREE(asn_DEF_MessageFrame, ptr); } };
+    frame->messageId = id;
+    frame->value.present = present;
+
+    // The frame takes over the message contents
+    frame->value.choice.*member = *value;
+    std::free(value);
+
+    auto enc = asn_encode_to_new_buffer(nullptr, ATS_UNALIGNED_BASIC_PER, &asn_DEF_MessageFrame, frame.get());
+    if (enc.result.encoded < 0 || !enc.buffer)
+        throw std::runtime_error("Unable to encode sample " + xer);
+
+    std::basic_string<std::uint8_t> bytes { static_cast<const std::uint8_t *>(enc.buffer),
+                                            static_cast<std::size_t>(enc.result.encoded) };
+    std::free(enc.buffer);
+    return bytes;
+}
+
+static std::shared_ptr<MessageFrame> from_uper(std::basic_string<std::uint8_t> const &bytes) {
+    MessageFrame *frame = nullptr;
+    auto ret = asn_decode(nullptr, ATS_UNALIGNED_BASIC_PER, &asn_DEF_MessageFrame, (void **)&frame,
+                          bytes.data(), bytes.length());
+    std::shared_ptr<MessageFrame> _frame { frame, [](auto *ptr) { ASN_STRUCT_FREE(asn_DEF_MessageFrame, ptr); } };
+    if (ret.code != RC_OK)
+        return { };
+
+    return _frame;
+}
+
+static TmxBenchmarkSampleData const &get_sample(std::int64_t sample) {
+    static std::array<TmxBenchmarkSampleData, TMX_BENCHMARK_LAST_SAMPLE + 1> _samples;
+    static std::once_flag _once;
+
+    std::call_once(_once, []() {
+        _samples[TmxBenchmarkSample::MAP].bytes = from_hex(SAMPLE_MAP_BYTES);
+        _samples[TmxBenchmarkSample::SPAT].bytes = from_xer(sample_spat_xer(), &asn_DEF_SPAT, 19,
+                                                            MessageFrame__value_PR_SPAT, &MessageFrame_value_t::SPAT);
+        _samples[TmxBenchmarkSample::BSM].bytes = from_xer(SAMPLE_BSM_XER, &asn_DEF_BasicSafetyMessage, 20,
+                                                           MessageFrame__value_PR_BasicSafetyMessage,
+                                                           &MessageFrame_value_t::BasicSafetyMessage);
+        _samples[TmxBenchmarkSample::RTCM].bytes = from_xer(SAMPLE_RTCM_XER, &asn_DEF_RTCMcorrections, 28,
+                                                            MessageFrame__value_PR_RTCMcorrections,
+                                                            &MessageFrame_value_t::RTCMcorrections);
+
+        for (std::size_t i = 0; i < _samples.size(); i++) {
+            auto frame = from_uper(_samples[i].bytes);
+            if (!frame)
+                throw std::runtime_error(std::string("Unable to decode sample ") + SAMPLE_NAMES[i]);
+
+            auto err = codec::asn::schema::dump(&asn_DEF_MessageFrame, frame.get(), _samples[i].data);
+            if (err)
+                throw std::runtime_error(err.get_message());
+        }
+    });
+
+    return _samples.at(sample);
+}
+
+const char *get_sample_name(std::int64_t sample) {
+    return SAMPLE_NAMES.at(sample);
+}
+
+std::basic_string<std::uint8_t> const &get_sample_bytes(std::int64_t sample) {
+    return get_sample(sample).bytes;
+}
+
+std::shared_ptr<MessageFrame> get_sample_frame(std::int64_t sample) {
+    return from_uper(get_sample_bytes(sample));
+}
+
+Any const &get_sample_data(std::int64_t sample) {
+    return get_sample(sample).data;
+}
+
+TmxMessage get_sample_message(std::int64_t sample) {
+    auto const &bytes = get_sample_bytes(sample);
+
+    TmxMessage msg;
+    msg.set_id("tmx::message::j2735::MessageFrame");
+    msg.set_topic(std::string("J2735/") + get_sample_name(sample));
+    msg.set_source("TmxBenchmark");
+    msg.set_encoding("asn.1-uper");
+    msg.set_timestamp(1729087200123456789ULL);
+
+    codec::TmxCodec codec { msg };
+    codec.set_payload_bytes(to_byte_sequence(bytes.data(), bytes.length()));
+    return codec.get_message();
+}
+
+} /* End namespace benchmark */
+} /* End namespace tmx */
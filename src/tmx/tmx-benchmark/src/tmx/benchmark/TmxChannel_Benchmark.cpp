@@ -0,0 +1,92 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxChannel_Benchmark.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/benchmark/TmxBenchmarkSamples.hpp>
+
+#include <tmx/broker/TmxBrokerClient.hpp>
+#include <tmx/common/TmxTypeRegistrar.hpp>
+#include <tmx/message/TmxData.hpp>
+#include <tmx/plugin/TmxChannel.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace tmx::broker;
+using namespace tmx::common;
+using namespace tmx::common::types;
+using namespace tmx::message;
+using namespace tmx::plugin;
+
+namespace tmx {
+namespace benchmark {
+
+/*!
+ * @brief An in-process broker that only counts the messages published
+ *
+ * This keeps the network out of the measurement, so the benchmark
+ * only covers the channel overhead of getting a message to the broker.
+ */
+class TmxBenchmarkBroker: public TmxBrokerClient {
+public:
+    TmxBenchmarkBroker() noexcept {
+        this->register_broker("benchmark");
+    }
+
+    TmxTypeDescriptor get_descriptor() const noexcept override {
+        static const auto &_desc = TmxBrokerClient::get_descriptor();
+        return { _desc.get_instance(), typeid(TmxBenchmarkBroker), type_fqname(*this).data() };
+    }
+
+    void publish(TmxBrokerContext &, TmxMessage const &) noexcept override {
+        published++;
+    }
+
+    static std::atomic<std::uint64_t> published;
+};
+
+std::atomic<std::uint64_t> TmxBenchmarkBroker::published { 0 };
+
+static TmxTypeRegistrar<TmxBenchmarkBroker> _benchmark_broker;
+
+static void TmxChannel_Publish(::benchmark::State &state) {
+    auto const msg = get_sample_message(state.range(0));
+
+    TmxData config;
+    config["id"] = std::string("benchmark-") + std::to_string(state.range(1));
+    config["context"] = std::string("benchmark://localhost");
+    config["config"]["thread-count"] = (std::uint64_t)state.range(1);
+
+    const TmxTypeDescriptor descriptor { std::shared_ptr<const void>(), typeid(void), "TmxBenchmark" };
+    TmxChannel channel { descriptor, config.get_container() };
+
+    const auto start = TmxBenchmarkBroker::published.load();
+    for (auto _: state)
+        channel.write_message(msg);
+
+    // With worker threads, wait for the messages to actually reach the broker
+    const std::uint64_t expected = start + state.iterations();
+    while (TmxBenchmarkBroker::published.load() < expected)
+        std::this_thread::yield();
+
+    state.SetLabel(get_sample_name(state.range(0)));
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(TmxChannel_Publish)->ArgsProduct({ ::benchmark::CreateDenseRange(TMX_BENCHMARK_FIRST_SAMPLE,
+                                                                            TMX_BENCHMARK_LAST_SAMPLE, 1),
+                                              { 0, 1 } })->UseRealTime();
+
+} /* End namespace benchmark */
+} /* End namespace tmx */
@@ -0,0 +1,188 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxCodec_Benchmark.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/benchmark/TmxBenchmarkSamples.hpp>
+
+#include <tmx/message/TmxMessage.hpp>
+#include <tmx/message/codec/TmxCodec.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+using namespace tmx::common;
+using namespace tmx::common::types;
+using namespace tmx::message;
+using namespace tmx::message::codec;
+
+namespace tmx {
+namespace benchmark {
+
+// Encode the sample J2735 data, as converted to TMX data
+static void TmxCodec_Encode(::benchmark::State &state, const char *encoding) {
+    auto const &data = get_sample_data(state.range(0));
+
+    auto encoder = TmxEncoder::get_encoder(encoding);
+    if (!encoder) {
+        state.SkipWithError("No encoder registered");
+        return;
+    }
+
+    std::string buffer;
+    for (auto _: state) {
+        buffer.clear();
+        auto err = encoder->encode(data, buffer);
+        if (err) {
+            state.SkipWithError(err.get_message().c_str());
+            break;
+        }
+    }
+
+    state.SetLabel(get_sample_name(state.range(0)));
+    state.SetBytesProcessed(state.iterations() * buffer.length());
+}
+
+BENCHMARK_CAPTURE(TmxCodec_Encode, json, "json")->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE, TMX_BENCHMARK_LAST_SAMPLE);
+BENCHMARK_CAPTURE(TmxCodec_Encode, xml, "xml")->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE, TMX_BENCHMARK_LAST_SAMPLE);
+
+static void TmxCodec_Decode(::benchmark::State &state, const char *encoding) {
+    auto const &data = get_sample_data(state.range(0));
+
+    auto encoder = TmxEncoder::get_encoder(encoding);
+    auto decoder = TmxDecoder::get_decoder(encoding);
+    if (!encoder || !decoder) {
+        state.SkipWithError("No codec registered");
+        return;
+    }
+
+    std::string buffer;
+    auto err = encoder->encode(data, buffer);
+    if (err) {
+        state.SkipWithError(err.get_message().c_str());
+        return;
+    }
+
+    for (auto _: state) {
+        Any copy;
+        err = decoder->decode(copy, to_char_sequence(buffer.data(), buffer.length()));
+        if (err) {
+            state.SkipWithError(err.get_message().c_str());
+            break;
+        }
+
+        ::benchmark::DoNotOptimize(copy);
+    }
+
+    state.SetLabel(get_sample_name(state.range(0)));
+    state.SetBytesProcessed(state.iterations() * buffer.length());
+}
+
+BENCHMARK_CAPTURE(TmxCodec_Decode, json, "json")->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE, TMX_BENCHMARK_LAST_SAMPLE);
+BENCHMARK_CAPTURE(TmxCodec_Decode, xml, "xml")->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE, TMX_BENCHMARK_LAST_SAMPLE);
+
+// The full message encoding, including the base-N payload, as it is done for every message sent
+static void TmxCodec_EncodeMessage(::benchmark::State &state, const char *encoding) {
+    auto const &data = get_sample_data(state.range(0));
+
+    TmxCodec codec;
+    for (auto _: state) {
+        auto err = codec.encode(data, encoding);
+        if (err) {
+            state.SkipWithError(err.get_message().c_str());
+            break;
+        }
+    }
+
+    state.SetLabel(get_sample_name(state.range(0)));
+    state.SetBytesProcessed(state.iterations() * codec.get_message().get_length());
+}
+
+BENCHMARK_CAPTURE(TmxCodec_EncodeMessage, json, "json")->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE,
+                                                                     TMX_BENCHMARK_LAST_SAMPLE);
+BENCHMARK_CAPTURE(TmxCodec_EncodeMessage, xml, "xml")->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE,
+                                                                   TMX_BENCHMARK_LAST_SAMPLE);
+
+static void TmxCodec_DecodeMessage(::benchmark::State &state, const char *encoding) {
+    auto const &data = get_sample_data(state.range(0));
+
+    TmxCodec codec;
+    auto err = codec.encode(data, encoding);
+    if (err) {
+        state.SkipWithError(err.get_message().c_str());
+        return;
+    }
+
+    for (auto _: state) {
+        Any copy;
+        err = codec.decode(copy);
+        if (err) {
+            state.SkipWithError(err.get_message().c_str());
+            break;
+        }
+
+        ::benchmark::DoNotOptimize(copy);
+    }
+
+    state.SetLabel(get_sample_name(state.range(0)));
+    state.SetBytesProcessed(state.iterations() * codec.get_message().get_length());
+}
+
+BENCHMARK_CAPTURE(TmxCodec_DecodeMessage, json, "json")->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE,
+                                                                     TMX_BENCHMARK_LAST_SAMPLE);
+BENCHMARK_CAPTURE(TmxCodec_DecodeMessage, xml, "xml")->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE,
+                                                                   TMX_BENCHMARK_LAST_SAMPLE);
+
+// The base-N encoding of the binary UPER payload
+static void TmxCodec_EncodePayload(::benchmark::State &state, std::uint8_t base) {
+    auto const &bytes = get_sample_bytes(state.range(0));
+
+    TmxMessage msg;
+    msg.set_base(base);
+
+    TmxCodec codec { msg };
+    for (auto _: state)
+        codec.set_payload_bytes(to_byte_sequence(bytes.data(), bytes.length()));
+
+    state.SetLabel(get_sample_name(state.range(0)));
+    state.SetBytesProcessed(state.iterations() * bytes.length());
+}
+
+BENCHMARK_CAPTURE(TmxCodec_EncodePayload, base16, 16)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE,
+                                                                   TMX_BENCHMARK_LAST_SAMPLE);
+BENCHMARK_CAPTURE(TmxCodec_EncodePayload, base32, 32)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE,
+                                                                   TMX_BENCHMARK_LAST_SAMPLE);
+
+static void TmxCodec_DecodePayload(::benchmark::State &state, std::uint8_t base) {
+    auto const &bytes = get_sample_bytes(state.range(0));
+
+    TmxMessage msg;
+    msg.set_base(base);
+
+    TmxCodec codec { msg };
+    codec.set_payload_bytes(to_byte_sequence(bytes.data(), bytes.length()));
+
+    std::basic_string<byte_t> buffer;
+    for (auto _: state) {
+        buffer.clear();
+        ::benchmark::DoNotOptimize(codec.get_payload_bytes(buffer));
+    }
+
+    state.SetLabel(get_sample_name(state.range(0)));
+    state.SetBytesProcessed(state.iterations() * bytes.length());
+}
+
+BENCHMARK_CAPTURE(TmxCodec_DecodePayload, base16, 16)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE,
+                                                                   TMX_BENCHMARK_LAST_SAMPLE);
+BENCHMARK_CAPTURE(TmxCodec_DecodePayload, base32, 32)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE,
+                                                                   TMX_BENCHMARK_LAST_SAMPLE);
+
+} /* End namespace benchmark */
+} /* End namespace tmx */
@@ -0,0 +1,73 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxMessage_Benchmark.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/benchmark/TmxBenchmarkSamples.hpp>
+
+#include <tmx/message/TmxMessage.hpp>
+#include <tmx/message/codec/TmxCodec.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace tmx::common;
+using namespace tmx::message;
+
+namespace tmx {
+namespace benchmark {
+
+static void TmxMessage_Construct(::benchmark::State &state) {
+    auto const &bytes = get_sample_bytes(state.range(0));
+    auto const topic = std::string("J2735/") + get_sample_name(state.range(0));
+
+    for (auto _: state) {
+        TmxMessage msg;
+        msg.set_id("tmx::message::j2735::MessageFrame");
+        msg.set_topic(topic);
+        msg.set_source("TmxBenchmark");
+        msg.set_encoding("asn.1-uper");
+        msg.set_timestamp(1729087200123456789ULL);
+
+        codec::TmxCodec codec { msg };
+        codec.set_payload_bytes(to_byte_sequence(bytes.data(), bytes.length()));
+        ::benchmark::DoNotOptimize(codec.get_message());
+    }
+
+    state.SetLabel(get_sample_name(state.range(0)));
+    state.SetBytesProcessed(state.iterations() * bytes.length());
+}
+
+BENCHMARK(TmxMessage_Construct)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE, TMX_BENCHMARK_LAST_SAMPLE);
+
+static void TmxMessage_Copy(::benchmark::State &state) {
+    auto const msg = get_sample_message(state.range(0));
+
+    for (auto _: state) {
+        TmxMessage copy { msg };
+        ::benchmark::DoNotOptimize(copy);
+    }
+
+    state.SetLabel(get_sample_name(state.range(0)));
+}
+
+BENCHMARK(TmxMessage_Copy)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE, TMX_BENCHMARK_LAST_SAMPLE);
+
+static void TmxMessage_ToString(::benchmark::State &state) {
+    auto const msg = get_sample_message(state.range(0));
+
+    for (auto _: state)
+        ::benchmark::DoNotOptimize(msg.to_string());
+
+    state.SetLabel(get_sample_name(state.range(0)));
+}
+
+BENCHMARK(TmxMessage_ToString)->DenseRange(TMX_BENCHMARK_FIRST_SAMPLE, TMX_BENCHMARK_LAST_SAMPLE);
+
+} /* End namespace benchmark */
+} /* End namespace tmx */
@@ -0,0 +1,137 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxPluginConfig_Benchmark.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/message/TmxData.hpp>
+#include <tmx/plugin/TmxPlugin.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <mutex>
+
+using namespace tmx::common;
+using namespace tmx::message;
+using namespace tmx::plugin;
+
+namespace tmx {
+namespace benchmark {
+
+/*!
+ * @brief The config values read on every pass of a plugin data loop
+ */
+struct TestLoopConfig {
+    bool alwaysSend = false;
+    int pinNumber = 0;
+};
+
+/*!
+ * @brief A plugin with a few config values bound for the data path
+ */
+class TestConfigPlugin: public TmxPlugin {
+public:
+    TestConfigPlugin() {
+        this->set_config("AlwaysSend", true);
+        this->set_config("RailPinNumber", 3);
+        this->set_config("PortName", "/dev/ttyS0");
+        this->set_config("Frequency", 100);
+
+        this->bind_config("AlwaysSend", alwaysSend);
+        this->bind_config<TestLoopConfig>(loopConfig, [](TmxData const &config) {
+            return TestLoopConfig { config["AlwaysSend"].to_bool(), (int)config["RailPinNumber"] };
+        });
+    }
+
+    std::atomic<bool> alwaysSend { false };
+    TmxPluginConfigView<TestLoopConfig> loopConfig;
+};
+
+static TestConfigPlugin &get_plugin() {
+    static TestConfigPlugin _plugin;
+    return _plugin;
+}
+
+/*!
+ * @brief Read a config value by key, as the data loops did before the snapshots
+ */
+static void TmxPluginConfig_GetConfig(::benchmark::State &state) {
+    auto &plugin = get_plugin();
+    for (auto _: state) {
+        const TmxData value { plugin.get_config("AlwaysSend") };
+        ::benchmark::DoNotOptimize(value.to_bool());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(TmxPluginConfig_GetConfig)->ThreadRange(1, 8)->UseRealTime();
+
+/*!
+ * @brief The mutex protected look up and copy that get_config() replaced, for comparison
+ */
+static void TmxPluginConfig_MutexCopy(::benchmark::State &state) {
+    static std::mutex lock;
+    static const TmxData config { types::Any(get_plugin().get_config_snapshot()->get_container()) };
+
+    for (auto _: state) {
+        TmxData value;
+        lock.lock();
+        if (!config["AlwaysSend"].is_empty())
+            value = config["AlwaysSend"].get_container();
+        lock.unlock();
+        ::benchmark::DoNotOptimize(value.to_bool());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(TmxPluginConfig_MutexCopy)->ThreadRange(1, 8)->UseRealTime();
+
+/*!
+ * @brief Read a config value from an atomic field bound to the key
+ */
+static void TmxPluginConfig_BoundField(::benchmark::State &state) {
+    auto &plugin = get_plugin();
+    for (auto _: state)
+        ::benchmark::DoNotOptimize(plugin.alwaysSend.load());
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(TmxPluginConfig_BoundField)->ThreadRange(1, 8)->UseRealTime();
+
+/*!
+ * @brief Read several config values together from a typed view
+ */
+static void TmxPluginConfig_BoundView(::benchmark::State &state) {
+    auto &plugin = get_plugin();
+    for (auto _: state) {
+        auto config = plugin.loopConfig.get();
+        ::benchmark::DoNotOptimize(config->alwaysSend);
+        ::benchmark::DoNotOptimize(config->pinNumber);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(TmxPluginConfig_BoundView)->ThreadRange(1, 8)->UseRealTime();
+
+/*!
+ * @brief Change a bound config value, which publishes a new snapshot
+ */
+static void TmxPluginConfig_SetConfig(::benchmark::State &state) {
+    auto &plugin = get_plugin();
+
+    int pin = 0;
+    for (auto _: state)
+        plugin.set_config("RailPinNumber", (pin++ & 0x07));
+
+    plugin.set_config("RailPinNumber", 3);
+}
+BENCHMARK(TmxPluginConfig_SetConfig);
+
+} /* End namespace benchmark */
+} /* End namespace tmx */
@@ -0,0 +1,62 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxTaskWorker_Benchmark.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/plugin/utils/async/TmxTaskWorker.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace tmx::plugin::utils::async;
+
+namespace tmx {
+namespace benchmark {
+
+typedef TmxTaskWorker<boost::asio::io_context> worker_t;
+typedef std::chrono::steady_clock clock_type;
+
+/*!
+ * @brief Measure the time for an idle worker to pick up a task
+ *
+ * Each task is posted to an idle worker, so this measures the wake up time.
+ * The p50 and p99 dispatch latency, in microseconds, are reported as counters.
+ */
+static void TmxTaskWorker_DispatchLatency(::benchmark::State &state) {
+    worker_t worker { new boost::asio::io_context(1) };
+    worker.start();
+
+    std::vector<double> latency;
+    for (auto _: state) {
+        clock_type::time_point started;
+
+        auto posted = clock_type::now();
+        worker.schedule([&started]() -> void { started = clock_type::now(); }).wait();
+
+        latency.push_back(std::chrono::duration<double, std::micro>(started - posted).count());
+    }
+
+    worker.stop();
+
+    if (latency.empty())
+        return;
+
+    std::sort(latency.begin(), latency.end());
+    state.counters["p50_us"] = latency[latency.size() / 2];
+    state.counters["p99_us"] = latency[(latency.size() * 99) / 100];
+    state.counters["max_us"] = latency.back();
+}
+
+BENCHMARK(TmxTaskWorker_DispatchLatency)->Iterations(2000)->UseRealTime();
+
+} /* End namespace benchmark */
+} /* End namespace tmx */
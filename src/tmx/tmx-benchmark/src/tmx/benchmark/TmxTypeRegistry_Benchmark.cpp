@@ -0,0 +1,85 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxTypeRegistry_Benchmark.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/common/TmxTypeRegistry.hpp>
+#include <tmx/common/types/Int.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+using namespace tmx::common;
+using namespace tmx::common::types;
+
+namespace tmx {
+namespace benchmark {
+
+static void TmxTypeRegistry_Construct(::benchmark::State &state) {
+    for (auto _: state)
+        ::benchmark::DoNotOptimize(TmxTypeRegistry("tmx.message.J2735.202007"));
+}
+
+BENCHMARK(TmxTypeRegistry_Construct);
+
+static void TmxTypeRegistry_GetByName(::benchmark::State &state) {
+    TmxTypeRegistry reg { "tmx.message.J2735.202007" };
+    if (!reg.get("SPAT")) {
+        state.SkipWithError("The J2735 messages are not registered");
+        return;
+    }
+
+    for (auto _: state)
+        ::benchmark::DoNotOptimize(reg.get("SPAT"));
+}
+
+BENCHMARK(TmxTypeRegistry_GetByName);
+
+static void TmxTypeRegistry_GetByType(::benchmark::State &state) {
+    TmxTypeRegistry reg;
+    for (auto _: state)
+        ::benchmark::DoNotOptimize(reg.get(typeid(Int32)));
+}
+
+BENCHMARK(TmxTypeRegistry_GetByType);
+
+static void TmxTypeRegistry_GetMissing(::benchmark::State &state) {
+    TmxTypeRegistry reg { "tmx.message.J2735.202007" };
+    for (auto _: state)
+        ::benchmark::DoNotOptimize(reg.get("NotAMessage"));
+}
+
+BENCHMARK(TmxTypeRegistry_GetMissing);
+
+// This is what every broker and plugin look-up does, with a namespace from a string
+static void TmxTypeRegistry_ConstructAndGet(::benchmark::State &state) {
+    for (auto _: state)
+        ::benchmark::DoNotOptimize(TmxTypeRegistry("tmx.message.J2735.202007").get("SPAT"));
+}
+
+BENCHMARK(TmxTypeRegistry_ConstructAndGet);
+
+struct TmxTypeRegistryChurnType { };
+
+// Like a subscription that comes and goes, which retires the removed entries
+static void TmxTypeRegistry_RegisterAndUnregister(::benchmark::State &state) {
+    TmxTypeRegistry reg { "tmx.benchmark.churn" };
+    auto instance = std::make_shared<const int>(0);
+
+    for (auto _: state) {
+        reg.register_type(instance, typeid(TmxTypeRegistryChurnType), "Callback");
+        reg.unregister(typeid(TmxTypeRegistryChurnType));
+    }
+}
+
+BENCHMARK(TmxTypeRegistry_RegisterAndUnregister);
+
+} /* End namespace benchmark */
+} /* End namespace tmx */
@@ -0,0 +1,51 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file benchmark_main.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifndef TMX_BENCHMARK_VERSION
+#define TMX_BENCHMARK_VERSION "unknown"
+#endif
+
+#ifndef TMX_BENCHMARK_DEFAULT_OUT
+#define TMX_BENCHMARK_DEFAULT_OUT "tmx-benchmark.json"
+#endif
+
+int main(int argc, char **argv) {
+    static std::string _out { "--benchmark_out=" TMX_BENCHMARK_DEFAULT_OUT };
+    static std::string _format { "--benchmark_out_format=json" };
+
+    std::vector<char *> args { argv, argv + argc };
+
+    // Unless told otherwise, always keep the machine-readable results
+    bool hasOut = false;
+    for (auto arg: args)
+        hasOut |= (std::strncmp(arg, "--benchmark_out=", 16) == 0);
+
+    if (!hasOut) {
+        args.push_back(_out.data());
+        args.push_back(_format.data());
+    }
+
+    int count = args.size();
+    benchmark::Initialize(&count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(count, args.data()))
+        return 1;
+
+    benchmark::AddCustomContext("tmx_version", TMX_BENCHMARK_VERSION);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
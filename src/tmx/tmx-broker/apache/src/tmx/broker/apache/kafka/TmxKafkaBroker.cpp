@@ -24,6 +24,27 @@
 #include <memory>
 #include <sstream>
 #include <thread>
+#include <vector>
+
+#ifndef TMX_KAFKA_LINGER_MS
+#define TMX_KAFKA_LINGER_MS 5
+#endif
+
+#ifndef TMX_KAFKA_BATCH_SIZE
+#define TMX_KAFKA_BATCH_SIZE 10000
+#endif
+
+#ifndef TMX_KAFKA_COMPRESSION
+#define TMX_KAFKA_COMPRESSION "lz4"
+#endif
+
+#ifndef TMX_KAFKA_CONSUME_BATCH_SIZE
+#define TMX_KAFKA_CONSUME_BATCH_SIZE 1000
+#endif
+
+#ifndef TMX_KAFKA_POLL_TIMEOUT_MS
+#define TMX_KAFKA_POLL_TIMEOUT_MS 100
+#endif
 
 using namespace tmx::broker;
 using namespace tmx::common;
@@ -39,6 +60,22 @@ typedef typename tmx::common::TmxFunctor<types::Any const &, TmxMessage const &>
 
 static TmxBrokerContext _errCtx { "kafka://localhost" };
 
+/*!
+ * @brief The thread that serves the producer delivery reports
+ */
+struct TmxKafkaDeliveryThread { };
+
+/*!
+ * @brief A message waiting for its delivery report
+ *
+ * The producer points directly at the payload in here instead of copying it,
+ * and the same message is handed back to the delivery callback.
+ */
+struct TmxKafkaDelivery {
+    TmxBrokerContext *ctx;
+    message::TmxMessage msg;
+};
+
 template <typename _T>
 auto _key() {
     static const typename types::Properties_::key_t _key{ type_short_name<_T>().data() };
@@ -58,6 +95,28 @@ std::shared_ptr<_V> _put(_V *ptr, TmxBrokerContext &ctx) {
     return ctx[_key<_T>()].template emplace<std::shared_ptr<_V> >(ptr);
 }
 
+message::TmxMessage convert(RdKafka::Message &message) {
+    message::TmxMessage msg;
+    msg.set_timepoint(std::chrono::system_clock::time_point(std::chrono::milliseconds(message.timestamp().timestamp)));
+
+    // Convert dots back to slashes
+    typename types::Properties_::key_t nm { message.topic_name() };
+    std::replace(nm.begin(), nm.end(), '.', std::filesystem::path::preferred_separator);
+    msg.set_topic(nm);
+
+    msg.set_payload((const char *)message.payload(), message.len());
+    if (message.headers()) {
+        for (auto header: message.headers()->get("content-type"))
+            msg.get_id().assign((const char *)header.value(), header.value_size());
+        for (auto header: message.headers()->get("content-source"))
+            msg.get_source().assign((const char *)header.value(), header.value_size());
+        for (auto header: message.headers()->get("content-encoding"))
+            msg.get_encoding().assign((const char *)header.value(), header.value_size());
+    }
+
+    return { msg };
+}
+
 TmxKafkaBroker::TmxKafkaBroker() noexcept {
     this->register_broker("kafka");
 }
@@ -190,9 +249,13 @@ void TmxKafkaBroker::initialize(TmxBrokerContext &ctx) noexcept {
     if (!data["global"]["allow.auto.create.topics"])
         data["global"]["allow.auto.create.topics"] = true;
 
-    // ...low latency
+    // ...short batches of compressed messages
     if (!data["global"]["linger.ms"])
-        data["global"]["linger.ms"] = 0;
+        data["global"]["linger.ms"] = TMX_KAFKA_LINGER_MS;
+    if (!data["global"]["batch.num.messages"])
+        data["global"]["batch.num.messages"] = TMX_KAFKA_BATCH_SIZE;
+    if (!data["global"]["compression.type"])
+        data["global"]["compression.type"] = std::string(TMX_KAFKA_COMPRESSION);
 
     for (auto const &kv: data["global"].to_map()) {
         TLOG(DEBUG) << "Setting Global Kafka config " << kv.first << "=" << kv.second;
@@ -214,6 +277,13 @@ void TmxKafkaBroker::destroy(tmx::broker::TmxBrokerContext &ctx) noexcept {
     if (this->is_connected(ctx))
         this->disconnect(ctx);
 
+    // Hand back anything still waiting on a delivery report
+    auto producer = _get<RdKafka::Producer>(ctx);
+    if (producer && producer->outq_len()) {
+        producer->purge(RdKafka::Producer::PURGE_QUEUE | RdKafka::Producer::PURGE_INFLIGHT);
+        producer->poll(0);
+    }
+
     // Delete the remaining Kafka resources
     ctx.erase(_key<RdKafka::Producer>());
     ctx.erase(_key<RdKafka::Conf>());
@@ -228,6 +298,12 @@ void TmxKafkaBroker::disconnect(TmxBrokerContext &ctx) noexcept {
     auto producer = _get<RdKafka::Producer>(ctx);
     if (producer) producer->flush(2500);
 
+    auto drThread = _get<TmxKafkaDeliveryThread, std::thread>(ctx);
+    if (drThread && drThread->joinable())
+        drThread->join();
+
+    ctx.erase(_key<TmxKafkaDeliveryThread>());
+
     auto recvThread = _get<std::thread>(ctx);
     if (recvThread && recvThread->joinable())
         recvThread->join();
@@ -287,6 +363,14 @@ void TmxKafkaBroker::connect(TmxBrokerContext &ctx, const types::Any &params) no
     }
 
     TmxBrokerClient::connect(ctx, params);
+
+    // Serve the delivery reports here so the publisher never has to poll
+    if (this->is_connected(ctx) && !_get<TmxKafkaDeliveryThread, std::thread>(ctx)) {
+        _put<TmxKafkaDeliveryThread>(new std::thread([this, &ctx, producer]() {
+            while (this->is_connected(ctx))
+                producer->poll(TMX_KAFKA_POLL_TIMEOUT_MS);
+        }), ctx);
+    }
 }
 
 void TmxKafkaBroker::publish(TmxBrokerContext &ctx, const message::TmxMessage &msg) noexcept {
@@ -319,17 +403,24 @@ void TmxKafkaBroker::publish(TmxBrokerContext &ctx, const message::TmxMessage &m
 
     TLOG(DEBUG2) << "Producing " << msg.get_length() << " bytes to topic " << topic << ": " << msg.get_payload_string();
 
+    // The payload stays in this copy until the delivery report, so Kafka does not need its own
+    auto delivery = new TmxKafkaDelivery { &ctx, msg };
+    auto payload = delivery->msg.get_payload();
+
+    // Optionally wait for room in the producer queue instead of failing
+    int flags = 0;
+    if (TmxData(ctx.get_parameters())["block-when-full"])
+        flags |= RdKafka::Producer::RK_MSG_BLOCK;
+
     auto tm = std::chrono::duration_cast<std::chrono::milliseconds>(msg.get_timepoint().time_since_epoch());
-    auto ec = producer->produce(topic, RdKafka::Topic::PARTITION_UA, RdKafka::Producer::RK_MSG_COPY,
-                                (void *)msg.get_payload().data(), msg.get_length(), nullptr, 0,
-                                tm.count(), headers, (void *)&ctx);
+    auto ec = producer->produce(topic, RdKafka::Topic::PARTITION_UA, flags,
+                                (void *)payload.data(), payload.length(), nullptr, 0,
+                                tm.count(), headers, (void *)delivery);
     if (ec != RdKafka::ERR_NO_ERROR) {
+        delete headers;
+        delete delivery;
         this->on_published(ctx, { ec, RdKafka::err2str(ec) }, msg);
-        return;
     }
-
-    // Poll the producer to check delivery
-    producer->poll(0);
 }
 
 void TmxKafkaBroker::subscribe(TmxBrokerContext &ctx, const_string topicName, const TmxTypeDescriptor &cb) noexcept {
@@ -398,27 +489,44 @@ void TmxKafkaBroker::subscribe(TmxBrokerContext &ctx, const_string topicName, co
 
     // Start up the consume thread upon the first subscription
     if (!_get<std::thread>(ctx)) {
-        _put<std::thread>(new std::thread([this, &ctx]() {
-            std::size_t cnt = 0;
+        std::size_t batchSize = TMX_KAFKA_CONSUME_BATCH_SIZE;
 
-            while (this->is_connected(ctx)) {
-                auto consumer = _get<RdKafka::KafkaConsumer>(ctx);
-                if (consumer) {
-                    RdKafka::Message *msg = consumer->consume(1);
-                    if (msg) {
-                        // Check for error
-                        if (msg->err()) {
-                            if (msg->err() != RdKafka::ErrorCode::ERR__TIMED_OUT)
-                                this->on_error(ctx, { msg->err(), msg->errstr() });
-                        } else {
-                            this->consume_cb(*msg, &ctx);
-                        }
+        const TmxData params { ctx.get_parameters() };
+        if (params["consume-batch-size"])
+            batchSize = std::max<std::size_t>(params["consume-batch-size"], 1);
+
+        _put<std::thread>(new std::thread([this, &ctx, consumer, batchSize]() {
+            std::vector<TmxMessage> batch;
+            batch.reserve(batchSize);
 
-                        delete msg;
+            while (this->is_connected(ctx)) {
+                // Block for the first message, then take whatever else is already fetched
+                std::unique_ptr<RdKafka::Message> msg { consumer->consume(TMX_KAFKA_POLL_TIMEOUT_MS) };
+                while (msg) {
+                    // Check for error
+                    if (msg->err()) {
+                        if (msg->err() != RdKafka::ErrorCode::ERR__TIMED_OUT)
+                            this->on_error(ctx, { msg->err(), msg->errstr() });
+
+                        break;
                     }
+
+                    if (msg->len())
+                        batch.push_back(convert(*msg));
+
+                    if (batch.size() >= batchSize)
+                        break;
+
+                    msg.reset(consumer->consume(0));
                 }
 
-                std::this_thread::sleep_for(std::chrono::microseconds(10));
+                if (batch.size()) {
+                    TLOG(DEBUG2) << this->get_descriptor().get_type_name() << ": Received " << batch.size()
+                                 << " messages on channel " << ctx.get_id();
+
+                    this->callback(ctx.get_id(), batch);
+                    batch.clear();
+                }
             }
         }), ctx);
     }
@@ -486,34 +594,10 @@ void TmxKafkaBroker::event_cb(RdKafka::Event &event) {
 	}
 }
 
-message::TmxMessage convert(RdKafka::Message &message) {
-    message::TmxMessage msg;
-    msg.set_timepoint(std::chrono::system_clock::time_point(std::chrono::milliseconds(message.timestamp().timestamp)));
-
-    // Convert dots back to slashes
-    typename types::Properties_::key_t nm { message.topic_name() };
-    std::replace(nm.begin(), nm.end(), '.', std::filesystem::path::preferred_separator);
-    msg.set_topic(nm);
-
-    msg.set_payload((const char *)message.payload(), message.len());
-    if (message.headers()) {
-        for (auto header: message.headers()->get("content-type"))
-            msg.get_id().assign((const char *)header.value(), header.value_size());
-        for (auto header: message.headers()->get("content-source"))
-            msg.get_source().assign((const char *)header.value(), header.value_size());
-        for (auto header: message.headers()->get("content-encoding"))
-            msg.get_encoding().assign((const char *)header.value(), header.value_size());
-    }
-
-    return { msg };
-}
-
 void TmxKafkaBroker::dr_cb(RdKafka::Message &message) {
-	TmxBrokerContext *ctx = (TmxBrokerContext *)message.msg_opaque();
-	if (ctx) {
-        auto data = to_byte_sequence((byte_t *)message.payload(), message.len());
-        this->on_published(*ctx, { message.err(), message.errstr() }, convert(message));
-	}
+    std::unique_ptr<TmxKafkaDelivery> delivery { (TmxKafkaDelivery *)message.msg_opaque() };
+    if (delivery && delivery->ctx)
+        this->on_published(*delivery->ctx, { message.err(), message.errstr() }, delivery->msg);
 }
 
 void TmxKafkaBroker::consume_cb(RdKafka::Message &message, void *opaque) {
@@ -0,0 +1,165 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxKafkaBroker_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/broker/TmxBrokerClient.hpp>
+#include <tmx/broker/TmxBrokerContext.hpp>
+#include <tmx/common/TmxFunctor.hpp>
+#include <tmx/common/TmxTypeRegistrar.hpp>
+#include <tmx/message/TmxData.hpp>
+#include <tmx/message/TmxMessage.hpp>
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <thread>
+
+using namespace tmx::common;
+using namespace tmx::message;
+
+namespace tmx {
+namespace broker {
+namespace apache {
+namespace kafka {
+namespace test {
+
+#define BENCH_DEFAULT_BROKER "localhost:9092"
+#define BENCH_MESSAGE_SIZE 200
+#define BENCH_MESSAGE_COUNT 200000
+#define BENCH_TIMEOUT_S 60
+
+/*!
+ * @return The single-node broker to run against, from TMX_KAFKA_TEST_BROKER if set
+ */
+static std::string get_test_broker() {
+    auto env = std::getenv("TMX_KAFKA_TEST_BROKER");
+    return env && *env ? env : BENCH_DEFAULT_BROKER;
+}
+
+/*!
+ * @brief Only run when there is something listening at the test broker address
+ */
+static boost::test_tools::assertion_result broker_available(boost::unit_test::test_unit_id) {
+    auto broker = get_test_broker();
+    auto sep = broker.rfind(':');
+
+    boost::asio::io_context io;
+    boost::asio::ip::tcp::resolver resolver { io };
+    boost::asio::ip::tcp::socket socket { io };
+
+    boost::system::error_code ec;
+    auto endpoints = resolver.resolve(broker.substr(0, sep), sep == std::string::npos ? "9092" : broker.substr(sep + 1), ec);
+    if (!ec)
+        boost::asio::connect(socket, endpoints, ec);
+
+    boost::test_tools::assertion_result result { !ec };
+    if (ec)
+        result.message() << "No Kafka broker at " << broker << ": " << ec.message();
+
+    return result;
+}
+
+template <typename _Pred, typename _Duration = std::chrono::seconds>
+bool wait_for(_Pred &&pred, _Duration timeout = std::chrono::seconds(5)) {
+    auto end = std::chrono::steady_clock::now() + timeout;
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > end)
+            return false;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return true;
+}
+
+static std::atomic<std::size_t> _received { 0 };
+
+class TestMessageCounter: public TmxFunctor<types::Any const &, TmxMessage const &> {
+public:
+    TmxError execute(types::Any const &, TmxMessage const &) const override {
+        _received++;
+        return { };
+    }
+};
+
+static TmxTypeRegistrar<TestMessageCounter> _counter;
+
+BOOST_AUTO_TEST_SUITE(kafka_broker_test_suite)
+
+BOOST_AUTO_TEST_CASE(local_broker_throughput, *boost::unit_test::precondition(broker_available)) {
+    // A new topic and consumer group every run, so the consumer reads only this run from the start
+    auto run = std::to_string(std::chrono::system_clock::now().time_since_epoch().count());
+
+    TmxBrokerContext client { "kafka://" + get_test_broker(), "kafka-bench-" + run, TmxData(types::Any()) };
+    TmxData params { client.get_parameters() };
+    params["global"]["auto.offset.reset"] = std::string("earliest");
+    params["block-when-full"] = true;
+
+    auto broker = TmxBrokerClient::get_broker(client);
+    BOOST_REQUIRE(broker);
+
+    broker->initialize(client);
+    broker->connect(client);
+    BOOST_REQUIRE(wait_for([&client]() { return client.get_state() >= TmxBrokerState::connected; }));
+
+    TmxMessage msg;
+    msg.set_topic("Bench/Kafka/" + run);
+    msg.set_payload(std::string(BENCH_MESSAGE_SIZE, '\x5A'));
+
+    _received = 0;
+
+    auto cpuStart = std::clock();
+    auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < BENCH_MESSAGE_COUNT; i++)
+        broker->publish(client, msg);
+
+    auto produced = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto producedCpu = (double)(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+    BOOST_TEST_MESSAGE("Produced " << BENCH_MESSAGE_COUNT << " messages of " << BENCH_MESSAGE_SIZE <<
+                       " bytes in " << produced << "s: " << (std::size_t)(BENCH_MESSAGE_COUNT / produced) <<
+                       " messages/s, " << producedCpu * 1e6 / BENCH_MESSAGE_COUNT << "us CPU/message");
+
+    cpuStart = std::clock();
+    start = std::chrono::steady_clock::now();
+
+    broker->subscribe(client, msg.get_topic(), _counter.descriptor());
+    wait_for([]() { return _received >= BENCH_MESSAGE_COUNT; }, std::chrono::seconds(BENCH_TIMEOUT_S));
+
+    auto consumed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto consumedCpu = (double)(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+    std::size_t received = _received;
+
+    BOOST_TEST_MESSAGE("Consumed " << received << " messages in " << consumed << "s, including the group join: " <<
+                       (std::size_t)(received / consumed) << " messages/s, " <<
+                       (received ? consumedCpu * 1e6 / received : 0.0) << "us CPU/message");
+
+    BOOST_CHECK_EQUAL(received, BENCH_MESSAGE_COUNT);
+
+    broker->unsubscribe(client, msg.get_topic(), _counter.descriptor());
+    broker->disconnect(client);
+    broker->destroy(client);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} /* End namespace test */
+} /* End namespace kafka */
+} /* End namespace apache */
+} /* End namespace broker */
+} /* End namespace tmx */
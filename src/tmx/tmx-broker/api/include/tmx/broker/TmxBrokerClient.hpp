@@ -25,6 +25,7 @@
 
 #include <atomic>
 #include <memory>
+#include <vector>
 
 namespace tmx {
 namespace broker {
@@ -258,6 +259,17 @@ public:
      */
     virtual void callback(common::const_string id, message::TmxMessage const &message) noexcept;
 
+    /*!
+     * @brief Execute the callbacks registered in the context for a batch of messages
+     *
+     * The registered callbacks are looked up once for each run of messages
+     * on the same topic, and then invoked for each message in order.
+     *
+     * @param[in] id The context id
+     * @param[in] messages The messages to send
+     */
+    virtual void callback(common::const_string id, std::vector<message::TmxMessage> const &messages) noexcept;
+
 protected:
 	/*!
 	 * @brief The default constructor
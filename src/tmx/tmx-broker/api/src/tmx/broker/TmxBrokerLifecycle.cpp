@@ -118,5 +118,43 @@ void TmxBrokerClient::callback(const_string id, const message::TmxMessage &messa
     }
 }
 
+void TmxBrokerClient::callback(const_string id, std::vector<message::TmxMessage> const &messages) noexcept {
+    TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION << " on context " << id << " with " << messages.size() << " messages";
+
+    static TmxBrokerContext _error_context;
+
+    auto ctx = this->get_context(id);
+    const types::Any _id { std::string(id.data()) };
+
+    std::vector<TmxTypeDescriptor> callbacks;
+    for (std::size_t i = 0; i < messages.size(); ) {
+        auto const &topic = messages[i].get_topic();
+
+        std::size_t end = i + 1;
+        while (end < messages.size() && messages[end].get_topic() == topic)
+            end++;
+
+        // Only look up the callbacks once for the whole run
+        TmxTypeRegistry const &_reg = callback_registry(id, topic);
+        callbacks.clear();
+        for (const auto &cb: _reg.get_all()) {
+            // Do not include entries from other namespaces, i.e. topics
+            if (cb.get_type_namespace() == _reg.get_namespace())
+                callbacks.push_back(cb);
+        }
+
+        TLOG(DEBUG2) << this->get_descriptor().get_type_name() << ": Invoking " << callbacks.size()
+                     << " callbacks for " << (end - i) << " incoming messages on topic " << topic;
+
+        for (; i < end; i++) {
+            for (const auto &cb: callbacks) {
+                auto ret = common::dispatch(cb, _id, messages[i]);
+                if (ret)
+                    this->on_error(ctx ? *ctx : _error_context, ret, false);
+            }
+        }
+    }
+}
+
 } /* End namespace broker */
 } /* End namespace tmx */
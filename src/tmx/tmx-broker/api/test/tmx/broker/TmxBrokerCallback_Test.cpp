@@ -0,0 +1,105 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxBrokerCallback_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/broker/TmxBrokerClient.hpp>
+#include <tmx/broker/TmxBrokerContext.hpp>
+#include <tmx/common/TmxFunctor.hpp>
+#include <tmx/common/TmxTypeRegistrar.hpp>
+#include <tmx/message/TmxMessage.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace tmx::common;
+using namespace tmx::message;
+
+namespace tmx {
+namespace broker {
+namespace test {
+
+typedef typename TmxFunctor<types::Any const &, TmxMessage const &>::type::type cb_type;
+
+static std::vector<std::string> _received;
+
+class TestMessageRecorder: public TmxFunctor<types::Any const &, TmxMessage const &> {
+public:
+    TmxError execute(types::Any const &, TmxMessage const &msg) const override {
+        _received.push_back(msg.get_topic() + ":" + msg.get_payload_string());
+        return { };
+    }
+};
+
+static TmxTypeRegistrar<TestMessageRecorder> _recorder;
+
+/*!
+ * @brief A broker that only keeps track of the subscriptions
+ */
+class TestCallbackBrokerClient: public TmxBrokerClient {
+public:
+    void subscribe(TmxBrokerContext &ctx, const_string topic, TmxTypeDescriptor const &cb) noexcept override {
+        auto callback = cb.as_instance<cb_type>();
+        if (callback)
+            callback_registry(ctx.get_id(), topic).register_handler(*callback, cb.get_typeid(), cb.get_type_short_name());
+    }
+
+    void unsubscribe(TmxBrokerContext &ctx, const_string topic, TmxTypeDescriptor const &cb) noexcept override {
+        callback_registry(ctx.get_id(), topic).unregister(cb.get_typeid());
+    }
+};
+
+static TmxMessage make_message(std::string const &topic, std::string const &payload) {
+    TmxMessage msg;
+    msg.set_topic(topic);
+    msg.set_payload(payload);
+    return msg;
+}
+
+BOOST_AUTO_TEST_SUITE(broker_callback_test_suite)
+
+BOOST_AUTO_TEST_CASE(batch_matches_single) {
+    TestCallbackBrokerClient client;
+    TmxBrokerContext ctx { "test://localhost", "callback-test" };
+
+    client.subscribe(ctx, "A", _recorder.descriptor());
+    client.subscribe(ctx, "B", _recorder.descriptor());
+
+    // Topic C has no subscribers, and topic A comes back after B
+    const std::vector<TmxMessage> batch {
+        make_message("A", "1"), make_message("A", "2"), make_message("B", "1"),
+        make_message("C", "1"), make_message("A", "3")
+    };
+
+    const std::vector<std::string> expected { "A:1", "A:2", "B:1", "A:3" };
+
+    _received.clear();
+    client.callback(ctx.get_id(), batch);
+    BOOST_CHECK_EQUAL_COLLECTIONS(_received.begin(), _received.end(), expected.begin(), expected.end());
+
+    _received.clear();
+    for (auto const &msg: batch)
+        client.callback(ctx.get_id(), msg);
+    BOOST_CHECK_EQUAL_COLLECTIONS(_received.begin(), _received.end(), expected.begin(), expected.end());
+
+    _received.clear();
+    client.callback(ctx.get_id(), std::vector<TmxMessage> { });
+    BOOST_CHECK(_received.empty());
+
+    client.unsubscribe(ctx, "A", _recorder.descriptor());
+    client.unsubscribe(ctx, "B", _recorder.descriptor());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} /* End namespace test */
+} /* End namespace broker */
+} /* End namespace tmx */
@@ -32,6 +32,12 @@ class TmxAsynchronousIOBrokerClient: public TmxBrokerClient {
 public:
     virtual ~TmxAsynchronousIOBrokerClient() = default;
 
+    /*!
+     * @brief Resolve the context parameters that are used on every message
+     */
+    virtual void initialize(TmxBrokerContext &) noexcept override;
+    virtual void destroy(TmxBrokerContext &) noexcept override;
+
     virtual void subscribe(TmxBrokerContext &, common::const_string,
                            common::TmxTypeDescriptor const &) noexcept override;
     virtual void unsubscribe(TmxBrokerContext &, common::const_string,
@@ -63,6 +69,31 @@ protected:
     virtual common::TmxError to_message(boost::asio::const_buffer const &,
                                         TmxBrokerContext &ctx, message::TmxMessage &) const noexcept;
 
+    /*!
+     * @brief Write the TmxMessage to the outgoing bytes
+     *
+     * By default, only the payload bytes are written, since the device
+     * on the other end is typically not a TMX component. However, if the
+     * "binary-frame" parameter is set when the broker context is initialized, then the
+     * complete message is written as a binary TMX frame, which is read
+     * back in by to_message() without any guessing or re-encoding of the
+     * payload. All integers in the frame are in network byte order:
+     *
+     * | Preamble (2) | Frame length (4) | Metadata (8) | Timestamp (8) |
+     * | Id length (2) | Id | Topic length (2) | Topic |
+     * | Source length (2) | Source | Encoding length (2) | Encoding |
+     * | Payload length (4) | Payload bytes |
+     *
+     * The frame length counts all the bytes that follow it.
+     *
+     * @param[in] msg The message to write
+     * @param[in] ctx The TMX broker context
+     * @param[out] bytes The bytes to write to the I/O device
+     * @return Any errors that occurred during the operation
+     */
+    virtual common::TmxError from_message(message::TmxMessage const &, TmxBrokerContext &ctx,
+                                          std::basic_string<common::byte_t> &) const noexcept;
+
     /*!
      * @param[in] ctx The TMX broker context
      * @return The thread pool to use for this broker context
@@ -124,6 +155,19 @@ protected:
      */
     virtual void on_read(boost::system::error_code const &, std::size_t,
                          std::shared_ptr<boost::asio::streambuf>, std::reference_wrapper<TmxBrokerContext>) noexcept;
+
+    /*!
+     * @brief A handler for a complete set of bytes read in
+     *
+     * By default, this function converts the bytes to a TmxMessage
+     * and executes the callbacks. This is used by on_read(), but can
+     * also be used directly for reads that do not use a stream buffer,
+     * such as a batch of datagrams.
+     *
+     * @param[in] buf The bytes read in
+     * @param[in] ctx The TMX context to use
+     */
+    virtual void on_data(boost::asio::const_buffer const &, std::reference_wrapper<TmxBrokerContext>) noexcept;
 };
 
 } /* End namespace async */
@@ -16,6 +16,7 @@
 #include <boost/asio.hpp>
 #include <chrono>
 #include <future>
+#include <limits>
 #include <thread>
 
 using namespace tmx::common;
@@ -26,8 +27,97 @@ namespace tmx {
 namespace broker {
 namespace async {
 
+/*!
+ * @brief The context parameters used on every message, resolved once at initialize
+ */
+struct TmxAsynchronousIOParameters {
+    bool binaryFrame = false;
+};
+
+static typename types::Properties_::key_t _params { type_short_name<TmxAsynchronousIOParameters>().data() };
+
 typedef typename common::TmxFunctor<common::types::Any const &, message::TmxMessage const &>::type::type cb_type;
 
+// Helper functions for the binary TMX frame, which always uses network byte order
+
+template <typename _T>
+static void put_frame_value(std::basic_string<byte_t> &bytes, _T value) {
+    for (std::size_t i = sizeof(_T); i > 0; i--)
+        bytes.push_back(static_cast<byte_t>(value >> ((i - 1) * 8)));
+}
+
+template <typename _T>
+static bool get_frame_value(byte_sequence &bytes, _T &value) {
+    if (bytes.length() < sizeof(_T))
+        return false;
+
+    value = 0;
+    for (std::size_t i = 0; i < sizeof(_T); i++)
+        value = static_cast<_T>((value << 8) | std::to_integer<_T>(bytes[i]));
+
+    bytes.remove_prefix(sizeof(_T));
+    return true;
+}
+
+template <typename _T>
+static bool put_frame_bytes(std::basic_string<byte_t> &bytes, byte_sequence const &value) {
+    if (value.length() > std::numeric_limits<_T>::max())
+        return false;
+
+    put_frame_value(bytes, static_cast<_T>(value.length()));
+    bytes.append(value.data(), value.length());
+    return true;
+}
+
+template <typename _T>
+static bool get_frame_bytes(byte_sequence &bytes, byte_sequence &value) {
+    _T len;
+    if (!get_frame_value(bytes, len) || bytes.length() < len)
+        return false;
+
+    value = bytes.substr(0, len);
+    bytes.remove_prefix(len);
+    return true;
+}
+
+static inline byte_sequence frame_bytes_of(std::string const &str) {
+    return to_byte_sequence(str.data(), str.length());
+}
+
+static inline std::string frame_string_of(byte_sequence const &bytes) {
+    return { reinterpret_cast<const char *>(bytes.data()), bytes.length() };
+}
+
+static TmxError decode_frame(byte_sequence bytes, codec::TmxCodec &codec) {
+    static const TmxError _bad_frame { EBADMSG, "Invalid binary TMX frame" };
+
+    std::uint16_t preamble;
+    std::uint32_t frameLen;
+    if (!get_frame_value(bytes, preamble) || preamble != TmxMessage::get_preamble() ||
+            !get_frame_value(bytes, frameLen) || frameLen != bytes.length())
+        return _bad_frame;
+
+    std::uint64_t metadata, timestamp;
+    byte_sequence id, topic, source, encoding, payload;
+    if (!get_frame_value(bytes, metadata) || !get_frame_value(bytes, timestamp) ||
+            !get_frame_bytes<std::uint16_t>(bytes, id) || !get_frame_bytes<std::uint16_t>(bytes, topic) ||
+            !get_frame_bytes<std::uint16_t>(bytes, source) || !get_frame_bytes<std::uint16_t>(bytes, encoding) ||
+            !get_frame_bytes<std::uint32_t>(bytes, payload) || !bytes.empty())
+        return _bad_frame;
+
+    auto &msg = codec.get_message();
+    msg.set_metadata(metadata);
+    msg.set_timestamp(timestamp);
+    msg.set_id(frame_string_of(id));
+    msg.set_topic(frame_string_of(topic));
+    msg.set_source(frame_string_of(source));
+    msg.set_encoding(frame_string_of(encoding));
+
+    // Payload bytes must be written after the encoding and base are known
+    codec.set_payload_bytes(payload);
+    return { };
+}
+
 void TmxAsynchronousIOBrokerClient::on_read(boost::system::error_code const &ec, std::size_t bytes,
                                             std::shared_ptr<boost::asio::streambuf> buffer,
                                             std::reference_wrapper<TmxBrokerContext> ctx) noexcept {
@@ -46,23 +136,26 @@ void TmxAsynchronousIOBrokerClient::on_read(boost::system::error_code const &ec,
     if (buffer && bytes) {
         buffer->commit(bytes);
 
-        TmxMessage msg;
-        msg.set_topic("UNKNOWN");
-        msg.set_timepoint();
-
-        boost::asio::const_buffer _tmp { buffer->data().data(), bytes };
-
-        auto err = this->to_message(_tmp, ctx.get(), msg);
-        if (err)
-            this->on_error(ctx, err);
+        this->on_data({ buffer->data().data(), bytes }, ctx);
 
         // Clear the buffer
         buffer->consume(bytes);
-
-        this->callback(ctx.get().get_id(), msg);
     }
 }
 
+void TmxAsynchronousIOBrokerClient::on_data(boost::asio::const_buffer const &buf,
+                                            std::reference_wrapper<TmxBrokerContext> ctx) noexcept {
+    TmxMessage msg;
+    msg.set_topic("UNKNOWN");
+    msg.set_timepoint();
+
+    auto err = this->to_message(buf, ctx.get(), msg);
+    if (err)
+        this->on_error(ctx, err);
+
+    this->callback(ctx.get().get_id(), msg);
+}
+
 void TmxAsynchronousIOBrokerClient::on_write(boost::system::error_code const &ec, std::size_t bytes,
                                              std::reference_wrapper<TmxBrokerContext> ctx, TmxMessage const &msg) noexcept {
     TLOG(DEBUG1) << ctx.get().get_id() << ": " << bytes << " data bytes written to the I/O device.";
@@ -70,6 +163,20 @@ void TmxAsynchronousIOBrokerClient::on_write(boost::system::error_code const &ec
     this->on_published(ctx.get(), { ec.value(), ec.message() }, msg);
 }
 
+void TmxAsynchronousIOBrokerClient::initialize(TmxBrokerContext &ctx) noexcept {
+    auto &params = ctx[_params].emplace<TmxAsynchronousIOParameters>();
+
+    const TmxData data { ctx.get_parameters() };
+    params.binaryFrame = data["binary-frame"].to_bool();
+
+    TmxBrokerClient::initialize(ctx);
+}
+
+void TmxAsynchronousIOBrokerClient::destroy(TmxBrokerContext &ctx) noexcept {
+    ctx.erase(_params);
+    TmxBrokerClient::destroy(ctx);
+}
+
 void TmxAsynchronousIOBrokerClient::subscribe(TmxBrokerContext &ctx, common::const_string topic,
                                               TmxTypeDescriptor const &cb) noexcept {
     if (!cb) {
@@ -141,14 +248,30 @@ TmxError TmxAsynchronousIOBrokerClient::to_message(boost::asio::const_buffer con
 
     TLOG(DEBUG2) << "Incoming: " << byte_string_encode(to_byte_sequence(incoming));
 
+    static auto preamble = message::TmxMessage::get_preamble();
+
+    // A complete binary TMX frame needs no further inspection
+    auto raw = to_byte_sequence((const byte_t *)buf.data(), buf.size());
+    if (raw.length() > byte_size_of<decltype(preamble)>() &&
+            get_value<decltype(preamble)>(raw.substr(0, byte_size_of<decltype(preamble)>())) == preamble) {
+        codec::TmxCodec frame;
+        auto err = decode_frame(raw, frame);
+        if (!err) {
+            TLOG(DEBUG2) << "Received TMX frame: " << frame.get_message().to_string();
+
+            msg = frame.get_message();
+            return { };
+        }
+
+        TLOG(DEBUG2) << err.get_message() << ". Assuming the bytes are all payload.";
+    }
+
     // Do a quick trim of white space characters
     auto data = types::String_(incoming).trim();
 
     codec::TmxCodec codec;
     message::TmxData decoded;
 
-    static auto preamble = message::TmxMessage::get_preamble();
-
     codec.get_message().set_source(ctx.get_id());
     codec.get_message().set_payload(data);
 
@@ -179,47 +302,78 @@ TmxError TmxAsynchronousIOBrokerClient::to_message(boost::asio::const_buffer con
         return { };
     }
 
-    if (preamble == get_value<decltype(preamble)>(data.substr(0, byte_size_of<decltype(preamble)>()).data())) {
-        // TODO: Chunk off each string and set to the message
-        return { ENOTSUP, "No support yet for binary TMX message" };
-    } else {
-        TLOG(DEBUG3) << "Scanning for non-printable characters";
-
-        // Scan for non-printable characters
-        std::size_t i;
-        for (i = 0; i < data.size(); i++) {
-           auto chk = std::find(non_printable_characters::array.begin(),
-                                           non_printable_characters::array.end(), data[i]);
-           if (chk != non_printable_characters::array.end()) {
-               // Make sure it is not a white space character also
-               chk = std::find(whitespace_characters::array.begin(), whitespace_characters::array.end(), data[i]);
-               if (chk == whitespace_characters::array.end()) {
-                   TLOG(DEBUG2) << "Found non-printable character " << (int) data[i] << " at position " << i;
-                   break;
-               }
+    TLOG(DEBUG3) << "Scanning for non-printable characters";
+
+    // Scan for non-printable characters
+    std::size_t i;
+    for (i = 0; i < data.size(); i++) {
+       auto chk = std::find(non_printable_characters::array.begin(),
+                                       non_printable_characters::array.end(), data[i]);
+       if (chk != non_printable_characters::array.end()) {
+           // Make sure it is not a white space character also
+           chk = std::find(whitespace_characters::array.begin(), whitespace_characters::array.end(), data[i]);
+           if (chk == whitespace_characters::array.end()) {
+               TLOG(DEBUG2) << "Found non-printable character " << (int) data[i] << " at position " << i;
+               break;
            }
-        }
+       }
+    }
+
+    if (i >= data.size()) {
+        // This is a string payload
+        codec.get_message().set_encoding("string");
+    } else {
+        auto bytes = to_byte_sequence(incoming.begin(), incoming.length());
 
-        if (i >= data.size()) {
-            // This is a string payload
-            codec.get_message().set_encoding("string");
+        // This is a binary payload so encode the bytes
+        if TMX_CONSTEXPR_FN (decltype(TMX_DEFAULT_BYTE_ENCODING)::size >= 16) {
+            codec.get_message().set_base(decltype(TMX_DEFAULT_BYTE_ENCODING)::size);
+            codec.get_message().set_payload(byte_string_encode(bytes));
         } else {
-            auto bytes = to_byte_sequence(incoming.begin(), incoming.length());
-
-            // This is a binary payload so encode the bytes
-            if TMX_CONSTEXPR_FN (decltype(TMX_DEFAULT_BYTE_ENCODING)::size >= 16) {
-                codec.get_message().set_base(decltype(TMX_DEFAULT_BYTE_ENCODING)::size);
-                codec.get_message().set_payload(byte_string_encode(bytes));
-            } else {
-                codec.get_message().set_base(16);
-                codec.get_message().set_payload(byte_string_encode(bytes, hexadecimal::value));
-            }
+            codec.get_message().set_base(16);
+            codec.get_message().set_payload(byte_string_encode(bytes, hexadecimal::value));
         }
+    }
 
-        msg = codec.get_message();
+    msg = codec.get_message();
+    return { };
+}
+
+TmxError TmxAsynchronousIOBrokerClient::from_message(message::TmxMessage const &msg, TmxBrokerContext &ctx,
+                                                     std::basic_string<byte_t> &bytes) const noexcept {
+    codec::TmxCodec codec { msg };
+    auto payload = codec.get_payload_bytes();
+
+    std::shared_ptr<TmxAsynchronousIOParameters> params;
+    if (ctx.count(_params))
+        params = types::as<TmxAsynchronousIOParameters>(ctx.at(_params));
+
+    if (!params || !params->binaryFrame) {
+        bytes = std::move(payload);
         return { };
     }
 
+    bytes.clear();
+    bytes.reserve(payload.length() + msg.get_id().length() + msg.get_topic().length() +
+                  msg.get_source().length() + msg.get_encoding().length() + 36);
+
+    put_frame_value(bytes, message::TmxMessage::get_preamble());
+
+    // Fill in the length at the end
+    put_frame_value(bytes, (std::uint32_t)0);
+
+    put_frame_value(bytes, (std::uint64_t)msg.get_metadata());
+    put_frame_value(bytes, (std::uint64_t)msg.get_timestamp());
+    if (!put_frame_bytes<std::uint16_t>(bytes, frame_bytes_of(msg.get_id())) ||
+            !put_frame_bytes<std::uint16_t>(bytes, frame_bytes_of(msg.get_topic())) ||
+            !put_frame_bytes<std::uint16_t>(bytes, frame_bytes_of(msg.get_source())) ||
+            !put_frame_bytes<std::uint16_t>(bytes, frame_bytes_of(msg.get_encoding())) ||
+            !put_frame_bytes<std::uint32_t>(bytes, to_byte_sequence(payload.data(), payload.length())))
+        return { EMSGSIZE, "Message is too large for a binary TMX frame" };
+
+    std::basic_string<byte_t> len;
+    put_frame_value(len, (std::uint32_t)(bytes.length() - 6));
+    bytes.replace(2, len.length(), len);
     return { };
 }
 
@@ -13,11 +13,27 @@
 #include <tmx/common/TmxLogger.hpp>
 #include <tmx/message/codec/TmxCodec.hpp>
 
+#include <cerrno>
 #include <ctime>
 #include <iomanip>
+#include <memory>
+#include <mutex>
 #include <regex>
 #include <sstream>
 #include <thread>
+#include <utility>
+#include <vector>
+
+#include <sys/socket.h>
+
+#ifndef TMX_UDP_BATCH_SIZE
+#define TMX_UDP_BATCH_SIZE 32
+#endif
+
+// The largest datagram read in a batch, unless the "udp-max-datagram" parameter is set
+#ifndef TMX_UDP_MAX_DATAGRAM
+#define TMX_UDP_MAX_DATAGRAM 65535
+#endif
 
 using namespace tmx::common;
 using namespace tmx::message;
@@ -29,6 +45,192 @@ namespace async {
 
 static auto _conn_reset = boost::system::errc::make_error_code(boost::system::errc::errc_t::connection_reset);
 
+/*!
+ * @brief A set of reusable buffers for batched datagram reads and writes
+ *
+ * A busy socket can have many datagrams waiting at each wakeup, so this
+ * drains up to a full batch at once into a fixed pool of buffers that is
+ * allocated only one time. Each buffer holds the largest datagram that is
+ * expected, and a longer datagram is flagged as truncated. Outgoing
+ * datagrams are queued up and written out together. On Linux, each batch
+ * is a single recvmmsg() or sendmmsg() system call. Otherwise, the
+ * datagrams are transferred one at a time until the socket would block.
+ *
+ * The receive() and send() functions must only be invoked from the
+ * socket strand, but datagrams may be queued from any thread.
+ */
+class TmxDatagramBatch {
+public:
+    typedef std::basic_string<byte_t> bytes_type;
+    typedef std::pair<std::shared_ptr<bytes_type>, TmxMessage> outgoing_type;
+
+    TmxDatagramBatch(std::size_t size, std::size_t maxDatagram):
+            _size(size ? size : 1), _maxDatagram(maxDatagram ? maxDatagram : 1),
+            _data(new byte_t[_size * _maxDatagram]), _lengths(_size, 0), _truncated(_size, false) {
+#ifdef __linux__
+        _iov.resize(_size);
+        _hdr.resize(_size);
+#endif
+    }
+
+    /*!
+     * @return The maximum number of datagrams in a batch
+     */
+    std::size_t size() const noexcept {
+        return _size;
+    }
+
+    /*!
+     * @param[in] i The datagram number in the last batch received
+     * @return The bytes of that datagram
+     */
+    boost::asio::const_buffer datagram(std::size_t i) const noexcept {
+        return { _data.get() + i * _maxDatagram, _lengths[i] };
+    }
+
+    /*!
+     * @param[in] i The datagram number in the last batch received
+     * @return True if that datagram did not fit in its buffer
+     */
+    bool truncated(std::size_t i) const noexcept {
+        return _truncated[i];
+    }
+
+    /*!
+     * @brief Read in as many datagrams as possible without blocking
+     *
+     * @param[in] fd The native socket handle
+     * @return The number of datagrams received, or -1 on error with errno set
+     */
+    int receive(int fd) noexcept {
+#ifdef __linux__
+        for (std::size_t i = 0; i < _size; i++) {
+            _iov[i].iov_base = _data.get() + i * _maxDatagram;
+            _iov[i].iov_len = _maxDatagram;
+            _hdr[i].msg_hdr = { };
+            _hdr[i].msg_hdr.msg_iov = &_iov[i];
+            _hdr[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        int cnt = ::recvmmsg(fd, _hdr.data(), _size, MSG_DONTWAIT, nullptr);
+        for (int i = 0; i < cnt; i++) {
+            _lengths[i] = _hdr[i].msg_len;
+            _truncated[i] = _hdr[i].msg_hdr.msg_flags & MSG_TRUNC;
+        }
+
+        return cnt;
+#else
+        std::size_t cnt;
+        for (cnt = 0; cnt < _size; cnt++) {
+            // A plain recv() can not tell if the datagram was cut short
+            auto len = ::recv(fd, _data.get() + cnt * _maxDatagram, _maxDatagram, MSG_DONTWAIT);
+            if (len < 0)
+                return cnt ? (int)cnt : -1;
+
+            _lengths[cnt] = len;
+            _truncated[cnt] = false;
+        }
+
+        return cnt;
+#endif
+    }
+
+    /*!
+     * @brief Queue up a datagram to write
+     *
+     * @param[in] bytes The bytes of the datagram
+     * @param[in] msg The message the datagram came from
+     * @return True if a send must be scheduled for this batch
+     */
+    bool enqueue(std::shared_ptr<bytes_type> bytes, TmxMessage const &msg) noexcept {
+        std::lock_guard<std::mutex> lock(_lock);
+        _outgoing.emplace_back(std::move(bytes), msg);
+
+        bool wasScheduled = _scheduled;
+        _scheduled = true;
+        return !wasScheduled;
+    }
+
+    /*!
+     * @brief Take all the queued datagrams to write
+     *
+     * The send stays scheduled until finish() finds nothing more queued,
+     * so that only one writer is ever working on this batch.
+     *
+     * @param[out] out The list to fill with the queued datagrams
+     */
+    void dequeue(std::vector<outgoing_type> &out) noexcept {
+        std::lock_guard<std::mutex> lock(_lock);
+        out.clear();
+        out.swap(_outgoing);
+    }
+
+    /*!
+     * @brief Complete the scheduled send if there is nothing more to write
+     *
+     * Any datagram queued after this returns true schedules a new send.
+     *
+     * @return True if the send is done, or false if more datagrams were queued
+     */
+    bool finish() noexcept {
+        std::lock_guard<std::mutex> lock(_lock);
+        if (!_outgoing.empty())
+            return false;
+
+        _scheduled = false;
+        return true;
+    }
+
+    /*!
+     * @brief Write as many of the datagrams as possible without blocking
+     *
+     * @param[in] fd The native socket handle
+     * @param[in] out The datagrams to write
+     * @param[in] offset The first datagram to write
+     * @return The number of datagrams written, or -1 on error with errno set
+     */
+    int send(int fd, std::vector<outgoing_type> const &out, std::size_t offset) noexcept {
+        std::size_t cnt = std::min(out.size() - offset, _size);
+#ifdef __linux__
+        for (std::size_t i = 0; i < cnt; i++) {
+            auto &bytes = *(out[offset + i].first);
+            _iov[i].iov_base = const_cast<byte_t *>(bytes.data());
+            _iov[i].iov_len = bytes.length();
+            _hdr[i].msg_hdr = { };
+            _hdr[i].msg_hdr.msg_iov = &_iov[i];
+            _hdr[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        return ::sendmmsg(fd, _hdr.data(), cnt, MSG_DONTWAIT);
+#else
+        std::size_t i;
+        for (i = 0; i < cnt; i++) {
+            auto &bytes = *(out[offset + i].first);
+            if (::send(fd, bytes.data(), bytes.length(), MSG_DONTWAIT) < 0)
+                return i ? (int)i : -1;
+        }
+
+        return i;
+#endif
+    }
+
+private:
+    std::size_t _size;
+    std::size_t _maxDatagram;
+    std::unique_ptr<byte_t[]> _data;
+    std::vector<std::size_t> _lengths;
+    std::vector<bool> _truncated;
+
+#ifdef __linux__
+    std::vector<struct iovec> _iov;
+    std::vector<struct mmsghdr> _hdr;
+#endif
+
+    std::mutex _lock;
+    std::vector<outgoing_type> _outgoing;
+    bool _scheduled = false;
+};
+
 /*!
  * @brief A broker that bridges generic socket input/output to TMX messages
  *
@@ -52,6 +254,7 @@ public:
 
     typename types::Properties_::key_t _sock { type_short_name<socket>().data() };
     typename types::Properties_::key_t _buffer { type_short_name<streambuf>().data() };
+    typename types::Properties_::key_t _batch { type_short_name<TmxDatagramBatch>().data() };
 
     TmxAsynchronousSocketBridge() {
         std::string ip = type_short_name<ip_type>().data();
@@ -113,6 +316,21 @@ public:
 
         // Add a socket to use, with a strand for synchronizing when necessary
         ctx[_sock].emplace<std::shared_ptr<socket> >(new socket(this->make_strand(ctx)));
+
+        // Datagrams are read and written in batches
+        if TMX_CONSTEXPR_FN (std::is_same<ip_type, boost::asio::ip::udp>::value) {
+            const TmxData params { ctx.get_parameters() };
+            std::size_t batchSz = TMX_UDP_BATCH_SIZE;
+            if (params["udp-batch-size"])
+                batchSz = params["udp-batch-size"];
+
+            std::size_t maxDatagram = TMX_UDP_MAX_DATAGRAM;
+            if (params["udp-max-datagram"])
+                maxDatagram = params["udp-max-datagram"];
+
+            ctx[_batch].emplace<std::shared_ptr<TmxDatagramBatch> >(new TmxDatagramBatch(batchSz, maxDatagram));
+        }
+
         TmxAsynchronousIOBrokerClient::initialize(ctx);
     }
 
@@ -120,6 +338,7 @@ public:
         this->get_context(ctx).stop();
 
         ctx.erase(_sock);
+        ctx.erase(_batch);
         TmxAsynchronousIOBrokerClient::destroy(ctx);
     }
 
@@ -260,13 +479,19 @@ public:
             sock = types::as<socket>(ctx.at(_sock));
 
         if (sock && sock->is_open()) {
-            codec::TmxCodec codec { msg };
+            // The bytes must stay alive until the write completes
+            auto bytes = std::make_shared<std::basic_string<byte_t> >();
+            auto err = this->from_message(msg, ctx, *bytes);
+            if (err) {
+                this->on_published(ctx, err, msg);
+                return;
+            }
 
-            auto bytes = codec.get_payload_bytes();
-            TLOG(DEBUG1) << ctx.get_id() << ": " << "Writing " << bytes.length() << " bytes to the socket.";
-            sock->async_send(boost::asio::const_buffer(bytes.data(), bytes.length()),
-                             std::bind(&self_type ::on_write, this,
-                                       std::placeholders::_1, std::placeholders::_2, std::ref(ctx), msg));
+            TLOG(DEBUG1) << ctx.get_id() << ": " << "Writing " << bytes->length() << " bytes to the socket.";
+            sock->async_send(boost::asio::const_buffer(bytes->data(), bytes->length()),
+                             [this, bytes, &ctx, msg](error_code const &ec, std::size_t len) {
+                                 this->on_write(ec, len, std::ref(ctx), msg);
+                             });
         } else {
             this->on_published(ctx, { ENOTCONN, std::strerror(ENOTCONN) }, msg);
         }
@@ -309,23 +534,157 @@ public:
                                     std::bind(&self_type::on_read, this,
                                               std::placeholders::_1, std::placeholders::_2, buffer, std::ref(ctx)));
     }
+
+    // Batched operations that only apply to datagram sockets
+
+    std::shared_ptr<TmxDatagramBatch> get_batch(TmxBrokerContext &ctx) const noexcept {
+        if (ctx.count(_batch))
+            return types::as<TmxDatagramBatch>(ctx.at(_batch));
+
+        return { };
+    }
+
+    void on_datagrams_ready(error_code const &ec, std::reference_wrapper<TmxBrokerContext> ctx) noexcept {
+        if (ec.value() == boost::asio::error::operation_aborted)
+            return;
+
+        if (ec) {
+            this->on_error(ctx.get(), { ec.value(), ec.message() });
+            return;
+        }
+
+        std::shared_ptr<socket> sock;
+        if (ctx.get().count(_sock))
+            sock = types::as<socket>(ctx.get().at(_sock));
+
+        auto batch = this->get_batch(ctx.get());
+        if (!sock || !sock->is_open() || !batch)
+            return;
+
+        // Drain everything that is available
+        int cnt;
+        do {
+            cnt = batch->receive(sock->native_handle());
+            if (cnt < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+                this->on_error(ctx.get(), { errno, std::strerror(errno) });
+                break;
+            }
+
+            TLOG(DEBUG1) << ctx.get().get_id() << ": " << std::max(cnt, 0) << " datagrams read from the socket.";
+
+            for (int i = 0; i < cnt; i++) {
+                if (batch->truncated(i)) {
+                    this->on_error(ctx.get(), { EMSGSIZE, "Dropping datagram larger than the udp-max-datagram of " +
+                                                          std::to_string(batch->datagram(i).size()) + " bytes" });
+                    continue;
+                }
+
+                // Skip empty reads
+                if (batch->datagram(i).size())
+                    this->on_data(batch->datagram(i), ctx);
+            }
+        } while (cnt == (int)batch->size());
+
+        this->read_next_message(*sock, nullptr, ctx.get());
+    }
+
+    void on_datagrams_writable(error_code const &ec, std::reference_wrapper<TmxBrokerContext> ctx,
+                               std::shared_ptr<std::vector<TmxDatagramBatch::outgoing_type> > out,
+                               std::size_t offset) noexcept {
+        std::shared_ptr<socket> sock;
+        if (ctx.get().count(_sock))
+            sock = types::as<socket>(ctx.get().at(_sock));
+
+        auto batch = this->get_batch(ctx.get());
+        if (!batch)
+            return;
+
+        if (!out)
+            out = std::make_shared<std::vector<TmxDatagramBatch::outgoing_type> >();
+
+        // Keep writing until the queue is empty, in the order the datagrams were published
+        while (offset < out->size() || !batch->finish()) {
+            if (offset == out->size()) {
+                batch->dequeue(*out);
+                offset = 0;
+                continue;
+            }
+
+            if (ec || !sock || !sock->is_open()) {
+                TmxError err { ENOTCONN, std::strerror(ENOTCONN) };
+                if (ec)
+                    err = { ec.value(), ec.message() };
+
+                for (; offset < out->size(); offset++)
+                    this->on_published(ctx.get(), err, out->at(offset).second);
+
+                continue;
+            }
+
+            int cnt = batch->send(sock->native_handle(), *out, offset);
+            if (cnt < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                // Wait for room in the socket buffer to write the rest. The send stays
+                // scheduled meanwhile, so no other publish can write ahead of these.
+                sock->async_wait(socket::wait_write, boost::asio::bind_executor(sock->get_executor(),
+                        std::bind(&self_type::on_datagrams_writable, this, std::placeholders::_1, ctx, out, offset)));
+                return;
+            }
+
+            if (cnt < 0) {
+                // Drop this one datagram and keep going
+                this->on_write({ errno, boost::system::system_category() }, 0, ctx, out->at(offset).second);
+                offset++;
+                continue;
+            }
+
+            TLOG(DEBUG1) << ctx.get().get_id() << ": " << cnt << " datagrams written to the socket.";
+
+            for (int i = 0; i < cnt; i++, offset++)
+                this->on_write({ }, out->at(offset).first->length(), ctx, out->at(offset).second);
+        }
+    }
 };
 
 template <>
 void TmxAsynchronousSocketBridge<boost::asio::ip::udp>::read_next_message(socket &sock,
-                                                                          std::shared_ptr<streambuf> buffer,
+                                                                          std::shared_ptr<streambuf>,
                                                                           TmxBrokerContext &ctx) noexcept {
-    if (!buffer) {
-        this->on_error(ctx, { ENOMEM, "Could not create buffer for context " + ctx.get_id() });
+    if (!this->get_batch(ctx)) {
+        this->on_error(ctx, { ENOMEM, "Could not create datagram batch for context " + ctx.get_id() });
         return;
     }
 
-    TLOG(DEBUG2) << ctx.get_id() << ": Awaiting incoming UDP message";
+    TLOG(DEBUG2) << ctx.get_id() << ": Awaiting incoming UDP messages";
+
+    // Wait until there is something to read, then drain the whole batch
+    sock.async_wait(socket::wait_read, std::bind(&self_type::on_datagrams_ready, this,
+                                                  std::placeholders::_1, std::ref(ctx)));
+}
+
+template <>
+void TmxAsynchronousSocketBridge<boost::asio::ip::udp>::publish(TmxBrokerContext &ctx, TmxMessage const &msg) noexcept {
+    std::shared_ptr<socket> sock;
+    if (ctx.count(_sock))
+        sock = types::as<socket>(ctx.at(_sock));
+
+    auto batch = this->get_batch(ctx);
+    if (!sock || !sock->is_open() || !batch) {
+        this->on_published(ctx, { ENOTCONN, std::strerror(ENOTCONN) }, msg);
+        return;
+    }
+
+    auto bytes = std::make_shared<TmxDatagramBatch::bytes_type>();
+    auto err = this->from_message(msg, ctx, *bytes);
+    if (err) {
+        this->on_published(ctx, err, msg);
+        return;
+    }
 
-    const TmxData params { ctx.get_parameters() };
-    sock.async_receive(buffer->prepare(65535), std::bind(&self_type::on_read, this,
-                                                          std::placeholders::_1, std::placeholders::_2,
-                                                          buffer, std::ref(ctx)));
+    // Only the first datagram queued needs to schedule the write of the batch,
+    // which runs on the socket strand so it never overlaps another write
+    if (batch->enqueue(bytes, msg))
+        boost::asio::post(boost::asio::bind_executor(sock->get_executor(),
+                std::bind(&self_type::on_datagrams_writable, this, error_code { }, std::ref(ctx), nullptr, 0)));
 }
 
 template <>
@@ -348,7 +707,7 @@ void TmxAsynchronousSocketBridge<boost::asio::ip::udp>::on_socket_bound(const er
 
     // If no errors, simply wait for any incoming messages
     if (!ec && sock)
-        this->read_next_message(*sock, std::make_shared<streambuf>(), ctx);
+        this->read_next_message(*sock, nullptr, ctx);
 }
 
 /*!
@@ -0,0 +1,15 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file test_main.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#define BOOST_TEST_MODULE libtmxbroker-async test
+
+#include <boost/test/unit_test.hpp>
+
@@ -0,0 +1,165 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxAsynchronousIOBroker_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/broker/async/TmxAsynchronousIOBroker.hpp>
+#include <tmx/message/codec/TmxCodec.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace tmx::common;
+using namespace tmx::message;
+
+namespace tmx {
+namespace broker {
+namespace async {
+namespace test {
+
+// Expose the message conversions for testing
+class TestIOBrokerClient: public TmxAsynchronousIOBrokerClient {
+public:
+    using TmxAsynchronousIOBrokerClient::to_message;
+    using TmxAsynchronousIOBrokerClient::from_message;
+};
+
+const byte_t test_bytes[] = { byte_t(0x00), byte_t(0x13), byte_t(0x4D), byte_t(0x97), byte_t(0x0A), byte_t(0x20) };
+
+TmxMessage make_message(std::uint8_t base = 0) {
+    TmxMessage msg;
+    msg.set_id("tmx::message::j2735::MessageFrame");
+    msg.set_topic("J2735/SPAT");
+    msg.set_source("TestIOBrokerClient");
+    msg.set_encoding("asn.1-uper");
+    msg.set_programmable_metadata(0x1234);
+    msg.set_timestamp(1729087200123456789ULL);
+    msg.set_base(base);
+
+    // Include bytes that would otherwise be trimmed
+    codec::TmxCodec codec { msg };
+    codec.set_payload_bytes(to_byte_sequence(test_bytes, sizeof(test_bytes)));
+    return codec.get_message();
+}
+
+void check_equal(TmxMessage const &expected, TmxMessage const &actual) {
+    BOOST_CHECK_EQUAL(expected.get_id(), actual.get_id());
+    BOOST_CHECK_EQUAL(expected.get_topic(), actual.get_topic());
+    BOOST_CHECK_EQUAL(expected.get_source(), actual.get_source());
+    BOOST_CHECK_EQUAL(expected.get_encoding(), actual.get_encoding());
+    BOOST_CHECK_EQUAL(expected.get_metadata(), actual.get_metadata());
+    BOOST_CHECK_EQUAL(expected.get_timestamp(), actual.get_timestamp());
+    BOOST_CHECK_EQUAL(expected.get_payload_string(), actual.get_payload_string());
+}
+
+BOOST_AUTO_TEST_SUITE(async_io_broker_test_suite)
+
+BOOST_AUTO_TEST_CASE(binary_frame_round_trip) {
+    TestIOBrokerClient client;
+    TmxBrokerContext ctx { "udp://127.0.0.1:12345", "test", TmxData(types::Any()) };
+    TmxData params { ctx.get_parameters() };
+    params["binary-frame"] = true;
+    client.initialize(ctx);
+
+    auto msg = make_message();
+
+    std::basic_string<byte_t> bytes;
+    BOOST_REQUIRE(!client.from_message(msg, ctx, bytes));
+    BOOST_REQUIRE_GT(bytes.length(), 6u);
+    BOOST_CHECK_EQUAL(0x4D, std::to_integer<int>(bytes[0]));
+    BOOST_CHECK_EQUAL(0x97, std::to_integer<int>(bytes[1]));
+
+    TmxMessage decoded;
+    BOOST_REQUIRE(!client.to_message(boost::asio::const_buffer(bytes.data(), bytes.length()), ctx, decoded));
+    check_equal(msg, decoded);
+}
+
+BOOST_AUTO_TEST_CASE(binary_frame_payload_base) {
+    TestIOBrokerClient client;
+    TmxBrokerContext ctx { "udp://127.0.0.1:12345", "test", TmxData(types::Any()) };
+    TmxData params { ctx.get_parameters() };
+    params["binary-frame"] = true;
+    client.initialize(ctx);
+
+    const std::basic_string<byte_t> expected { test_bytes, sizeof(test_bytes) };
+    const std::pair<std::uint8_t, std::string> payloads[] = {
+        { 16, "00134D970A20" }, { 32, "AAJU3FYKEA======" }, { 64, "ABNNlwog" }
+    };
+
+    for (auto const &payload: payloads) {
+        BOOST_TEST_CONTEXT("Base " << (int)payload.first) {
+            auto msg = make_message(payload.first);
+            BOOST_CHECK_EQUAL((int)payload.first, (int)msg.get_base());
+            BOOST_CHECK_EQUAL(payload.second, msg.get_payload_string());
+            BOOST_CHECK(expected == codec::TmxCodec(msg).get_payload_bytes());
+
+            std::basic_string<byte_t> bytes;
+            BOOST_REQUIRE(!client.from_message(msg, ctx, bytes));
+
+            TmxMessage decoded;
+            BOOST_REQUIRE(!client.to_message(boost::asio::const_buffer(bytes.data(), bytes.length()), ctx, decoded));
+            BOOST_CHECK_EQUAL((int)payload.first, (int)decoded.get_base());
+            BOOST_CHECK(expected == codec::TmxCodec(decoded).get_payload_bytes());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(binary_frame_disabled) {
+    TestIOBrokerClient client;
+    TmxBrokerContext ctx { "udp://127.0.0.1:12345", "test" };
+    client.initialize(ctx);
+
+    auto msg = make_message();
+
+    std::basic_string<byte_t> bytes;
+    BOOST_REQUIRE(!client.from_message(msg, ctx, bytes));
+    BOOST_CHECK(bytes == codec::TmxCodec(msg).get_payload_bytes());
+}
+
+BOOST_AUTO_TEST_CASE(binary_frame_resolved_at_initialize) {
+    TestIOBrokerClient client;
+    TmxBrokerContext ctx { "udp://127.0.0.1:12345", "test", TmxData(types::Any()) };
+    client.initialize(ctx);
+
+    // Too late, since the parameter was already resolved
+    TmxData params { ctx.get_parameters() };
+    params["binary-frame"] = true;
+
+    auto msg = make_message();
+
+    std::basic_string<byte_t> bytes;
+    BOOST_REQUIRE(!client.from_message(msg, ctx, bytes));
+    BOOST_CHECK(bytes == codec::TmxCodec(msg).get_payload_bytes());
+}
+
+BOOST_AUTO_TEST_CASE(binary_frame_invalid) {
+    TestIOBrokerClient client;
+    TmxBrokerContext ctx { "udp://127.0.0.1:12345", "test", TmxData(types::Any()) };
+    TmxData params { ctx.get_parameters() };
+    params["binary-frame"] = true;
+    client.initialize(ctx);
+
+    std::basic_string<byte_t> bytes;
+    BOOST_REQUIRE(!client.from_message(make_message(), ctx, bytes));
+
+    // A truncated frame is not decoded, so the bytes are assumed to be a binary payload
+    bytes.pop_back();
+
+    TmxMessage decoded;
+    BOOST_REQUIRE(!client.to_message(boost::asio::const_buffer(bytes.data(), bytes.length()), ctx, decoded));
+    BOOST_CHECK_EQUAL("", decoded.get_id());
+    BOOST_CHECK_EQUAL(byte_string_encode(to_byte_sequence(bytes.data(), bytes.length())),
+                      decoded.get_payload_string());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} /* End namespace test */
+} /* End namespace async */
+} /* End namespace broker */
+} /* End namespace tmx */
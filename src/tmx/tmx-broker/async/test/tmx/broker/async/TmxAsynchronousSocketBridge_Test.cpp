@@ -0,0 +1,335 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxAsynchronousSocketBridge_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/broker/TmxBrokerClient.hpp>
+#include <tmx/broker/TmxBrokerContext.hpp>
+#include <tmx/common/TmxFunctor.hpp>
+#include <tmx/common/TmxTypeRegistrar.hpp>
+#include <tmx/message/TmxMessage.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace tmx::common;
+using namespace tmx::message;
+
+namespace tmx {
+namespace broker {
+namespace async {
+namespace test {
+
+// Roughly the size of a J2735 BSM with a Part II extension
+#define DATAGRAM_SIZE 200
+#define DATAGRAM_COUNT 2000u
+#define DATAGRAM_WINDOW 50
+
+static std::atomic<std::size_t> _received { 0 };
+
+class TestDatagramCounter: public TmxFunctor<types::Any const &, TmxMessage const &> {
+public:
+    TmxError execute(types::Any const &, TmxMessage const &) const override {
+        _received++;
+        return { };
+    }
+};
+
+static TmxTypeRegistrar<TestDatagramCounter> _counter;
+
+static std::mutex _payloadsLock;
+static std::vector<std::string> _payloads;
+
+class TestDatagramRecorder: public TmxFunctor<types::Any const &, TmxMessage const &> {
+public:
+    TmxError execute(types::Any const &, TmxMessage const &msg) const override {
+        std::lock_guard<std::mutex> lock(_payloadsLock);
+        _payloads.emplace_back(msg.get_payload_string());
+        return { };
+    }
+};
+
+static TmxTypeRegistrar<TestDatagramRecorder> _recorder;
+
+static std::size_t payload_count() {
+    std::lock_guard<std::mutex> lock(_payloadsLock);
+    return _payloads.size();
+}
+
+// A payload that is different for every datagram
+static std::string make_payload(std::size_t i, std::size_t size = DATAGRAM_SIZE) {
+    char prefix[32];
+    std::snprintf(prefix, sizeof(prefix), "Datagram %05zu ", i);
+
+    std::string payload { prefix };
+    payload.resize(size, '\x5A');
+    return payload;
+}
+
+template <typename _Pred, typename _Duration = std::chrono::seconds>
+bool wait_for(_Pred &&pred, _Duration timeout = std::chrono::seconds(5)) {
+    auto end = std::chrono::steady_clock::now() + timeout;
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > end)
+            return false;
+
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    return true;
+}
+
+BOOST_AUTO_TEST_SUITE(async_socket_bridge_test_suite)
+
+BOOST_AUTO_TEST_CASE(udp_loopback_delivers_every_datagram) {
+    TmxBrokerContext server { "udp-d://127.0.0.1:24601", "udp-count-server" };
+    TmxBrokerContext client { "udp://127.0.0.1:24601", "udp-count-client" };
+
+    auto serverBroker = TmxBrokerClient::get_broker(server);
+    auto clientBroker = TmxBrokerClient::get_broker(client);
+    BOOST_REQUIRE(serverBroker);
+    BOOST_REQUIRE(clientBroker);
+
+    serverBroker->initialize(server);
+    serverBroker->subscribe(server, "UNKNOWN", _counter.descriptor());
+    serverBroker->connect(server);
+    BOOST_REQUIRE(wait_for([&server]() { return server.get_state() >= TmxBrokerState::connected; }));
+
+    clientBroker->initialize(client);
+    clientBroker->connect(client);
+    BOOST_REQUIRE(wait_for([&client]() { return client.get_state() >= TmxBrokerState::connected; }));
+
+    TmxMessage msg;
+    msg.set_payload(std::string(DATAGRAM_SIZE, '\x5A'));
+
+    // Send in bursts, so the socket buffers do not overflow
+    const std::size_t start = _received;
+    for (std::size_t sent = 0; sent < DATAGRAM_COUNT; ) {
+        for (std::size_t i = 0; i < DATAGRAM_WINDOW; i++, sent++)
+            clientBroker->publish(client, msg);
+
+        BOOST_REQUIRE(wait_for([start, sent]() { return _received - start >= sent; }));
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    BOOST_CHECK_EQUAL(_received - start, DATAGRAM_COUNT);
+
+    clientBroker->disconnect(client);
+    serverBroker->disconnect(server);
+    wait_for([&]() { return client.get_state() == TmxBrokerState::disconnected &&
+                            server.get_state() == TmxBrokerState::disconnected; });
+
+    clientBroker->destroy(client);
+    serverBroker->destroy(server);
+}
+
+BOOST_AUTO_TEST_CASE(udp_burst_arrives_in_order) {
+    const std::size_t count = 100;
+
+    // Small batches and buffers, so the burst takes several reads and an oversize datagram is easy to make
+    TmxData params;
+    params["udp-batch-size"] = 8;
+    params["udp-max-datagram"] = 512;
+
+    TmxBrokerContext server { "udp-d://127.0.0.1:24602", "udp-burst-server", params.get_container() };
+    TmxBrokerContext client { "udp://127.0.0.1:24602", "udp-burst-client" };
+
+    auto serverBroker = TmxBrokerClient::get_broker(server);
+    auto clientBroker = TmxBrokerClient::get_broker(client);
+    BOOST_REQUIRE(serverBroker);
+    BOOST_REQUIRE(clientBroker);
+
+    serverBroker->initialize(server);
+    serverBroker->subscribe(server, "UNKNOWN", _recorder.descriptor());
+    serverBroker->connect(server);
+    BOOST_REQUIRE(wait_for([&server]() { return server.get_state() >= TmxBrokerState::connected; }));
+
+    clientBroker->initialize(client);
+    clientBroker->connect(client);
+    BOOST_REQUIRE(wait_for([&client]() { return client.get_state() >= TmxBrokerState::connected; }));
+
+    {
+        std::lock_guard<std::mutex> lock(_payloadsLock);
+        _payloads.clear();
+    }
+
+    TmxMessage msg;
+    for (std::size_t i = 0; i < count; i++) {
+        msg.set_payload(make_payload(i));
+        clientBroker->publish(client, msg);
+    }
+
+    BOOST_CHECK(wait_for([count]() { return payload_count() >= count; }));
+
+    // Then one too big for the server buffers, which is dropped, and one more that is not
+    msg.set_payload(make_payload(count, 1024));
+    clientBroker->publish(client, msg);
+    msg.set_payload(make_payload(count + 1));
+    clientBroker->publish(client, msg);
+
+    BOOST_CHECK(wait_for([count]() { return payload_count() >= count + 1; }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    {
+        std::lock_guard<std::mutex> lock(_payloadsLock);
+        BOOST_REQUIRE_EQUAL(_payloads.size(), count + 1);
+        for (std::size_t i = 0; i < count; i++)
+            BOOST_CHECK_EQUAL(_payloads[i], make_payload(i));
+
+        BOOST_CHECK_EQUAL(_payloads[count], make_payload(count + 1));
+    }
+
+    clientBroker->disconnect(client);
+    serverBroker->disconnect(server);
+    wait_for([&]() { return client.get_state() == TmxBrokerState::disconnected &&
+                            server.get_state() == TmxBrokerState::disconnected; });
+
+    clientBroker->destroy(client);
+    serverBroker->destroy(server);
+}
+
+BOOST_AUTO_TEST_CASE(udp_large_datagrams_arrive_whole) {
+    // Well past any MTU, but still within a single UDP datagram
+    const std::vector<std::size_t> sizes { 4097, 9000, 65000 };
+
+    TmxBrokerContext server { "udp-d://127.0.0.1:24603", "udp-large-server" };
+    TmxBrokerContext client { "udp://127.0.0.1:24603", "udp-large-client" };
+
+    auto serverBroker = TmxBrokerClient::get_broker(server);
+    auto clientBroker = TmxBrokerClient::get_broker(client);
+    BOOST_REQUIRE(serverBroker);
+    BOOST_REQUIRE(clientBroker);
+
+    serverBroker->initialize(server);
+    serverBroker->subscribe(server, "UNKNOWN", _recorder.descriptor());
+    serverBroker->connect(server);
+    BOOST_REQUIRE(wait_for([&server]() { return server.get_state() >= TmxBrokerState::connected; }));
+
+    clientBroker->initialize(client);
+    clientBroker->connect(client);
+    BOOST_REQUIRE(wait_for([&client]() { return client.get_state() >= TmxBrokerState::connected; }));
+
+    {
+        std::lock_guard<std::mutex> lock(_payloadsLock);
+        _payloads.clear();
+    }
+
+    TmxMessage msg;
+    for (std::size_t i = 0; i < sizes.size(); i++) {
+        msg.set_payload(make_payload(i, sizes[i]));
+        clientBroker->publish(client, msg);
+    }
+
+    BOOST_CHECK(wait_for([&sizes]() { return payload_count() >= sizes.size(); }));
+
+    {
+        std::lock_guard<std::mutex> lock(_payloadsLock);
+        BOOST_REQUIRE_EQUAL(_payloads.size(), sizes.size());
+        for (std::size_t i = 0; i < sizes.size(); i++)
+            BOOST_CHECK(_payloads[i] == make_payload(i, sizes[i]));
+    }
+
+    clientBroker->disconnect(client);
+    serverBroker->disconnect(server);
+    wait_for([&]() { return client.get_state() == TmxBrokerState::disconnected &&
+                            server.get_state() == TmxBrokerState::disconnected; });
+
+    clientBroker->destroy(client);
+    serverBroker->destroy(server);
+}
+
+BOOST_AUTO_TEST_CASE(udp_concurrent_publishers_keep_order) {
+    // The loopback never makes the sender wait, so several publishers keep
+    // the write queue busy instead, which queues up more datagrams while
+    // each batch is still being written out
+    const std::size_t threads = 4;
+    const std::size_t count = 500;
+    const std::size_t window = 8;
+
+    TmxBrokerContext server { "udp-d://127.0.0.1:24604", "udp-concurrent-server" };
+    TmxBrokerContext client { "udp://127.0.0.1:24604", "udp-concurrent-client" };
+
+    auto serverBroker = TmxBrokerClient::get_broker(server);
+    auto clientBroker = TmxBrokerClient::get_broker(client);
+    BOOST_REQUIRE(serverBroker);
+    BOOST_REQUIRE(clientBroker);
+
+    serverBroker->initialize(server);
+    serverBroker->subscribe(server, "UNKNOWN", _recorder.descriptor());
+    serverBroker->connect(server);
+    BOOST_REQUIRE(wait_for([&server]() { return server.get_state() >= TmxBrokerState::connected; }));
+
+    clientBroker->initialize(client);
+    clientBroker->connect(client);
+    BOOST_REQUIRE(wait_for([&client]() { return client.get_state() >= TmxBrokerState::connected; }));
+
+    {
+        std::lock_guard<std::mutex> lock(_payloadsLock);
+        _payloads.clear();
+    }
+
+    // Each publisher has its own range of datagram numbers
+    std::atomic<std::size_t> published { 0 };
+    std::vector<std::thread> publishers;
+    for (std::size_t t = 0; t < threads; t++) {
+        publishers.emplace_back([&, t]() {
+            TmxMessage msg;
+            for (std::size_t i = 0; i < count; i++) {
+                msg.set_payload(make_payload(t * count + i));
+                clientBroker->publish(client, msg);
+
+                // Keep the total in flight within the socket buffers
+                if (++published % window == 0)
+                    wait_for([&published, window]() { return payload_count() + threads * window >= published; });
+            }
+        });
+    }
+
+    for (auto &publisher: publishers)
+        publisher.join();
+
+    BOOST_CHECK(wait_for([&]() { return payload_count() >= threads * count; }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    {
+        std::lock_guard<std::mutex> lock(_payloadsLock);
+        BOOST_REQUIRE_EQUAL(_payloads.size(), threads * count);
+
+        std::vector<std::size_t> next(threads, 0);
+        for (auto &payload: _payloads) {
+            auto n = std::stoul(payload.substr(9, 5));
+            auto t = n / count;
+            BOOST_REQUIRE_LT(t, threads);
+            BOOST_CHECK_EQUAL(n, t * count + next[t]);
+            next[t] = n % count + 1;
+        }
+    }
+
+    clientBroker->disconnect(client);
+    serverBroker->disconnect(server);
+    wait_for([&]() { return client.get_state() == TmxBrokerState::disconnected &&
+                            server.get_state() == TmxBrokerState::disconnected; });
+
+    clientBroker->destroy(client);
+    serverBroker->destroy(server);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} /* End namespace test */
+} /* End namespace async */
+} /* End namespace broker */
+} /* End namespace tmx */
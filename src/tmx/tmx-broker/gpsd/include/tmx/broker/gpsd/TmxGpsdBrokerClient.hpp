@@ -18,10 +18,47 @@
 #include <tmx/broker/TmxBrokerContext.hpp>
 #include <tmx/broker/async/TmxAsynchronousIOBroker.hpp>
 
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 namespace tmx {
 namespace broker {
 namespace gpsd {
 
+/*!
+ * @brief The latest position fix and sky view reported by gpsd
+ *
+ * This is filled in directly from the libgps structures as each TPV
+ * or SKY report is read, so that a location is available without
+ * decoding the JSON message. Values that gpsd did not report are NaN.
+ */
+struct TmxGpsdLocation {
+    std::chrono::system_clock::time_point time;
+    int mode = 0;
+    int status = 0;
+
+    double latitude = std::numeric_limits<double>::quiet_NaN();
+    double longitude = std::numeric_limits<double>::quiet_NaN();
+    double altitude = std::numeric_limits<double>::quiet_NaN();
+    double speed = std::numeric_limits<double>::quiet_NaN();
+    double track = std::numeric_limits<double>::quiet_NaN();
+    double climb = std::numeric_limits<double>::quiet_NaN();
+    double eph = std::numeric_limits<double>::quiet_NaN();
+    double epv = std::numeric_limits<double>::quiet_NaN();
+
+    double hdop = std::numeric_limits<double>::quiet_NaN();
+    double vdop = std::numeric_limits<double>::quiet_NaN();
+    double pdop = std::numeric_limits<double>::quiet_NaN();
+    int satellites_visible = 0;
+    int satellites_used = 0;
+
+    std::size_t fixes = 0;
+};
+
 /*!
  * @brief The TMX broker client implementation for connecting to gpsd
  */
@@ -41,7 +78,25 @@ public:
     void disconnect(TmxBrokerContext &ctx) noexcept override;
     void publish(TmxBrokerContext &ctx, message::TmxMessage const &) noexcept override;
 
+    /*!
+     * @brief Get the latest location read from gpsd on this context
+     *
+     * This is safe to call from any thread. The location is found through
+     * a table in the client, not through the context, so it does not race
+     * the reader thread updating the context.
+     *
+     * @param[in] ctx The broker context
+     * @return A copy of the latest location, or an empty location if none has been read yet
+     */
+    TmxGpsdLocation get_location(TmxBrokerContext &ctx) const noexcept;
+
 private:
+    typedef std::shared_ptr<TmxGpsdLocation const> location_ptr;
+
+    // The location slot for each context ID, kept from initialize until destroy
+    mutable std::mutex _locationLock;
+    std::unordered_map<std::string, std::shared_ptr<location_ptr> > _locations;
+
     common::TmxError to_message(boost::asio::const_buffer const &,
                                 TmxBrokerContext &ctx, message::TmxMessage &) const noexcept override;
 
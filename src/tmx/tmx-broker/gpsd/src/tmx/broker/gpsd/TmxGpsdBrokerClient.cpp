@@ -16,14 +16,17 @@
 #include <tmx/common/TmxError.hpp>
 #include <tmx/common/TmxLogger.hpp>
 
+#include <cctype>
 #include <cmath>
 #include <cstdio>
 #include <ctime>
 #include <filesystem>
 #include <gps.h>
 #include <istream>
+#include <memory>
 #include <regex>
 #include <sstream>
+#include <vector>
 
 using namespace tmx::common;
 using namespace tmx::message;
@@ -35,8 +38,20 @@ namespace gpsd {
 using boost::system::error_code;
 typedef typename boost::asio::ip::tcp::socket socket;
 
+/*!
+ * @brief The context parameters used on every read, resolved once at connect
+ */
+struct TmxGpsdParameters {
+    std::size_t bufSize = 64 * 1024;
+};
+
+typedef std::shared_ptr<TmxGpsdLocation const> location_ptr;
+
 static typename types::Properties_::key_t _gps { type_short_name<struct gps_data_t>().data() };
 static typename types::Properties_::key_t _sock { type_short_name<socket>().data() };
+static typename types::Properties_::key_t _params { type_short_name<TmxGpsdParameters>().data() };
+static typename types::Properties_::key_t _location { type_short_name<TmxGpsdLocation>().data() };
+static typename types::Properties_::key_t _version { "version" };
 
 TmxGpsdBrokerClient::TmxGpsdBrokerClient() noexcept {
     this->register_broker("gpsd");      // Basic location information
@@ -54,7 +69,7 @@ common::types::Any TmxGpsdBrokerClient::get_broker_info(TmxBrokerContext &ctx) c
 
     // Make copies of the context data
     // TODO: Add more broker information besides version?
-    for (auto &key: { typename types::Properties_::key_t("version") }) {
+    for (auto &key: { _version }) {
         if (ctx.count(key)) {
             TLOG(INFO) << "Got " << key << ": " << TmxData(ctx[key]).to_string();
             info["gpsd"][key] = types::Any(static_cast<types::Any const &>(ctx[key]));
@@ -76,6 +91,15 @@ void TmxGpsdBrokerClient::initialize(TmxBrokerContext &ctx) noexcept {
     // Insert an empty socket within a strand to use
     ctx[_sock].emplace<std::shared_ptr<socket> >(std::make_shared<socket>(this->make_strand(ctx)));
 
+    // Insert an empty location, which is swapped out as each new fix is read
+    auto slot = std::make_shared<location_ptr>(std::make_shared<TmxGpsdLocation>());
+    ctx[_location].emplace<std::shared_ptr<location_ptr> >(slot);
+
+    {
+        std::lock_guard<std::mutex> lock { this->_locationLock };
+        this->_locations[ctx.get_id()] = slot;
+    }
+
     super::initialize(ctx);
 }
 
@@ -83,9 +107,16 @@ void TmxGpsdBrokerClient::destroy(TmxBrokerContext &ctx) noexcept {
     if (this->is_connected(ctx))
         this->disconnect(ctx);
 
+    {
+        std::lock_guard<std::mutex> lock { this->_locationLock };
+        this->_locations.erase(ctx.get_id());
+    }
+
     ctx.erase(_gps);
     ctx.erase(_sock);
-    TmxBrokerClient::destroy(ctx);
+    ctx.erase(_params);
+    ctx.erase(_location);
+    super::destroy(ctx);
 }
 
 auto to_seconds(timespec &tm) {
@@ -94,46 +125,124 @@ auto to_seconds(timespec &tm) {
     return sec.count();
 }
 
-int read_gps_message(TmxBrokerContext &ctx, std::shared_ptr<boost::asio::streambuf> buffer) noexcept {
-    if (!ctx.count(_gps) || !ctx.count(_sock))
-        return ENOTCONN;
+/*!
+ * @return The class of the gpsd JSON report, or an empty string if it is not one
+ */
+const_string get_class(const_string report) noexcept {
+    // gpsd always writes the class first
+    static constexpr const_string prefix { "{\"class\":\"" };
 
-    auto gps = types::as<struct gps_data_t>(ctx.at(_gps));
-    if (!gps || !gps->gps_fd)
-        return ENOTCONN;
+    if (report.substr(0, prefix.length()) != prefix)
+        return { };
 
-    std::size_t bufSize = 64 * 1024;
-    const TmxData params { ctx.get_parameters() };
-    if (params["max-buffer-size"])
-        bufSize = params["max-buffer-size"];
-
-    auto buf = buffer->prepare(bufSize);
-    int n = gps_read(gps.get(), (char *) buf.data(), buf.size());
-    if (n <= 0)
-        return n;
-
-    // Need to cache some things
-    if (gps->set & VERSION_SET) {
-        TmxData ver;
-        if (std::strlen(gps->version.release))
-            ver["release"] = std::string(gps->version.release);
-        if (std::strlen(gps->version.rev))
-            ver["revision"] = std::string(gps->version.rev);
-        if (gps->version.proto_major) {
-            ver["protocol"]["major"] = gps->version.proto_major;
-            ver["protocol"]["minor"] = gps->version.proto_minor;
-        }
+    auto idx = report.find_first_of('"', prefix.length());
+    if (idx == report.npos)
+        return { };
 
-        ctx[typename types::Properties_::key_t("version")] = std::move(ver.get_container());
+    return report.substr(prefix.length(), idx - prefix.length());
+}
+
+/*!
+ * @brief Read the next complete report from gpsd into the buffer
+ *
+ * Only one report is unpacked into the GPS data on each call, but libgps
+ * holds on to the rest of what it read from the socket, so this should
+ * be called until there is nothing left.
+ *
+ * @return The length of the report, including the line terminator, 0 if there
+ * is no complete report yet, or less than zero if the connection failed
+ */
+int read_gps_message(struct gps_data_t &gps, boost::asio::mutable_buffer const &buf) noexcept {
+    if (!gps.gps_fd) {
+        errno = ENOTCONN;
+        return -1;
+    }
+
+    int n = gps_read(&gps, (char *) buf.data(), buf.size());
+    if (n > 0) {
+        TLOG(DEBUG1) << "Read from GPSD: " << to_char_sequence((char *) buf.data(), std::min<std::size_t>(n, buf.size()) - 1);
     }
 
-    auto chars = to_char_sequence((char *) buf.data(), n);
-    int idx = chars.find_first_of('\n');
-    chars = chars.substr(0, idx);
+    return n;
+}
 
-    TLOG(DEBUG1) << "Read from GPSD: " << chars;
+/*!
+ * @brief Cache the gpsd version information in the context
+ */
+void update_version(TmxBrokerContext &ctx, struct gps_data_t const &gps) noexcept {
+    TmxData ver;
+    if (std::strlen(gps.version.release))
+        ver["release"] = std::string(gps.version.release);
+    if (std::strlen(gps.version.rev))
+        ver["revision"] = std::string(gps.version.rev);
+    if (gps.version.proto_major) {
+        ver["protocol"]["major"] = gps.version.proto_major;
+        ver["protocol"]["minor"] = gps.version.proto_minor;
+    }
 
-    return chars.length();
+    ctx[_version] = std::move(ver.get_container());
+}
+
+/*!
+ * @brief Copy the newly read TPV or SKY report into the context location
+ */
+void update_location(TmxBrokerContext &ctx, struct gps_data_t const &gps, const_string cls) noexcept {
+    if (!ctx.count(_location))
+        return;
+
+    auto slot = types::as<location_ptr>(ctx.at(_location));
+    if (!slot)
+        return;
+
+    auto location = std::make_shared<TmxGpsdLocation>(**slot);
+    if (cls == "TPV") {
+        auto tm = std::chrono::seconds(gps.fix.time.tv_sec) + std::chrono::nanoseconds(gps.fix.time.tv_nsec);
+        location->time = std::chrono::system_clock::time_point(
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(tm));
+        location->mode = gps.fix.mode;
+#if GPSD_API_MAJOR_VERSION >= 10
+        location->status = gps.fix.status;
+#else
+        location->status = gps.status;
+#endif
+        location->latitude = gps.fix.latitude;
+        location->longitude = gps.fix.longitude;
+        location->altitude = gps.fix.altHAE;
+        location->speed = gps.fix.speed;
+        location->track = gps.fix.track;
+        location->climb = gps.fix.climb;
+        location->eph = gps.fix.eph;
+        location->epv = gps.fix.epv;
+        location->fixes++;
+    } else if (cls == "SKY") {
+        location->hdop = gps.dop.hdop;
+        location->vdop = gps.dop.vdop;
+        location->pdop = gps.dop.pdop;
+        location->satellites_visible = gps.satellites_visible;
+        location->satellites_used = gps.satellites_used;
+    } else {
+        return;
+    }
+
+    std::atomic_store(slot.get(), location_ptr(location));
+}
+
+TmxGpsdLocation TmxGpsdBrokerClient::get_location(TmxBrokerContext &ctx) const noexcept {
+    std::shared_ptr<location_ptr> slot;
+    {
+        std::lock_guard<std::mutex> lock { this->_locationLock };
+        auto iter = this->_locations.find(ctx.get_id());
+        if (iter != this->_locations.end())
+            slot = iter->second;
+    }
+
+    if (slot) {
+        auto location = std::atomic_load(slot.get());
+        if (location)
+            return *location;
+    }
+
+    return { };
 }
 
 void TmxGpsdBrokerClient::on_read(const boost::system::error_code &ec, std::size_t bytes,
@@ -149,42 +258,88 @@ void TmxGpsdBrokerClient::on_read(const boost::system::error_code &ec, std::size
         return;
     }
 
-    error_code err;
-    int n = read_gps_message(ctx.get(), buffer);
-    if (n < 0)
-        err = boost::system::errc::make_error_code(static_cast<boost::system::errc::errc_t>(errno));
-    else
-        err = boost::system::errc::make_error_code((boost::system::errc::errc_t::success));
-
-    // Process the incoming GPSD message, reading one line at a time
-    if (n < 0) {
-        this->on_disconnected(ctx, { err.value(), err.message() });
+    if (!ctx.get().count(_gps) || !ctx.get().count(_sock) || !ctx.get().count(_params)) {
+        this->on_disconnected(ctx, { ENOTCONN, std::strerror(ENOTCONN) });
         return;
     }
 
-    if (n > 0) {
-        super::on_read(err, n - 1, buffer, ctx);
-        buffer->consume(1);
+    auto gps = types::as<struct gps_data_t>(ctx.get().at(_gps));
+    auto params = types::as<TmxGpsdParameters>(ctx.get().at(_params));
+    if (!gps || !params) {
+        this->on_disconnected(ctx, { ENOTCONN, std::strerror(ENOTCONN) });
+        return;
     }
 
-    // Schedule the next read
-    if (ctx.get().count(_sock)) {
-        auto sock = types::as<socket>(ctx.get().at(_sock));
-
-        // Wait for the next data to be available
-        if (sock && sock->is_open())
-            sock->async_wait(boost::asio::ip::tcp::socket::wait_read, std::bind(&self_type::on_read, this,
-                                                                                std::placeholders::_1, 0, buffer, ctx));
-
-        // Consider the broker connected once the first successful read (VERSION) is complete
-        // But, post the callback to the strand so that additional reads may occur to get more information
-        if (!err && !this->is_connected(ctx.get())) {
-            boost::asio::post(sock->get_executor(), [this, ctx]() {
-                this->on_connected(ctx.get(), { EXIT_SUCCESS, std::strerror(EXIT_SUCCESS) });
-            });
+    auto buf = buffer->prepare(params->bufSize);
+    const bool json = std::strcmp("gpsd", ctx.get().get_scheme().c_str()) == 0;
+
+    // gpsd often writes several reports at once, so process every complete one
+    std::vector<TmxMessage> batch;
+    error_code err = boost::system::errc::make_error_code((boost::system::errc::errc_t::success));
+    int n;
+    while ((n = read_gps_message(*gps, buf)) > 0) {
+        std::size_t len = std::min<std::size_t>(n, buf.size()) - 1;
+        auto report = to_char_sequence((const char *) buf.data(), len);
+
+        // The reports end with a CR before the LF
+        while (report.length() && std::isspace(report.back()))
+            report.remove_suffix(1);
+
+        auto cls = get_class(report);
+
+        if (cls == "VERSION")
+            update_version(ctx, *gps);
+        else if (cls == "TPV" || cls == "SKY")
+            update_location(ctx, *gps, cls);
+
+        if (json && !cls.empty()) {
+            // The report is already JSON, so only the message header is needed
+            TmxMessage msg;
+            msg.set_timepoint();
+            msg.set_topic(std::string("gpsd") + std::filesystem::path::preferred_separator);
+            msg.get_topic().append(cls.data(), cls.length());
+            msg.set_source(std::strlen(gps->dev.path) ? std::string(gps->dev.path) : std::string(ctx.get().get_id()));
+            msg.set_encoding("json");
+            msg.set_payload(std::string(report.data(), report.length()));
+
+            batch.push_back(std::move(msg));
+            continue;
+        }
+
+        // Everything else gets inspected as usual, but after the reports before it
+        if (batch.size()) {
+            this->callback(ctx.get().get_id(), batch);
+            batch.clear();
         }
+
+        super::on_read(err, len, buffer, ctx);
+        buf = buffer->prepare(params->bufSize);
     }
 
+    if (batch.size())
+        this->callback(ctx.get().get_id(), batch);
+
+    if (n < 0) {
+        err = boost::system::errc::make_error_code(static_cast<boost::system::errc::errc_t>(errno));
+        this->on_disconnected(ctx, { err.value(), err.message() });
+        return;
+    }
+
+    // Schedule the next read
+    auto sock = types::as<socket>(ctx.get().at(_sock));
+
+    // Wait for the next data to be available
+    if (sock && sock->is_open())
+        sock->async_wait(boost::asio::ip::tcp::socket::wait_read, std::bind(&self_type::on_read, this,
+                                                                            std::placeholders::_1, 0, buffer, ctx));
+
+    // Consider the broker connected once the first successful read (VERSION) is complete
+    // But, post the callback to the strand so that additional reads may occur to get more information
+    if (sock && !this->is_connected(ctx.get())) {
+        boost::asio::post(sock->get_executor(), [this, ctx]() {
+            this->on_connected(ctx.get(), { EXIT_SUCCESS, std::strerror(EXIT_SUCCESS) });
+        });
+    }
 }
 
 void TmxGpsdBrokerClient::on_gps_stream(error_code const &ec, std::reference_wrapper<TmxBrokerContext> ctx) noexcept {
@@ -253,7 +408,11 @@ void TmxGpsdBrokerClient::on_gps_open(error_code const &ec, std::reference_wrapp
 
         TLOG(DEBUG) << "Opening GPSD stream with watch " << watch;
 
+#if GPSD_API_MAJOR_VERSION >= 14
+        int ret = gps_stream(gps.get(), watch, ctx.get().get_path().c_str());
+#else
         int ret = gps_stream(gps.get(), watch, (void *)ctx.get().get_path().c_str());
+#endif
 
         boost::system::error_code ec;
         if (ret)
@@ -280,6 +439,13 @@ void TmxGpsdBrokerClient::connect(TmxBrokerContext &ctx, const types::Any &args)
         return;
     }
 
+    // Resolve the parameters used on every read
+    auto &params = ctx[_params].emplace<TmxGpsdParameters>();
+
+    const TmxData data { ctx.get_parameters() };
+    if (data["max-buffer-size"])
+        params.bufSize = data["max-buffer-size"];
+
     // Resolve the hostname
     // Resolve the host name, but only the service name if it is not already a port number
     boost::system::error_code ec;
@@ -397,10 +563,9 @@ common::TmxError TmxGpsdBrokerClient::to_message(boost::asio::const_buffer const
     } else if (msg.get_encoding() == "json") {
         // This is a GPSD specific message
         msg.set_topic(std::string("gpsd") + std::filesystem::path::preferred_separator);
-        auto idx = payload.find_first_of(',');
-        if (idx != payload.npos && idx > 11 && payload[0] == '{' && payload[idx - 1] == '"' &&
-            payload.substr(2, 5) == "class")
-            msg.get_topic().append(payload.substr(10, idx - 11).c_str());
+        auto cls = get_class(payload);
+        if (!cls.empty())
+            msg.get_topic().append(cls.data(), cls.length());
         else
             msg.get_topic().append("UNKNOWN");
     } else {
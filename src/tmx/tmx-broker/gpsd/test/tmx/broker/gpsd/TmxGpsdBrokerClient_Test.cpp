@@ -0,0 +1,213 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxGpsdBrokerClient_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/broker/gpsd/TmxGpsdBrokerClient.hpp>
+#include <tmx/broker/TmxBrokerContext.hpp>
+#include <tmx/common/TmxFunctor.hpp>
+#include <tmx/common/TmxTypeRegistrar.hpp>
+#include <tmx/message/TmxMessage.hpp>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace tmx::common;
+using namespace tmx::message;
+
+namespace tmx {
+namespace broker {
+namespace gpsd {
+namespace test {
+
+#define TEST_REPLAY_LOG GPSD_TEST_DIR "/ublox-8.log.chk"
+#define TEST_CHUNK_SIZE 16 * 1024
+
+template <typename _Pred, typename _Duration = std::chrono::seconds>
+bool wait_for(_Pred &&pred, _Duration timeout = std::chrono::seconds(5)) {
+    auto end = std::chrono::steady_clock::now() + timeout;
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > end)
+            return false;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return true;
+}
+
+/*!
+ * @return The JSON reports that gpsd is expected to produce for the replay log
+ */
+static std::vector<std::string> get_reports() {
+    std::vector<std::string> reports;
+
+    std::ifstream in { TEST_REPLAY_LOG };
+    for (std::string line; std::getline(in, line); ) {
+        if (line.substr(0, 9) == "{\"class\":")
+            reports.push_back(line);
+    }
+
+    return reports;
+}
+
+/*!
+ * @brief A stand-in for gpsd, which writes all the reports at once in large chunks
+ */
+class TestGpsd {
+public:
+    TestGpsd(std::vector<std::string> const &reports):
+            _acceptor(_io, { boost::asio::ip::address_v4::loopback(), 0 }) {
+        _stream = "{\"class\":\"VERSION\",\"release\":\"3.25\",\"rev\":\"3.25\",\"proto_major\":3,\"proto_minor\":15}\r\n";
+        for (auto const &report: reports)
+            _stream += report + "\r\n";
+
+        _acceptor.non_blocking(true);
+        _thread = std::thread(&TestGpsd::run, this);
+    }
+
+    ~TestGpsd() {
+        _done = true;
+        if (_thread.joinable())
+            _thread.join();
+    }
+
+    unsigned short get_port() const {
+        return _acceptor.local_endpoint().port();
+    }
+
+private:
+    void run() {
+        boost::system::error_code ec;
+        boost::asio::ip::tcp::socket sock { _io };
+        while (!_done && _acceptor.accept(sock, ec))
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        if (_done)
+            return;
+
+        // Nothing is reported until the client asks to watch
+        boost::asio::streambuf in;
+        boost::asio::read_until(sock, in, ';', ec);
+
+        for (std::size_t i = 0; !ec && i < _stream.length(); i += TEST_CHUNK_SIZE)
+            boost::asio::write(sock, boost::asio::buffer(_stream.substr(i, TEST_CHUNK_SIZE)), ec);
+
+        while (!_done)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    boost::asio::io_context _io;
+    boost::asio::ip::tcp::acceptor _acceptor;
+    std::string _stream;
+    std::atomic<bool> _done { false };
+    std::thread _thread;
+};
+
+static std::atomic<std::size_t> _tpv { 0 };
+static std::atomic<std::size_t> _sky { 0 };
+
+class TestReportCounter: public TmxFunctor<types::Any const &, TmxMessage const &> {
+public:
+    TmxError execute(types::Any const &, TmxMessage const &msg) const override {
+        if (msg.get_topic() == "gpsd/TPV")
+            _tpv++;
+        else if (msg.get_topic() == "gpsd/SKY")
+            _sky++;
+
+        return { };
+    }
+};
+
+static TmxTypeRegistrar<TestReportCounter> _counter;
+
+BOOST_AUTO_TEST_SUITE(gpsd_broker_test_suite)
+
+BOOST_AUTO_TEST_CASE(replay_all_reports) {
+    auto reports = get_reports();
+    BOOST_REQUIRE(reports.size());
+
+    std::size_t tpv = 0, sky = 0;
+    std::string lastTpv, lastSky;
+    for (auto const &report: reports) {
+        if (report.find("\"class\":\"TPV\"") != report.npos) {
+            tpv++;
+            lastTpv = report;
+        } else if (report.find("\"class\":\"SKY\"") != report.npos) {
+            sky++;
+            lastSky = report;
+        }
+    }
+
+    TestGpsd gpsd { reports };
+
+    TmxBrokerContext ctx { "gpsd://127.0.0.1:" + std::to_string(gpsd.get_port()), "gpsd-test-client" };
+    auto broker = TmxBrokerClient::get_broker(ctx);
+    auto client = std::dynamic_pointer_cast<TmxGpsdBrokerClient>(broker);
+    BOOST_REQUIRE(client);
+
+    _tpv = 0;
+    _sky = 0;
+
+    client->initialize(ctx);
+    client->subscribe(ctx, "gpsd/TPV", _counter.descriptor());
+    client->subscribe(ctx, "gpsd/SKY", _counter.descriptor());
+    client->connect(ctx);
+
+    // Several reports arrive in each read, and none of them may be left behind
+    BOOST_CHECK(wait_for([&ctx]() { return ctx.get_state() >= TmxBrokerState::connected; }));
+    BOOST_CHECK(wait_for([tpv, sky]() { return _tpv == tpv && _sky == sky; }));
+    BOOST_CHECK_EQUAL(_tpv, tpv);
+    BOOST_CHECK_EQUAL(_sky, sky);
+
+    // The location comes straight from libgps, so check it against the JSON
+    auto field = [](std::string const &report, std::string const &name) {
+        std::smatch match;
+        std::regex_search(report, match, std::regex("\"" + name + "\":([-0-9.]+)"));
+        return match.size() > 1 ? std::stod(match[1]) : 0.0;
+    };
+
+    auto location = client->get_location(ctx);
+    BOOST_CHECK_EQUAL(location.fixes, tpv);
+    BOOST_CHECK_EQUAL(location.mode, (int)field(lastTpv, "mode"));
+    BOOST_CHECK_CLOSE(location.latitude, field(lastTpv, "lat"), 1e-9);
+    BOOST_CHECK_CLOSE(location.longitude, field(lastTpv, "lon"), 1e-9);
+    BOOST_CHECK_CLOSE(location.altitude, field(lastTpv, "altHAE"), 1e-9);
+    BOOST_CHECK_CLOSE(location.eph, field(lastTpv, "eph"), 1e-9);
+    BOOST_CHECK_CLOSE(location.hdop, field(lastSky, "hdop"), 1e-9);
+    BOOST_CHECK_EQUAL(location.satellites_used, (int)field(lastSky, "uSat"));
+
+    client->unsubscribe(ctx, "gpsd/TPV", _counter.descriptor());
+    client->unsubscribe(ctx, "gpsd/SKY", _counter.descriptor());
+    client->disconnect(ctx);
+    wait_for([&ctx]() { return ctx.get_state() == TmxBrokerState::disconnected; });
+    client->destroy(ctx);
+
+    // The location is forgotten along with the context
+    BOOST_CHECK_EQUAL(client->get_location(ctx).fixes, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} /* End namespace test */
+} /* End namespace gpsd */
+} /* End namespace broker */
+} /* End namespace tmx */
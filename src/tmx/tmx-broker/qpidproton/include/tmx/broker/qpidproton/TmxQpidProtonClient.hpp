@@ -36,6 +36,12 @@ namespace qpidproton {
  * The Qpid Proton messaging handler callback functions all invoke the
  * appropriate the TMX callbacks, making this client a good example
  * for asynchronous implementations using the TMX Broker API.
+ *
+ * Published messages go out on one sender link per topic, which is
+ * opened on first use and kept for the life of the connection. Each
+ * link queues up to sender-queue-size messages while it waits for
+ * credit, and reports the accepted messages every settle-batch
+ * settlements instead of one at a time.
  */
 class TmxQpidProtonClient : public TmxBrokerClient,
                             private proton::messaging_handler {
@@ -71,6 +77,9 @@ private:
     proton::container &get_container(TmxBrokerContext &ctx) noexcept;
     proton::connection &get_connection(TmxBrokerContext &ctx, proton::connection * = nullptr) noexcept;
 
+    // Close all the sender links, which fails any messages still waiting on them
+    void close_senders(TmxBrokerContext &ctx, common::TmxError const &) noexcept;
+
     // Initialization handlers
     void on_container_start(proton::container &) override;
     void on_container_stop(proton::container &) override;
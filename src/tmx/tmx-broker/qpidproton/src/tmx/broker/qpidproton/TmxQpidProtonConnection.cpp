@@ -98,6 +98,10 @@ void TmxQpidProtonClient::on_connected(tmx::broker::TmxBrokerContext &ctx, const
 void TmxQpidProtonClient::on_connection_open(proton::connection &c) {
     TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION << " for " << c.container().id();
 
+    // The sender links from before a reconnect are not used again
+    if (c.reconnected())
+        this->close_senders(this->get_context(c.container()), { ENOTCONN, "Connection was re-established." });
+
     // Connection was successful. Save the new object
     this->get_connection(this->get_context(c.container()), &c);
     this->on_connected(this->get_context(c.container()), this->to_error(c.error()));
@@ -151,8 +155,9 @@ void TmxQpidProtonClient::on_transport_close(proton::transport &t) {
     // reconnect attempts and no more event functions.
     // Therefore, this must be the final use for the connection
     auto &ctx = this->get_context(t.connection().container());
-    std::lock_guard<std::mutex> lock{ ctx.get_thread_lock() };
+    this->close_senders(ctx, this->to_error(t.error()));
 
+    std::lock_guard<std::mutex> lock{ ctx.get_thread_lock() };
     ctx.erase(typename types::Properties_::key_t("connection"));
     this->on_disconnected(ctx, this->to_error(t.error()));
 }
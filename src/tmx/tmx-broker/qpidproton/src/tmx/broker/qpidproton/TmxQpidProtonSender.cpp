@@ -27,8 +27,12 @@
 #include <proton/tracker.hpp>
 #include <proton/work_queue.hpp>
 
-#include <queue>
+#include <algorithm>
+#include <deque>
+#include <filesystem>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 using namespace tmx::common;
 using namespace tmx::message;
@@ -37,16 +41,145 @@ namespace tmx {
 namespace broker {
 namespace qpidproton {
 
-void TmxQpidProtonClient::publish(TmxBrokerContext &ctx, TmxMessage const &msg) noexcept {
-    // Make a copy of the message
-    std::shared_ptr<TmxMessage> message;
-    try {
-        message = std::make_shared<TmxMessage>(msg);
-    } catch (std::exception &ex) {
-        this->on_published(ctx, { ex }, msg);
+/*!
+ * @brief An open sender link for one topic, with the messages that are waiting on it
+ *
+ * The link stays open for as long as the connection does. Messages wait in
+ * a bounded queue until the peer grants credit, and the messages that were
+ * sent but not yet settled are kept in send order, by sequence number.
+ */
+struct TmxQpidProtonSenderLink {
+    std::string topic;
+    proton::sender sender;
+
+    std::deque<std::shared_ptr<TmxMessage> > queue;
+    std::size_t maxQueue = 1000;
+
+    std::deque<std::shared_ptr<TmxMessage> > unsettled;
+    std::uintptr_t firstSequence = 1;
+
+    std::size_t accepted = 0;
+    std::size_t settleBatch = 100;
+};
+
+typedef std::unordered_map<std::string, std::shared_ptr<TmxQpidProtonSenderLink> > sender_cache;
+
+static typename types::Properties_::key_t _senders { "senders" };
+
+/*!
+ * @brief The open sender links for the context, by topic
+ *
+ * The links must only be used from the work queue of the connection.
+ */
+static std::shared_ptr<sender_cache> get_sender_cache(TmxBrokerContext &ctx) noexcept {
+    std::lock_guard<std::mutex> lock { ctx.get_thread_lock() };
+    if (!ctx.count(_senders))
+        return ctx[_senders].emplace<std::shared_ptr<sender_cache> >(std::make_shared<sender_cache>());
+
+    return types::as<sender_cache>(ctx.at(_senders));
+}
+
+static proton::message to_proton_message(TmxMessage const &message, std::string const &address) {
+    proton::message m;
+    m.address(address);
+    m.content_type(message.get_id());
+    m.subject(message.get_source());
+    m.content_encoding(message.get_encoding());
+    m.body(message.get_payload_string());
+
+    proton::timestamp ts{
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                    message.get_timepoint().time_since_epoch()).count()
+    };
+    m.creation_time(ts);
+
+    types::UInt<TMX_METADATA_QOS_BITS> _qos{ message.get_QoS() };
+    types::UInt<TMX_METADATA_PRIORITY_BITS> _priority{ message.get_priority() };
+    types::UInt<TMX_METADATA_BASE_BITS> _base{ message.get_base() };
+    m.priority(types::pack(_qos, _priority, _base));
+
+    types::UInt<TMX_METADATA_ASSIGNMENT_GROUP_BITS> _grp{ message.get_assignment_group() };
+    types::UInt<TMX_METADATA_ASSIGNMENT_ID_BITS> _aid{ message.get_assignment_id() };
+    m.group_sequence(types::pack(_grp, _aid));
+
+    m.delivery_count(message.get_attempt());
+    return m;
+}
+
+/*!
+ * @brief Report the accepted messages once a batch of them settles, or nothing more is outstanding
+ */
+static void report_accepted(TmxQpidProtonClient &client, TmxBrokerContext &ctx, TmxQpidProtonSenderLink &link,
+                            TmxMessage const &last) noexcept {
+    if (!link.accepted)
+        return;
+
+    if (link.accepted < link.settleBatch && !link.unsettled.empty())
         return;
+
+    std::string msg { std::to_string(link.accepted) };
+    msg.append(" message(s) accepted from sender ");
+    msg.append(link.sender.name());
+    msg.append(" on topic ");
+    msg.append(link.topic);
+    msg.append(" with connection ");
+    msg.append(ctx.get_id());
+
+    link.accepted = 0;
+    client.on_published(ctx, { 0, msg }, last);
+}
+
+/*!
+ * @brief Send as many of the waiting messages as there is credit for
+ */
+static void drain(TmxQpidProtonClient &client, TmxBrokerContext &ctx, TmxQpidProtonSenderLink &link) noexcept {
+    while (!link.queue.empty() && link.sender.credit() > 0) {
+        auto message = std::move(link.queue.front());
+        link.queue.pop_front();
+
+        TLOG(DEBUG2) << "Writing " << message->get_length() << " bytes to broker topic "
+                     << message->get_topic() << " on sender " << link.sender.name();
+
+        auto tracker = link.sender.send(to_proton_message(*message, link.sender.target().address()));
+        if (tracker.settled()) {
+            // Sent pre-settled, so there is no settlement to wait for
+            link.accepted++;
+            report_accepted(client, ctx, link, *message);
+        } else {
+            tracker.user_data(reinterpret_cast<void *>(link.firstSequence + link.unsettled.size()));
+            link.unsettled.push_back(std::move(message));
+        }
+    }
+}
+
+/*!
+ * @brief Forget the link, and report all its outstanding messages as failed
+ */
+static void drop_link(TmxQpidProtonClient &client, TmxBrokerContext &ctx, proton::sender &s,
+                      TmxError const &err) noexcept {
+    auto ptr = static_cast<TmxQpidProtonSenderLink *>(s.user_data());
+    if (!ptr)
+        return;
+
+    s.user_data(nullptr);
+
+    auto cache = get_sender_cache(ctx);
+    auto link = (*cache)[ptr->topic];
+    cache->erase(ptr->topic);
+
+    if (!link)
+        return;
+
+    for (auto const &message: link->unsettled) {
+        if (message)
+            client.on_published(ctx, err, *message);
     }
 
+    for (auto const &message: link->queue)
+        client.on_published(ctx, err, *message);
+}
+
+void TmxQpidProtonClient::publish(TmxBrokerContext &ctx, TmxMessage const &msg) noexcept {
     if (!this->is_connected(ctx)) {
         std::string err{ "No connection established to " };
         err.append(ctx.to_string());
@@ -54,28 +187,90 @@ void TmxQpidProtonClient::publish(TmxBrokerContext &ctx, TmxMessage const &msg)
         err.append(enums::enum_name(ctx.get_state()));
         err.append(".");
 
-        this->on_published(ctx, { ENOTCONN, err }, *message);
+        this->on_published(ctx, { ENOTCONN, err }, msg);
         return;
     }
 
-    this->get_container(ctx).schedule(proton::duration(), [this, &ctx, message]() -> void {
-         auto &connection = this->get_connection(ctx);
+    // Make a copy of the message
+    std::shared_ptr<TmxMessage> message;
+    try {
+        message = std::make_shared<TmxMessage>(msg);
+    } catch (std::exception &ex) {
+        this->on_published(ctx, { ex }, msg);
+        return;
+    }
+
+    // The sender links are only used from the connection work queue, so they need no lock
+    bool queued = this->get_connection(ctx).work_queue().add([this, &ctx, message]() {
+        // The connection may have been replaced since the task was queued
+        auto &connection = this->get_connection(ctx);
+        auto cache = get_sender_cache(ctx);
+
+        std::string topic { message->get_topic().c_str() };
+        auto &link = (*cache)[topic];
+        if (!link) {
+            link = std::make_shared<TmxQpidProtonSenderLink>();
+            link->topic = topic;
+
+            const TmxData params { ctx.get_parameters() };
+            if (params["sender-queue-size"])
+                link->maxQueue = params["sender-queue-size"];
+            if (params["settle-batch"])
+                link->settleBatch = std::max<std::size_t>(1, params["settle-batch"]);
 
-        // Create a new sender for this topic and attach the message
-        connection.work_queue().add([&connection, message]() {
             // AMPQ topic names have a dot separator instead of slash
-            std::string topic { message->get_topic().c_str() };
-            std::replace(topic.begin(), topic.end(), std::filesystem::path::preferred_separator, '.');
+            std::string address { topic };
+            std::replace(address.begin(), address.end(), std::filesystem::path::preferred_separator, '.');
+
+            link->sender = connection.open_sender(address, connection.container().sender_options());
+            link->sender.user_data(link.get());
+        }
+
+        if (link->queue.size() >= link->maxQueue) {
+            std::string err{ "Dropping message with full queue of " };
+            err.append(std::to_string(link->queue.size()));
+            err.append(" for sender ");
+            err.append(link->sender.name());
+            err.append(" on topic ");
+            err.append(topic);
+            err.append(" with connection ");
+            err.append(ctx.get_id());
 
-            connection.open_sender(topic, connection.container().sender_options()).user_data(
-                    new decltype(message)(message));
-        });
+            this->on_published(ctx, { EBUSY, err }, *message);
+            return;
+        }
+
+        link->queue.push_back(message);
+        drain(*this, ctx, *link);
     });
 
+    if (!queued) {
+        std::string err{ "Connection to " };
+        err.append(ctx.to_string());
+        err.append(" is no longer accepting work.");
+
+        this->on_published(ctx, { ENOTCONN, err }, msg);
+        return;
+    }
+
     // Results will be determined asynchronously
     std::this_thread::yield();
 }
 
+void TmxQpidProtonClient::close_senders(TmxBrokerContext &ctx, common::TmxError const &err) noexcept {
+    auto cache = get_sender_cache(ctx);
+
+    std::vector<proton::sender> senders;
+    for (auto const &link: *cache)
+        if (link.second)
+            senders.push_back(link.second->sender);
+
+    for (auto &s: senders)
+        drop_link(*this, ctx, s, err);
+
+    cache->clear();
+}
+
 void TmxQpidProtonClient::on_published(TmxBrokerContext &ctx, common::TmxError const &err,
                                        message::TmxMessage const &msg) noexcept {
     TmxBrokerClient::on_published(ctx, err, msg);
@@ -117,91 +312,69 @@ void TmxQpidProtonClient::on_sender_open(proton::sender &s) {
 
 void TmxQpidProtonClient::on_sender_close(proton::sender &s) {
     TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION << " for " << s.container().id();
+
+    drop_link(*this, this->get_context(s.container()), s, { ENOTCONN, "Sender " + s.name() + " was closed." });
 }
 
 void TmxQpidProtonClient::on_sender_detach(proton::sender &s) {
     TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION << " for " << s.container().id();
+
+    drop_link(*this, this->get_context(s.container()), s, { ENOTCONN, "Sender " + s.name() + " was detached." });
 }
 
 void TmxQpidProtonClient::on_sender_error(proton::sender &s) {
     TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION << " for " << s.container().id();
 
-    // We at least know the topic
-    TmxMessage tmp;
-    tmp.set_topic(TmxTypeRegistry(s.target().address()).get_namespace().data());
+    auto &ctx = this->get_context(s.container());
+    if (s.user_data()) {
+        drop_link(*this, ctx, s, this->to_error(s.error()));
+    } else {
+        // We at least know the topic
+        TmxMessage tmp;
+        tmp.set_topic(TmxTypeRegistry(s.target().address()).get_namespace().data());
 
-    this->on_published(this->get_context(s.container().id()), this->to_error(s.error()), tmp);
+        this->on_published(ctx, this->to_error(s.error()), tmp);
+    }
 }
 
 void TmxQpidProtonClient::on_sendable(proton::sender &s) {
     TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION << " for " << s.container().id();
 
-    // See if there is a message to send
-    auto msg = (std::shared_ptr<TmxMessage> *)s.user_data();
-    s.user_data(nullptr);
-
-    if (msg && msg->get()) {
-        auto const &message = *(msg->get());
-
-        if (!s.credit()) {
-            std::string err{ "Dropping message with no credits for sender " };
-            err.append(s.name());
-            err.append(" on topic ");
-            err.append(message.get_topic());
-            err.append(" with connection ");
-            err.append(s.container().id());
-
-            this->on_published(this->get_context(s.container()), { EBUSY, err }, message);
-            return;
-        }
-
-        TLOG(DEBUG2) << "Writing " << message.get_length() << " bytes to broker topic "
-                     << message.get_topic() << " on sender " << s.name();
-
-        // Build a Qpid Proton message from the TMX message
-        proton::message m;
-        m.address(s.target().address());
-        m.content_type(message.get_id());
-        m.subject(message.get_source());
-        m.content_encoding(message.get_encoding());
-        m.body(message.get_payload_string());
-
-        proton::timestamp ts{
-                std::chrono::duration_cast<std::chrono::milliseconds>(
-                        message.get_timepoint().time_since_epoch()).count()
-        };
-        m.creation_time(ts);
-
-        types::UInt<TMX_METADATA_QOS_BITS> _qos{ message.get_QoS() };
-        types::UInt<TMX_METADATA_PRIORITY_BITS> _priority{ message.get_priority() };
-        types::UInt<TMX_METADATA_BASE_BITS> _base{ message.get_base() };
-        m.priority(types::pack(_qos, _priority, _base));
-
-        types::UInt<TMX_METADATA_ASSIGNMENT_GROUP_BITS> _grp{ message.get_assignment_group() };
-        types::UInt<TMX_METADATA_ASSIGNMENT_ID_BITS> _aid{ message.get_assignment_id() };
-        m.group_sequence(types::pack(_grp, _aid));
-
-        m.delivery_count(message.get_attempt());
-
-        // Always assign the TMX message to the tracker
-        s.send(m).user_data(new std::shared_ptr<TmxMessage>(*msg));
-    }
-
-    delete msg;
+    // Credit arrived, so send what is waiting
+    auto link = static_cast<TmxQpidProtonSenderLink *>(s.user_data());
+    if (link)
+        drain(*this, this->get_context(s.container()), *link);
 }
 
 void TmxQpidProtonClient::on_tracker_settle(proton::tracker &t) {
     TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION << " with " << t.container().id();
 
-    auto ptr = (std::shared_ptr<TmxMessage> *)t.user_data();
+    auto &ctx = this->get_context(t.container());
+    auto link = static_cast<TmxQpidProtonSenderLink *>(t.sender().user_data());
+    auto seq = reinterpret_cast<std::uintptr_t>(t.user_data());
+    t.user_data(nullptr);
+
+    // Find the message by its place in the send order, which is usually the first one
+    std::shared_ptr<TmxMessage> message;
+    if (link && seq >= link->firstSequence && seq - link->firstSequence < link->unsettled.size()) {
+        message = std::move(link->unsettled[seq - link->firstSequence]);
+
+        while (!link->unsettled.empty() && !link->unsettled.front()) {
+            link->unsettled.pop_front();
+            link->firstSequence++;
+        }
+    }
 
     // We at least know the topic
     TmxMessage tmp;
     tmp.set_topic(TmxTypeRegistry(t.sender().target().address()).get_namespace().data());
+    if (message)
+        tmp = *message;
 
-    if (ptr) {
-        tmp = *(ptr->get());
-        delete ptr;
+    if (t.state() == proton::transfer::ACCEPTED && link) {
+        link->accepted++;
+        report_accepted(*this, ctx, *link, tmp);
+        return;
     }
 
     std::string msg { "Message from sender "};
@@ -213,8 +386,7 @@ void TmxQpidProtonClient::on_tracker_settle(proton::tracker &t) {
     msg.append(" with connection ");
     msg.append(t.sender().container().id());
 
-    this->on_published(this->get_context(t.container().id()), { t.state() == proton::transfer::ACCEPTED ? 0 : (int)t.state(), msg }, tmp);
-    t.sender().close();
+    this->on_published(ctx, { t.state() == proton::transfer::ACCEPTED ? 0 : (int)t.state(), msg }, tmp);
 }
 
 } /* End namespace qpidproton */
@@ -0,0 +1,158 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxQpidProtonSender_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/broker/TmxBrokerClient.hpp>
+#include <tmx/broker/TmxBrokerContext.hpp>
+#include <tmx/message/TmxMessage.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <proton/connection.hpp>
+#include <proton/container.hpp>
+#include <proton/delivery.hpp>
+#include <proton/listener.hpp>
+#include <proton/message.hpp>
+#include <proton/messaging_handler.hpp>
+#include <proton/receiver.hpp>
+#include <proton/receiver_options.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <string>
+#include <thread>
+
+using namespace tmx::common;
+using namespace tmx::message;
+
+namespace tmx {
+namespace broker {
+namespace qpidproton {
+namespace test {
+
+#define BENCH_LISTEN_ADDRESS "127.0.0.1:25672"
+#define BENCH_MESSAGE_SIZE 200
+#define BENCH_MESSAGE_COUNT 20000
+#define BENCH_WINDOW 500
+#define BENCH_TIMEOUT_S 20
+
+template <typename _Pred, typename _Duration = std::chrono::seconds>
+bool wait_for(_Pred &&pred, _Duration timeout = std::chrono::seconds(5)) {
+    auto end = std::chrono::steady_clock::now() + timeout;
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > end)
+            return false;
+
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    return true;
+}
+
+/*!
+ * @brief An in-process AMQP peer that accepts every link and counts the messages
+ */
+class TestListener: public proton::messaging_handler {
+public:
+    TestListener(): _container(*this, "qpid-bench-listener") {
+        _thread = std::thread([this]() { _container.run(); });
+    }
+
+    ~TestListener() {
+        _container.stop();
+        if (_thread.joinable())
+            _thread.join();
+    }
+
+    std::atomic<bool> listening { false };
+    std::atomic<std::size_t> received { 0 };
+    std::atomic<std::size_t> links { 0 };
+
+private:
+    void on_container_start(proton::container &c) override {
+        _listener = c.listen(BENCH_LISTEN_ADDRESS);
+        listening = true;
+    }
+
+    void on_receiver_open(proton::receiver &r) override {
+        links++;
+        if (r.uninitialized())
+            r.open(proton::receiver_options().credit_window(BENCH_WINDOW));
+    }
+
+    void on_message(proton::delivery &, proton::message &) override {
+        received++;
+    }
+
+    proton::container _container;
+    proton::listener _listener;
+    std::thread _thread;
+};
+
+BOOST_AUTO_TEST_SUITE(qpid_proton_sender_test_suite)
+
+BOOST_AUTO_TEST_CASE(local_listener_throughput) {
+    TestListener listener;
+    BOOST_REQUIRE(wait_for([&listener]() -> bool { return listener.listening; }));
+
+    TmxBrokerContext client { "amqp://" BENCH_LISTEN_ADDRESS, "qpid-bench-client" };
+
+    auto broker = TmxBrokerClient::get_broker(client);
+    BOOST_REQUIRE(broker);
+
+    broker->initialize(client);
+    broker->connect(client);
+    BOOST_REQUIRE(wait_for([&client]() { return client.get_state() >= TmxBrokerState::connected; }));
+
+    TmxMessage msg;
+    msg.set_topic("Bench/Sender");
+    msg.set_payload(std::string(BENCH_MESSAGE_SIZE, '\x5A'));
+
+    auto end = std::chrono::steady_clock::now() + std::chrono::seconds(BENCH_TIMEOUT_S);
+    auto cpuStart = std::clock();
+    auto start = std::chrono::steady_clock::now();
+
+    // Each burst is bigger than the first grant of credit, so some have to wait in the queue
+    std::size_t sent = 0;
+    while (sent < BENCH_MESSAGE_COUNT && std::chrono::steady_clock::now() < end) {
+        for (std::size_t i = 0; i < 2 * BENCH_WINDOW; i++, sent++)
+            broker->publish(client, msg);
+
+        std::size_t last = listener.received;
+        while (listener.received < sent &&
+               wait_for([&listener, last]() { return listener.received > last; }, std::chrono::milliseconds(100)))
+            last = listener.received;
+    }
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto cpu = (double)(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+    std::size_t received = listener.received;
+
+    BOOST_TEST_MESSAGE("Sent " << sent << " and received " << received << " messages of " <<
+                       BENCH_MESSAGE_SIZE << " bytes in " << elapsed << "s: " <<
+                       (std::size_t)(received / elapsed) << " messages/s, " <<
+                       (received ? cpu * 1e6 / received : 0.0) << "us CPU/message");
+
+    // Nothing is dropped, and the topic only ever needed one link
+    BOOST_CHECK_EQUAL(received, sent);
+    BOOST_CHECK_EQUAL(listener.links, 1u);
+
+    broker->disconnect(client);
+    wait_for([&client]() { return client.get_state() == TmxBrokerState::disconnected; });
+    broker->destroy(client);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} /* End namespace test */
+} /* End namespace qpidproton */
+} /* End namespace broker */
+} /* End namespace tmx */
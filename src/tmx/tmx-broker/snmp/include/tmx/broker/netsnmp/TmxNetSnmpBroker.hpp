@@ -20,12 +20,38 @@
 #include <tmx/common/types/Any.hpp>
 #include <tmx/message/TmxMessage.hpp>
 
+#include <functional>
+
 namespace tmx {
 namespace broker {
 namespace netsnmp {
 
+/*!
+ * @brief A broker client for SNMP agents, such as an RSU
+ *
+ * Requests are sent without waiting for the response, so each connected
+ * agent can have many requests outstanding at once. The responses are
+ * read as they arrive by an asynchronous I/O thread pool, which is either
+ * the broker context executor or a new pool of "asio-pool-size" threads.
+ *
+ * Publishing to a topic starting with "snmpget", "snmpset" or "snmpwalk"
+ * sends the OIDs or OID:value pairs in the payload. The response to a get
+ * or walk is delivered to the subscribers. A walk reads every object in
+ * the tables below the given OIDs, at most "max-repetitions" per request.
+ */
 class TmxNetSnmpBrokerClient: public TmxBrokerClient {
 public:
+    /*!
+     * @brief A handler for the result of an SNMP request
+     *
+     * The handler is invoked from the I/O thread pool, so it must not
+     * block on another SNMP request.
+     *
+     * @param[in] err The result of the operation
+     * @param[in] results The OID:value pairs returned by the agent
+     */
+    typedef std::function<void(common::TmxError const &, common::types::Any &)> snmp_handler;
+
     TmxNetSnmpBrokerClient() noexcept;
 
     common::TmxTypeDescriptor get_descriptor() const noexcept override;
@@ -64,6 +90,53 @@ public:
      */
     common::TmxError snmp_set(TmxBrokerContext &ctx,
                               common::types::Properties<common::types::Any> const &oids) const noexcept;
+
+    /*!
+     * @brief Make an SNMP walk of the tables below the given OIDs
+     *
+     * The broker context must already be connected
+     *
+     * @param[in] ctx The broker context to use
+     * @param[in] oids The root OIDs of the tables to read
+     * @param[in] results A container to hold the results
+     * @return The result of the operation
+     */
+    common::TmxError snmp_walk(TmxBrokerContext &ctx,
+                               common::types::Properties<common::types::Any> const &oids,
+                               common::types::Any &results) const noexcept;
+
+    /*!
+     * @brief Send an SNMP get request without waiting for the response
+     *
+     * @param[in] ctx The broker context to use
+     * @param[in] oids The OIDs to request
+     * @param[in] handler The handler for the response
+     */
+    void async_get(TmxBrokerContext &ctx, common::types::Properties<common::types::Any> const &oids,
+                   snmp_handler handler) const noexcept;
+
+    /*!
+     * @brief Send an SNMP set request without waiting for the response
+     *
+     * @param[in] ctx The broker context to use
+     * @param[in] oids The OIDs and associated values to set
+     * @param[in] handler The handler for the response
+     */
+    void async_set(TmxBrokerContext &ctx, common::types::Properties<common::types::Any> const &oids,
+                   snmp_handler handler) const noexcept;
+
+    /*!
+     * @brief Start an SNMP walk without waiting for the response
+     *
+     * Each table is read with GETBULK requests, or GETNEXT for SNMP
+     * version 1, and all the tables are read at the same time.
+     *
+     * @param[in] ctx The broker context to use
+     * @param[in] oids The root OIDs of the tables to read
+     * @param[in] handler The handler for the complete response
+     */
+    void async_walk(TmxBrokerContext &ctx, common::types::Properties<common::types::Any> const &oids,
+                    snmp_handler handler) const noexcept;
 };
 
 } /* End namespace netsnmp */
@@ -25,14 +25,26 @@
 #include <net-snmp/net-snmp-includes.h>
 #include <arpa/inet.h>
 #include <bitset>
+#include <boost/asio.hpp>
+#include <chrono>
 #include <future>
+#include <memory>
+#include <mutex>
 #include <netdb.h>
+#include <poll.h>
+#include <shared_mutex>
 #include <sys/socket.h>
 #include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #define BUFFER_SIZE 1024
 
+#ifndef TMX_SNMP_MAX_REPETITIONS
+#define TMX_SNMP_MAX_REPETITIONS 25
+#endif
+
 using namespace tmx::common;
 using namespace tmx::message;
 using namespace tmx::message::codec::serializer;
@@ -59,6 +71,565 @@ enum class SNMP_SECURITY_LEVEL: std::uint8_t {
 static const typename types::Properties_::key_t _session { "session" };
 static const typename types::Properties_::key_t _handle  { "handle" };
 
+/*!
+ * @brief An OID string resolved against the MIB tree
+ */
+struct TmxNetSnmpOid {
+    std::vector<oid> name;
+    u_char type = 0;
+};
+
+static std::shared_mutex _oidLock;
+static std::unordered_map<std::string, std::shared_ptr<const TmxNetSnmpOid> > _oidCache;
+
+/*!
+ * @brief Resolve the OID string, which is only searched for in the MIB tree once
+ *
+ * An OID that is not found is not saved, since more MIBs may be loaded later.
+ *
+ * @param[in] str The OID string, either numeric or by MIB name
+ * @return The resolved OID, or null if it was not found
+ */
+static std::shared_ptr<const TmxNetSnmpOid> resolve_oid(std::string const &str) noexcept {
+    {
+        std::shared_lock<std::shared_mutex> lock(_oidLock);
+        auto iter = _oidCache.find(str);
+        if (iter != _oidCache.end())
+            return iter->second;
+    }
+
+    // The MIB tree is not safe to search from more than one thread
+    std::unique_lock<std::shared_mutex> lock(_oidLock);
+    auto iter = _oidCache.find(str);
+    if (iter != _oidCache.end())
+        return iter->second;
+
+    oid theOid[MAX_OID_LEN];
+    size_t theOid_len = MAX_OID_LEN;
+
+    int found = 0;
+    if (!str.empty() && str[0] == '.')
+        found = read_objid(str.c_str(), theOid, &theOid_len);
+    else if (!str.empty())
+        found = get_node(str.c_str(), theOid, &theOid_len);
+
+    if (!found)
+        return { };
+
+    auto resolved = std::make_shared<TmxNetSnmpOid>();
+    resolved->name.assign(theOid, theOid + theOid_len);
+
+    auto tp = get_tree(theOid, theOid_len, get_tree_head());
+    if (tp)
+        resolved->type = tp->type;
+
+    _oidCache.emplace(str, resolved);
+    return resolved;
+}
+
+static void clear_oid_cache() noexcept {
+    std::unique_lock<std::shared_mutex> lock(_oidLock);
+    _oidCache.clear();
+}
+
+/*!
+ * @brief Write the variable value to the results, by its OID name
+ */
+static void set_value(TmxData &values, netsnmp_variable_list *vars) noexcept {
+    typename types::Properties_::key_t nm;
+
+    if (vars->name) {
+        char nameBuf[BUFFER_SIZE];
+        auto chars = snprint_objid(nameBuf, BUFFER_SIZE, vars->name, vars->name_length);
+        nm.assign(nameBuf, chars);
+    }
+
+    values[nm] = types::Null();
+
+    if (vars->type == SNMP_NOSUCHOBJECT ||
+        vars->type == SNMP_NOSUCHINSTANCE ||
+        vars->type == SNMP_ENDOFMIBVIEW ||
+        vars->type == ASN_NULL)
+        return;
+
+    auto &_tmp = values[nm].get_container().emplace<std::string>(4096, '\0');
+    _tmp.resize(snprint_value(_tmp.data(), _tmp.capacity(), vars->name, vars->name_length, vars));
+
+    auto idx = _tmp.find_first_of(':');
+    if (idx < _tmp.length())
+        _tmp = _tmp.substr(idx + 2);
+
+    TLOG(DEBUG3) << nm << ": " << _tmp;
+}
+
+/*!
+ * @brief Add the value to set for the OID, based on its MIB type
+ */
+static void add_value(netsnmp_pdu *pdu, TmxNetSnmpOid const &resolved, TmxData const &value) noexcept {
+    auto theOid = resolved.name.data();
+    auto theOid_len = resolved.name.size();
+
+    switch (resolved.type) {
+        case ASN_OCTET_STR:
+        {
+            std::string copy = value.to_string();
+            snmp_pdu_add_variable(pdu, theOid, theOid_len, resolved.type, (const void *)copy.c_str(), copy.length());
+            break;
+        }
+        case ASN_BOOLEAN:
+        {
+            int copy = (int)(value.to_bool());
+            snmp_pdu_add_variable(pdu, theOid, theOid_len, resolved.type, (const void *)&copy, sizeof(copy));
+            break;
+        }
+        case ASN_INTEGER:
+        {
+            long copy = value;
+            snmp_pdu_add_variable(pdu, theOid, theOid_len, resolved.type, (const void *)&copy, sizeof(copy));
+            break;
+        }
+        case ASN_TIMETICKS:
+        case ASN_COUNTER:
+        {
+            uint32_t copy = value;
+            snmp_pdu_add_variable(pdu, theOid, theOid_len, resolved.type, (const void *)&copy, sizeof(copy));
+            break;
+        }
+        case ASN_BIT_STR:
+        {
+            const std::bitset<BUFFER_SIZE> bits(value.to_uint());
+            std::string copy = bits.to_string();
+            snmp_pdu_add_variable(pdu, theOid, theOid_len, resolved.type, (const void *)&copy, sizeof(copy));
+            break;
+        }
+        case ASN_DOUBLE:
+        case ASN_FLOAT:
+        {
+            double copy = value;
+            snmp_pdu_add_variable(pdu, theOid, theOid_len, resolved.type, (const void *)&copy, sizeof(copy));
+        }
+    }
+}
+
+/*!
+ * @brief One SNMP operation, which may take more than one request to complete
+ */
+struct TmxNetSnmpTransaction {
+    int command = SNMP_MSG_GET;
+    TmxData results;
+    TmxError error;
+    std::size_t outstanding = 1;
+    TmxNetSnmpBrokerClient::snmp_handler handler;
+};
+
+/*!
+ * @brief A request that is waiting on the response from the agent
+ */
+struct TmxNetSnmpRequest {
+    std::shared_ptr<TmxNetSnmpTransaction> transaction;
+
+    // For a walk, the root of the table and the last OID requested
+    std::shared_ptr<const TmxNetSnmpOid> root;
+    std::vector<oid> last;
+};
+
+/*!
+ * @brief An open session to an SNMP agent
+ *
+ * This uses the single session API of Net-SNMP, so that each session can
+ * be used by a different thread. The agent socket and the retry timer are
+ * both watched by the ASIO thread pool, through the session strand, and
+ * every call to Net-SNMP for this session happens in that strand.
+ * Therefore, any number of requests can be waiting on a response, and
+ * a slow agent never holds up a request to any other agent.
+ */
+class TmxNetSnmpSession: public std::enable_shared_from_this<TmxNetSnmpSession> {
+public:
+    typedef boost::asio::strand<boost::asio::thread_pool::executor_type> strand_t;
+
+    TmxNetSnmpSession(void *sessp, strand_t strand, long version, long maxRepetitions) noexcept:
+            _sessp(sessp), _strand(strand), _socket(strand), _timer(strand),
+            _version(version), _maxRepetitions(maxRepetitions) {
+        auto transport = snmp_sess_transport(_sessp);
+        if (transport && transport->sock >= 0) {
+            boost::system::error_code ec;
+            _socket.assign(transport->sock, ec);
+            if (ec) {
+                TLOG(ERR) << "Unable to watch the SNMP socket: " << ec.message();
+            }
+        }
+    }
+
+    ~TmxNetSnmpSession() {
+        // The socket belongs to Net-SNMP
+        if (_socket.is_open())
+            _socket.release();
+
+        if (_sessp)
+            snmp_sess_close(_sessp);
+    }
+
+    /*!
+     * @return True if the caller is running in the session strand
+     */
+    bool running_in_this_thread() const noexcept {
+        return _strand.running_in_this_thread();
+    }
+
+    /*!
+     * @brief Send the request PDU for the transaction
+     */
+    void execute(std::shared_ptr<TmxNetSnmpTransaction> tx, netsnmp_pdu *pdu) noexcept {
+        boost::asio::post(_strand, [self = this->shared_from_this(), tx, pdu]() {
+            auto err = self->send(pdu, { tx });
+            if (err) {
+                tx->error = err;
+                self->finish(tx);
+            }
+        });
+    }
+
+    /*!
+     * @brief Start a walk of each table for the transaction
+     */
+    void walk(std::shared_ptr<TmxNetSnmpTransaction> tx,
+              std::vector<std::shared_ptr<const TmxNetSnmpOid> > roots) noexcept {
+        tx->outstanding = roots.size();
+        boost::asio::post(_strand, [self = this->shared_from_this(), tx, roots = std::move(roots)]() {
+            for (auto const &root: roots) {
+                auto err = self->next({ tx, root, root->name });
+                if (err) {
+                    tx->error = err;
+                    self->finish(tx);
+                }
+            }
+        });
+    }
+
+    /*!
+     * @brief Close the session, which fails any request still waiting
+     */
+    void close() noexcept {
+        auto done = std::make_shared<std::promise<void> >();
+        auto fn = [self = this->shared_from_this(), done]() {
+            if (self->_sessp) {
+                if (self->_socket.is_open())
+                    self->_socket.release();
+                self->_timer.cancel();
+
+                snmp_sess_close(self->_sessp);
+                self->_sessp = nullptr;
+
+                auto pending = std::move(self->_pending);
+                self->_pending.clear();
+                for (auto &request: pending) {
+                    request.second.transaction->error = { ENOTCONN, "The SNMP session was closed." };
+                    self->finish(request.second.transaction);
+                }
+            }
+
+            done->set_value();
+        };
+
+        if (this->running_in_this_thread()) {
+            fn();
+        } else {
+            auto future = done->get_future();
+            boost::asio::post(_strand, std::move(fn));
+            future.wait_for(std::chrono::seconds(1));
+        }
+    }
+
+private:
+    void finish(std::shared_ptr<TmxNetSnmpTransaction> const &tx) noexcept {
+        if (--tx->outstanding == 0 && tx->handler)
+            tx->handler(tx->error, tx->results.get_container());
+    }
+
+    TmxError error() const noexcept {
+        int liberr = 0, syserr = 0;
+        char *errstr = nullptr;
+        snmp_sess_error(_sessp, &liberr, &syserr, &errstr);
+
+        TmxError err { liberr ? liberr : -1, errstr ? errstr : "Unable to send the SNMP request." };
+        if (errstr)
+            free(errstr);
+
+        return err;
+    }
+
+    TmxError send(netsnmp_pdu *pdu, TmxNetSnmpRequest &&request) noexcept {
+        if (!_sessp) {
+            snmp_free_pdu(pdu);
+            return { ENOTCONN, "The SNMP session was closed." };
+        }
+
+        auto reqid = snmp_sess_async_send(_sessp, pdu, &TmxNetSnmpSession::on_response, this);
+        if (!reqid) {
+            snmp_free_pdu(pdu);
+            return this->error();
+        }
+
+        _pending.emplace(reqid, std::move(request));
+        this->wait();
+        return { };
+    }
+
+    TmxError next(TmxNetSnmpRequest &&request) noexcept {
+        netsnmp_pdu *pdu;
+        if (_version == SNMP_VERSION_1) {
+            pdu = snmp_pdu_create(SNMP_MSG_GETNEXT);
+        } else {
+            pdu = snmp_pdu_create(SNMP_MSG_GETBULK);
+            pdu->non_repeaters = 0;
+            pdu->max_repetitions = _maxRepetitions;
+        }
+
+        snmp_add_null_var(pdu, request.last.data(), request.last.size());
+        return this->send(pdu, std::move(request));
+    }
+
+    /*!
+     * @brief Wait for the next response or timeout, if anything is still outstanding
+     */
+    void wait() noexcept {
+        if (!_sessp || _pending.empty())
+            return;
+
+        if (!_reading && _socket.is_open()) {
+            _reading = true;
+            _socket.async_wait(boost::asio::posix::stream_descriptor::wait_read,
+                               [self = this->shared_from_this()](boost::system::error_code const &ec) {
+                self->_reading = false;
+                if (ec)
+                    return;
+
+                self->read();
+                self->wait();
+            });
+        }
+
+        int numfds = 0, block = 1;
+        struct timeval timeout { 0, 0 };
+        netsnmp_large_fd_set fdset;
+        netsnmp_large_fd_set_init(&fdset, FD_SETSIZE);
+        snmp_sess_select_info2(_sessp, &numfds, &fdset, &timeout, &block);
+        netsnmp_large_fd_set_cleanup(&fdset);
+
+        if (block)
+            return;
+
+        // Later requests time out later, so only move the timer up
+        auto expiry = std::chrono::steady_clock::now() + std::chrono::seconds(timeout.tv_sec) +
+                      std::chrono::microseconds(timeout.tv_usec);
+        if (_timing && _timer.expiry() <= expiry)
+            return;
+
+        _timing = true;
+        _timer.expires_at(expiry);
+        _timer.async_wait([self = this->shared_from_this()](boost::system::error_code const &ec) {
+            if (ec)
+                return;
+
+            self->_timing = false;
+            if (self->_sessp) {
+                // Any response that came in must be read before it is retried
+                self->read();
+                if (self->_sessp)
+                    snmp_sess_timeout(self->_sessp);
+            }
+
+            self->wait();
+        });
+    }
+
+    /*!
+     * @brief Read every response that is ready on the socket
+     */
+    void read() noexcept {
+        if (!_socket.is_open())
+            return;
+
+        auto fd = _socket.native_handle();
+        struct pollfd ready { fd, POLLIN, 0 };
+
+        while (_sessp && ::poll(&ready, 1, 0) > 0 && (ready.revents & POLLIN)) {
+            netsnmp_large_fd_set fdset;
+            netsnmp_large_fd_set_init(&fdset, fd + 1);
+            NETSNMP_LARGE_FD_SET(fd, &fdset);
+            auto ret = snmp_sess_read2(_sessp, &fdset);
+            netsnmp_large_fd_set_cleanup(&fdset);
+
+            if (ret)
+                break;
+        }
+    }
+
+    static int on_response(int op, netsnmp_session *, int reqid, netsnmp_pdu *response, void *magic) {
+        auto self = static_cast<TmxNetSnmpSession *>(magic);
+
+        auto iter = self->_pending.find(reqid);
+        if (iter == self->_pending.end())
+            return 1;
+
+        auto request = std::move(iter->second);
+        self->_pending.erase(iter);
+
+        auto &tx = *(request.transaction);
+        if (op == NETSNMP_CALLBACK_OP_TIMED_OUT)
+            tx.error = { STAT_TIMEOUT, "Timed out waiting for SNMP response." };
+        else if (op != NETSNMP_CALLBACK_OP_RECEIVED_MESSAGE || !response)
+            tx.error = { ENOTCONN, "Lost the connection to the SNMP agent." };
+        else if (request.root && self->on_walk(response, request))
+            return 1;
+        else if (!request.root && self->on_get(response, request))
+            return 1;
+
+        self->finish(request.transaction);
+        return 1;
+    }
+
+    /*!
+     * @return True if another request was sent to finish the operation
+     */
+    bool on_get(netsnmp_pdu *response, TmxNetSnmpRequest &request) noexcept {
+        auto &tx = *(request.transaction);
+
+        // Only a get can be retried without the problem OID
+        if (response->errstat && (tx.command != SNMP_MSG_GET || !response->errindex)) {
+            tx.error = { (int)response->errstat, snmp_errstring(response->errstat) };
+            return false;
+        }
+
+        if (tx.command != SNMP_MSG_GET)
+            return false;
+
+        std::size_t cnt = 0;
+        for (auto vars = response->variables; vars; vars = vars->next_variable, cnt++) {
+            // If there is a missing object on the agent, then nothing will be set
+            // Only set the value for the problem OID and then retry
+            if (response->errstat && cnt != (std::size_t)(response->errindex - 1))
+                continue;
+
+            set_value(tx.results, vars);
+        }
+
+        if (!response->errstat)
+            return false;
+
+        auto pdu = snmp_fix_pdu(response, SNMP_MSG_GET);
+        if (!pdu)
+            return false;
+
+        auto err = this->send(pdu, std::move(request));
+        if (err) {
+            tx.error = err;
+            return false;
+        }
+
+        return true;
+    }
+
+    /*!
+     * @return True if another request was sent to finish the walk
+     */
+    bool on_walk(netsnmp_pdu *response, TmxNetSnmpRequest &request) noexcept {
+        auto &tx = *(request.transaction);
+        auto const &root = request.root->name;
+
+        if (response->errstat) {
+            // SNMP version 1 agents report the end of the MIB as no such name
+            if (response->errstat != SNMP_ERR_NOSUCHNAME)
+                tx.error = { (int)response->errstat, snmp_errstring(response->errstat) };
+            return false;
+        }
+
+        bool more = false;
+        for (auto vars = response->variables; vars; vars = vars->next_variable) {
+            more = false;
+
+            if (vars->type == SNMP_ENDOFMIBVIEW ||
+                vars->type == SNMP_NOSUCHOBJECT ||
+                vars->type == SNMP_NOSUCHINSTANCE)
+                break;
+
+            // Past the end of the table
+            if (netsnmp_oid_is_subtree(root.data(), root.size(), vars->name, vars->name_length) != 0)
+                break;
+
+            // A broken agent may not move forward
+            if (snmp_oid_compare(vars->name, vars->name_length, request.last.data(), request.last.size()) <= 0) {
+                tx.error = { EILSEQ, "SNMP agent returned OIDs out of order." };
+                break;
+            }
+
+            set_value(tx.results, vars);
+            request.last.assign(vars->name, vars->name + vars->name_length);
+            more = true;
+        }
+
+        if (!more)
+            return false;
+
+        auto err = this->next(std::move(request));
+        if (err) {
+            tx.error = err;
+            return false;
+        }
+
+        return true;
+    }
+
+    void *_sessp;
+    strand_t _strand;
+    boost::asio::posix::stream_descriptor _socket;
+    boost::asio::steady_timer _timer;
+    long _version;
+    long _maxRepetitions;
+
+    bool _reading = false;
+    bool _timing = false;
+    std::unordered_map<int, TmxNetSnmpRequest> _pending;
+};
+
+static const typename types::Properties_::key_t _pool { "pool" };
+
+/*!
+ * @return The thread pool to read the responses in for this broker context
+ */
+static boost::asio::thread_pool &get_pool(TmxBrokerContext &ctx) noexcept {
+    typedef boost::asio::thread_pool pool_t;
+
+    if (ctx.count(_pool)) {
+        auto ptr = types::as<pool_t>(ctx.at(_pool));
+        if (ptr)
+            return *ptr;
+    }
+
+    // Use the current executor, if possible
+    auto exec = ctx.get_executor();
+    if (exec && exec->get_implementation()) {
+        auto pool = static_cast<pool_t *>(exec->get_implementation());
+        if (pool)
+            return *(ctx[_pool].emplace<std::shared_ptr<pool_t> >(pool, [](auto *) { }));
+    }
+
+    // Otherwise, add a new pool
+    const TmxData params { ctx.get_parameters() };
+    std::size_t threadSz = 1;
+    if (params["asio-pool-size"])
+        threadSz = params["asio-pool-size"];
+
+    return *(ctx[_pool].emplace<std::shared_ptr<pool_t> >(new pool_t(threadSz)));
+}
+
+static std::shared_ptr<TmxNetSnmpSession> get_session(TmxBrokerContext &ctx) noexcept {
+    if (!ctx.count(_handle))
+        return { };
+
+    return types::as<TmxNetSnmpSession>(ctx.at(_handle));
+}
+
 TmxNetSnmpBrokerClient::TmxNetSnmpBrokerClient() noexcept {
     this->register_broker(enums::enum_name(SNMP_VERSION::snmpv1));
     this->register_broker(enums::enum_name(SNMP_VERSION::snmpv2c));
@@ -114,6 +685,9 @@ void TmxNetSnmpBrokerClient::initialize(TmxBrokerContext &ctx) noexcept {
     init_mib_internals();
     init_mib();
 
+    // The new MIBs may resolve the names differently
+    clear_oid_cache();
+
     // Create a new session
     auto &session = ctx[_session].emplace<snmp_session>();
     snmp_sess_init(&session);
@@ -319,21 +893,27 @@ void TmxNetSnmpBrokerClient::initialize(TmxBrokerContext &ctx) noexcept {
 }
 
 void TmxNetSnmpBrokerClient::destroy(TmxBrokerContext &ctx) noexcept {
-    shutdown_mib();
-
     if (this->is_connected(ctx))
         this->disconnect(ctx);
 
+    shutdown_mib();
+    clear_oid_cache();
+
     if (ctx.count(_session)) {
         auto session = tmx::common::types::as<snmp_session>(ctx.at(_session));
         close_snmp(session.get());
     }
 
     ctx.erase(_session);
+    ctx.erase(_pool);
     TmxBrokerClient::destroy(ctx);
 }
 
 void TmxNetSnmpBrokerClient::disconnect(TmxBrokerContext &ctx) noexcept {
+    auto session = get_session(ctx);
+    if (session)
+        session->close();
+
     ctx.erase(_handle);
     TmxBrokerClient::disconnect(ctx);
 }
@@ -349,13 +929,29 @@ void TmxNetSnmpBrokerClient::connect(TmxBrokerContext &ctx, types::Any const &p)
         return;
     }
 
-    // Use the destructor function in the smart pointer
-    auto session = ctx[_handle].emplace<std::shared_ptr<snmp_session> >(snmp_open(init.get()), &snmp_close);
-    if (!session) {
-        this->on_connected(ctx, { -1, "snmp_open() failed for unknown reason." });
+    auto sessp = snmp_sess_open(init.get());
+    if (!sessp) {
+        int liberr = 0, syserr = 0;
+        char *errstr = nullptr;
+        snmp_error(init.get(), &liberr, &syserr, &errstr);
+
+        TmxError err { liberr ? liberr : -1, errstr ? errstr : "snmp_sess_open() failed for unknown reason." };
+        if (errstr)
+            free(errstr);
+
+        this->on_connected(ctx, err);
         return;
     }
 
+    const TmxData params { ctx.get_parameters() };
+    long maxRepetitions = TMX_SNMP_MAX_REPETITIONS;
+    if (params["max-repetitions"])
+        maxRepetitions = params["max-repetitions"].to_int();
+
+    ctx[_handle].emplace<std::shared_ptr<TmxNetSnmpSession> >(
+            std::make_shared<TmxNetSnmpSession>(sessp, boost::asio::make_strand(get_pool(ctx)),
+                                                init->version, maxRepetitions));
+
     TmxBrokerClient::connect(ctx, p);
 }
 
@@ -371,48 +967,48 @@ void TmxNetSnmpBrokerClient::publish(TmxBrokerContext &ctx, message::TmxMessage
     auto result = _codec.decode(_data.get_container());
     if (result) {
         this->on_published(ctx, result, msg);
-        this->disconnect(ctx);
         return;
     }
 
-    if (_codec.get_message().get_source().empty())
-        _codec.get_message().set_source(ctx.get_id());
-
     if (!_data.is_map()) {
         this->on_published(ctx, { 7, "Unable to get OID:value pairs from message" }, msg);
-        this->disconnect(ctx);
         return;
     }
 
+    // The response comes back later, so the agent is free to take other requests
     auto oids = _data.to_map();
     if (std::strncmp("snmpset", msg.get_topic().c_str(), 7) == 0) {
-        this->on_published(ctx, this->snmp_set(ctx, oids), msg);
-        this->disconnect(ctx);
-        return;
-    } else if (std::strncmp("snmpget", msg.get_topic().c_str(), 7) == 0) {
-        types::Any results;
-        result = this->snmp_get(ctx, oids, results);
-        this->on_published(ctx, result, msg);
+        this->async_set(ctx, oids, [this, &ctx, msg](TmxError const &err, types::Any &) {
+            this->on_published(ctx, err, msg);
+        });
+    } else if (std::strncmp("snmpget", msg.get_topic().c_str(), 7) == 0 ||
+               std::strncmp("snmpwalk", msg.get_topic().c_str(), 8) == 0) {
+        auto handler = [this, &ctx, msg](TmxError const &err, types::Any &results) {
+            this->on_published(ctx, err, msg);
+            if (err)
+                return;
+
+            codec::TmxCodec _codec(msg);
+            if (_codec.get_message().get_source().empty())
+                _codec.get_message().set_source(ctx.get_id());
 
-        if (!result) {
             // Encode the message
-            result = _codec.encode(results, "json");
+            auto result = _codec.encode(results, "json");
             if (result) {
                 this->on_error(ctx, result);
-                this->disconnect(ctx);
                 return;
             }
 
-            types::Any _id;
-            _id.emplace<std::string>(ctx.get_id());
-
             // Invoke the callbacks
             this->callback(ctx.get_id(), _codec.get_message());
-        }
+        };
+
+        if (msg.get_topic()[4] == 'w')
+            this->async_walk(ctx, oids, std::move(handler));
+        else
+            this->async_get(ctx, oids, std::move(handler));
     } else {
-        this->on_published(ctx, { 0, "Topic name " + msg.get_topic() + " skipped: Must start with set or get" }, msg);
-        this->disconnect(ctx);
-        return;
+        this->on_published(ctx, { 0, "Topic name " + msg.get_topic() + " skipped: Must start with snmpget, snmpset or snmpwalk" }, msg);
     }
 }
 
@@ -453,173 +1049,166 @@ void TmxNetSnmpBrokerClient::unsubscribe(TmxBrokerContext &ctx, const_string top
     TmxBrokerClient::unsubscribe(ctx, topic, cb);
 }
 
+/*!
+ * @brief Wait for the result of an asynchronous request
+ */
+static TmxError wait_for_result(TmxBrokerContext &ctx, types::Any &results,
+                                std::function<void(TmxNetSnmpBrokerClient::snmp_handler &&)> const &request) noexcept {
+    auto session = get_session(ctx);
+    if (session && session->running_in_this_thread())
+        return { EDEADLK, "A synchronous SNMP request can not be made from an SNMP response handler." };
+
+    auto done = std::make_shared<std::promise<TmxError> >();
+    auto future = done->get_future();
+
+    request([done, &results](TmxError const &err, types::Any &values) {
+        results = std::move(values);
+        done->set_value(err);
+    });
+
+    try {
+        return future.get();
+    } catch (std::future_error &) {
+        return { ENOTCONN, "The SNMP session was closed." };
+    }
+}
+
+/*!
+ * @brief Check that the context is connected, and otherwise invoke the handler with the error
+ *
+ * @return The open session, or null if not connected
+ */
+static std::shared_ptr<TmxNetSnmpSession> get_connected_session(TmxNetSnmpBrokerClient const &client,
+                                                                TmxBrokerContext &ctx,
+                                                                TmxNetSnmpBrokerClient::snmp_handler const &handler) noexcept {
+    types::Any none;
+
+    if (!client.is_connected(ctx)) {
+        if (handler)
+            handler({ 1, "Broker context " + ctx.to_string() + " is not connected." }, none);
+        return { };
+    }
+
+    auto session = get_session(ctx);
+    if (!session && handler)
+        handler({ 2, "Broker context " + ctx.to_string() + " not connected properly." }, none);
+
+    return session;
+}
+
 TmxError TmxNetSnmpBrokerClient::snmp_get(TmxBrokerContext &ctx,
                                           types::Properties<types::Any> const &oids,
                                           common::types::Any &results) const noexcept {
-    if (!this->is_connected(ctx))
-        return { 1, "Broker context " + ctx.to_string() + " is not connected."};
+    return wait_for_result(ctx, results, [this, &ctx, &oids](snmp_handler &&handler) {
+        this->async_get(ctx, oids, std::move(handler));
+    });
+}
 
-    auto session = tmx::common::types::as<snmp_session>(ctx.at(_handle));
-    if (!session)
-        return { 2, "Broker context " + ctx.to_string() + " not connected properly." };
+TmxError TmxNetSnmpBrokerClient::snmp_set(TmxBrokerContext &ctx,
+                                          types::Properties<common::types::Any> const &oids) const noexcept {
+    TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION;
 
-    struct snmp_pdu *pdu = nullptr, *response = nullptr;
-    struct variable_list *vars;
+    types::Any results;
+    return wait_for_result(ctx, results, [this, &ctx, &oids](snmp_handler &&handler) {
+        this->async_set(ctx, oids, std::move(handler));
+    });
+}
 
-    oid theOid[MAX_OID_LEN];
-    size_t theOid_len = MAX_OID_LEN;
+TmxError TmxNetSnmpBrokerClient::snmp_walk(TmxBrokerContext &ctx,
+                                           types::Properties<types::Any> const &oids,
+                                           common::types::Any &results) const noexcept {
+    return wait_for_result(ctx, results, [this, &ctx, &oids](snmp_handler &&handler) {
+        this->async_walk(ctx, oids, std::move(handler));
+    });
+}
 
-    pdu = snmp_pdu_create(SNMP_MSG_GET);
+void TmxNetSnmpBrokerClient::async_get(TmxBrokerContext &ctx, types::Properties<types::Any> const &oids,
+                                       snmp_handler handler) const noexcept {
+    auto session = get_connected_session(*this, ctx, handler);
+    if (!session)
+        return;
 
-    // Return values
-    TmxData values { results };
+    auto tx = std::make_shared<TmxNetSnmpTransaction>();
+    tx->handler = std::move(handler);
 
+    auto pdu = snmp_pdu_create(SNMP_MSG_GET);
     for (auto const &oidStr: oids) {
-        if (oidStr.first[0] == '.')
-            read_objid(oidStr.first.c_str(), theOid, &theOid_len);
-        else
-            get_node(oidStr.first.c_str(), theOid, &theOid_len);
-
-        snmp_add_null_var(pdu, theOid, theOid_len);
+        auto resolved = resolve_oid(oidStr.first.c_str());
+        if (resolved) {
+            snmp_add_null_var(pdu, resolved->name.data(), resolved->name.size());
+        } else {
+            TLOG(WARN) << "Unknown OID " << oidStr.first;
+            tx->results[oidStr.first] = types::Null();
+        }
     }
 
-retry:
-    auto ec = snmp_synch_response(session.get(), pdu, &response);
-    if (ec == STAT_TIMEOUT)
-        return { ec, "Timed out waiting for SNMP response." };
-    else if (ec != STAT_SUCCESS)
-        return { ec, snmp_errstring(ec) };
-    else if (!response)
-        return { ENODATA, "No response from SNMP agent" };
-
-    std::size_t cnt = 0;
-    for (vars = response->variables; vars; vars = vars->next_variable, cnt++) {
-        typename types::Properties_::key_t nm;
+    if (!pdu->variables) {
+        snmp_free_pdu(pdu);
+        if (tx->handler)
+            tx->handler(tx->error, tx->results.get_container());
+        return;
+    }
 
-        if (vars->name) {
-            char nameBuf[BUFFER_SIZE];
-            auto chars = snprint_objid(nameBuf, BUFFER_SIZE, vars->name, vars->name_length);
-            nm.assign(nameBuf, chars);
-        }
+    session->execute(tx, pdu);
+}
 
-        // If there is a missing object on the agent, then nothing will be set
-        // Only set the value for the problem OID and then retry
-        if (response->errstat && cnt != (response->errindex - 1))
-            continue;
+void TmxNetSnmpBrokerClient::async_set(TmxBrokerContext &ctx, types::Properties<types::Any> const &oids,
+                                       snmp_handler handler) const noexcept {
+    auto session = get_connected_session(*this, ctx, handler);
+    if (!session)
+        return;
 
-        values[nm] = types::Null();
+    auto tx = std::make_shared<TmxNetSnmpTransaction>();
+    tx->command = SNMP_MSG_SET;
+    tx->handler = std::move(handler);
 
-        if (vars->type == SNMP_NOSUCHOBJECT ||
-            vars->type == SNMP_NOSUCHINSTANCE ||
-            vars->type == SNMP_ENDOFMIBVIEW ||
-            vars->type == ASN_NULL)
+    auto pdu = snmp_pdu_create(SNMP_MSG_SET);
+    for (auto const &pair: oids) {
+        auto resolved = resolve_oid(pair.first.c_str());
+        if (!resolved || !resolved->type) {
+            TLOG(WARN) << "Unknown OID " << pair.first;
             continue;
-
-        auto &_tmp = values[nm].get_container().emplace<std::string>(4096, '\0');
-        _tmp.resize(snprint_value(_tmp.data(), _tmp.capacity(), vars->name, vars->name_length, vars));
-
-        auto idx = _tmp.find_first_of(':');
-        if (idx < _tmp.length())
-            _tmp = _tmp.substr(idx + 2);
-
-        TLOG(DEBUG3) << nm << ": " << _tmp;
-
-        if (response->errstat) {
-            pdu = snmp_fix_pdu(response, SNMP_MSG_GET);
-            snmp_free_pdu(response);
-            response = nullptr;
-
-            if (!pdu)
-                return { response->errstat, "Unable to obtain OID " + nm };
-
-            goto retry;
         }
+
+        add_value(pdu, *resolved, TmxData { pair.second });
     }
 
-    snmp_free_pdu(response);
-    response = nullptr;
+    if (!pdu->variables) {
+        snmp_free_pdu(pdu);
+        if (tx->handler)
+            tx->handler(tx->error, tx->results.get_container());
+        return;
+    }
 
-    return { };
+    session->execute(tx, pdu);
 }
 
-TmxError TmxNetSnmpBrokerClient::snmp_set(TmxBrokerContext &ctx,
-                                          types::Properties<common::types::Any> const &oids) const noexcept {
-    TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION;
-
-    if (!this->is_connected(ctx))
-        return { 1, "Broker context " + ctx.to_string() + " is not connected."};
-
-    auto session = tmx::common::types::as<snmp_session>(ctx.at(_handle));
+void TmxNetSnmpBrokerClient::async_walk(TmxBrokerContext &ctx, types::Properties<types::Any> const &oids,
+                                        snmp_handler handler) const noexcept {
+    auto session = get_connected_session(*this, ctx, handler);
     if (!session)
-        return { 2, "Broker context " + ctx.to_string() + " not connected properly." };
-
-    struct snmp_pdu *pdu = nullptr, *response = nullptr;
-    oid theOid[MAX_OID_LEN];
-    size_t theOid_len = MAX_OID_LEN;
-
-    pdu = snmp_pdu_create(SNMP_MSG_SET);
-
-    for (auto &pair: oids) {
-        if (pair.first[0] == '.')
-            read_objid(pair.first.c_str(), theOid, &theOid_len);
-        else
-            get_node(pair.first.c_str(), theOid, &theOid_len);
+        return;
 
-        auto tp = get_tree(theOid, theOid_len, get_tree_head());
-        if (!tp)
-            continue;
+    auto tx = std::make_shared<TmxNetSnmpTransaction>();
+    tx->handler = std::move(handler);
 
-        const TmxData value { pair.second };
-        switch (tp->type) {
-            case ASN_OCTET_STR:
-            {
-                std::string copy = value.to_string();
-                snmp_pdu_add_variable(pdu, theOid, theOid_len, tp->type, (const void *)copy.c_str(), copy.length());
-                break;
-            }
-            case ASN_BOOLEAN:
-            {
-                int copy = (int)(value.to_bool());
-                snmp_pdu_add_variable(pdu, theOid, theOid_len, tp->type, (const void *)&copy, sizeof(copy));
-                break;
-            }
-            case ASN_INTEGER:
-            {
-                long copy = value;
-                snmp_pdu_add_variable(pdu, theOid, theOid_len, tp->type, (const void *)&copy, sizeof(copy));
-                break;
-            }
-            case ASN_TIMETICKS:
-            case ASN_COUNTER:
-            {
-                uint32_t copy = value;
-                snmp_pdu_add_variable(pdu, theOid, theOid_len, tp->type, (const void *)&copy, sizeof(copy));
-                break;
-            }
-            case ASN_BIT_STR:
-            {
-                const std::bitset<BUFFER_SIZE> bits(value.to_uint());
-                std::string copy = bits.to_string();
-                snmp_pdu_add_variable(pdu, theOid, theOid_len, tp->type, (const void *)&copy, sizeof(copy));
-                break;
-            }
-            case ASN_DOUBLE:
-            case ASN_FLOAT:
-            {
-                double copy = value;
-                snmp_pdu_add_variable(pdu, theOid, theOid_len, tp->type, (const void *)&copy, sizeof(copy));
-            }
+    std::vector<std::shared_ptr<const TmxNetSnmpOid> > roots;
+    for (auto const &oidStr: oids) {
+        auto resolved = resolve_oid(oidStr.first.c_str());
+        if (resolved) {
+            roots.push_back(resolved);
+        } else {
+            TLOG(WARN) << "Unknown OID " << oidStr.first;
         }
     }
 
-    auto ec = snmp_synch_response(session.get(), pdu, &response);
-    if (ec != STAT_SUCCESS)
-        return { ec, snmp_errstring(ec) };
-
-    snmp_free_pdu(response);
-    snmp_free_pdu(pdu);
+    if (roots.empty()) {
+        if (tx->handler)
+            tx->handler(tx->error, tx->results.get_container());
+        return;
+    }
 
-    return { };
+    session->walk(tx, std::move(roots));
 }
 
 types::Any TmxNetSnmpBrokerClient::get_broker_info(TmxBrokerContext &ctx) const noexcept {
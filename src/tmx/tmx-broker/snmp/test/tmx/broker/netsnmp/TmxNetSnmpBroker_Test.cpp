@@ -0,0 +1,295 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxNetSnmpBroker_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/broker/netsnmp/TmxNetSnmpBroker.hpp>
+#include <tmx/broker/TmxBrokerClient.hpp>
+#include <tmx/broker/TmxBrokerContext.hpp>
+#include <tmx/message/TmxData.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <poll.h>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace tmx::common;
+using namespace tmx::message;
+
+namespace tmx {
+namespace broker {
+namespace netsnmp {
+namespace test {
+
+#define TEST_AGENT_PORT "16161"
+#define TEST_AGENT_DELAY_MS 20
+#define TEST_REQUEST_COUNT 50
+#define TEST_TABLE_ROWS 250
+#define TEST_MAX_REPETITIONS 25
+
+template <typename _Pred, typename _Duration = std::chrono::seconds>
+bool wait_for(_Pred &&pred, _Duration timeout = std::chrono::seconds(5)) {
+    auto end = std::chrono::steady_clock::now() + timeout;
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > end)
+            return false;
+
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    return true;
+}
+
+/*!
+ * @brief A stand-in for an RSU SNMP agent, which takes a fixed time to respond to each request
+ *
+ * The agent has one scalar, .1.3.6.1.4.1.99999.2.0, and one table under
+ * .1.3.6.1.4.1.99999.1.1 with a row for each index.
+ */
+class TestAgent {
+    typedef std::vector<oid> name_t;
+
+public:
+    TestAgent() {
+        for (long i = 1; i <= TEST_TABLE_ROWS; i++)
+            _objects[{ 1, 3, 6, 1, 4, 1, 99999, 1, 1, (oid)i }] = i;
+        _objects[{ 1, 3, 6, 1, 4, 1, 99999, 2, 0 }] = 42;
+
+        init_snmp("tmx-test-agent");
+
+        netsnmp_session session;
+        snmp_sess_init(&session);
+        session.version = SNMP_VERSION_2c;
+        session.callback = &TestAgent::on_request;
+        session.callback_magic = this;
+        session.isAuthoritative = SNMP_SESS_AUTHORITATIVE;
+
+        auto transport = netsnmp_transport_open_server("snmp", "udp:127.0.0.1:" TEST_AGENT_PORT);
+        if (transport)
+            _sessp = snmp_sess_add(&session, transport, nullptr, nullptr);
+
+        if (_sessp)
+            _thread = std::thread(&TestAgent::run, this);
+    }
+
+    ~TestAgent() {
+        _running = false;
+        if (_thread.joinable())
+            _thread.join();
+
+        for (auto &reply: _replies)
+            snmp_free_pdu(reply.second);
+
+        if (_sessp)
+            snmp_sess_close(_sessp);
+    }
+
+    bool is_running() const noexcept {
+        return _sessp != nullptr;
+    }
+
+    std::atomic<std::size_t> requests { 0 };
+
+private:
+    void run() {
+        auto fd = snmp_sess_transport(_sessp)->sock;
+        while (_running) {
+            struct pollfd ready { fd, POLLIN, 0 };
+            if (::poll(&ready, 1, 1) > 0 && (ready.revents & POLLIN)) {
+                netsnmp_large_fd_set fdset;
+                netsnmp_large_fd_set_init(&fdset, fd + 1);
+                NETSNMP_LARGE_FD_SET(fd, &fdset);
+                snmp_sess_read2(_sessp, &fdset);
+                netsnmp_large_fd_set_cleanup(&fdset);
+            }
+
+            // Every reply waits the same time, but the agent keeps taking requests
+            auto now = std::chrono::steady_clock::now();
+            while (!_replies.empty() && _replies.front().first <= now) {
+                if (!snmp_sess_send(_sessp, _replies.front().second))
+                    snmp_free_pdu(_replies.front().second);
+                _replies.erase(_replies.begin());
+            }
+        }
+    }
+
+    static int on_request(int op, netsnmp_session *, int, netsnmp_pdu *pdu, void *magic) {
+        auto self = static_cast<TestAgent *>(magic);
+        if (op != NETSNMP_CALLBACK_OP_RECEIVED_MESSAGE || !pdu)
+            return 1;
+
+        self->requests++;
+
+        auto repetitions = pdu->command == SNMP_MSG_GETBULK ? pdu->max_repetitions : 1;
+        auto reply = snmp_clone_pdu(pdu);
+        snmp_free_varbind(reply->variables);
+        reply->variables = nullptr;
+        reply->command = SNMP_MSG_RESPONSE;
+        reply->errstat = 0;
+        reply->errindex = 0;
+
+        for (auto vars = pdu->variables; vars; vars = vars->next_variable) {
+            name_t name { vars->name, vars->name + vars->name_length };
+
+            if (pdu->command == SNMP_MSG_GET) {
+                auto iter = self->_objects.find(name);
+                if (iter == self->_objects.end())
+                    snmp_pdu_add_variable(reply, vars->name, vars->name_length, SNMP_NOSUCHOBJECT, nullptr, 0);
+                else
+                    snmp_pdu_add_variable(reply, vars->name, vars->name_length, ASN_INTEGER,
+                                          &(iter->second), sizeof(iter->second));
+                continue;
+            }
+
+            auto iter = self->_objects.upper_bound(name);
+            for (long i = 0; i < repetitions; i++, iter++) {
+                if (iter == self->_objects.end()) {
+                    snmp_pdu_add_variable(reply, vars->name, vars->name_length, SNMP_ENDOFMIBVIEW, nullptr, 0);
+                    break;
+                }
+
+                snmp_pdu_add_variable(reply, iter->first.data(), iter->first.size(), ASN_INTEGER,
+                                      &(iter->second), sizeof(iter->second));
+            }
+        }
+
+        self->_replies.emplace_back(std::chrono::steady_clock::now() +
+                                    std::chrono::milliseconds(TEST_AGENT_DELAY_MS), reply);
+        return 1;
+    }
+
+    void *_sessp = nullptr;
+    std::atomic<bool> _running { true };
+    std::thread _thread;
+    std::map<name_t, long> _objects;
+    std::vector<std::pair<std::chrono::steady_clock::time_point, netsnmp_pdu *> > _replies;
+};
+
+struct TestClient {
+    TestClient(): ctx { "snmpv2c://public@127.0.0.1:" TEST_AGENT_PORT, "snmp-test-client", TmxData(types::Any()) } {
+        TmxData params { ctx.get_parameters() };
+        params["max-repetitions"] = TEST_MAX_REPETITIONS;
+        params["timeout"] = 2000;
+
+        broker = TmxBrokerClient::get_broker(ctx);
+        client = std::dynamic_pointer_cast<TmxNetSnmpBrokerClient>(broker);
+
+        if (client) {
+            client->initialize(ctx);
+            client->connect(ctx);
+        }
+    }
+
+    ~TestClient() {
+        if (client) {
+            client->disconnect(ctx);
+            client->destroy(ctx);
+        }
+    }
+
+    TmxBrokerContext ctx;
+    std::shared_ptr<TmxBrokerClient> broker;
+    std::shared_ptr<TmxNetSnmpBrokerClient> client;
+};
+
+BOOST_AUTO_TEST_SUITE(netsnmp_broker_test_suite)
+
+BOOST_AUTO_TEST_CASE(pipelined_get) {
+    TestAgent agent;
+    BOOST_REQUIRE(agent.is_running());
+
+    TestClient test;
+    BOOST_REQUIRE(test.client);
+    BOOST_REQUIRE(wait_for([&test]() { return test.ctx.get_state() >= TmxBrokerState::connected; }));
+
+    types::Properties<types::Any> oids;
+    oids[".1.3.6.1.4.1.99999.2.0"] = true;
+
+    std::atomic<std::size_t> done { 0 }, failed { 0 }, values { 0 };
+    auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < TEST_REQUEST_COUNT; i++) {
+        test.client->async_get(test.ctx, oids, [&](TmxError const &err, types::Any &results) {
+            if (err)
+                failed++;
+            else
+                values += TmxData { results }.to_map().size();
+
+            done++;
+        });
+    }
+
+    BOOST_REQUIRE(wait_for([&done]() { return done == TEST_REQUEST_COUNT; }));
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    BOOST_TEST_MESSAGE(TEST_REQUEST_COUNT << " get requests with a " << TEST_AGENT_DELAY_MS <<
+                       "ms round trip completed in " << elapsed.count() << "ms");
+
+    BOOST_CHECK_EQUAL(failed, 0u);
+    BOOST_CHECK_EQUAL(values, TEST_REQUEST_COUNT);
+    BOOST_CHECK_EQUAL(agent.requests, TEST_REQUEST_COUNT);
+
+    // One request at a time would take the round trip time for every request
+    BOOST_CHECK_LT(elapsed.count(), TEST_REQUEST_COUNT * TEST_AGENT_DELAY_MS / 2);
+}
+
+BOOST_AUTO_TEST_CASE(bulk_walk) {
+    TestAgent agent;
+    BOOST_REQUIRE(agent.is_running());
+
+    TestClient test;
+    BOOST_REQUIRE(test.client);
+    BOOST_REQUIRE(wait_for([&test]() { return test.ctx.get_state() >= TmxBrokerState::connected; }));
+
+    types::Properties<types::Any> oids;
+    oids[".1.3.6.1.4.1.99999.1"] = true;
+
+    types::Any results;
+    auto err = test.client->snmp_walk(test.ctx, oids, results);
+    BOOST_REQUIRE_MESSAGE(!err, err.get_message());
+
+    // Stops at the end of the table, not the end of the agent
+    BOOST_CHECK_EQUAL(TmxData { results }.to_map().size(), TEST_TABLE_ROWS);
+    BOOST_CHECK_EQUAL(agent.requests, TEST_TABLE_ROWS / TEST_MAX_REPETITIONS + 1);
+}
+
+BOOST_AUTO_TEST_CASE(unknown_oid) {
+    TestAgent agent;
+    BOOST_REQUIRE(agent.is_running());
+
+    TestClient test;
+    BOOST_REQUIRE(test.client);
+    BOOST_REQUIRE(wait_for([&test]() { return test.ctx.get_state() >= TmxBrokerState::connected; }));
+
+    types::Properties<types::Any> oids;
+    oids[".1.3.6.1.4.1.99999.3.0"] = true;
+    oids[".1.3.6.1.4.1.99999.2.0"] = true;
+
+    types::Any results;
+    auto err = test.client->snmp_get(test.ctx, oids, results);
+    BOOST_REQUIRE_MESSAGE(!err, err.get_message());
+
+    BOOST_CHECK_EQUAL(TmxData { results }.to_map().size(), 2u);
+    BOOST_CHECK_EQUAL(agent.requests, 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} /* End namespace test */
+} /* End namespace netsnmp */
+} /* End namespace broker */
+} /* End namespace tmx */
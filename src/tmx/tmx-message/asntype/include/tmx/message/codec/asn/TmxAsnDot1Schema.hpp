@@ -33,6 +33,35 @@ asn_TYPE_descriptor_t const *get_schema(common::TmxTypeDescriptor const &) noexc
 common::TmxError dump(common::TmxTypeDescriptor const &, const void *, common::types::Any &) noexcept;
 common::TmxError load(common::TmxTypeDescriptor const &, common::types::Any const &, void **) noexcept;
 
+/*!
+ * @brief Convert the ASN.1 structure to TMX data
+ *
+ * If the schema is a J2735 type, then the structure is converted by
+ * walking the type descriptor directly. Otherwise, the structure is
+ * converted through its XER encoding.
+ *
+ * @param[in] The ASN.1 schema for the structure
+ * @param[in] The structure to convert
+ * @param[out] The TMX data
+ * @return Any error that occurred
+ */
+common::TmxError dump(asn_TYPE_descriptor_t const *, const void *, common::types::Any &) noexcept;
+
+/*!
+ * @brief Build a new ASN.1 structure from TMX data
+ *
+ * If the schema is a J2735 type, then the structure is filled by
+ * walking the type descriptor directly. Otherwise, the structure is
+ * decoded from the XER encoding of the data. The new structure should
+ * be released with ASN_STRUCT_FREE.
+ *
+ * @param[in] The ASN.1 schema for the structure
+ * @param[in] The TMX data
+ * @param[out] The new structure
+ * @return Any error that occurred
+ */
+common::TmxError load(asn_TYPE_descriptor_t const *, common::types::Any const &, void **) noexcept;
+
 template <typename _T>
 common::TmxError dump(const _T *obj, common::types::Any &out) {
     return dump(common::TmxTypeRegistry().get(typeid(_T), true), (const void *)obj, out);
@@ -218,31 +218,57 @@ public:
 
     template <typename _Tp>
     TmxError do_encode(asn_TYPE_descriptor_t const *descriptor, _Tp *value, byte_stream &os) const {
-        auto ret = asn_encode_to_new_buffer(nullptr, _Syntax, descriptor, value);
-        if (ret.result.encoded < 0 || !ret.buffer) {
+        // Write each encoded chunk straight to the stream, instead of into a new buffer
+        encode_state state { os };
+        auto ret = asn_encode(nullptr, _Syntax, descriptor, value, &self_type::write_chunk, &state);
+        if (ret.encoded < 0) {
             std::string err{ "ASN.1 serialization of " };
             err.append(type_fqname<_Tp>());
             err.append(" type failed at tag ");
-            err.append(ret.result.failed_type ? ret.result.failed_type->name : "????");
+            err.append(ret.failed_type ? ret.failed_type->name : "????");
             err.append(".");
-            return { ret.result.encoded, err };
+            return { ret.encoded, err };
         }
 
+        return { };
+    }
+
+private:
+    struct encode_state {
+        byte_stream &os;
+
+        // A trailing newline that is only written if more characters follow
+        bool newline = false;
+    };
+
+    static int write_chunk(const void *buffer, size_t size, void *key) {
+        auto state = static_cast<encode_state *>(key);
+        if (!state || !size)
+            return 0;
+
         // For XML encoding, use the actual string
         // Otherwise, convert to bytes
         static const_string nm{ _Name::c_str() };
-        const_string str{ (typename byte_stream::char_type *) ret.buffer };
-        if (str[str.length() - 1] == '\n')
-            str = str.substr(0, str.length() - 1);
-
         if (nm.length() && nm[0] == 'x') {
-            os << str;
+            const_string str{ static_cast<const typename byte_stream::char_type *>(buffer), size };
+
+            if (state->newline)
+                state->os << '\n';
+
+            state->newline = (str[str.length() - 1] == '\n');
+            if (state->newline)
+                str = str.substr(0, str.length() - 1);
+
+            state->os << str;
         } else {
-            os << byte_string_encode(to_byte_sequence(str.data(), str.length()));
+            // Each byte is encoded separately, so the chunks can be split anywhere
+            static_assert(byte_encoder_traits<std::decay_t<decltype(TMX_DEFAULT_BYTE_ENCODING)> >::bytes == 1,
+                          "Byte encoding must not span multiple bytes");
+            byte_string_encode(state->os, to_byte_sequence(static_cast<const char *>(buffer), size),
+                               TMX_DEFAULT_BYTE_ENCODING);
         }
 
-        free(ret.buffer);
-        return { };
+        return state->os ? 0 : -1;
     }
 };
 
@@ -253,21 +279,42 @@ static common::TmxTypeRegistrar< TmxAsnDot1Encoder<decltype(TMX_STATIC_STRING("u
 
 namespace schema {
 
-common::TmxError dump(TmxTypeDescriptor const &descr, const void *obj, Any &out) noexcept {
+static const TmxTypeRegistry &j2735_registry() noexcept {
+    static const TmxTypeRegistry _registry { "tmx.message.J2735" };
+    return _registry;
+}
+
+common::TmxError dump(asn_TYPE_descriptor_t const *descriptor, const void *obj, Any &out) noexcept {
+    if (!descriptor)
+        return { EINVAL, "Invalid argument: Missing ASN.1 schema." };
+
+    // Try walking the structure directly
+    auto fn = j2735_registry().get("dump").as_instance<std::function<TmxError(const void *, const void *, Any &)> >();
+    if (fn && *fn) {
+        auto ret = (*fn)(descriptor, obj, out);
+        if (ret.get_code() != ENOTSUP)
+            return ret;
+    }
+
     std::stringstream ss;
 
-    auto descriptor = get_schema(descr);
-    if (descriptor) {
-        // Always serialize to XML
-        _asn1xer_encoder_registrar.instance()->do_encode(descriptor, obj, ss);
-        auto decoder = message::codec::TmxDecoder::get_decoder("xml");
-        if (decoder) {
-            // It is byte encoded
-            auto bytes = byte_string_decode(ss.str().c_str());
-            return decoder->decode(out, to_char_sequence(bytes.data()));
-        }
+    // Otherwise, serialize to XML
+    _asn1xer_encoder_registrar.instance()->do_encode(descriptor, obj, ss);
+    auto decoder = message::codec::TmxDecoder::get_decoder("xml");
+    if (decoder) {
+        // It is byte encoded
+        auto bytes = byte_string_decode(ss.str().c_str());
+        return decoder->decode(out, to_char_sequence(bytes.data()));
     }
 
+    return { ENOTSUP, std::string("Could not convert ") + descriptor->name };
+}
+
+common::TmxError dump(TmxTypeDescriptor const &descr, const void *obj, Any &out) noexcept {
+    auto descriptor = get_schema(descr);
+    if (descriptor)
+        return dump(descriptor, obj, out);
+
     return { ENOTSUP, "Could not determine schema for " + descr.get_type_name() };
 }
 
@@ -419,21 +466,36 @@ static common::TmxTypeRegistrar< TmxAsnDot1Decoder<decltype(TMX_STATIC_STRING("u
 
 namespace schema {
 
-common::TmxError load(TmxTypeDescriptor const &descr, Any const &obj, void **out) noexcept {
+common::TmxError load(asn_TYPE_descriptor_t const *descriptor, Any const &obj, void **out) noexcept {
+    if (!descriptor)
+        return { EINVAL, "Invalid argument: Missing ASN.1 schema." };
+
+    // Try filling the structure directly
+    auto fn = j2735_registry().get("load").as_instance<std::function<TmxError(const void *, Any const &, void **)> >();
+    if (fn && *fn) {
+        auto ret = (*fn)(descriptor, obj, out);
+        if (ret.get_code() != ENOTSUP)
+            return ret;
+    }
+
     std::stringstream ss;
-    auto descriptor = get_schema(descr);
-    if (descriptor) {
-        // Always serialize from XML
-        auto encoder = codec::TmxEncoder::get_encoder("xml");
-        if (encoder) {
-            auto ret = encoder->encode(obj, ss);
-            if (ret) return ret;
-        }
 
-        auto bytes = to_byte_sequence(ss.str().c_str());
-        return _asn1xer_decoder_registrar.instance()->do_decode(descriptor, out, bytes);
+    // Otherwise, serialize from XML
+    auto encoder = codec::TmxEncoder::get_encoder("xml");
+    if (encoder) {
+        auto ret = encoder->encode(obj, ss);
+        if (ret) return ret;
     }
 
+    auto bytes = to_byte_sequence(ss.str().c_str());
+    return _asn1xer_decoder_registrar.instance()->do_decode(descriptor, out, bytes);
+}
+
+common::TmxError load(TmxTypeDescriptor const &descr, Any const &obj, void **out) noexcept {
+    auto descriptor = get_schema(descr);
+    if (descriptor)
+        return load(descriptor, obj, out);
+
     return { ENOTSUP, "Could not determine schema for " + descr.get_type_name() };
 }
 
@@ -0,0 +1,333 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxAsnDot1Schema_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <tmx/message/j2735/202007/MessageFrame.h>
+#include <tmx/message/TmxData.hpp>
+#include <tmx/message/codec/TmxCodec.hpp>
+#include <tmx/message/codec/asn/TmxAsnDot1Schema.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace tmx::common;
+using namespace tmx::common::types;
+
+namespace tmx {
+namespace message {
+namespace codec {
+namespace asn {
+namespace test {
+
+// A MAP message for the 5th and Perry intersection, taken from the MapPlugin manifest
+static const char *TEST_MAP_BYTES =
+        "0012810B380130002073BE054D75DCBE9CAAC13A198C02DC0AC814657CBCFA20C3C3872DF871E8140000003124C5B9014140179B"
+        "608AA6EE20A365F21998DA91042363E886BC34DA43765A3411E5AF9844424E51732C0814143352B02064A75CB0C4E2AE00D85C00"
+        "0E77C04059078C8B879F44187870E5BF0E3D06800000010B1EAD349E424FB2BD42CC7C0A0A0E26A3A1B1F8001CEF80808805D900"
+        "0000042CF88FB17784D90B88A6983EDE83880FE900000004918F55C0A0A006CB604D0B2719F99BE6E85054EDFCBA6841D3961C7A"
+        "C89804004000B4EF6457503A0480C94C000E77C09C0A4AA7BFAF4D083A72C38F5A230080080A0C282E0E430600ECC650E9949C2C"
+        "917C71E7962DA4CF262460";
+
+std::shared_ptr<MessageFrame> decode_frame() {
+    std::string hex { TEST_MAP_BYTES };
+    std::vector<std::uint8_t> bytes;
+    for (std::size_t i = 0; i + 1 < hex.length(); i += 2)
+        bytes.push_back(std::stoi(hex.substr(i, 2), nullptr, 16));
+
+    MessageFrame *frame = nullptr;
+    auto ret = asn_decode(nullptr, ATS_UNALIGNED_BASIC_PER, &asn_DEF_MessageFrame, (void **)&frame,
+                          bytes.data(), bytes.size());
+    BOOST_REQUIRE_EQUAL(RC_OK, ret.code);
+    BOOST_REQUIRE(frame);
+    BOOST_REQUIRE_EQUAL(MessageFrame__value_PR_MapData, frame->value.present);
+
+    return { frame, [](auto *ptr) { ASN_STRUCT_FREE(asn_DEF_MessageFrame, ptr); } };
+}
+
+template <typename _T>
+_T *alloc() {
+    return static_cast<_T *>(std::calloc(1, sizeof(_T)));
+}
+
+// A SPAT for one intersection with eight signal groups
+std::shared_ptr<SPAT> make_spat() {
+    auto spat = alloc<SPAT>();
+    spat->timeStamp = alloc<MinuteOfTheYear_t>();
+    *(spat->timeStamp) = 412312;
+
+    auto state = alloc<IntersectionState>();
+    state->name = alloc<DescriptiveName_t>();
+    OCTET_STRING_fromString(state->name, "5th and Perry");
+    state->id.id = 1301;
+    state->revision = 7;
+
+    state->status.size = 2;
+    state->status.buf = static_cast<std::uint8_t *>(std::calloc(2, 1));
+    state->status.buf[0] = 0x20;
+
+    state->moy = alloc<MinuteOfTheYear_t>();
+    *(state->moy) = 412312;
+    state->timeStamp = alloc<DSecond_t>();
+    *(state->timeStamp) = 35176;
+
+    for (long group = 1; group <= 8; group++) {
+        auto movement = alloc<MovementState>();
+        movement->signalGroup = group;
+
+        auto event = alloc<MovementEvent>();
+        event->eventState = (group % 2) ? MovementPhaseState_protected_Movement_Allowed
+                                        : MovementPhaseState_stop_And_Remain;
+        event->timing = alloc<TimeChangeDetails>();
+        event->timing->minEndTime = 22000 + group * 10;
+        event->timing->maxEndTime = alloc<TimeMark_t>();
+        *(event->timing->maxEndTime) = 22500 + group * 10;
+
+        ASN_SEQUENCE_ADD(&movement->state_time_speed.list, event);
+        ASN_SEQUENCE_ADD(&state->states.list, movement);
+    }
+
+    ASN_SEQUENCE_ADD(&spat->intersections.list, state);
+    return { spat, [](auto *ptr) { ASN_STRUCT_FREE(asn_DEF_SPAT, ptr); } };
+}
+
+// A BSM, which carries the temporary ID as an OCTET STRING
+static const char *TEST_BSM_XER =
+        "<BasicSafetyMessage><coreData>"
+        "<msgCnt>12</msgCnt><id>A1B2C3D4</id><secMark>35176</secMark>"
+        "<lat>399652654</lat><long>-830296342</long><elev>2140</elev>"
+        "<accuracy><semiMajor>40</semiMajor><semiMinor>30</semiMinor><orientation>12000</orientation></accuracy>"
+        "<transmission><forwardGears/></transmission><speed>650</speed><heading>4520</heading><angle>5</angle>"
+        "<accelSet><long>20</long><lat>-3</lat><vert>0</vert><yaw>12</yaw></accelSet>"
+        "<brakes><wheelBrakes>00000</wheelBrakes><traction><off/></traction><abs><on/></abs><scs><on/></scs>"
+        "<brakeBoost><unavailable/></brakeBoost><auxBrakes><unavailable/></auxBrakes></brakes>"
+        "<size><width>190</width><length>480</length></size>"
+        "</coreData></BasicSafetyMessage>";
+
+std::shared_ptr<BasicSafetyMessage> make_bsm() {
+    BasicSafetyMessage *bsm = nullptr;
+    std::string xer { TEST_BSM_XER };
+    auto ret = asn_decode(nullptr, ATS_BASIC_XER, &asn_DEF_BasicSafetyMessage, (void **)&bsm, xer.data(), xer.length());
+    std::shared_ptr<BasicSafetyMessage> _bsm { bsm, [](auto *ptr) { ASN_STRUCT_FREE(asn_DEF_BasicSafetyMessage, ptr); } };
+    BOOST_REQUIRE_EQUAL(RC_OK, ret.code);
+    return _bsm;
+}
+
+std::string to_uper(asn_TYPE_descriptor_t const *td, const void *obj) {
+    auto ret = asn_encode_to_new_buffer(nullptr, ATS_UNALIGNED_BASIC_PER, td, obj);
+    BOOST_REQUIRE_MESSAGE(ret.result.encoded > 0 && ret.buffer, "UPER encoding of " << td->name << " failed at " <<
+                          (ret.result.failed_type ? ret.result.failed_type->name : "????"));
+
+    std::string bytes { static_cast<const char *>(ret.buffer), static_cast<std::size_t>((ret.result.encoded + 7) / 8) };
+    std::free(ret.buffer);
+    return bytes;
+}
+
+std::string to_json(Any const &data) {
+    auto encoder = TmxEncoder::get_encoder("json");
+    BOOST_REQUIRE(encoder);
+
+    std::ostringstream os;
+    BOOST_REQUIRE(!encoder->encode(data, os));
+    return os.str();
+}
+
+// Dump to JSON, read it back and make sure the encoding is identical
+void check_round_trip(asn_TYPE_descriptor_t const *td, const void *obj) {
+    Any data;
+    auto err = schema::dump(td, obj, data);
+    BOOST_REQUIRE_MESSAGE(!err, err.get_message());
+
+    auto props = tmx::common::any_cast< Properties<Any> >(&data);
+    BOOST_REQUIRE(props);
+    BOOST_CHECK_EQUAL(1u, props->size());
+    BOOST_CHECK(props->count(Properties<Any>::key_t(td->xml_tag)));
+
+    auto json = to_json(data);
+    BOOST_TEST_MESSAGE(td->name << ": " << json);
+
+    auto decoder = TmxDecoder::get_decoder("json");
+    BOOST_REQUIRE(decoder);
+
+    Any copy;
+    err = decoder->decode(copy, to_char_sequence(json.c_str(), json.length()));
+    BOOST_REQUIRE_MESSAGE(!err, err.get_message());
+
+    void *loaded = nullptr;
+    err = schema::load(td, copy, &loaded);
+    BOOST_REQUIRE_MESSAGE(!err, err.get_message());
+    BOOST_REQUIRE(loaded);
+
+    BOOST_CHECK(to_uper(td, obj) == to_uper(td, loaded));
+    td->op->free_struct(td, loaded, ASFM_FREE_EVERYTHING);
+
+    // The structure can also be loaded directly from the dump
+    loaded = nullptr;
+    err = schema::load(td, data, &loaded);
+    BOOST_REQUIRE_MESSAGE(!err, err.get_message());
+    BOOST_CHECK(to_uper(td, obj) == to_uper(td, loaded));
+    td->op->free_struct(td, loaded, ASFM_FREE_EVERYTHING);
+}
+
+// The original conversion, through XER and the XML decoder
+TmxError dump_by_xml(asn_TYPE_descriptor_t const *td, const void *obj, Any &out) {
+    auto ret = asn_encode_to_new_buffer(nullptr, ATS_BASIC_XER, td, obj);
+    if (ret.result.encoded < 0 || !ret.buffer)
+        return { EINVAL, "XER encoding failed" };
+
+    auto decoder = TmxDecoder::get_decoder("xml");
+    BOOST_REQUIRE(decoder);
+
+    auto err = decoder->decode(out, to_char_sequence(static_cast<const char *>(ret.buffer), ret.result.encoded));
+    std::free(ret.buffer);
+    return err;
+}
+
+std::string strip_space(std::string text) {
+    text.erase(std::remove_if(text.begin(), text.end(), [](unsigned char c) { return std::isspace(c); }), text.end());
+    return text;
+}
+
+/*!
+ * @brief Compare the direct conversion to the original conversion through XER
+ *
+ * The XER path keeps every value as text, surrounds a BIT STRING with white
+ * space, splits the bytes of an OCTET STRING with white space and wraps a
+ * SEQUENCE OF with one element in the tag of the element type, so only the
+ * structure and the text of the values without white space can be compared.
+ */
+void check_same_as_xml(TmxData const &direct, TmxData const &xml, std::string const &path) {
+    BOOST_TEST_CONTEXT(path) {
+        if (direct.is_array()) {
+            auto list = direct.to_array();
+
+            TmxData other { xml };
+            if (xml.is_map() && xml.to_map()->size() == 1)
+                other = TmxData(xml.to_map()->begin()->second);
+
+            if (other.is_array()) {
+                auto otherList = other.to_array();
+                BOOST_REQUIRE_EQUAL(list->size(), otherList->size());
+                for (std::size_t i = 0; i < list->size(); i++)
+                    check_same_as_xml(list->at(i), otherList->at(i), path + "[" + std::to_string(i) + "]");
+            } else {
+                BOOST_REQUIRE_EQUAL(1u, list->size());
+                check_same_as_xml(list->at(0), other, path + "[0]");
+            }
+        } else if (direct.is_map()) {
+            BOOST_REQUIRE(xml.is_map());
+
+            auto map = direct.to_map();
+            BOOST_CHECK_EQUAL(map->size(), xml.to_map()->size());
+            for (auto const &entry: *map) {
+                const std::string key { entry.first };
+                check_same_as_xml(entry.second, xml[key], path + "." + key);
+            }
+        } else {
+            BOOST_CHECK_EQUAL(strip_space(direct.to_string()), strip_space(xml.to_string()));
+        }
+    }
+}
+
+void check_same_as_xml(asn_TYPE_descriptor_t const *td, const void *obj) {
+    Any direct, xml;
+    BOOST_REQUIRE(!schema::dump(td, obj, direct));
+    BOOST_REQUIRE(!dump_by_xml(td, obj, xml));
+    check_same_as_xml(TmxData(direct), TmxData(xml), td->name);
+}
+
+BOOST_AUTO_TEST_SUITE(asn_schema_test_suite)
+
+BOOST_AUTO_TEST_CASE(map_round_trip) {
+    auto frame = decode_frame();
+    check_round_trip(&asn_DEF_MapData, &frame->value.choice.MapData);
+}
+
+BOOST_AUTO_TEST_CASE(message_frame_round_trip) {
+    auto frame = decode_frame();
+    check_round_trip(&asn_DEF_MessageFrame, frame.get());
+
+    Any data;
+    BOOST_REQUIRE(!schema::dump(&asn_DEF_MessageFrame, frame.get(), data));
+
+    auto &props = tmx::common::any_cast< Properties<Any> const & >(data);
+    auto &contents = tmx::common::any_cast< Properties<Any> const & >(props.at(Properties<Any>::key_t("MessageFrame")));
+    BOOST_CHECK_EQUAL(18, tmx::common::any_cast<Intmax>(contents.at(Properties<Any>::key_t("messageId"))));
+
+    auto &value = tmx::common::any_cast< Properties<Any> const & >(contents.at(Properties<Any>::key_t("value")));
+    BOOST_CHECK(value.count(Properties<Any>::key_t("MapData")));
+}
+
+BOOST_AUTO_TEST_CASE(spat_round_trip) {
+    auto spat = make_spat();
+    check_round_trip(&asn_DEF_SPAT, spat.get());
+
+    Any data;
+    BOOST_REQUIRE(!schema::dump(&asn_DEF_SPAT, spat.get(), data));
+
+    auto json = to_json(data);
+    BOOST_CHECK_NE(std::string::npos, json.find("\"5th and Perry\""));
+    BOOST_CHECK_NE(std::string::npos, json.find("\"protected-Movement-Allowed\""));
+    BOOST_CHECK_NE(std::string::npos, json.find("\"0010000000000000\""));
+}
+
+BOOST_AUTO_TEST_CASE(bsm_round_trip) {
+    auto bsm = make_bsm();
+    check_round_trip(&asn_DEF_BasicSafetyMessage, bsm.get());
+
+    Any data;
+    BOOST_REQUIRE(!schema::dump(&asn_DEF_BasicSafetyMessage, bsm.get(), data));
+
+    // An OCTET STRING is written as hex, just like XER
+    auto json = to_json(data);
+    BOOST_CHECK_NE(std::string::npos, json.find("\"id\":\"A1B2C3D4\""));
+}
+
+BOOST_AUTO_TEST_CASE(load_errors) {
+    void *ptr = nullptr;
+
+    Any data { make_any(42) };
+    BOOST_CHECK(schema::load(&asn_DEF_SPAT, data, &ptr));
+    BOOST_CHECK(!ptr);
+
+    // Missing the required intersections
+    Properties<Any> props;
+    props[Properties<Any>::key_t("timeStamp")] = make_any(10);
+    data = props;
+    BOOST_CHECK(schema::load(&asn_DEF_SPAT, data, &ptr));
+    BOOST_CHECK(!ptr);
+}
+
+BOOST_AUTO_TEST_CASE(same_as_xml) {
+    auto frame = decode_frame();
+    check_same_as_xml(&asn_DEF_MessageFrame, frame.get());
+
+    // The XML decoder reads a number from the start of text like "5th and Perry", so use a name it keeps
+    auto spat = make_spat();
+    OCTET_STRING_fromString(spat->intersections.list.array[0]->name, "Fifth and Perry");
+    check_same_as_xml(&asn_DEF_SPAT, spat.get());
+
+    auto bsm = make_bsm();
+    check_same_as_xml(&asn_DEF_BasicSafetyMessage, bsm.get());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} /* End namespace test */
+} /* End namespace asn */
+} /* End namespace codec */
+} /* End namespace message */
+} /* End namespace tmx */
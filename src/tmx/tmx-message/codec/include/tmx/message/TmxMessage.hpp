@@ -449,6 +449,16 @@ public:
      */
     void set_payload(string_type const &) noexcept;
 
+    /*!
+     * @brief Set the payload from the given string.
+     *
+     * This function takes ownership of the given string contents,
+     * so no copy is made.
+     *
+     * @param[in] The payload
+     */
+    void set_payload(string_type &&) noexcept;
+
     /*!
 	 * @brief Set the payload from the given sequence of bytes.
 	 *
@@ -26,6 +26,8 @@
 #include <istream>
 #include <ostream>
 #include <sstream>
+#include <streambuf>
+#include <string>
 
 #ifndef TMX_DEFAULT_CODEC
 #define TMX_DEFAULT_CODEC "json"
@@ -35,6 +37,54 @@ namespace tmx {
 namespace message {
 namespace codec {
 
+/*!
+ * @brief An output stream that appends directly to a caller-supplied string
+ *
+ * Since the string is owned by the caller, the same memory can be
+ * re-used for every encoding, which avoids the extra copies needed
+ * to get the result out of a string stream.
+ */
+template <typename _CharT = common::char_t>
+class TmxBufferStream: private std::basic_streambuf<_CharT>, public std::basic_ostream<_CharT> {
+    typedef std::basic_streambuf<_CharT> buf_type;
+    typedef std::basic_ostream<_CharT> stream_type;
+
+public:
+    typedef typename buf_type::traits_type traits_type;
+    typedef typename buf_type::int_type int_type;
+
+    /*!
+     * @brief Construct a stream that appends to the given buffer
+     *
+     * @param[in] buffer The buffer to append to
+     */
+    explicit TmxBufferStream(std::basic_string<_CharT> &buffer) noexcept:
+            buf_type(), stream_type(static_cast<buf_type *>(this)), _buffer(buffer) { }
+
+    /*!
+     * @return The buffer being written to
+     */
+    std::basic_string<_CharT> &get_buffer() const noexcept {
+        return this->_buffer;
+    }
+
+protected:
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+            this->_buffer.push_back(traits_type::to_char_type(c));
+
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const _CharT *s, std::streamsize n) override {
+        this->_buffer.append(s, n);
+        return n;
+    }
+
+private:
+    std::basic_string<_CharT> &_buffer;
+};
+
 /*!
  * @brief An interface for encoding Any type to byte form
  */
@@ -84,6 +134,35 @@ public:
         return result;
     }
 
+    /*!
+     * @brief Encode the specified data to the end of the given buffer
+     *
+     * The encoded bytes are written in place, so re-using the same
+     * buffer for each encoding avoids any extra copies, and also any
+     * new memory once the buffer capacity is large enough. If an error
+     * occurs, the buffer is restored to its original length.
+     *
+     * @param[in] data The data to encode
+     * @param[out] buffer The buffer to append the encoded bytes to
+     * @return Any error that occurs
+     */
+    inline common::TmxError encode(common::types::Any const &data,
+                                   std::basic_string<common::char_t> &buffer) const noexcept {
+        const auto _len = buffer.length();
+
+        // The stream outlives the handler, so just alias it without any ownership
+        TmxBufferStream<common::char_t> os { buffer };
+        std::shared_ptr< byte_stream > _ptr { std::shared_ptr< byte_stream >(), &os };
+        common::TmxArgList _args { data, _ptr };
+
+        auto _descr = common::TmxTypeRegistry().get(data.type(), true);
+        common::TmxError result = this->execute(_descr, std::ref(_args));
+        if (result)
+            buffer.resize(_len);
+
+        return result;
+    }
+
 protected:
     /*!
      * @brief Default constructor is protected so this interface cannot be used directly
@@ -121,6 +200,17 @@ public:
      */
     static std::shared_ptr<const TmxDecoder> get_decoder(common::const_string = TMX_DEFAULT_CODEC);
 
+    /*!
+     * @brief Decode the bytes from the character sequence to the given data structure
+     *
+     * The sequence is a view, i.e. a std::basic_string_view, over the
+     * encoded bytes, so nothing is copied before the decoder is invoked.
+     *
+     * @param[out] data The data structure
+     * @param[in] type The type to decode to
+     * @param[in] str The encoded bytes
+     * @return Any error that occurs
+     */
     template <typename _CharT>
     inline common::TmxError decode(common::types::Any &data, common::TmxTypeDescriptor const &type,
                                    common::char_sequence<_CharT> const &str) const noexcept {
@@ -294,6 +384,30 @@ public:
      */
     std::basic_string<common::byte_t> get_payload_bytes() const;
 
+    /*!
+     * @brief Get the message payload as raw bytes
+     *
+     * The bytes are written to the given buffer, replacing any existing
+     * contents. Re-using the same buffer for each message avoids any
+     * new memory once the buffer capacity is large enough.
+     *
+     * @param[out] The buffer to write the raw payload bytes to
+     * @return The buffer
+     */
+    std::basic_string<common::byte_t> &get_payload_bytes(std::basic_string<common::byte_t> &) const;
+
+    /*!
+     * @brief Set the message payload from the raw bytes
+     *
+     * This is the inverse of get_payload_bytes(), so the bytes are
+     * expected to already be encoded by the message encoding. If that
+     * encoder is binary, then the bytes are written to the payload in
+     * the base specified in the message metadata.
+     *
+     * @param[in] The raw payload bytes
+     */
+    void set_payload_bytes(common::byte_sequence const &);
+
     /*!
      * @return The message payload as a new string
      */
@@ -304,7 +418,19 @@ public:
         return { seq.data(), seq.length() };
     }
 private:
+    std::shared_ptr<const TmxEncoder> get_encoder(common::const_string) const;
+    std::shared_ptr<const TmxDecoder> get_decoder(common::const_string) const;
+
     TmxMessage _message;
+
+    // The buffer to encode into, which is swapped with the payload on success
+    std::basic_string<common::char_t> _buffer;
+
+    // The last encoder and decoder used, to avoid a registry look-up for each message
+    mutable std::basic_string<common::char_t> _encoderName;
+    mutable std::shared_ptr<const TmxEncoder> _encoder;
+    mutable std::basic_string<common::char_t> _decoderName;
+    mutable std::shared_ptr<const TmxDecoder> _decoder;
 };
 
 } /* End namespace codec */
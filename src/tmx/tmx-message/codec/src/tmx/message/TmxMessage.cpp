@@ -196,9 +196,9 @@ void TmxMessage::set_priority(typename decltype(TmxMessage::_priority)::value_ty
 }
 
 void TmxMessage::set_base(typename decltype(TmxMessage::_base)::value_type base) noexcept {
-    this->_base = (base >> 4);
-    if (this->_base > decltype(TmxMessage::_base)::mask)
-        this->_base = decltype(TmxMessage::_base)::mask;
+    // Clamp before assigning, since the field would otherwise drop the high bits
+    const unsigned int value = (base >> 4);
+    this->_base = (value > decltype(TmxMessage::_base)::mask ? decltype(TmxMessage::_base)::mask : value);
     *(this->_metadata) = types::pack(_QoS, _priority, _base, _assign_group, _assign_id,
                                      _fragment, _attempt, _reserved, _prog);
 }
@@ -246,9 +246,13 @@ void TmxMessage::set_payload(typename TmxMessage::string_type const &value) noex
     this->get_payload_string().assign(value);
 }
 
+void TmxMessage::set_payload(typename TmxMessage::string_type &&value) noexcept {
+    this->get_payload_string() = std::move(value);
+}
+
 void TmxMessage::set_payload(const common::byte_sequence &value) noexcept {
     const auto &chars = to_char_sequence(value);
-    this->set_payload(typename TmxMessage::string_type(chars.data(), value.length()));
+    this->get_payload_string().assign(chars.data(), value.length());
 }
 
 } /* End namespace message */
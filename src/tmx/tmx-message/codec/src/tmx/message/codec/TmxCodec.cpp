@@ -80,40 +80,90 @@ TmxCodec::TmxCodec(TmxMessage const &message) noexcept: _message(message) { };
 
 TmxMessage &TmxCodec::get_message() noexcept { return this->_message; };
 
+std::shared_ptr<const TmxEncoder> TmxCodec::get_encoder(common::const_string name) const {
+    if (!this->_encoder || name != this->_encoderName) {
+        this->_encoder = TmxEncoder::get_encoder(name);
+        this->_encoderName.assign(name.data(), name.length());
+    }
+
+    return this->_encoder;
+}
+
+std::shared_ptr<const TmxDecoder> TmxCodec::get_decoder(common::const_string name) const {
+    if (!this->_decoder || name != this->_decoderName) {
+        this->_decoder = TmxDecoder::get_decoder(name);
+        this->_decoderName.assign(name.data(), name.length());
+    }
+
+    return this->_decoder;
+}
+
 std::basic_string<common::byte_t> TmxCodec::get_payload_bytes() const {
+    std::basic_string<common::byte_t> bytes;
+    return this->get_payload_bytes(bytes);
+}
+
+std::basic_string<common::byte_t> &TmxCodec::get_payload_bytes(std::basic_string<common::byte_t> &bytes) const {
+    bytes.clear();
+
+    const auto &payload = this->_message.get_payload_string();
+    const auto chars = to_char_sequence<common::char_t>(payload.data(), payload.length());
+
     // Determine if the encoder produced a binary output
-    auto encoder = TmxEncoder::get_encoder(this->_message.get_encoding());
+    auto encoder = this->get_encoder(this->_message.get_encoding());
     if (encoder && encoder->is_binary()) {
         // Decode the bytes
-        auto chars = this->_message.get_payload<common::char_t>();
-
         switch (this->_message.get_base()) {
             case 0:
-                return byte_string_decode(chars, TMX_DEFAULT_BYTE_ENCODING);
-            case 1:
-                return byte_string_decode(chars, base16::value);
-            case 2:
-                return byte_string_decode(chars, base32::value);
-            case 3:
-                return byte_string_decode(chars, base64::value);
+                return byte_string_decode(chars, bytes, TMX_DEFAULT_BYTE_ENCODING);
+            case 16:
+                return byte_string_decode(chars, bytes, base16::value);
+            case 32:
+                return byte_string_decode(chars, bytes, base32::value);
+            case 64:
+                return byte_string_decode(chars, bytes, base64::value);
         }
     }
 
     // Use the payload string directly
-    auto bytes = to_byte_sequence(this->_message.get_payload_string().c_str(), this->_message.get_length());
-    return { bytes.data(), bytes.length() };
+    auto raw = to_byte_sequence(payload.data(), payload.length());
+    bytes.assign(raw.data(), raw.length());
+    return bytes;
+}
+
+void TmxCodec::set_payload_bytes(common::byte_sequence const &bytes) {
+    // Determine if the encoder produced a binary output
+    auto encoder = this->get_encoder(this->_message.get_encoding());
+    if (encoder && encoder->is_binary()) {
+        // Encode the bytes in place, which keeps the existing payload capacity
+        auto &payload = this->_message.get_payload_string();
+        payload.clear();
+
+        switch (this->_message.get_base()) {
+            case 0:
+                byte_string_encode(payload, bytes, TMX_DEFAULT_BYTE_ENCODING);
+                return;
+            case 16:
+                byte_string_encode(payload, bytes, base16::value);
+                return;
+            case 32:
+                byte_string_encode(payload, bytes, base32::value);
+                return;
+            case 64:
+                byte_string_encode(payload, bytes, base64::value);
+                return;
+        }
+    }
+
+    // Use the bytes directly
+    this->_message.set_payload(bytes);
 }
 
 TmxError TmxCodec::encode(const common::types::Any &data, common::const_string codec) {
     if (codec == empty_string())
         codec = this->_message.get_encoding();
 
-    std::shared_ptr<const TmxEncoder> encoder;
-    if (codec == empty_string())
-        encoder = TmxEncoder::get_encoder();
-    else
-        encoder = TmxEncoder::get_encoder(codec);
-
+    auto encoder = this->get_encoder(codec == empty_string() ? TMX_DEFAULT_CODEC : codec);
     if (!encoder) {
         std::string err { "TMX codec " };
         err.append(codec);
@@ -129,13 +179,13 @@ TmxError TmxCodec::encode(const common::types::Any &data, common::const_string c
     if (this->_message.get_id().empty())
         this->_message.set_id(common::types::contents(data).get_type_short_name());
 
-    std::ostringstream byte_stream;
-
-    TmxError ret = encoder->encode(data, byte_stream);
-    if (ret) return ret;
+    // Encode into the scratch buffer, which keeps its capacity between messages,
+    // and only replace the payload if the encoding succeeds
+    this->_buffer.clear();
+    auto err = encoder->encode(data, this->_buffer);
+    if (err) return err;
 
-    std::string const &str = byte_stream.str();
-    this->_message.set_payload(str.c_str(), str.length());
+    this->_message.get_payload_string().swap(this->_buffer);
     return { };
 }
 
@@ -143,12 +193,8 @@ TmxError TmxCodec::decode(common::types::Any &data, common::const_string schema)
     if (schema == empty_string())
         schema = common::types::contents(data).get_type_name();
 
-    std::shared_ptr<const TmxDecoder> decoder;
-    if (this->_message.get_encoding() == empty_string())
-        decoder = TmxDecoder::get_decoder();
-    else
-        decoder = TmxDecoder::get_decoder(this->_message.get_encoding());
-
+    common::const_string codec { this->_message.get_encoding() };
+    auto decoder = this->get_decoder(codec == empty_string() ? TMX_DEFAULT_CODEC : codec);
     if (!decoder) {
         std::string err { "TMX codec " };
         err.append(this->_message.get_encoding());
@@ -157,9 +203,10 @@ TmxError TmxCodec::decode(common::types::Any &data, common::const_string schema)
         return { 11, err };
     }
 
-    auto const &b = this->_message.get_payload();
-    std::istringstream is(to_char_sequence(b.data(), b.length()).data());
-    return decoder->decode(data, TmxTypeRegistry().get(schema), is);
+    // Decode from a view of the payload, without any copies
+    auto const &payload = this->_message.get_payload_string();
+    return decoder->decode(data, TmxTypeRegistry().get(schema),
+                           to_char_sequence<common::char_t>(payload.data(), payload.length()));
 }
 
 } /* End namespace codec */
@@ -0,0 +1,264 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxCodec_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <tmx/message/codec/TmxCodec.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <set>
+#include <sstream>
+#include <string>
+
+// Count every allocation made through the global operator new
+static std::atomic<std::size_t> _allocations { 0 };
+
+void *operator new(std::size_t size) {
+    _allocations++;
+    if (auto ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+using namespace tmx::common;
+using namespace tmx::common::types;
+
+namespace tmx {
+namespace message {
+namespace codec {
+namespace test {
+
+static constexpr std::size_t TEST_RUNS = 1000;
+
+// Some UPER-like bytes, including ones that would be trimmed from a string
+std::basic_string<byte_t> make_bytes(std::size_t len, std::uint8_t seed) {
+    std::basic_string<byte_t> bytes;
+    for (std::size_t i = 0; i < len; i++)
+        bytes.push_back(byte_t((seed + i * 31) & 0xFF));
+
+    bytes[0] = byte_t(0x00);
+    return bytes;
+}
+
+template <typename _Fn>
+std::size_t count_allocations(_Fn fn) {
+    std::size_t start = _allocations;
+    fn();
+    return _allocations - start;
+}
+
+/*!
+ * @brief An encoder that writes part of the output before failing
+ */
+class TestFailingEncoder: public TmxEncoder {
+public:
+    TestFailingEncoder() {
+        this->register_encoder();
+    }
+
+    TmxTypeDescriptor get_descriptor() const noexcept override {
+        static const auto &_descr = TmxEncoder::get_descriptor();
+        return { _descr.get_instance(), typeid(TestFailingEncoder), "test-failing" };
+    }
+
+    bool is_binary() const noexcept override {
+        return false;
+    }
+
+    TmxError execute(TmxTypeDescriptor const &, std::reference_wrapper<TmxArgList> args) const override {
+        auto ptr = tmx::common::any_cast< std::shared_ptr<byte_stream> >(&(args.get().at(1)));
+        if (ptr && ptr->get())
+            *(ptr->get()) << "{\"partial\":";
+
+        return { EINVAL, "Test encoding failure" };
+    }
+};
+
+static TmxTypeRegistrar<TestFailingEncoder> _failing_encoder_registrar;
+
+BOOST_AUTO_TEST_SUITE(codec_test_suite)
+
+BOOST_AUTO_TEST_CASE(encode_failure_keeps_payload) {
+    TmxMessage msg;
+    msg.set_encoding("json");
+
+    TmxCodec codec { msg };
+    BOOST_REQUIRE(!codec.encode(Any(String8("first"))));
+    const std::string payload = codec.get_message().get_payload_string();
+    BOOST_REQUIRE(!payload.empty());
+
+    BOOST_CHECK(codec.encode(Any(String8("second")), "test-failing"));
+    BOOST_CHECK_EQUAL(payload, codec.get_message().get_payload_string());
+
+    // And the scratch buffer does not leak into the next encoding
+    BOOST_REQUIRE(!codec.encode(Any(String8("third"))));
+    BOOST_CHECK_EQUAL("\"third\"", codec.get_message().get_payload_string());
+}
+
+BOOST_AUTO_TEST_CASE(payload_bytes_round_trip) {
+    TmxMessage msg;
+    msg.set_encoding("asn.1-uper");
+
+    TmxCodec codec { msg };
+    auto bytes = make_bytes(200, 7);
+    codec.set_payload_bytes(to_byte_sequence(bytes.data(), bytes.length()));
+
+    // Binary encoders are written in the default byte encoding
+    BOOST_CHECK_EQUAL(byte_string_encode(to_byte_sequence(bytes.data(), bytes.length())),
+                      codec.get_message().get_payload_string());
+    BOOST_CHECK(bytes == codec.get_payload_bytes());
+
+    // And in the base from the message metadata
+    codec.get_message().set_base(32);
+    codec.set_payload_bytes(to_byte_sequence(bytes.data(), bytes.length()));
+    BOOST_CHECK_EQUAL(byte_string_encode(to_byte_sequence(bytes.data(), bytes.length()), base32::value),
+                      codec.get_message().get_payload_string());
+    BOOST_CHECK(bytes == codec.get_payload_bytes());
+
+    // Character encoders use the bytes directly
+    codec.get_message().set_encoding("string");
+    codec.set_payload_bytes(to_byte_sequence("Hello, World", 12));
+    BOOST_CHECK_EQUAL("Hello, World", codec.get_message().get_payload_string());
+    BOOST_CHECK(to_byte_sequence("Hello, World", 12) == codec.get_payload_bytes());
+}
+
+BOOST_AUTO_TEST_CASE(payload_bytes_steady_state_does_not_allocate) {
+    TmxMessage msg;
+    msg.set_encoding("asn.1-uper");
+
+    TmxCodec codec { msg };
+    const auto first = make_bytes(300, 1);
+    const auto second = make_bytes(250, 2);
+
+    // Warm up the buffers and the encoder look-up
+    std::basic_string<byte_t> buffer;
+    codec.set_payload_bytes(to_byte_sequence(first.data(), first.length()));
+    codec.get_payload_bytes(buffer);
+    BOOST_REQUIRE(first == buffer);
+
+    auto allocs = count_allocations([&]() {
+        for (std::size_t i = 0; i < TEST_RUNS; i++) {
+            auto &bytes = (i % 2) ? first : second;
+            codec.set_payload_bytes(to_byte_sequence(bytes.data(), bytes.length()));
+            codec.get_payload_bytes(buffer);
+        }
+    });
+
+    BOOST_TEST_MESSAGE(allocs << " allocations for " << TEST_RUNS << " messages");
+    BOOST_CHECK_EQUAL(0u, allocs);
+    BOOST_CHECK(first == buffer);
+}
+
+BOOST_AUTO_TEST_CASE(byte_string_decode_from_view_does_not_allocate) {
+    const auto bytes = make_bytes(128, 3);
+    const auto encoded = byte_string_encode(to_byte_sequence(bytes.data(), bytes.length()));
+
+    std::basic_string<byte_t> buffer;
+    std::string chars;
+    buffer.reserve(bytes.length());
+    chars.reserve(encoded.length());
+
+    auto allocs = count_allocations([&]() {
+        for (std::size_t i = 0; i < TEST_RUNS; i++) {
+            buffer.clear();
+            byte_string_decode(char_sequence<char> { encoded.data(), encoded.length() }, buffer,
+                               TMX_DEFAULT_BYTE_ENCODING);
+
+            chars.clear();
+            byte_string_encode(chars, to_byte_sequence(buffer.data(), buffer.length()), TMX_DEFAULT_BYTE_ENCODING);
+        }
+    });
+
+    BOOST_CHECK_EQUAL(0u, allocs);
+    BOOST_CHECK(bytes == buffer);
+    BOOST_CHECK_EQUAL(encoded, chars);
+}
+
+BOOST_AUTO_TEST_CASE(encode_to_buffer) {
+    auto encoder = TmxEncoder::get_encoder("asn.1-ber");
+    BOOST_REQUIRE(encoder);
+
+    Any data { String8("Hello, World") };
+
+    std::ostringstream os;
+    auto err = encoder->encode(data, os);
+    BOOST_REQUIRE_MESSAGE(!err, err.get_message());
+    BOOST_CHECK_NE(std::string::npos, os.str().find(byte_string_encode(to_byte_sequence("Hello, World", 12))));
+
+    // The bytes are appended to the existing buffer
+    std::string buffer { "ABC" };
+    BOOST_REQUIRE(!encoder->encode(data, buffer));
+    BOOST_CHECK_EQUAL("ABC" + os.str(), buffer);
+
+    // The buffer is restored if the encoding fails
+    Properties<Any> props;
+    props[Properties<Any>::key_t("value")] = make_any(42);
+    BOOST_CHECK(encoder->encode(Any { props }, buffer));
+    BOOST_CHECK_EQUAL("ABC" + os.str(), buffer);
+
+    // The XML encoding does not include the trailing newline
+    encoder = TmxEncoder::get_encoder("asn.1-xer");
+    BOOST_REQUIRE(encoder);
+
+    buffer.clear();
+    BOOST_REQUIRE(!encoder->encode(Any { String8("test") }, buffer));
+    BOOST_CHECK(!buffer.empty());
+    BOOST_CHECK_NE('\n', buffer.back());
+    BOOST_CHECK_NE(std::string::npos, buffer.find("test"));
+}
+
+BOOST_AUTO_TEST_CASE(encode_reuses_payload) {
+    Properties<Any> props;
+    props[Properties<Any>::key_t("name")] = make_any(String8("test"));
+    props[Properties<Any>::key_t("value")] = make_any(42);
+    Any data { props };
+
+    TmxCodec codec;
+    BOOST_REQUIRE(!codec.encode(data, "json"));
+    BOOST_CHECK_EQUAL("json", codec.get_message().get_encoding());
+
+    const auto json = codec.get_message().get_payload_string();
+    BOOST_REQUIRE(!codec.encode(data));
+
+    // The payload is swapped with the scratch buffer, so the same two blocks of memory are used again
+    std::set<const void *> used;
+    for (std::size_t i = 0; i < 10; i++) {
+        BOOST_REQUIRE(!codec.encode(data));
+        BOOST_CHECK_EQUAL(json, codec.get_message().get_payload_string());
+        used.insert(codec.get_message().get_payload_string().data());
+    }
+
+    BOOST_CHECK_LE(used.size(), 2u);
+
+    Any copy;
+    BOOST_REQUIRE(!codec.decode(copy));
+    auto decoded = tmx::common::any_cast< Properties<Any> >(&copy);
+    BOOST_REQUIRE(decoded);
+    BOOST_CHECK_EQUAL(2u, decoded->size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} /* End namespace test */
+} /* End namespace codec */
+} /* End namespace message */
+} /* End namespace tmx */
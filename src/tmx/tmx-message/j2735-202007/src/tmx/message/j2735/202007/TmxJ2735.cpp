@@ -17,6 +17,7 @@
 #include <tmx/common/TmxTypeDescriptor.hpp>
 #include <tmx/common/TmxTypeRegistrar.hpp>
 #include <tmx/common/TmxTypeRegistry.hpp>
+#include <tmx/common/types/Any.hpp>
 #include <tmx/message/j2735/202007/MessageFrame.h>
 
 #include <tuple>
@@ -109,6 +110,10 @@ public:
     }
 };
 
+// The direct structure converters, from TmxJ2735Converter.cpp
+common::TmxError dump(const void *, const void *, common::types::Any &);
+common::TmxError load(const void *, common::types::Any const &, void **);
+
 } /* End namespace R202007 */
 
 using namespace RELEASE_NS(RELEASE);
@@ -118,6 +123,8 @@ class TmxJ2735 {
     struct _getMsgNm { };
     struct _getTypeD { };
     struct _getTypeNm { };
+    struct _dump { };
+    struct _load { };
 public:
     template <J2735_MESSAGE ... _Id>
     auto get_messages(common::static_array<J2735_MESSAGE, _Id...> const &) {
@@ -141,11 +148,15 @@ public:
         static auto getMsgNm = common::make_function(&TmxJ2735::get_message_name);
         static auto getTypeD = common::make_function(&TmxJ2735::get_type_descriptor);
         static auto getTypeNm = common::make_function(&TmxJ2735::get_type_name);
+        static auto dumpFn = common::make_function(&RELEASE_NS(RELEASE)::dump);
+        static auto loadFn = common::make_function(&RELEASE_NS(RELEASE)::load);
 
         _registry.register_handler(getMsgId, typeid(_getMsgId), "get-message-id");
         _registry.register_handler(getMsgNm, typeid(_getMsgNm), "get-message-name");
         _registry.register_handler(getTypeD, typeid(_getTypeD), "get-type-descriptor");
         _registry.register_handler(getTypeNm, typeid(_getTypeNm), "get-type-name");
+        _registry.register_handler(dumpFn, typeid(_dump), "dump");
+        _registry.register_handler(loadFn, typeid(_load), "load");
 
         // Check to see if this is the latest version
         if (auto const &descr = reg.get("latest"))
@@ -0,0 +1,719 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxJ2735Converter.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/common/TmxError.hpp>
+#include <tmx/common/types/Any.hpp>
+#include <tmx/common/types/Array.hpp>
+#include <tmx/common/types/Boolean.hpp>
+#include <tmx/common/types/Enum.hpp>
+#include <tmx/common/types/Float.hpp>
+#include <tmx/common/types/Int.hpp>
+#include <tmx/common/types/Map.hpp>
+#include <tmx/common/types/Null.hpp>
+#include <tmx/common/types/String.hpp>
+#include <tmx/message/j2735/202007/ANY.h>
+#include <tmx/message/j2735/202007/BIT_STRING.h>
+#include <tmx/message/j2735/202007/BOOLEAN.h>
+#include <tmx/message/j2735/202007/IA5String.h>
+#include <tmx/message/j2735/202007/INTEGER.h>
+#include <tmx/message/j2735/202007/NativeEnumerated.h>
+#include <tmx/message/j2735/202007/NativeInteger.h>
+#include <tmx/message/j2735/202007/OCTET_STRING.h>
+#include <tmx/message/j2735/202007/OPEN_TYPE.h>
+#include <tmx/message/j2735/202007/asn_SEQUENCE_OF.h>
+#include <tmx/message/j2735/202007/asn_SET_OF.h>
+#include <tmx/message/j2735/202007/constr_CHOICE.h>
+#include <tmx/message/j2735/202007/constr_SEQUENCE.h>
+#include <tmx/message/j2735/202007/constr_SEQUENCE_OF.h>
+#include <tmx/message/j2735/202007/constr_SET_OF.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <tuple>
+
+using namespace tmx::common;
+using namespace tmx::common::types;
+
+namespace tmx {
+namespace message {
+namespace J2735 {
+namespace R202007 {
+
+/*
+ * The asn1c type descriptors do not carry a type code, but each one
+ * points to the operations table of its base type. Since those tables
+ * are compiled into this library along with the descriptors, comparing
+ * the pointers is enough to tell how the structure is laid out.
+ */
+enum class asn_kind {
+    UNKNOWN,
+    SEQUENCE,
+    CHOICE,
+    SEQUENCE_OF,
+    NATIVE_INTEGER,
+    NATIVE_ENUMERATED,
+    INTEGER,
+    BOOLEAN,
+    BIT_STRING,
+    OCTET_STRING,
+    STRING
+};
+
+typedef Properties<Any> properties_type;
+typedef Array<Any> array_type;
+
+static asn_kind kind_of(asn_TYPE_descriptor_t const *td) noexcept {
+    auto op = td->op;
+    if (op == &asn_OP_SEQUENCE)
+        return asn_kind::SEQUENCE;
+    if (op == &asn_OP_CHOICE || op == &asn_OP_OPEN_TYPE)
+        return asn_kind::CHOICE;
+    if (op == &asn_OP_SEQUENCE_OF || op == &asn_OP_SET_OF)
+        return asn_kind::SEQUENCE_OF;
+    if (op == &asn_OP_NativeInteger)
+        return asn_kind::NATIVE_INTEGER;
+    if (op == &asn_OP_NativeEnumerated)
+        return asn_kind::NATIVE_ENUMERATED;
+    if (op == &asn_OP_INTEGER)
+        return asn_kind::INTEGER;
+    if (op == &asn_OP_BOOLEAN)
+        return asn_kind::BOOLEAN;
+    if (op == &asn_OP_BIT_STRING)
+        return asn_kind::BIT_STRING;
+    if (op == &asn_OP_IA5String)
+        return asn_kind::STRING;
+    // A plain OCTET STRING also has the ASN_OSUBV_STR subvariant, so only the operations tell the text apart
+    if (op == &asn_OP_OCTET_STRING || op == &asn_OP_ANY)
+        return asn_kind::OCTET_STRING;
+
+    return asn_kind::UNKNOWN;
+}
+
+static std::size_t struct_size_of(asn_TYPE_descriptor_t const *td) noexcept {
+    switch (kind_of(td)) {
+        case asn_kind::SEQUENCE:
+            return static_cast<asn_SEQUENCE_specifics_t const *>(td->specifics)->struct_size;
+        case asn_kind::CHOICE:
+            return static_cast<asn_CHOICE_specifics_t const *>(td->specifics)->struct_size;
+        case asn_kind::SEQUENCE_OF:
+            return static_cast<asn_SET_OF_specifics_t const *>(td->specifics)->struct_size;
+        case asn_kind::NATIVE_INTEGER:
+        case asn_kind::NATIVE_ENUMERATED:
+            return sizeof(long);
+        case asn_kind::INTEGER:
+            return sizeof(INTEGER_t);
+        case asn_kind::BOOLEAN:
+            return sizeof(BOOLEAN_t);
+        case asn_kind::BIT_STRING:
+        case asn_kind::OCTET_STRING:
+        case asn_kind::STRING:
+            if (td->specifics)
+                return static_cast<asn_OCTET_STRING_specifics_t const *>(td->specifics)->struct_size;
+            return sizeof(OCTET_STRING_t);
+        default:
+            return 0;
+    }
+}
+
+static TmxError unsupported(asn_TYPE_descriptor_t const *td) {
+    return { ENOTSUP, std::string("Unsupported ASN.1 type ") + td->name };
+}
+
+static TmxError mismatch(asn_TYPE_descriptor_t const *td, const char *expected) {
+    return { EINVAL, std::string("Expected ") + expected + " for ASN.1 type " + td->name };
+}
+
+/*
+ * CHOICE and open type structures keep the selected member index,
+ * starting at one, in an integer of whatever size asn1c chose.
+ */
+static unsigned get_present(asn_CHOICE_specifics_t const *specs, const void *sptr) noexcept {
+    auto ptr = static_cast<const char *>(sptr) + specs->pres_offset;
+    switch (specs->pres_size) {
+        case sizeof(unsigned char):
+            return *reinterpret_cast<const unsigned char *>(ptr);
+        case sizeof(unsigned short):
+            return *reinterpret_cast<const unsigned short *>(ptr);
+        case sizeof(unsigned int):
+            return *reinterpret_cast<const unsigned int *>(ptr);
+        default:
+            return 0;
+    }
+}
+
+static void set_present(asn_CHOICE_specifics_t const *specs, void *sptr, unsigned present) noexcept {
+    auto ptr = static_cast<char *>(sptr) + specs->pres_offset;
+    switch (specs->pres_size) {
+        case sizeof(unsigned char):
+            *reinterpret_cast<unsigned char *>(ptr) = present;
+            break;
+        case sizeof(unsigned short):
+            *reinterpret_cast<unsigned short *>(ptr) = present;
+            break;
+        case sizeof(unsigned int):
+            *reinterpret_cast<unsigned int *>(ptr) = present;
+            break;
+    }
+}
+
+static const void *get_member(asn_TYPE_member_t const &elm, const void *sptr) noexcept {
+    auto ptr = static_cast<const char *>(sptr) + elm.memb_offset;
+    if (elm.flags & ATF_POINTER)
+        return *reinterpret_cast<const void * const *>(ptr);
+
+    return ptr;
+}
+
+/*
+ * Dump the contents of an asn1c structure
+ */
+
+static TmxError to_any(asn_TYPE_descriptor_t const *, const void *, Any &) noexcept;
+
+static TmxError dump_sequence(asn_TYPE_descriptor_t const *td, const void *sptr, Any &out) noexcept {
+    auto &_props = out.emplace<properties_type>();
+    _props.reserve(td->elements_count);
+
+    for (unsigned int i = 0; i < td->elements_count; i++) {
+        auto const &elm = td->elements[i];
+        auto memb = get_member(elm, sptr);
+        if (!memb)
+            continue;
+
+        auto err = to_any(elm.type, memb, _props[properties_type::key_t(elm.name)]);
+        if (err) return err;
+    }
+
+    return { };
+}
+
+static TmxError dump_choice(asn_TYPE_descriptor_t const *td, const void *sptr, Any &out) noexcept {
+    auto specs = static_cast<asn_CHOICE_specifics_t const *>(td->specifics);
+    auto present = get_present(specs, sptr);
+    if (present == 0 || present > td->elements_count) {
+        out.emplace<Null>();
+        return { };
+    }
+
+    auto const &elm = td->elements[present - 1];
+    auto memb = get_member(elm, sptr);
+
+    auto &_props = out.emplace<properties_type>();
+    auto &val = _props[properties_type::key_t(elm.name)];
+    if (!memb) {
+        val.emplace<Null>();
+        return { };
+    }
+
+    return to_any(elm.type, memb, val);
+}
+
+static TmxError dump_sequence_of(asn_TYPE_descriptor_t const *td, const void *sptr, Any &out) noexcept {
+    auto list = _A_CSEQUENCE_FROM_VOID(sptr);
+    auto elmtd = td->elements[0].type;
+
+    auto &_array = out.emplace<array_type>();
+    _array.reserve(list->count);
+
+    for (int i = 0; i < list->count; i++) {
+        auto &val = _array.emplace_back(Null());
+        if (!list->array[i])
+            continue;
+
+        auto err = to_any(elmtd, list->array[i], val);
+        if (err) return err;
+    }
+
+    return { };
+}
+
+static TmxError dump_integer(asn_TYPE_descriptor_t const *td, const void *sptr, Any &out) noexcept {
+    auto specs = static_cast<asn_INTEGER_specifics_t const *>(td->specifics);
+    auto value = *static_cast<const long *>(sptr);
+
+    // Always pass a temporary, or else the data type would keep a reference to the local
+    if (specs && specs->field_unsigned)
+        out.emplace<UIntmax>(static_cast<TmxValueTypeOf<UIntmax> >(static_cast<unsigned long>(value)));
+    else
+        out.emplace<Intmax>(static_cast<TmxValueTypeOf<Intmax> >(value));
+
+    return { };
+}
+
+static TmxError dump_enumerated(asn_TYPE_descriptor_t const *td, const void *sptr, Any &out) noexcept {
+    auto specs = static_cast<asn_INTEGER_specifics_t const *>(td->specifics);
+    auto value = *static_cast<const long *>(sptr);
+
+    auto entry = specs ? INTEGER_map_value2enum(specs, value) : nullptr;
+    if (entry)
+        out.emplace<String8>(entry->enum_name, entry->enum_len);
+    else
+        out.emplace<Intmax>(static_cast<TmxValueTypeOf<Intmax> >(value));
+
+    return { };
+}
+
+static TmxError dump_big_integer(asn_TYPE_descriptor_t const *td, const void *sptr, Any &out) noexcept {
+    auto ptr = static_cast<const INTEGER_t *>(sptr);
+
+    intmax_t value;
+    if (asn_INTEGER2imax(ptr, &value) == 0) {
+        out.emplace<Intmax>(static_cast<TmxValueTypeOf<Intmax> >(value));
+        return { };
+    }
+
+    uintmax_t uvalue;
+    if (asn_INTEGER2umax(ptr, &uvalue) == 0) {
+        out.emplace<UIntmax>(static_cast<TmxValueTypeOf<UIntmax> >(uvalue));
+        return { };
+    }
+
+    return { ERANGE, std::string("Value of ASN.1 type ") + td->name + " is out of range" };
+}
+
+static TmxError dump_bit_string(asn_TYPE_descriptor_t const *, const void *sptr, Any &out) noexcept {
+    auto ptr = static_cast<const BIT_STRING_t *>(sptr);
+    std::size_t bits = ptr->size * 8;
+    if (bits >= (std::size_t)ptr->bits_unused)
+        bits -= ptr->bits_unused;
+
+    std::string str(bits, '0');
+    for (std::size_t i = 0; i < bits; i++) {
+        if (ptr->buf[i / 8] & (0x80 >> (i % 8)))
+            str[i] = '1';
+    }
+
+    out.emplace<String8>(str.c_str(), str.length());
+    return { };
+}
+
+static TmxError dump_octet_string(asn_TYPE_descriptor_t const *, const void *sptr, Any &out) noexcept {
+    static constexpr const char *hex = "0123456789ABCDEF";
+
+    auto ptr = static_cast<const OCTET_STRING_t *>(sptr);
+    std::string str(ptr->size * 2, '0');
+    for (int i = 0; i < ptr->size; i++) {
+        str[2 * i] = hex[ptr->buf[i] >> 4];
+        str[2 * i + 1] = hex[ptr->buf[i] & 0x0F];
+    }
+
+    out.emplace<String8>(str.c_str(), str.length());
+    return { };
+}
+
+static TmxError dump_string(asn_TYPE_descriptor_t const *, const void *sptr, Any &out) noexcept {
+    auto ptr = static_cast<const OCTET_STRING_t *>(sptr);
+    out.emplace<String8>(reinterpret_cast<const char *>(ptr->buf), ptr->size);
+    return { };
+}
+
+static TmxError to_any(asn_TYPE_descriptor_t const *td, const void *sptr, Any &out) noexcept {
+    switch (kind_of(td)) {
+        case asn_kind::SEQUENCE:
+            return dump_sequence(td, sptr, out);
+        case asn_kind::CHOICE:
+            return dump_choice(td, sptr, out);
+        case asn_kind::SEQUENCE_OF:
+            return dump_sequence_of(td, sptr, out);
+        case asn_kind::NATIVE_INTEGER:
+            return dump_integer(td, sptr, out);
+        case asn_kind::NATIVE_ENUMERATED:
+            return dump_enumerated(td, sptr, out);
+        case asn_kind::INTEGER:
+            return dump_big_integer(td, sptr, out);
+        case asn_kind::BOOLEAN:
+            out.emplace<Boolean>(*static_cast<const BOOLEAN_t *>(sptr) != 0);
+            return { };
+        case asn_kind::BIT_STRING:
+            return dump_bit_string(td, sptr, out);
+        case asn_kind::OCTET_STRING:
+            return dump_octet_string(td, sptr, out);
+        case asn_kind::STRING:
+            return dump_string(td, sptr, out);
+        default:
+            return unsupported(td);
+    }
+}
+
+/*
+ * Load the contents of an asn1c structure
+ */
+
+template <typename _Tp, typename _T>
+static bool cast_scalar(Any const &in, _Tp &out) noexcept {
+    auto ptr = tmx::common::any_cast<_T>(&in);
+    if (!ptr)
+        return false;
+
+    if TMX_CONSTEXPR_FN (std::is_same<_T, Boolean>::value)
+        out = static_cast<_Tp>(*ptr ? 1 : 0);
+    else
+        out = static_cast<_Tp>((TmxValueTypeOf<_T>)*ptr);
+    return true;
+}
+
+template <typename _Tp, typename _T>
+static bool cast_enum(Any const &in, _Tp &out) noexcept {
+    auto ptr = tmx::common::any_cast<_T>(&in);
+    if (!ptr)
+        return false;
+
+    out = static_cast<_Tp>(ptr->get_integer_value());
+    return true;
+}
+
+template <typename _Tp, typename... _T, typename... _E>
+static bool get_scalar(Any const &in, _Tp &out, std::tuple<_T...> const &, std::tuple<_E...> const &) noexcept {
+    return (cast_scalar<_Tp, _T>(in, out) || ...) || (cast_enum<_Tp, _E>(in, out) || ...);
+}
+
+template <typename _Tp>
+static bool get_scalar(Any const &in, _Tp &out) noexcept {
+    return get_scalar(in, out, TmxArithmeticTypes { }, TmxEnumTypes { });
+}
+
+/*
+ * Enumerations, bit strings and such may have come through as a string,
+ * or as an enumeration name from the XML decoder.
+ */
+static bool get_text(Any const &in, std::string &out) noexcept {
+    auto str = tmx::common::any_cast<String8>(&in);
+    if (str) {
+        out.assign(str->c_str(), str->length());
+        return true;
+    }
+
+    auto e = tmx::common::any_cast<Enum16>(&in);
+    if (e) {
+        out = e->get_enum_name();
+        return !out.empty();
+    }
+
+    return false;
+}
+
+static TmxError from_any(asn_TYPE_descriptor_t const *, Any const &, void *) noexcept;
+
+static TmxError load_member(asn_TYPE_member_t const &elm, Any const &in, void *sptr) noexcept {
+    void *memb = static_cast<char *>(sptr) + elm.memb_offset;
+    if (elm.flags & ATF_POINTER) {
+        auto size = struct_size_of(elm.type);
+        if (!size)
+            return unsupported(elm.type);
+
+        // The allocation belongs to the parent now, so it is freed with it
+        auto ptr = std::calloc(1, size);
+        if (!ptr)
+            return { ENOMEM, std::string("Unable to allocate ASN.1 type ") + elm.type->name };
+
+        *static_cast<void **>(memb) = ptr;
+        memb = ptr;
+    }
+
+    return from_any(elm.type, in, memb);
+}
+
+static TmxError load_sequence(asn_TYPE_descriptor_t const *td, Any const &in, void *sptr) noexcept {
+    auto _props = tmx::common::any_cast<properties_type>(&in);
+    if (!_props)
+        return mismatch(td, "properties");
+
+    for (unsigned int i = 0; i < td->elements_count; i++) {
+        auto const &elm = td->elements[i];
+        auto iter = _props->find(properties_type::key_t(elm.name));
+        if (iter == _props->end() || tmx::common::any_cast<Null>(&iter->second)) {
+            if (elm.default_value_set) {
+                auto memb = reinterpret_cast<void **>(static_cast<char *>(sptr) + elm.memb_offset);
+                if (elm.default_value_set(memb))
+                    return { EINVAL, std::string("Unable to set default value for ") + elm.name };
+            } else if (!elm.optional) {
+                return { EINVAL, std::string("Missing required member ") + elm.name + " of ASN.1 type " + td->name };
+            }
+
+            continue;
+        }
+
+        auto err = load_member(elm, iter->second, sptr);
+        if (err) return err;
+    }
+
+    return { };
+}
+
+static TmxError load_choice(asn_TYPE_descriptor_t const *td, Any const &in, void *sptr) noexcept {
+    auto _props = tmx::common::any_cast<properties_type>(&in);
+    if (!_props || _props->size() != 1)
+        return mismatch(td, "a single choice");
+
+    auto const &choice = *(_props->begin());
+    for (unsigned int i = 0; i < td->elements_count; i++) {
+        auto const &elm = td->elements[i];
+        if (std::strcmp(choice.first.c_str(), elm.name) != 0)
+            continue;
+
+        set_present(static_cast<asn_CHOICE_specifics_t const *>(td->specifics), sptr, i + 1);
+        return load_member(elm, choice.second, sptr);
+    }
+
+    return { EINVAL, "Unknown choice " + std::string(choice.first.c_str()) + " for ASN.1 type " + td->name };
+}
+
+static TmxError load_sequence_of(asn_TYPE_descriptor_t const *td, Any const &in, void *sptr) noexcept {
+    auto _array = tmx::common::any_cast<array_type>(&in);
+    if (!_array)
+        return mismatch(td, "an array");
+
+    auto elmtd = td->elements[0].type;
+    auto size = struct_size_of(elmtd);
+    if (!size)
+        return unsupported(elmtd);
+
+    for (auto const &val: *_array) {
+        auto ptr = std::calloc(1, size);
+        if (!ptr)
+            return { ENOMEM, std::string("Unable to allocate ASN.1 type ") + elmtd->name };
+
+        if (asn_set_add(sptr, ptr)) {
+            std::free(ptr);
+            return { ENOMEM, std::string("Unable to add to ASN.1 type ") + td->name };
+        }
+
+        auto err = from_any(elmtd, val, ptr);
+        if (err) return err;
+    }
+
+    return { };
+}
+
+static TmxError load_integer(asn_TYPE_descriptor_t const *td, Any const &in, void *sptr) noexcept {
+    auto specs = static_cast<asn_INTEGER_specifics_t const *>(td->specifics);
+    auto ptr = static_cast<long *>(sptr);
+
+    if (specs && specs->field_unsigned) {
+        unsigned long value;
+        if (!get_scalar(in, value))
+            return mismatch(td, "an integer");
+
+        *ptr = static_cast<long>(value);
+    } else if (!get_scalar(in, *ptr)) {
+        return mismatch(td, "an integer");
+    }
+
+    return { };
+}
+
+static TmxError load_enumerated(asn_TYPE_descriptor_t const *td, Any const &in, void *sptr) noexcept {
+    auto specs = static_cast<asn_INTEGER_specifics_t const *>(td->specifics);
+    auto ptr = static_cast<long *>(sptr);
+
+    std::string name;
+    if (specs && get_text(in, name)) {
+        for (int i = 0; i < specs->map_count; i++) {
+            auto const &entry = specs->value2enum[i];
+            if (name.length() == entry.enum_len && std::strncmp(name.c_str(), entry.enum_name, entry.enum_len) == 0) {
+                *ptr = entry.nat_value;
+                return { };
+            }
+        }
+
+        return { EINVAL, "Unknown enumeration " + name + " for ASN.1 type " + td->name };
+    }
+
+    if (!get_scalar(in, *ptr))
+        return mismatch(td, "an enumeration");
+
+    return { };
+}
+
+static TmxError load_big_integer(asn_TYPE_descriptor_t const *td, Any const &in, void *sptr) noexcept {
+    auto ptr = static_cast<INTEGER_t *>(sptr);
+
+    uintmax_t uvalue;
+    if (tmx::common::any_cast<UIntmax>(&in) && get_scalar(in, uvalue)) {
+        if (asn_umax2INTEGER(ptr, uvalue))
+            return { ENOMEM, std::string("Unable to set ASN.1 type ") + td->name };
+
+        return { };
+    }
+
+    intmax_t value;
+    if (!get_scalar(in, value))
+        return mismatch(td, "an integer");
+
+    if (asn_imax2INTEGER(ptr, value))
+        return { ENOMEM, std::string("Unable to set ASN.1 type ") + td->name };
+
+    return { };
+}
+
+static TmxError load_boolean(asn_TYPE_descriptor_t const *td, Any const &in, void *sptr) noexcept {
+    auto ptr = static_cast<BOOLEAN_t *>(sptr);
+
+    std::string name;
+    if (get_text(in, name)) {
+        if (name == "true" || name == "True")
+            *ptr = 1;
+        else if (name == "false" || name == "False")
+            *ptr = 0;
+        else
+            return mismatch(td, "a boolean");
+    } else if (!get_scalar(in, *ptr)) {
+        return mismatch(td, "a boolean");
+    }
+
+    return { };
+}
+
+static TmxError load_bit_string(asn_TYPE_descriptor_t const *td, Any const &in, void *sptr) noexcept {
+    auto ptr = static_cast<BIT_STRING_t *>(sptr);
+
+    std::string bits;
+    if (!get_text(in, bits) || bits.find_first_not_of("01") != std::string::npos)
+        return mismatch(td, "a bit string");
+
+    ptr->size = (bits.length() + 7) / 8;
+    ptr->bits_unused = ptr->size * 8 - bits.length();
+    ptr->buf = static_cast<std::uint8_t *>(std::calloc(ptr->size + 1, 1));
+    if (!ptr->buf)
+        return { ENOMEM, std::string("Unable to allocate ASN.1 type ") + td->name };
+
+    for (std::size_t i = 0; i < bits.length(); i++) {
+        if (bits[i] == '1')
+            ptr->buf[i / 8] |= (0x80 >> (i % 8));
+    }
+
+    return { };
+}
+
+static TmxError load_octet_string(asn_TYPE_descriptor_t const *td, Any const &in, void *sptr) noexcept {
+    std::string str;
+    if (!get_text(in, str) || str.length() % 2 || str.find_first_not_of("0123456789ABCDEFabcdef") != std::string::npos)
+        return mismatch(td, "a hex string");
+
+    std::string bytes(str.length() / 2, '\0');
+    for (std::size_t i = 0; i < bytes.length(); i++)
+        bytes[i] = static_cast<char>(std::strtoul(str.substr(2 * i, 2).c_str(), nullptr, 16));
+
+    if (OCTET_STRING_fromBuf(static_cast<OCTET_STRING_t *>(sptr), bytes.data(), bytes.length()))
+        return { ENOMEM, std::string("Unable to allocate ASN.1 type ") + td->name };
+
+    return { };
+}
+
+static TmxError load_string(asn_TYPE_descriptor_t const *td, Any const &in, void *sptr) noexcept {
+    std::string str;
+    if (!get_text(in, str))
+        return mismatch(td, "a string");
+
+    if (OCTET_STRING_fromBuf(static_cast<OCTET_STRING_t *>(sptr), str.data(), str.length()))
+        return { ENOMEM, std::string("Unable to allocate ASN.1 type ") + td->name };
+
+    return { };
+}
+
+static TmxError from_any(asn_TYPE_descriptor_t const *td, Any const &in, void *sptr) noexcept {
+    switch (kind_of(td)) {
+        case asn_kind::SEQUENCE:
+            return load_sequence(td, in, sptr);
+        case asn_kind::CHOICE:
+            return load_choice(td, in, sptr);
+        case asn_kind::SEQUENCE_OF:
+            return load_sequence_of(td, in, sptr);
+        case asn_kind::NATIVE_INTEGER:
+            return load_integer(td, in, sptr);
+        case asn_kind::NATIVE_ENUMERATED:
+            return load_enumerated(td, in, sptr);
+        case asn_kind::INTEGER:
+            return load_big_integer(td, in, sptr);
+        case asn_kind::BOOLEAN:
+            return load_boolean(td, in, sptr);
+        case asn_kind::BIT_STRING:
+            return load_bit_string(td, in, sptr);
+        case asn_kind::OCTET_STRING:
+            return load_octet_string(td, in, sptr);
+        case asn_kind::STRING:
+            return load_string(td, in, sptr);
+        default:
+            return unsupported(td);
+    }
+}
+
+/*!
+ * @brief Convert the asn1c structure to TMX data
+ *
+ * This walks the type descriptor member tables directly. SEQUENCE types
+ * become properties by member name, with absent optional members left
+ * out, and CHOICE types become properties with only the selected member.
+ * Lists become arrays and enumerations become their names. The root
+ * value is keyed by the XML tag of the type, which is the same result
+ * as the original XER-based conversion.
+ *
+ * @param[in] descriptor The asn_TYPE_descriptor_t of the structure
+ * @param[in] obj The structure to convert
+ * @param[out] out The TMX data
+ * @return Any error that occurred
+ */
+TmxError dump(const void *descriptor, const void *obj, Any &out) {
+    auto td = static_cast<asn_TYPE_descriptor_t const *>(descriptor);
+    if (!td || !obj)
+        return { EINVAL, "Invalid argument: Missing ASN.1 type or structure." };
+
+    auto &_props = out.emplace<properties_type>();
+    return to_any(td, obj, _props[properties_type::key_t(td->xml_tag)]);
+}
+
+/*!
+ * @brief Build a new asn1c structure from TMX data
+ *
+ * This is the inverse of dump(), so the data may either be keyed by the
+ * XML tag of the type or be the structure contents themselves. On success,
+ * the new structure belongs to the caller and should be released with
+ * ASN_STRUCT_FREE. On failure, nothing is returned.
+ *
+ * @param[in] descriptor The asn_TYPE_descriptor_t of the structure
+ * @param[in] in The TMX data
+ * @param[out] out The new structure
+ * @return Any error that occurred
+ */
+TmxError load(const void *descriptor, Any const &in, void **out) {
+    auto td = static_cast<asn_TYPE_descriptor_t const *>(descriptor);
+    if (!td || !out)
+        return { EINVAL, "Invalid argument: Missing ASN.1 type or structure." };
+
+    auto size = struct_size_of(td);
+    if (!size)
+        return unsupported(td);
+
+    const Any *data = &in;
+    auto _props = tmx::common::any_cast<properties_type>(&in);
+    if (_props && _props->size() == 1 && std::strcmp(_props->begin()->first.c_str(), td->xml_tag) == 0)
+        data = &(_props->begin()->second);
+
+    auto ptr = std::calloc(1, size);
+    if (!ptr)
+        return { ENOMEM, std::string("Unable to allocate ASN.1 type ") + td->name };
+
+    auto err = from_any(td, *data, ptr);
+    if (err) {
+        td->op->free_struct(td, ptr, ASFM_FREE_EVERYTHING);
+        return err;
+    }
+
+    *out = ptr;
+    return { };
+}
+
+} /* End namespace R202007 */
+} /* End namespace J2735 */
+} /* End namespace message */
+} /* End namespace tmx */
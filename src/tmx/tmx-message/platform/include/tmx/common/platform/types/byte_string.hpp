@@ -17,6 +17,9 @@
 #include <tmx/common/platform/types/bytes.hpp>
 #include <tmx/common/platform/types/arrays.hpp>
 
+#include <iterator>
+#include <string>
+
 #ifndef TMX_DEFAULT_BYTE_ENCODING
 #define TMX_DEFAULT_BYTE_ENCODING tmx::common::hexadecimal::value
 #endif
@@ -128,9 +131,18 @@ constexpr auto byte_encoder_traits<typename std::decay<decltype(base64::value)>:
     return val - type::array.at(0) + (val > 'Z' ? 'Z' + 1 - 'a': 0) + (val < 'A' ? 'A' + 52 - '0': 0);
 }
 
-template <typename _CharT, typename _Iter, typename _IterTraits = std::iterator_traits<_Iter>, _CharT ... _Map>
-std::enable_if_t<std::is_same_v<typename _IterTraits::value_type, byte_t>, std::basic_ostream<_CharT> &>
-byte_string_encode(std::basic_ostream<_CharT> &os, _Iter iter, static_array<_CharT, _Map...> const &) noexcept {
+/*!
+ * @brief Encode the bytes from the iterator to the output character iterator
+ *
+ * This is the common implementation for all the byte string encoders,
+ * which allows writing to either a stream or directly to a string.
+ *
+ * @param[in] out The output character iterator
+ * @param[in] iter The byte iterator
+ * @return The output character iterator, after the last character written
+ */
+template <typename _Out, typename _CharT, typename _Iter, _CharT ... _Map>
+_Out byte_string_encode_to(_Out out, _Iter iter, static_array<_CharT, _Map...> const &) noexcept {
     typedef byte_encoder_traits< static_array<_CharT, _Map...> > traits;
 
     std::uint64_t value = 0;
@@ -143,26 +155,57 @@ byte_string_encode(std::basic_ostream<_CharT> &os, _Iter iter, static_array<_Cha
 
         if (byteCnt % traits::bytes == 0) {
             for (std::size_t i = traits::chars; i > 0; i--)
-                os << traits::type::array.at((value >> (traits::bits * (i - 1))) & traits::mask);
+                *out++ = traits::type::array.at((value >> (traits::bits * (i - 1))) & traits::mask);
 
             value = 0;
         }
     }
 
-    auto remainder = (byteCnt % traits::bytes == 0 ? 0 : traits::bytes - (byteCnt % traits::bytes));
+    const std::size_t remainder = byteCnt % traits::bytes;
     if (remainder) {
-        value <<= (8 * remainder);
-        for (std::size_t i = traits::chars; i > remainder; i--)
-            os << traits::type::array.at((value >> (traits::bits * (i - 1))) & traits::mask);
+        value <<= (TMX_BITS_PER_BYTE * (traits::bytes - remainder));
+
+        // Only write the characters that hold some of the remaining bits
+        const std::size_t used = (remainder * TMX_BITS_PER_BYTE + traits::bits - 1) / traits::bits;
+        for (std::size_t i = traits::chars; i > traits::chars - used; i--)
+            *out++ = traits::type::array.at((value >> (traits::bits * (i - 1))) & traits::mask);
 
         // Add the padding
-        for (std::size_t i = 0; i < remainder; i++)
-            os << traits::padding;
+        for (std::size_t i = used; i < traits::chars; i++)
+            *out++ = traits::padding;
     }
 
+    return out;
+}
+
+template <typename _CharT, typename _Iter, typename _IterTraits = std::iterator_traits<_Iter>, _CharT ... _Map>
+std::enable_if_t<std::is_same_v<typename _IterTraits::value_type, byte_t>, std::basic_ostream<_CharT> &>
+byte_string_encode(std::basic_ostream<_CharT> &os, _Iter iter, static_array<_CharT, _Map...> const &m) noexcept {
+    byte_string_encode_to(std::ostream_iterator<_CharT, _CharT>(os), iter, m);
     return os;
 }
 
+/*!
+ * @brief Append the encoded bytes to the end of the given string
+ *
+ * Since the characters are written in place, re-using the same string
+ * for each encoding does not require any new memory once the string
+ * capacity is large enough.
+ *
+ * @param[out] str The string to append to
+ * @param[in] bytes The bytes to encode
+ * @return The string
+ */
+template <typename _CharT, _CharT ... _Map>
+std::basic_string<_CharT> &byte_string_encode(std::basic_string<_CharT> &str, byte_sequence const &bytes,
+                                              static_array<_CharT, _Map...> const &m) noexcept {
+    typedef byte_encoder_traits< static_array<_CharT, _Map...> > traits;
+
+    str.reserve(str.length() + (bytes.length() + traits::bytes - 1) / traits::bytes * traits::chars);
+    byte_string_encode_to(std::back_inserter(str), make_byte_cursor(bytes), m);
+    return str;
+}
+
 template <typename _CharT, _CharT ... _Map>
 std::basic_ostream<_CharT> &byte_string_encode(std::basic_ostream<_CharT> &os, byte_sequence const &bytes,
                                                static_array<_CharT, _Map...> const &m) noexcept {
@@ -206,18 +249,32 @@ enable_arithmetic<_Tp, std::basic_string<_CharT> > byte_string_encode_value(_Tp
     return byte_string_encode_value(value, TMX_DEFAULT_BYTE_ENCODING);
 }
 
+/*!
+ * @brief Append the decoded bytes from the character sequence to the end of the given byte string
+ *
+ * Since the bytes are written in place, re-using the same byte string
+ * for each decoding does not require any new memory once the string
+ * capacity is large enough.
+ *
+ * @param[in] str The encoded characters
+ * @param[out] bytes The byte string to append to
+ * @return The byte string
+ */
 template <typename _CharT, _CharT ... _Map>
-std::basic_istream<_CharT> &byte_string_decode(std::basic_istream<_CharT> &is, std::basic_string<byte_t> &bytes,
-                                               static_array<_CharT, _Map...> const &) noexcept {
+std::basic_string<byte_t> &byte_string_decode(char_sequence<_CharT> const &str, std::basic_string<byte_t> &bytes,
+                                              static_array<_CharT, _Map...> const &) noexcept {
     typedef byte_encoder_traits< static_array<_CharT, _Map...> > traits;
 
-    std::basic_string<_CharT> str(std::istreambuf_iterator<_CharT>(is), { });
+    bytes.reserve(bytes.length() + str.length() / traits::chars * traits::bytes);
 
     std::uint64_t value = 0;
     std::size_t charCnt = 0;
+    std::size_t padCnt = 0;
     for (auto iter = str.begin(); iter != str.end(); iter++) {
         value <<= traits::bits;
-        if (*iter != traits::padding) {
+        if (*iter == traits::padding) {
+            padCnt++;
+        } else {
             // Special case for HEX, in that the characters can be upper or lowercase
             if (traits::base == 16)
                 value |= (unsigned char)(traits::decode(std::toupper(*iter)));
@@ -229,16 +286,29 @@ std::basic_istream<_CharT> &byte_string_decode(std::basic_istream<_CharT> &is, s
         charCnt++;
 
         if (charCnt % traits::chars == 0) {
+            // The padding characters do not hold any of the bytes
+            const std::size_t keep = (traits::chars - padCnt) * traits::bits / TMX_BITS_PER_BYTE;
+
             std::size_t i = 0;
             for (const auto &byte: make_byte_cursor(value)) {
                 if (i++ < sizeof(value) - traits::bytes) continue;
+                if (i > sizeof(value) - traits::bytes + keep) break;
                 bytes.push_back((byte_t) byte);
             }
 
             value = 0;
+            padCnt = 0;
         }
     }
 
+    return bytes;
+}
+
+template <typename _CharT, _CharT ... _Map>
+std::basic_istream<_CharT> &byte_string_decode(std::basic_istream<_CharT> &is, std::basic_string<byte_t> &bytes,
+                                               static_array<_CharT, _Map...> const &m) noexcept {
+    std::basic_string<_CharT> str(std::istreambuf_iterator<_CharT>(is), { });
+    byte_string_decode(char_sequence<_CharT> { str.data(), str.length() }, bytes, m);
     return is;
 }
 
@@ -250,8 +320,7 @@ std::basic_istream<_CharT> &byte_string_decode(std::basic_istream<_CharT> &is, s
 template <typename _CharT, _CharT ... _Map>
 auto byte_string_decode(char_sequence<_CharT> const &str, static_array<_CharT, _Map...> const &m) noexcept {
     std::basic_string<byte_t> bytes;
-    std::basic_istringstream<_CharT> ss(str.data());
-    byte_string_decode(ss, bytes, m);
+    byte_string_decode(str, bytes, m);
     return bytes;
 }
 
@@ -172,6 +172,25 @@ BOOST_AUTO_TEST_CASE ( tmxtest_byte_encoding_base32 ) {
     BOOST_CHECK_EQUAL((const char *)decoded.c_str(), phrase);
 }
 
+BOOST_AUTO_TEST_CASE ( tmxtest_byte_encoding_padding ) {
+    // The test vectors from RFC 4648, where the padding must not decode to any bytes
+    const std::string phrases[] = { "f", "fo", "foo", "foob", "fooba", "foobar" };
+    const std::string base32[] = { "MY======", "MZXQ====", "MZXW6===", "MZXW6YQ=", "MZXW6YTB", "MZXW6YTBOI======" };
+    const std::string base64[] = { "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy" };
+
+    for (std::size_t i = 0; i < 6; i++) {
+        auto bytes = to_byte_sequence(phrases[i].c_str());
+
+        BOOST_CHECK_EQUAL(byte_string_encode(bytes, tmx::common::base32::value), base32[i]);
+        auto decoded = byte_string_decode(base32[i], tmx::common::base32::value);
+        BOOST_CHECK_EQUAL(std::string((const char *)decoded.data(), decoded.length()), phrases[i]);
+
+        BOOST_CHECK_EQUAL(byte_string_encode(bytes, tmx::common::base64::value), base64[i]);
+        decoded = byte_string_decode(base64[i], tmx::common::base64::value);
+        BOOST_CHECK_EQUAL(std::string((const char *)decoded.data(), decoded.length()), phrases[i]);
+    }
+}
+
 BOOST_AUTO_TEST_CASE ( tmxtest_byte_encoding_base64 ) {
     const char *phrase = "The Lord is my shepherd; I shall not want.\n"
                          "He maketh me to lie down in green pastures: he leadeth me beside the still waters.\n"
@@ -19,7 +19,9 @@
 #include <tmx/common/TmxTypeDescriptor.hpp>
 #include <tmx/common/types/Any.hpp>
 
+#include <atomic>
 #include <chrono>
+#include <optional>
 #include <sstream>
 #include <string>
 
@@ -52,8 +54,9 @@ enum class TmxLogLevel : std::int8_t {
  *
  * This class is supposed to only be instantiated if the level of
  * the message is at or below the effective log level for the
- * namespace. Once destructed, the message will be passed to a
- * set of configured log writers. Therefore, this class should
+ * namespace. Once destructed, the message will be queued for
+ * a background thread, which formats the message and passes it
+ * to the set of configured log writers. Therefore, this class should
  * not be created directly, but through the use of the TLOG macro.
  *
  * While the pre-defined logging levels are generally preferred
@@ -98,7 +101,7 @@ public:
     TmxLogger(TmxLogger const &) = delete;
 
     /*!
-     * @brief Destructor invokes the writers
+     * @brief Destructor queues the message for the writers
      */
     ~TmxLogger();
 
@@ -141,22 +144,62 @@ public:
     static TmxLogLevel from_string(const char *) noexcept;
     static const_string to_string(TmxLogLevel) noexcept;
 
-    static bool can_log(TmxLogLevel, const char * = "") noexcept;
+    /*!
+     * @brief Check if the given level is enabled
+     *
+     * This is only an atomic load of the cached effective level,
+     * which is refreshed whenever the logger is enabled or disabled.
+     *
+     * @param[in] The log level to check
+     * @param[in] The namespace to check
+     * @return True if a message at that level would be written
+     */
+    static inline bool can_log(TmxLogLevel level, const char * = "") noexcept {
+        return static_cast<std::int8_t>(level) <= _enabled_level.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * @brief Check if the given level is enabled
+     *
+     * The level is the compile-time conversion of the name, if
+     * it is a known level. Otherwise, the name is searched for
+     * as a custom log level.
+     *
+     * @param[in] The log level to check, if known
+     * @param[in] The log level name to check
+     * @param[in] The namespace to check
+     * @return True if a message at that level would be written
+     */
+    static inline bool can_log(std::optional<TmxLogLevel> level, const char *name, const char *nmspace) noexcept {
+        if (level)
+            return can_log(level.value(), nmspace);
+        return can_log(name, nmspace);
+    }
+
     static bool can_log(const char * = TMX_DEFAULT_LOG_LEVEL, const char * = "") noexcept;
     static void enable(TmxLogLevel, const char * = "") noexcept;
     static void enable(const char * = TMX_DEFAULT_LOG_LEVEL, const char * = "") noexcept;
     static void disable(const char * = "") noexcept;
 
+    /*!
+     * @brief Block until all the queued log messages have been written
+     */
+    static void flush() noexcept;
+
     static void register_writer(TmxTypeDescriptor const &) noexcept;
     static void configure(types::Any const &) noexcept;
 
 private:
+    static void set_enabled_level(TmxLogLevel, const char *) noexcept;
+
+    static std::atomic<std::int8_t> _enabled_level;
+
     std::basic_ostringstream<char_t> _stream;
 
     std::chrono::system_clock::time_point const _time;
-    std::string const _level;
-    std::string const _nmspace;
-    std::string const _file;
+    std::string _level;
+    std::string _nmspace;
+    std::string _file;
     std::uint64_t const _line;
 };
 
@@ -166,9 +209,10 @@ private:
 #define TLOG(level)
 #else
 #define TMX_LOGGER(level) tmx::common::TmxLogger(level, TMX_PRETTY_FUNCTION, __FILE__, __LINE__).stream()
-#define TLOG(level)                                                     \
-    if (tmx::common::TmxLogger::can_log(#level, TMX_PRETTY_FUNCTION))   \
-        TMX_LOGGER(#level)
+#define TLOG(level)                                                                                     \
+    if (constexpr auto _tmx_log_level = tmx::common::enums::enum_cast<tmx::common::TmxLogLevel>(#level, true);  \
+        !tmx::common::TmxLogger::can_log(_tmx_log_level, #level, TMX_PRETTY_FUNCTION)) ;                       \
+    else TMX_LOGGER(#level)
 #endif
 
 // Backwards compatible alias for TMX plugins
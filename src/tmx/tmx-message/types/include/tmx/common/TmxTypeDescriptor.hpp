@@ -44,6 +44,19 @@ public:
 	TmxTypeDescriptor(std::shared_ptr<const void> instance,
 			const std::type_info &id, std::string name) noexcept;
 
+	/*!
+	 * @brief Construct a new descriptor that shares an existing path
+	 *
+	 * This avoids copying the name, which is useful for the type
+	 * registry since it already holds the fully-qualified path.
+	 *
+	 * @param[in] instance The type instance
+	 * @param[in] id The type identifier
+	 * @param[in] path The fully-qualified type path
+	 */
+	TmxTypeDescriptor(std::shared_ptr<const void> instance,
+			const std::type_info &id, std::shared_ptr<const filesystem::path> path) noexcept;
+
 	/*!
 	 * @brief Construct a new descriptor from a copy
 	 *
@@ -133,7 +146,7 @@ public:
 protected:
 	std::shared_ptr<const void> _instance;
 	const std::type_info &_id;
-	const filesystem::path _path;
+	const std::shared_ptr<const filesystem::path> _path;
 };
 
 } /* End namespace common */
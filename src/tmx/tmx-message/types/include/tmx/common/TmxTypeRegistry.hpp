@@ -88,6 +88,11 @@ static inline std::shared_ptr<const _Tp> get_singleton(_Tp const &) noexcept {
 	return get_singleton<_Tp>();
 }
 
+/*!
+ * @brief The interned storage for a single registry namespace
+ */
+struct TmxTypeNamespace;
+
 /*!
  * @brief A searchable container for type information
  *
@@ -118,6 +123,11 @@ static inline std::shared_ptr<const _Tp> get_singleton(_Tp const &) noexcept {
  * member function. Types may be retrieved by the name given, or the
  * type_info structure for the actual C++ type.
  *
+ * Each namespace is interned once, so a registry object just points
+ * to the hashed storage for its namespace. Look-ups never lock, and
+ * can run concurrently with any registrations, which are serialized
+ * and published atomically to the readers.
+ *
  * @see #std::type_info
  * @see #typeid()
  */
@@ -259,7 +269,8 @@ public:
 	 *
 	 * Note that this only really removes the name from the
 	 * namespace, since the type may be registered in other
-	 * namespaces as well.
+	 * namespaces as well. Once the type has no names left,
+	 * the registered instance is released.
 	 *
 	 * @param[in] id The type identifier to unregister
 	 */
@@ -270,7 +281,8 @@ public:
 	 *
 	 * Note that this only really removes the name from the
 	 * namespace, since the type may be registered in other
-	 * namespaces as well.
+	 * namespaces as well. Once the type has no names left,
+	 * the registered instance is released.
 	 *
 	 * @param[in] id The type name to unregister
 	 */
@@ -281,6 +293,16 @@ public:
 	 */
 	const_string get_namespace() const noexcept;
 
+	/*!
+	 * @brief Get the number of hash slots used for the names in this namespace
+	 *
+	 * This depends only on the number of names currently registered, so it
+	 * is mainly useful for checking that removed names are reclaimed.
+	 *
+	 * @return The capacity of the namespace
+	 */
+	std::size_t capacity() const noexcept;
+
 	/*!
 	 * @brief Get the type descriptor for the given id
 	 *
@@ -360,9 +382,10 @@ public:
 	 * every type registered in "org.example", "org.example.helpers",
 	 * "org.example.handlers", etc.
 	 *
-	 * Note that because of this filtering, this operation is
-	 * much slower performing that the standard get()
-	 * operations, and should be used only sparingly.
+	 * Note that because this must visit each namespace in
+	 * the hierarchy, this operation is much slower performing
+	 * that the standard get() operations, and should be used
+	 * only sparingly.
 	 *
 	 * @see #get()
 	 * @return An array of types found for this namespace
@@ -383,9 +406,9 @@ public:
 
 private:
 	/*!
-	 * @brief The namespace for this registry
+	 * @brief The interned namespace for this registry
 	 */
-	 string nmspace;
+	TmxTypeNamespace const *_ns = nullptr;
 };
 
 } /* namespace common */
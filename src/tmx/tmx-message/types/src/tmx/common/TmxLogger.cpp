@@ -17,68 +17,86 @@
 #include <tmx/common/TmxTypeRegistrar.hpp>
 #include <tmx/common/TmxTypeRegistry.hpp>
 
+#include <condition_variable>
 #include <cstring>
 #include <ctime>
 #include <fstream>
 #include <iostream>
 #include <iomanip>
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <type_traits>
 
 #define TMX_LOGGER_MAX_FILE_NAME 32
 
+#ifndef TMX_LOGGER_QUEUE_SIZE
+#define TMX_LOGGER_QUEUE_SIZE 1024
+#endif
+
 namespace tmx {
 namespace common {
 
-template <typename _CharT, typename _TimePoint>
-std::basic_ostream<_CharT> &_logtime(std::basic_ostream<_CharT> &os, _TimePoint tp)
-{
+/*!
+ * @brief Append the time stamp for the log message
+ *
+ * The local time conversion is cached for the current second,
+ * which is shared by most of the messages in a burst.
+ */
+template <typename _TimePoint>
+void _logtime(std::string &os, _TimePoint tp) {
+    static thread_local std::time_t lastSec = -1;
+    static thread_local char tmBuffer[20];
+
     auto sec = std::chrono::time_point_cast<std::chrono::seconds>(tp);
     if (sec > tp)
         sec = sec - std::chrono::seconds(1);
 
-    struct timeval tv;
-    tv.tv_sec = sec.time_since_epoch().count();
-    tv.tv_usec = std::chrono::duration_cast<std::chrono::microseconds>(tp - sec).count();
-
-    time_t time = tv.tv_sec;
-    struct tm *myTm = localtime(&time);
-    char tmBuffer[20];
-    strftime(tmBuffer, 20, "%F %T", myTm);
+    std::time_t time = sec.time_since_epoch().count();
+    if (time != lastSec) {
+        struct tm myTm;
+        localtime_r(&time, &myTm);
+        strftime(tmBuffer, sizeof(tmBuffer), "%F %T", &myTm);
+        lastSec = time;
+    }
 
-    os << "[" << tmBuffer << "." << std::setfill('0') << std::setw(3) << (tv.tv_usec / 1000) << "] " << std::setfill(' ');
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(tp - sec).count();
+    char msBuffer[5] = { '.', (char)('0' + (ms / 100) % 10), (char)('0' + (ms / 10) % 10), (char)('0' + ms % 10), '\0' };
 
-    return os;
+    os.append("[").append(tmBuffer).append(msBuffer).append("] ");
 }
 
-template <typename _CharT>
-std::basic_ostream<_CharT> &_logsource(std::basic_ostream<_CharT> &os, std::string file, std::uint64_t line)
-{
-    static constexpr int fileMaxLen = TMX_LOGGER_MAX_FILE_NAME;
+void _logsource(std::string &os, std::string const &file, std::uint64_t line) {
+    static constexpr std::size_t fileMaxLen = TMX_LOGGER_MAX_FILE_NAME;
 
-    if (line > 0)
-    {
-        file.append(" (");
-        file.append(std::to_string(line));
-        file.append(")");
+    std::string src { file };
+    if (line > 0) {
+        src.append(" (");
+        src.append(std::to_string(line));
+        src.append(")");
     }
 
-    if (file.length() > fileMaxLen)
-        os << std::right << std::setw(fileMaxLen) << file.substr(file.size() - fileMaxLen);
+    if (src.length() > fileMaxLen)
+        os.append(src, src.length() - fileMaxLen, fileMaxLen);
     else
-        os << std::right << std::setw(fileMaxLen) << file;
-
-    return os;
+        os.append(fileMaxLen - src.length(), ' ').append(src);
 }
 
-template <typename _CharT>
-std::basic_ostream<_CharT> &_loglevel(std::basic_ostream<_CharT> &os, const char *level)
-{
-    os << " - " << std::left << std::setw(7) << level << ": ";
-    return os;
+void _loglevel(std::string &os, std::string const &level) {
+    static constexpr std::size_t levelMinLen = 7;
+
+    os.append(" - ").append(level);
+    if (level.length() < levelMinLen)
+        os.append(levelMinLen - level.length(), ' ');
+    os.append(": ");
 }
 
-static TmxTypeRegistry _logger_reg { "tmx.common.logging" };
+// Other static initializers may log, so the registry is created on first use
+static TmxTypeRegistry &get_logger_registry() {
+    static TmxTypeRegistry _reg { "tmx.common.logging" };
+    return _reg;
+}
 
 std::string _strip_fn(const_string nmspace) {
     auto pIdx = nmspace.find_first_of('(');
@@ -94,11 +112,7 @@ std::string _strip_fn(const_string nmspace) {
 
 TmxLogger::TmxLogger(const char *level, const char *nmspace, const char *file, std::uint64_t line) noexcept:
         _time(std::chrono::system_clock::now()), _level(level),
-         _nmspace(_strip_fn(nmspace)), _file(file), _line(line) {
-    _logtime(this->_stream, this->get_time());
-    _logsource(this->_stream, this->get_file().data(), this->get_line());
-    _loglevel(this->_stream, this->get_level().data());
-}
+         _nmspace(_strip_fn(nmspace)), _file(file), _line(line) { }
 
 TmxLogger::TmxLogger(TmxLogLevel level, const char *nmspace, const char *file, std::uint64_t line) noexcept:
          TmxLogger(TmxLogger::to_string(level).data(), nmspace, file, line) { }
@@ -164,7 +178,7 @@ void do_enable(TmxLogLevel level, TmxTypeRegistry const &reg) {
 
 void init_namespace(TmxTypeRegistry const &reg) noexcept {
     // Traverse up the tree first. So, if this is the terminal case, just initialize
-    if (reg.get_namespace() == _logger_reg.get_namespace()) {
+    if (reg.get_namespace() == get_logger_registry().get_namespace()) {
         do_enable(_log_off, reg);
         return;
     }
@@ -180,9 +194,16 @@ void init_namespace(TmxTypeRegistry const &reg) noexcept {
     }
 }
 
+std::atomic<std::int8_t> TmxLogger::_enabled_level { static_cast<std::int8_t>(TmxLogLevel::OFF) };
+
 bool TmxLogger::can_log(const char *level, const char *nmspace) noexcept {
-//    auto reg = (_logger_reg / _strip_fn({ nmspace }) / _log_level);
-    auto reg = _logger_reg / _log_level;
+    // The known levels only need to check the cached value
+    auto lvl = enums::enum_cast<TmxLogLevel>(level);
+    if (lvl)
+        return TmxLogger::can_log(lvl.value(), nmspace);
+
+//    auto reg = (get_logger_registry() / _strip_fn({ nmspace }) / _log_level);
+    auto reg = get_logger_registry() / _log_level;
 
     // If this namespace has not been initialized, then do so
     if (!reg.get(_log_off))
@@ -192,41 +213,48 @@ bool TmxLogger::can_log(const char *level, const char *nmspace) noexcept {
     return reg.get(level);
 }
 
-bool TmxLogger::can_log(TmxLogLevel level, const char *nmspace) noexcept {
-    return TmxLogger::can_log(TmxLogger::to_string(level).data(), nmspace);
+void TmxLogger::set_enabled_level(TmxLogLevel level, const char *nmspace) noexcept {
+    // Only the root logger is currently checked
+    if (_strip_fn({ nmspace }).empty())
+        _enabled_level.store(static_cast<std::int8_t>(level), std::memory_order_relaxed);
 }
 
 void TmxLogger::enable(const char *level, const char *nmspace) noexcept {
     TmxLogger::disable(nmspace);
 
-    auto reg = _logger_reg / _strip_fn({ nmspace });
-    if (enums::enum_contains<TmxLogLevel>(level))
+    auto reg = get_logger_registry() / _strip_fn({ nmspace });
+    if (enums::enum_contains<TmxLogLevel>(level)) {
         do_enable(TmxLogger::from_string(level), reg);
-    else
+        set_enabled_level(TmxLogger::from_string(level), nmspace);
+    } else {
         do_enable(level, reg);
+    }
 
-    TLOG(NOTICE) << (reg.get_parent().get_namespace() == _logger_reg.get_namespace() ? "Root" : nmspace)
+    TLOG(NOTICE) << (reg.get_parent().get_namespace() == get_logger_registry().get_namespace() ? "Root" : nmspace)
                  << " logger enabled at level " << level;
 }
 
 void TmxLogger::enable(TmxLogLevel level, const char *nmspace) noexcept {
     TmxLogger::disable(nmspace);
 
-    auto reg = _logger_reg / _strip_fn({ nmspace });
+    auto reg = get_logger_registry() / _strip_fn({ nmspace });
     do_enable(level, reg);
+    set_enabled_level(level, nmspace);
 
-    TLOG(NOTICE) << (reg.get_parent().get_namespace() == _logger_reg.get_namespace() ? "Root" : nmspace)
+    TLOG(NOTICE) << (reg.get_parent().get_namespace() == get_logger_registry().get_namespace() ? "Root" : nmspace)
                  << " logger enabled at level " << TmxLogger::to_string(level);
 }
 
 void TmxLogger::disable(const char *nmspace) noexcept {
-    TmxTypeRegistry reg = _logger_reg / _strip_fn({ nmspace }) / "log-level";
+    set_enabled_level(TmxLogLevel::OFF, nmspace);
+
+    TmxTypeRegistry reg = get_logger_registry() / _strip_fn({ nmspace }) / _log_level;
     for (auto &d: reg.get_all())
         reg.unregister(d.get_type_short_name());
 }
 
 void TmxLogger::register_writer(TmxTypeDescriptor const &descriptor) noexcept {
-    (_logger_reg / "writers" / descriptor.get_type_short_name()).register_type(descriptor.get_instance(),
+    (get_logger_registry() / "writers" / descriptor.get_type_short_name()).register_type(descriptor.get_instance(),
                                                                                descriptor.get_typeid(),
                                                                                "|instance|");
 }
@@ -238,7 +266,7 @@ public:
     typedef TmxLogger::level_t level_t;
     typedef TmxLogger::message_t message_t;
 
-    TmxFileLogWriter(): _registry(_logger_reg / "writers" / type_short_name<self_type>().data()) {
+    TmxFileLogWriter(): _registry(get_logger_registry() / "writers" / type_short_name<self_type>().data()) {
         std::shared_ptr<TmxFileLogWriter> _ptr { this, [](auto *) { } };
 
         TmxLogger::register_writer({ _ptr, typeid(self_type), type_short_name<self_type>().data() });
@@ -251,12 +279,7 @@ public:
         while (_reg.get_namespace().length() >= _registry.get_namespace().length()) {
             bool done = false;
             for (auto &d: (_reg / "log-file").get_all()) {
-                if (d.get_type_short_name() == "-")
-                    std::cout << msg << std::endl;
-                else {
-                    std::ofstream os { d.get_type_short_name(), std::ios_base::app };
-                    os << msg << std::endl;
-                }
+                this->get_stream(d.get_type_short_name()) << msg << '\n';
                 done = true;
             }
 
@@ -267,28 +290,273 @@ public:
         return { };
     }
 
+    /*!
+     * @brief Flush all the open log streams
+     */
+    void flush() const {
+        std::cout.flush();
+        for (auto &f: this->_files)
+            f.second.flush();
+    }
+
     TmxTypeRegistry _registry;
+
+private:
+    // Each log file is opened only once, and kept open for the life of the writer
+    std::ostream &get_stream(const_string name) const {
+        if (name == "-")
+            return std::cout;
+
+        auto iter = this->_files.find(std::string(name));
+        if (iter == this->_files.end())
+            iter = this->_files.emplace(std::string(name), std::ofstream { std::string(name), std::ios_base::app }).first;
+
+        return iter->second;
+    }
+
+    mutable std::map<std::string, std::ofstream> _files;
 };
 
 static TmxFileLogWriter _writer;
 
-class TmxLogExector: public TmxTaskExecutor {
-    // By default, this is just to be a deferred call
-    future<TmxError> exec_async(Functor<TmxError> &&function) noexcept override {
-        return std::async(std::launch::deferred, function).share();
+/*!
+ * @brief The unformatted contents of a log message
+ */
+struct TmxLogRecord {
+    std::chrono::system_clock::time_point time;
+    std::string level;
+    std::string nmspace;
+    std::string file;
+    std::uint64_t line = 0;
+    std::string message;
+};
+
+/*!
+ * @brief A bounded, lock-free queue of log records
+ *
+ * Any number of threads may push records, but only the single
+ * log writer thread may pop them. Each cell holds a sequence
+ * number that tells the producers and consumer whose turn it is.
+ */
+template <std::size_t _Sz>
+class TmxLogQueue {
+    static_assert(_Sz > 1 && (_Sz & (_Sz - 1)) == 0, "Log queue size must be a power of 2");
+
+    struct alignas(64) cell {
+        std::atomic<std::size_t> seq;
+        TmxLogRecord record;
+    };
+
+public:
+    TmxLogQueue(): _cells(new cell[_Sz]) {
+        for (std::size_t i = 0; i < _Sz; i++)
+            _cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    bool try_push(TmxLogRecord &record) noexcept {
+        auto pos = _tail.load(std::memory_order_relaxed);
+        cell *c;
+
+        while (true) {
+            c = &_cells[pos & (_Sz - 1)];
+            auto seq = c->seq.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+            if (diff == 0) {
+                if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                // Full
+                return false;
+            } else {
+                pos = _tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        c->record = std::move(record);
+        c->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(TmxLogRecord &record) noexcept {
+        cell &c = _cells[_head & (_Sz - 1)];
+        if (c.seq.load(std::memory_order_acquire) != _head + 1)
+            return false;
+
+        record = std::move(c.record);
+        c.seq.store(_head + _Sz, std::memory_order_release);
+        _head++;
+        return true;
+    }
+
+    bool empty() const noexcept {
+        return _cells[_head & (_Sz - 1)].seq.load(std::memory_order_acquire) != _head + 1;
     }
+
+private:
+    std::unique_ptr<cell[]> _cells;
+    alignas(64) std::atomic<std::size_t> _tail { 0 };
+    alignas(64) std::size_t _head { 0 };
 };
 
-TmxLogger::~TmxLogger() {
-    const TmxLogger *ptr = this;
+void _write_record(TmxLogRecord &record) {
+    std::string msg;
+    msg.reserve(64 + record.message.length());
 
-    // Get an executor for the log
-    static TmxLogExector exec;
+    _logtime(msg, record.time);
+    _logsource(msg, record.file, record.line);
+    _loglevel(msg, record.level);
+    msg.append(record.message);
 
     // Send this log message to each registered writer
-    for (const auto &w: (_logger_reg / "writers").get_all()) {
+    for (const auto &w: (get_logger_registry() / "writers").get_all()) {
         if (w.get_type_short_name() == "|instance|")
-            common::dispatch(w, std::string(ptr->get_namespace()), std::string(ptr->get_level()), ptr->str());
+            common::dispatch(w, std::string(record.nmspace), std::string(record.level), std::string(msg));
+    }
+}
+
+/*!
+ * @brief The background thread that formats and writes the log records
+ *
+ * The logging threads only ever move the record into the queue. The
+ * condition variable is only used to wake the writer after it has
+ * found the queue to be empty.
+ */
+class TmxAsyncLogWriter {
+public:
+    TmxAsyncLogWriter(): _thread(&TmxAsyncLogWriter::run, this) {
+        _state().store(running, std::memory_order_release);
+    }
+
+    ~TmxAsyncLogWriter() {
+        _state().store(stopped, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cv.notify_all();
+
+        if (_thread.joinable())
+            _thread.join();
+    }
+
+    void push(TmxLogRecord &record) {
+        while (!_queue.try_push(record)) {
+            // A writer that logs cannot wait on itself
+            if (std::this_thread::get_id() == _thread.get_id()) {
+                _write_record(record);
+                return;
+            }
+
+            // Wait for the writer to catch up
+            this->wake();
+            std::this_thread::yield();
+        }
+
+        this->wake();
+    }
+
+    void flush() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto target = ++_flushRequested;
+        _cv.notify_all();
+        _flushed.wait(lock, [this, target]() { return _flushCompleted >= target || _stop; });
+    }
+
+    enum state_t { idle, running, stopped };
+
+    static std::atomic<int> &_state() {
+        static std::atomic<int> _singleton { idle };
+        return _singleton;
+    }
+
+private:
+    void wake() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_waiting.load()) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _cv.notify_one();
+        }
+    }
+
+    void run() {
+        TmxLogRecord record;
+        bool stop = false;
+
+        while (!stop) {
+            std::uint64_t flushTarget;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                flushTarget = _flushRequested;
+            }
+
+            while (_queue.try_pop(record))
+                _write_record(record);
+
+            _writer.flush();
+
+            std::unique_lock<std::mutex> lock(_mutex);
+            if (_flushCompleted < flushTarget) {
+                _flushCompleted = flushTarget;
+                _flushed.notify_all();
+            }
+
+            stop = _stop;
+            _waiting.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            _cv.wait(lock, [this]() { return _stop || _flushRequested > _flushCompleted || !_queue.empty(); });
+            _waiting.store(false);
+        }
+
+        // Drain anything left at shutdown
+        while (_queue.try_pop(record))
+            _write_record(record);
+
+        _writer.flush();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _flushCompleted = _flushRequested;
+        _flushed.notify_all();
+    }
+
+    TmxLogQueue<TMX_LOGGER_QUEUE_SIZE> _queue;
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::condition_variable _flushed;
+    std::atomic<bool> _waiting { false };
+    std::uint64_t _flushRequested { 0 };
+    std::uint64_t _flushCompleted { 0 };
+    bool _stop { false };
+
+    std::thread _thread;
+};
+
+static TmxAsyncLogWriter *_async_writer() {
+    // Once the writer has been stopped, i.e. at exit, write synchronously
+    if (TmxAsyncLogWriter::_state().load(std::memory_order_acquire) == TmxAsyncLogWriter::stopped)
+        return nullptr;
+
+    static TmxAsyncLogWriter _singleton;
+    return &_singleton;
+}
+
+void TmxLogger::flush() noexcept {
+    auto writer = _async_writer();
+    if (writer)
+        writer->flush();
+}
+
+TmxLogger::~TmxLogger() {
+    TmxLogRecord record { this->_time, std::move(this->_level), std::move(this->_nmspace),
+                          std::move(this->_file), this->_line, this->_stream.str() };
+
+    auto writer = _async_writer();
+    if (writer) {
+        writer->push(record);
+    } else {
+        _write_record(record);
+        _writer.flush();
     }
 }
 
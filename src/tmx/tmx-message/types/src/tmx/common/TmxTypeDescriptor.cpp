@@ -19,7 +19,11 @@ namespace common {
 
 TmxTypeDescriptor::TmxTypeDescriptor(std::shared_ptr<const void> instance,
 					std::type_info const &id, std::string name) noexcept:
-		_instance(instance), _id(id), _path(name) { }
+		_instance(instance), _id(id), _path(std::make_shared<const filesystem::path>(name)) { }
+
+TmxTypeDescriptor::TmxTypeDescriptor(std::shared_ptr<const void> instance,
+					std::type_info const &id, std::shared_ptr<const filesystem::path> path) noexcept:
+		_instance(instance), _id(id), _path(path) { }
 
 TmxTypeDescriptor::TmxTypeDescriptor(TmxTypeDescriptor const &copy) noexcept:
 		_instance(copy._instance), _id(copy._id), _path(copy._path) { }
@@ -33,19 +37,20 @@ std::type_info const &TmxTypeDescriptor::get_typeid() const noexcept {
 }
 
 filesystem::path const &TmxTypeDescriptor::get_path() const noexcept {
-    return this->_path;
+    static const filesystem::path _empty;
+    return this->_path ? *(this->_path) : _empty;
 }
 
 std::string TmxTypeDescriptor::get_type_name() const noexcept {
-    return this->_path.string();
+    return this->get_path().string();
 }
 
 std::string TmxTypeDescriptor::get_type_short_name() const noexcept {
-    return this->_path.filename().string();
+    return this->get_path().filename().string();
 }
 
 std::string TmxTypeDescriptor::get_type_namespace() const noexcept {
-    return this->_path.parent_path().string();
+    return this->get_path().parent_path().string();
 }
 
 bool TmxTypeDescriptor::operator ==(std::type_info const &other) const noexcept {
@@ -65,7 +70,7 @@ bool TmxTypeDescriptor::operator !=(const TmxTypeDescriptor &other) const noexce
 }
 
 TmxTypeDescriptor::operator bool() const noexcept {
-	return this->_id != typeid(void) && !this->_path.empty();
+	return this->_id != typeid(void) && !this->get_path().empty();
 }
 
 } /* End namespace common */
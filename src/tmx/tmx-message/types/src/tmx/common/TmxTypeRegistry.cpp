@@ -16,61 +16,608 @@
 #include <tmx/common/types/TmxDataType.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <cctype>
 #include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <deque>
 #include <iostream>
+#include <mutex>
 #include <regex>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <typeindex>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #ifndef TMX_INIT_REGISTRY_SIZE
 #define TMX_INIT_REGISTRY_SIZE 2048
 #endif
 
+#ifndef TMX_REGISTRY_READER_STRIPES
+#define TMX_REGISTRY_READER_STRIPES 16
+#endif
+
+#ifndef TMX_REGISTRY_RECLAIM_BATCH
+#define TMX_REGISTRY_RECLAIM_BATCH 64
+#endif
+
 using namespace tmx::common::types;
 
 namespace tmx {
 namespace common {
 
 typedef std::shared_ptr<const void> type_descriptor;
-typedef TmxRegistry<TmxTypeDescriptor, std::type_index> ById;
-typedef TmxRegistry<const TmxTypeDescriptor *, TmxValueTypeOf<typename TmxTypeRegistry::string> > ByName;
 
 // Using the filesystem notation, this
 static constexpr char _namespace_sep = filesystem::path::preferred_separator;
 
-ById &byId() {
-	static ById _singleton { TMX_INIT_REGISTRY_SIZE };
+/*!
+ * @brief Tracks the readers of the registry, so that retired memory can be freed
+ *
+ * Readers never lock, so anything a writer unlinks from the registry may
+ * still be in use by a reader. The writer retires it instead, and only
+ * frees it once every reader that could have seen it has finished. This
+ * is done by flipping between two reader phases: new readers count against
+ * the current phase, so after a flip the retired memory is freed once the
+ * count of the old phase drains. The counts are spread over a few cache
+ * lines to keep the readers on different threads from contending.
+ */
+class TmxTypeReaders {
+	struct alignas(64) stripe {
+		std::atomic<std::size_t> active[2] { { 0 }, { 0 } };
+	};
+
+public:
+	/*!
+	 * @brief Marks a read of the registry, which must not lock or write to the registry
+	 */
+	class guard {
+	public:
+		guard() noexcept;
+		~guard() { this->_active->fetch_sub(1, std::memory_order_release); }
+
+		guard(guard const &) = delete;
+		guard &operator=(guard const &) = delete;
+
+	private:
+		std::atomic<std::size_t> *_active;
+	};
+
+	/*!
+	 * @return The count of readers that this read was added to
+	 */
+	std::atomic<std::size_t> *enter() noexcept {
+		// Any per-thread address spreads the threads over the stripes
+		static thread_local char _tag;
+		auto &_stripe = this->_stripes[(reinterpret_cast<std::uintptr_t>(&_tag) >> 6) % TMX_REGISTRY_READER_STRIPES];
+		while (true) {
+			const auto _phase = this->_phase.load(std::memory_order_seq_cst);
+			auto &_active = _stripe.active[_phase & 1];
+			_active.fetch_add(1, std::memory_order_seq_cst);
+
+			// If the phase flipped in the mean time, the writer may not be waiting on this count
+			if (this->_phase.load(std::memory_order_seq_cst) == _phase)
+				return &_active;
+
+			_active.fetch_sub(1, std::memory_order_release);
+		}
+	}
+
+	/*!
+	 * @brief Retire memory that was just unlinked from the registry
+	 *
+	 * This must only be called while holding the registry lock.
+	 */
+	void retire(std::shared_ptr<void> &&garbage) {
+		this->_retired.push_back(std::move(garbage));
+	}
+
+	/*!
+	 * @brief Free everything retired that the readers can no longer see
+	 *
+	 * Only one flip is outstanding at a time. Anything retired before the
+	 * flip waits on the readers from the old phase, which are usually
+	 * already done. The writer only blocks on them once too much is waiting.
+	 *
+	 * This must only be called while holding the registry lock, and never
+	 * from inside a read.
+	 */
+	void reclaim() noexcept {
+		const bool _full = this->_waiting.size() + this->_retired.size() >= TMX_REGISTRY_RECLAIM_BATCH;
+
+		if (!this->_waiting.empty()) {
+			if (!this->drained(_full))
+				return;
+
+			this->_waiting.clear();
+		}
+
+		if (this->_retired.empty())
+			return;
+
+		std::swap(this->_waiting, this->_retired);
+		this->_phase.fetch_add(1, std::memory_order_seq_cst);
+
+		if (this->drained(_full))
+			this->_waiting.clear();
+	}
+
+private:
+	// Check if the readers from before the last flip are done, optionally waiting for them
+	bool drained(bool wait) const noexcept {
+		const auto _old = (this->_phase.load(std::memory_order_relaxed) - 1) & 1;
+		for (auto &_stripe: this->_stripes) {
+			while (_stripe.active[_old].load(std::memory_order_seq_cst)) {
+				if (!wait)
+					return false;
+
+				std::this_thread::yield();
+			}
+		}
+
+		return true;
+	}
+
+	std::atomic<std::uint64_t> _phase { 0 };
+	stripe _stripes[TMX_REGISTRY_READER_STRIPES];
+	std::vector< std::shared_ptr<void> > _waiting;
+	std::vector< std::shared_ptr<void> > _retired;
+};
+
+static TmxTypeReaders &readers() {
+	static TmxTypeReaders _singleton;
 	return _singleton;
 }
 
-ByName &byName() {
-	// Expect at least one alias per type
-	static ByName _singleton { 2 * TMX_INIT_REGISTRY_SIZE };
+TmxTypeReaders::guard::guard() noexcept: _active(readers().enter()) { }
+
+/*!
+ * @brief A hash table that never locks for reading
+ *
+ * Entries are only ever added, or replaced with a tombstone, by a writer
+ * that holds the registry lock. Each slot is atomic, so a reader sees
+ * either nothing or a fully constructed entry. When the table gets too
+ * full, a copy without the tombstones is published atomically. Readers
+ * may still be probing the old slots, so those are retired instead of
+ * freed.
+ */
+template <typename _Entry>
+class TmxTypeTable {
+	typedef std::atomic<_Entry *> slot_type;
+
+	struct slots {
+		explicit slots(std::size_t sz): mask(sz - 1), slot(new slot_type[sz]) {
+			for (std::size_t i = 0; i < sz; i++)
+				slot[i].store(nullptr, std::memory_order_relaxed);
+		}
+
+		const std::size_t mask;
+		std::unique_ptr<slot_type[]> slot;
+	};
+
+public:
+	/*!
+	 * @param[in] The initial number of entries, which is rounded up to a power of 2
+	 */
+	explicit TmxTypeTable(std::size_t sz = 8) {
+		std::size_t _sz = 16;
+		while (_sz < 2 * sz)
+			_sz <<= 1;
+
+		this->_min = _sz;
+		this->_owned.reset(new slots(_sz));
+		this->_current.store(this->_owned.get(), std::memory_order_release);
+	}
+
+	/*!
+	 * @return The number of slots in the table
+	 */
+	std::size_t capacity() const noexcept {
+		return this->_current.load(std::memory_order_acquire)->mask + 1;
+	}
+
+	/*!
+	 * @brief Find the entry with the given hash that matches
+	 *
+	 * @param[in] hash The hash of the entry
+	 * @param[in] eq A predicate that returns true for a matching entry
+	 * @return The matching entry, or null if none exists
+	 */
+	template <typename _Eq>
+	_Entry *find(std::size_t hash, _Eq &&eq) const noexcept {
+		auto _slots = this->_current.load(std::memory_order_acquire);
+		for (std::size_t i = hash & _slots->mask; ; i = (i + 1) & _slots->mask) {
+			auto _entry = _slots->slot[i].load(std::memory_order_acquire);
+			if (!_entry)
+				return nullptr;
+
+			if (_entry != tombstone() && _entry->hash == hash && eq(*_entry))
+				return _entry;
+		}
+	}
+
+	/*!
+	 * @brief Visit every live entry
+	 */
+	template <typename _Fn>
+	void for_each(_Fn &&fn) const {
+		auto _slots = this->_current.load(std::memory_order_acquire);
+		for (std::size_t i = 0; i <= _slots->mask; i++) {
+			auto _entry = _slots->slot[i].load(std::memory_order_acquire);
+			if (_entry && _entry != tombstone())
+				fn(*_entry);
+		}
+	}
+
+	/*!
+	 * @brief Add the entry, which must not already exist
+	 *
+	 * This must only be called while holding the registry lock.
+	 */
+	void insert(_Entry *entry) {
+		// Keep the table at most half full, including the tombstones
+		if (2 * (this->_used + 1) > this->capacity())
+			this->rebuild(this->_live + 1);
+
+		// Re-use the first tombstone on the way, so that the same name coming and going
+		// does not keep adding to the probe length. Any reader still probing past that
+		// slot continues on as before, since the slot never becomes empty.
+		auto _slots = this->_current.load(std::memory_order_relaxed);
+		std::size_t i = entry->hash & _slots->mask;
+		for (auto _entry = _slots->slot[i].load(std::memory_order_relaxed);
+				_entry && _entry != tombstone(); _entry = _slots->slot[i].load(std::memory_order_relaxed))
+			i = (i + 1) & _slots->mask;
+
+		if (!_slots->slot[i].load(std::memory_order_relaxed))
+			this->_used++;
+
+		_slots->slot[i].store(entry, std::memory_order_release);
+		this->_live++;
+	}
+
+	/*!
+	 * @brief Remove the entry
+	 *
+	 * This must only be called while holding the registry lock.
+	 */
+	void erase(_Entry *entry) noexcept {
+		auto _slots = this->_current.load(std::memory_order_relaxed);
+		for (std::size_t i = entry->hash & _slots->mask; ; i = (i + 1) & _slots->mask) {
+			auto _entry = _slots->slot[i].load(std::memory_order_relaxed);
+			if (!_entry)
+				return;
+
+			if (_entry == entry) {
+				_slots->slot[i].store(tombstone(), std::memory_order_release);
+				this->_live--;
+				break;
+			}
+		}
+
+		// Shrink the table once most of the entries are gone
+		if (_slots->mask + 1 > this->_min && 8 * this->_live < _slots->mask + 1) {
+			try {
+				this->rebuild(this->_live);
+			} catch (...) {
+				// The table still works at its current size
+			}
+		}
+	}
+
+private:
+	static _Entry *tombstone() noexcept {
+		static std::max_align_t _tombstone;
+		return reinterpret_cast<_Entry *>(&_tombstone);
+	}
+
+	// Publish a copy without the tombstones, sized only by the live entries
+	void rebuild(std::size_t live) {
+		std::size_t _sz = this->_min;
+		while (4 * (live + 1) > _sz)
+			_sz <<= 1;
+
+		std::unique_ptr<slots> _rebuilt { new slots(_sz) };
+		this->_used = 0;
+		this->for_each([this, &_rebuilt](_Entry &e) { this->put(_rebuilt.get(), &e); });
+
+		this->_current.store(_rebuilt.get(), std::memory_order_release);
+		std::swap(this->_owned, _rebuilt);
+		readers().retire(std::move(_rebuilt));
+	}
+
+	void put(slots *_slots, _Entry *entry) noexcept {
+		std::size_t i = entry->hash & _slots->mask;
+		while (_slots->slot[i].load(std::memory_order_relaxed))
+			i = (i + 1) & _slots->mask;
+
+		_slots->slot[i].store(entry, std::memory_order_release);
+		this->_used++;
+	}
+
+	std::atomic<slots *> _current;
+	std::unique_ptr<slots> _owned;
+	std::size_t _min = 0;
+	std::size_t _used = 0;
+	std::size_t _live = 0;
+};
+
+/*!
+ * @brief The original registration of a C++ type
+ */
+struct TmxTypeId {
+	TmxTypeId(TmxTypeDescriptor const &descr, std::size_t h, const_string nm):
+		descriptor(descr), hash(h), name(nm) { }
+
+	const TmxTypeDescriptor descriptor;
+	const std::size_t hash;
+
+	// The non-qualified name, which is backed by the descriptor path
+	const_string name;
+	std::size_t nameHash = 0;
+
+	// The number of names for this type, which is only used by the writers
+	std::size_t refs = 0;
+};
+
+/*!
+ * @brief A type name, or alias, inside of a namespace
+ */
+struct TmxTypeName {
+	const std::shared_ptr<const filesystem::path> path;
+	const std::size_t hash;
+
+	// The non-qualified name, which is backed by the path
+	const_string name;
+	TmxTypeId * const id;
+};
+
+struct TmxTypeNamespace {
+	TmxTypeNamespace(std::string &&p, std::size_t h, TmxTypeNamespace *parent):
+		path(std::move(p)), hash(h), parent(parent) { }
+
+	const std::string path;
+	const std::size_t hash;
+	TmxTypeNamespace * const parent;
+
+	// The sub-namespaces, as a linked list that is only ever added to at the front
+	std::atomic<TmxTypeNamespace *> children { nullptr };
+	TmxTypeNamespace *sibling = nullptr;
+
+	mutable TmxTypeTable<TmxTypeName> names;
+};
+
+/*!
+ * @brief All the registered types
+ *
+ * The registered paths are shared by every type descriptor that is
+ * returned from the registry, so those stay valid even after the type
+ * is removed. The namespaces are never freed until the program exits.
+ * The names, and any type that no longer has a name, are retired when
+ * they are removed.
+ */
+struct TmxTypeStore {
+	TmxTypeStore();
+
+	// Held only by the writers
+	std::mutex lock;
+
+	TmxTypeTable<TmxTypeId> byId;
+	TmxTypeTable<TmxTypeNamespace> byNamespace;
+
+	std::unordered_map<TmxTypeId const *, std::unique_ptr<TmxTypeId> > ids;
+	std::unordered_map<TmxTypeName const *, std::unique_ptr<TmxTypeName> > names;
+	std::deque<TmxTypeNamespace> namespaces;
+
+	// Always present, and never removed
+	TmxTypeNamespace *root;
+};
+
+static TmxTypeStore &store() {
+	static TmxTypeStore _singleton;
 	return _singleton;
 }
 
-TmxTypeRegistry::TmxTypeRegistry(typename TmxTypeRegistry::string const &_ns) noexcept {
-    static typename TmxTypeRegistry::string _repl { _namespace_sep };
-    static constexpr auto _delims = static_array<char, '.', ':', '/', '\\'>::c_str();
+/*!
+ * @brief Holds the registry lock, and frees anything retired before releasing it
+ */
+struct TmxTypeWriter {
+	TmxTypeWriter(): _lock(store().lock) { }
+	~TmxTypeWriter() { readers().reclaim(); }
+
+private:
+	std::lock_guard<std::mutex> _lock;
+};
+
+// A simple FNV-1a hash, which can be computed a character at a time
+static constexpr std::uint64_t _hash_init = 14695981039346656037ULL;
+
+static inline constexpr std::uint64_t _hash_next(std::uint64_t h, char c) noexcept {
+	return (h ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+}
+
+static std::size_t _hash(const_string str) noexcept {
+	std::uint64_t h = _hash_init;
+	for (auto c: str)
+		h = _hash_next(h, c);
+
+	return static_cast<std::size_t>(h);
+}
+
+// The readers are used while destroying the registrations, so those must outlive the store
+TmxTypeStore::TmxTypeStore(): byId((readers(), TMX_INIT_REGISTRY_SIZE)) {
+	root = &(namespaces.emplace_back(std::string(), _hash(const_string()), nullptr));
+	byNamespace.insert(root);
+}
+
+static const_string _trim(const_string str) noexcept {
+	while (!str.empty() && std::isspace(static_cast<unsigned char>(str.front())))
+		str.remove_prefix(1);
+	while (!str.empty() && std::isspace(static_cast<unsigned char>(str.back())))
+		str.remove_suffix(1);
+
+	return str;
+}
+
+static const_string _filename(const_string path) noexcept {
+	auto pos = path.find_last_of(_namespace_sep);
+	return pos == const_string::npos ? path : path.substr(pos + 1);
+}
+
+static inline constexpr bool _is_delim(char c) noexcept {
+	return c == '.' || c == ':' || c == '/' || c == '\\';
+}
+
+// Visit the characters of the namespace, unifying the separator and skipping any empty components
+template <typename _Fn>
+static bool _visit_namespace(const_string nmspace, _Fn &&fn) noexcept {
+	bool _started = false;
+	bool _sep = false;
+	for (auto c: nmspace) {
+		if (_is_delim(c)) {
+			_sep = _started;
+			continue;
+		}
+
+		if (_sep && !fn(_namespace_sep))
+			return false;
+		if (!fn(c))
+			return false;
+
+		_started = true;
+		_sep = false;
+	}
+
+	return true;
+}
+
+static TmxTypeNamespace *_find_namespace(const_string nmspace) noexcept {
+	std::uint64_t h = _hash_init;
+	_visit_namespace(nmspace, [&h](char c) {
+		h = _hash_next(h, c);
+		return true;
+	});
+
+	return store().byNamespace.find(static_cast<std::size_t>(h), [nmspace](TmxTypeNamespace const &ns) {
+		std::size_t i = 0;
+		return _visit_namespace(nmspace, [&ns, &i](char c) {
+			return i < ns.path.length() && ns.path[i++] == c;
+		}) && i == ns.path.length();
+	});
+}
+
+// This must only be called while holding the registry lock
+static TmxTypeNamespace *_add_namespace(const_string nmspace) {
+	auto ns = _find_namespace(nmspace);
+	if (ns)
+		return ns;
+
+	std::string _path;
+	_visit_namespace(nmspace, [&_path](char c) {
+		_path.push_back(c);
+		return true;
+	});
+
+	TmxTypeNamespace *_parent = nullptr;
+	if (!_path.empty()) {
+		auto pos = _path.find_last_of(_namespace_sep);
+		_parent = _add_namespace(pos == std::string::npos ? const_string() : const_string(_path.data(), pos));
+	}
+
+	auto h = _hash(_path);
+	ns = &(store().namespaces.emplace_back(std::move(_path), h, _parent));
+	store().byNamespace.insert(ns);
+
+	// Link to the parent only after the namespace is complete
+	if (_parent) {
+		ns->sibling = _parent->children.load(std::memory_order_relaxed);
+		_parent->children.store(ns, std::memory_order_release);
+	}
+
+	return ns;
+}
+
+static TmxTypeNamespace *_intern_namespace(const_string nmspace) {
+	{
+		TmxTypeReaders::guard _read;
+		auto ns = _find_namespace(nmspace);
+		if (ns)
+			return ns;
+	}
+
+	TmxTypeWriter _write;
+	return _add_namespace(nmspace);
+}
+
+// A static registry used before its constructor runs has no namespace yet, so it acts as the root
+static TmxTypeNamespace const *_namespace_of(TmxTypeNamespace const *ns) noexcept {
+	return ns ? ns : store().root;
+}
+
+// This must only be called while holding the registry lock
+static void _remove_name(TmxTypeNamespace const *ns, TmxTypeName *entry) {
+	ns->names.erase(entry);
+
+	// Drop the type once nothing refers to it, which releases the registered instance
+	auto _id = entry->id;
+	if (--(_id->refs) == 0) {
+		store().byId.erase(_id);
+
+		auto iter = store().ids.find(_id);
+		if (iter != store().ids.end()) {
+			readers().retire(std::move(iter->second));
+			store().ids.erase(iter);
+		}
+	}
+
+	auto iter = store().names.find(entry);
+	if (iter != store().names.end()) {
+		readers().retire(std::move(iter->second));
+		store().names.erase(iter);
+	}
+}
+
+static TmxTypeId *_find_id(std::type_info const &id) noexcept {
+	std::type_index _idx { id };
+	return store().byId.find(_idx.hash_code(), [&_idx](TmxTypeId const &entry) {
+		return _idx == std::type_index(entry.descriptor.get_typeid());
+	});
+}
 
-    auto _tmp = TmxTypeOf<std::string>(_ns).trim();
-	if (_tmp.empty())
-		_tmp = default_namespace().data();
+static TmxTypeName *_find_name(TmxTypeNamespace const *ns, const_string nm, std::size_t h) noexcept {
+	if (!ns)
+		return nullptr;
 
-    // Unify the namespace separator character
-    std::filesystem::path path;
-    std::size_t pos = 0;
-    do {
-        pos = _tmp.find_first_of(_delims);
-        path /= _tmp.substr(0, pos);
+	return ns->names.find(h, [nm](TmxTypeName const &entry) { return entry.name == nm; });
+}
+
+// Find the name, which may include some namespace components, relative to the given namespace
+static TmxTypeName *_find_name(TmxTypeNamespace const *ns, const_string nm, TmxTypeNamespace const **owner = nullptr) {
+	nm = _trim(nm);
+	if (nm.find(_namespace_sep) != const_string::npos) {
+		filesystem::path _path { ns->path };
+		_path /= nm;
+
+		auto _name = _filename(_path.native());
+		ns = _find_namespace(_path.parent_path().native());
+		nm = _name;
 
-        if (pos != std::string::npos)
-            _tmp = _tmp.substr(pos + 1);
-    } while (pos != std::string::npos);
+		if (owner) *owner = ns;
+		return _find_name(ns, nm, _hash(nm));
+	}
 
-	this->nmspace = path.native();
+	if (owner) *owner = ns;
+	return _find_name(ns, nm, _hash(nm));
+}
+
+TmxTypeRegistry::TmxTypeRegistry(typename TmxTypeRegistry::string const &_ns) noexcept {
+	static TmxTypeNamespace const *_default = _intern_namespace(default_namespace());
+
+	auto _tmp = _trim(_ns);
+	this->_ns = _tmp.empty() ? _default : _intern_namespace(_tmp);
 }
 
 TmxTypeRegistry::TmxTypeRegistry(typename TmxTypeRegistry::string &&_ns) noexcept: TmxTypeRegistry(_ns) { }
@@ -80,77 +627,75 @@ TmxTypeRegistry::TmxTypeRegistry(TmxTypeRegistry const &other) noexcept {
 }
 
 TmxTypeRegistry &TmxTypeRegistry::operator =(TmxTypeRegistry const &other) noexcept {
-	this->nmspace = other.nmspace;
+	this->_ns = other._ns;
 	return *this;
 }
 
+std::size_t TmxTypeRegistry::capacity() const noexcept {
+	TmxTypeReaders::guard _read;
+	return _namespace_of(this->_ns)->names.capacity();
+}
+
 TmxTypeRegistry TmxTypeRegistry::operator/(typename TmxTypeRegistry::string const &nmspace) const noexcept {
-    filesystem::path _path { this->nmspace };
+    filesystem::path _path { _namespace_of(this->_ns)->path };
     _path /= nmspace;
     return { _path.native() };
 }
 
 TmxTypeRegistry TmxTypeRegistry::get_parent() const noexcept {
-    filesystem::path _path { this->nmspace };
+    filesystem::path _path { _namespace_of(this->_ns)->path };
     return { _path.parent_path().native() };
 }
 
 const_string TmxTypeRegistry::get_namespace() const noexcept {
-	return { this->nmspace.c_str() };
+	auto const &_path = _namespace_of(this->_ns)->path;
+	return { _path.c_str(), _path.length() };
 }
 
 TmxTypeDescriptor TmxTypeRegistry::get(const std::type_info &type, bool ignoreNs) const noexcept {
-	if (byId().count(type)) {
-		TmxTypeDescriptor const &descriptor = byId().at(type);
+	TmxTypeReaders::guard _read;
+
+	auto _id = _find_id(type);
+	if (_id) {
         if (ignoreNs)
-            return { descriptor };
-
-		// The type descriptor name is intentionally a constant string view in order
-		// for fast copies, etc. However, that string view must be backed by an
-		// existing character array, which in this case is stored in the ByName registry.
-		// So, we must obtain that fully-qualified name value.
-        filesystem::path _path { this->nmspace };
-        _path /= descriptor.get_type_short_name();
-
-		ByName::const_iterator iter = byName().find(_path.native());
-		if (iter != byName().end()) {
-			return { descriptor.get_instance(), descriptor.get_typeid(),
-					 iter->first };
-		}
+            return { _id->descriptor };
+
+		// The type descriptor name must be the alias in this namespace, which
+		// shares the path that is already stored in the registry.
+		auto _name = _find_name(_namespace_of(this->_ns), _id->name, _id->nameHash);
+		if (_name)
+			return { _id->descriptor.get_instance(), _id->descriptor.get_typeid(), _name->path };
 	}
 
-	return { std::shared_ptr<const void> {}, type, std::string(empty_string()) };
+	return { std::shared_ptr<const void> {}, type, std::shared_ptr<const filesystem::path> {} };
 }
 
 TmxTypeDescriptor TmxTypeRegistry::get(const_string nm) const noexcept {
-	// The type descriptor name is intentionally a constant string view in order
-	// for fast copies, etc. However, that string view must be backed by an
-	// existing character array, which in this case is stored in the ByName registry.
-	// So, we must obtain that fully-qualified name value.
-    filesystem::path _path { this->nmspace };
-    _path /= String8(nm).trim();
-
-	ByName::const_iterator iter = byName().find(_path.native());
-	if (iter != byName().end()) {
-		return { iter->second->get_instance(), iter->second->get_typeid(),
-				 iter->first };
-	}
+	TmxTypeReaders::guard _read;
+
+	// The type descriptor shares the path that is already stored in the registry
+	auto _name = _find_name(_namespace_of(this->_ns), nm);
+	if (_name)
+		return { _name->id->descriptor.get_instance(), _name->id->descriptor.get_typeid(), _name->path };
 
 	return { std::shared_ptr<const void> {}, typeid(void), std::string(nm) };
 }
 
-Array<TmxTypeDescriptor> TmxTypeRegistry::get_all(std::type_info const &id) const noexcept {
-	const_string _ns = this->get_namespace();
-	Array<TmxTypeDescriptor> _ret;
+static void _get_all(TmxTypeNamespace const *ns, std::type_info const &id, Array<TmxTypeDescriptor> &ret) {
+	ns->names.for_each([&id, &ret](TmxTypeName const &entry) {
+		if (id == typeid(void) || entry.id->descriptor.get_typeid() == id)
+			ret.emplace_back(entry.id->descriptor.get_instance(), entry.id->descriptor.get_typeid(), entry.path);
+	});
 
-	for (auto &type: byName()) {
-        if (id != typeid(void) && type.second->get_typeid() != id)
-            continue;
+	for (auto child = ns->children.load(std::memory_order_acquire); child; child = child->sibling)
+		_get_all(child, id, ret);
+}
 
-		if (::strncmp(_ns.data(), type.first.c_str(), _ns.length()) == 0)
-			_ret.emplace_back(type.second->get_instance(), type.second->get_typeid(), type.first.c_str());
-	}
+Array<TmxTypeDescriptor> TmxTypeRegistry::get_all(std::type_info const &id) const noexcept {
+	Array<TmxTypeDescriptor> _ret;
 
+	TmxTypeReaders::guard _read;
+	_get_all(_namespace_of(this->_ns), id, _ret);
 	return _ret;
 }
 
@@ -161,18 +706,40 @@ void _register(TmxTypeDescriptor const &descriptor, const_string nmspace) {
     filesystem::path _path { nmspace };
     _path /= descriptor.get_type_short_name();
 
+	TmxTypeWriter _write;
+
     // Never register the type ID more than once, as it would override the default type name.
     // The fully qualified path name of the initial registration is used as the default type
     // name in order to ensure that aliases will always reference an original C++ type or class.
 	// Also, emplace the information into newly constructed objects so they stay after any
 	// temporaries are gone.
-	if (!byId().count(descriptor.get_typeid()))
-		byId().emplace(descriptor.get_typeid(),
-                       TmxTypeDescriptor(descriptor.get_instance(), descriptor.get_typeid(), _path.native()));
+	auto _id = _find_id(descriptor.get_typeid());
+	if (!_id) {
+		std::unique_ptr<TmxTypeId> _stored { new TmxTypeId(
+				TmxTypeDescriptor(descriptor.get_instance(), descriptor.get_typeid(),
+								  std::make_shared<const filesystem::path>(_path)),
+				std::type_index(descriptor.get_typeid()).hash_code(), const_string()) };
+		_stored->name = _filename(_stored->descriptor.get_path().native());
+		_stored->nameHash = _hash(_stored->name);
+
+		_id = _stored.get();
+		store().ids.emplace(_id, std::move(_stored));
+		store().byId.insert(_id);
+	}
 
     // The objects in the Name registry should contain only pointers to objects in the ID registry
-	TmxTypeDescriptor const &_stored = byId().at(descriptor.get_typeid());
-	byName().emplace(_path.native(), &(_stored));
+	auto ns = _add_namespace(_path.parent_path().native());
+	auto _name = _filename(_path.native());
+	auto h = _hash(_name);
+	if (_find_name(ns, _name, h))
+		return;
+
+	auto _stored = std::make_shared<const filesystem::path>(_path);
+	std::unique_ptr<TmxTypeName> _entry { new TmxTypeName { _stored, h, _filename(_stored->native()), _id } };
+	_id->refs++;
+
+	ns->names.insert(_entry.get());
+	store().names.emplace(_entry.get(), std::move(_entry));
 };
 
 void TmxTypeRegistry::register_type(std::shared_ptr<const void> instance, std::type_info const &id, const_string nm) const {
@@ -189,15 +756,24 @@ void TmxTypeRegistry::register_type(std::shared_ptr<const void> instance, std::t
 }
 
 void TmxTypeRegistry::unregister(std::type_info const &id) const noexcept {
-	auto descriptor = this->get(id);
-	if (descriptor)
-		this->unregister(descriptor.get_type_name());
+	TmxTypeWriter _write;
+
+	auto _id = _find_id(id);
+	if (!_id)
+		return;
+
+	auto _name = _find_name(_namespace_of(this->_ns), _id->name, _id->nameHash);
+	if (_name)
+		_remove_name(_namespace_of(this->_ns), _name);
 }
 
 void TmxTypeRegistry::unregister(const_string nm) const noexcept {
-	auto descriptor = this->get(nm);
-	if (descriptor)
-		byName().erase(typename ByName::key_type(descriptor.get_type_name()));
+	TmxTypeWriter _write;
+
+	TmxTypeNamespace const *_owner = nullptr;
+	auto _name = _find_name(_namespace_of(this->_ns), nm, &_owner);
+	if (_name && _owner)
+		_remove_name(_owner, _name);
 }
 
 static TmxTypeRegistry &defaultRegistry() {
@@ -207,7 +783,7 @@ static TmxTypeRegistry &defaultRegistry() {
 }
 
 struct _RegisterAllTypes {
-	static TmxTypeDescriptor _registerAlias(TmxTypeDescriptor const &descriptor, typename ByName::key_type &&name) {
+	static TmxTypeDescriptor _registerAlias(TmxTypeDescriptor const &descriptor, std::string &&name) {
 		if (descriptor) {
 			TmxTypeDescriptor _tmp(descriptor.get_instance(), descriptor.get_typeid(), name);
 			_register(_tmp, defaultRegistry().get_namespace());
@@ -221,7 +797,13 @@ struct _RegisterAllTypes {
 	template <typename _Tp>
 	static void _registerAlias(const_string name) {
         // Register a new instance of _Tp if it is not already registered to its appropriate namespace
-		if (!byId().count(typeid(_Tp))) {
+		bool _found;
+		{
+			TmxTypeReaders::guard _read;
+			_found = _find_id(typeid(_Tp)) != nullptr;
+		}
+
+		if (!_found) {
             auto _ptr = get_singleton<_Tp>();
 
             TmxTypeRegistry _helper { type_fqname<_Tp>().data() };
@@ -234,7 +816,7 @@ struct _RegisterAllTypes {
         if (!descr) return;
 
         // Add the alias
-		_registerAlias(descr, typename ByName::key_type(name));
+		_registerAlias(descr, std::string(name));
 	}
 
 	template <typename _Tp>
@@ -243,7 +825,7 @@ struct _RegisterAllTypes {
 	}
 
 	static constexpr auto _registerDefaultType = [](auto &&instance) {
-		typedef typename ByName::key_type key_type;
+		typedef std::string key_type;
         typedef TmxTypeTraits<decltype(instance)> traits_type;
         typedef TmxValueTypeOf<typename traits_type::type> value_type;
 
@@ -263,9 +845,9 @@ struct _RegisterAllTypes {
         }
 
 		std::transform(_name.begin(), _name.end(), _name.begin(), ::tolower);
-		auto lcAlias = _registerAlias(_tmp, typename ByName::key_type(_name));
+		auto lcAlias = _registerAlias(_tmp, key_type(_name));
 		if (isSzTemplate(instance)) {
-            _registerAlias(_tmp, typename ByName::key_type(std::regex_replace(_name, std::regex("[<>]"), "")));
+            _registerAlias(_tmp, key_type(std::regex_replace(_name, std::regex("[<>]"), "")));
         }
 	};
 
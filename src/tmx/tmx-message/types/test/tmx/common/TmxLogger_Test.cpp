@@ -0,0 +1,106 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxLogger_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <tmx/common/TmxLogger.hpp>
+#include <tmx/common/TmxTypeRegistry.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace tmx::common;
+
+static int _evaluated = 0;
+
+static int count_evaluated() {
+    return ++_evaluated;
+}
+
+BOOST_AUTO_TEST_CASE( tmxtest_logger_levels ) {
+    TmxLogger::enable(TmxLogLevel::INFO);
+
+    BOOST_CHECK(TmxLogger::can_log(TmxLogLevel::ERR));
+    BOOST_CHECK(TmxLogger::can_log(TmxLogLevel::INFO));
+    BOOST_CHECK(!TmxLogger::can_log(TmxLogLevel::DEBUG));
+    BOOST_CHECK(TmxLogger::can_log("INFO"));
+    BOOST_CHECK(TmxLogger::can_log("notice"));
+    BOOST_CHECK(!TmxLogger::can_log("debug3"));
+
+    // The disabled log statement should never evaluate the stream
+    _evaluated = 0;
+    TLOG(DEBUG) << count_evaluated();
+    TLOG(debug) << count_evaluated();
+    BOOST_CHECK_EQUAL(0, _evaluated);
+
+    TmxLogger::enable("DEBUG");
+    BOOST_CHECK(TmxLogger::can_log(TmxLogLevel::DEBUG));
+    BOOST_CHECK(!TmxLogger::can_log(TmxLogLevel::DEBUG1));
+
+    TLOG(DEBUG) << count_evaluated();
+    BOOST_CHECK_EQUAL(1, _evaluated);
+
+    // Lowering the level must disable the higher levels
+    TmxLogger::enable(TmxLogLevel::WARN);
+    BOOST_CHECK(!TmxLogger::can_log(TmxLogLevel::NOTICE));
+    BOOST_CHECK(!TmxLogger::can_log("DEBUG"));
+
+    TmxLogger::disable();
+    BOOST_CHECK(!TmxLogger::can_log(TmxLogLevel::EMERG));
+}
+
+BOOST_AUTO_TEST_CASE( tmxtest_logger_file_writer ) {
+    static constexpr int numThreads = 4;
+    static constexpr int numMessages = 1000;
+
+    std::string fileName { "test-TmxLogger.log" };
+    std::remove(fileName.c_str());
+
+    TmxLogger::enable(TmxLogLevel::INFO);
+    TmxLogger::flush();
+
+    // Write only to the test file
+    TmxTypeRegistry logFiles { "tmx.common.logging.writers.TmxFileLogWriter.log-file" };
+    auto ptr = get_singleton<std::string>();
+    logFiles.unregister("-");
+    logFiles.register_instance(ptr, fileName.c_str());
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < numMessages; i++)
+                TLOG(INFO) << "Thread " << t << " message " << i;
+        });
+    }
+
+    for (auto &t: threads)
+        t.join();
+
+    TmxLogger::flush();
+
+    std::ifstream is { fileName };
+    std::string line;
+    int count = 0;
+    while (std::getline(is, line)) {
+        BOOST_CHECK(line.find(" - INFO   : Thread ") != std::string::npos);
+        count++;
+    }
+
+    BOOST_CHECK_EQUAL(numThreads * numMessages, count);
+
+    logFiles.unregister(fileName.c_str());
+    logFiles.register_instance(ptr, "-");
+    std::remove(fileName.c_str());
+}
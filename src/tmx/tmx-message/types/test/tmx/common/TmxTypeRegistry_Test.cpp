@@ -0,0 +1,275 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxTypeRegistry_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/common/TmxTypeRegistry.hpp>
+#include <tmx/common/types/Int.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace tmx::common::types;
+
+namespace tmx {
+namespace common {
+namespace test {
+
+static constexpr std::size_t BENCHMARK_RUNS = 100000;
+
+struct RegistryTestType { };
+struct RegistryTestSubType { };
+struct RegistryChurnType { };
+
+std::shared_ptr<const void> test_instance() {
+    static int _instance = 0;
+    return { static_cast<const void *>(&_instance), [](auto *) { } };
+}
+
+void check_found(TmxTypeDescriptor const &descr, std::type_info const &id, std::string const &name) {
+    BOOST_CHECK(descr);
+    BOOST_CHECK(descr.get_typeid() == id);
+    BOOST_CHECK_EQUAL(name, descr.get_type_name());
+    BOOST_CHECK(descr.get_instance() == test_instance());
+}
+
+BOOST_AUTO_TEST_SUITE(type_registry_test_suite)
+
+BOOST_AUTO_TEST_CASE(registry_lookup) {
+    TmxTypeRegistry reg { "tmx.test.registry.lookup" };
+    BOOST_CHECK_EQUAL("tmx/test/registry/lookup", reg.get_namespace());
+
+    reg.register_type(test_instance(), typeid(RegistryTestType), "RegistryTestType");
+    reg.register_type(test_instance(), typeid(RegistryTestType), "TestAlias");
+
+    check_found(reg.get("RegistryTestType"), typeid(RegistryTestType), "tmx/test/registry/lookup/RegistryTestType");
+    check_found(reg.get("  TestAlias "), typeid(RegistryTestType), "tmx/test/registry/lookup/TestAlias");
+    check_found(reg.get(typeid(RegistryTestType)), typeid(RegistryTestType),
+                "tmx/test/registry/lookup/RegistryTestType");
+    BOOST_CHECK(!reg.get("Missing"));
+    BOOST_CHECK(!reg.get(typeid(RegistryTestSubType)));
+
+    // Any separator can be used in the namespace
+    for (auto ns: { "tmx::test::registry::lookup", "/tmx/test/registry/lookup/", " tmx.test:registry\\lookup " })
+        check_found(TmxTypeRegistry(ns).get("RegistryTestType"), typeid(RegistryTestType),
+                    "tmx/test/registry/lookup/RegistryTestType");
+
+    // Or in the name
+    check_found(TmxTypeRegistry("tmx.test.registry").get("lookup/TestAlias"), typeid(RegistryTestType),
+                "tmx/test/registry/lookup/TestAlias");
+
+    // But only the exact namespace is searched
+    BOOST_CHECK(!TmxTypeRegistry("tmx.test.registry").get("TestAlias"));
+    BOOST_CHECK(!TmxTypeRegistry("tmx.test.registry.lookup.sub").get("TestAlias"));
+
+    // The default namespace has all the TMX types
+    TmxTypeRegistry types;
+    BOOST_CHECK(types.get("Int32"));
+    BOOST_CHECK(types.get("Int32").get_typeid() == typeid(Int32));
+    BOOST_CHECK(types.get(typeid(Int32)));
+}
+
+BOOST_AUTO_TEST_CASE(registry_get_all) {
+    TmxTypeRegistry reg { "tmx.test.registry.all" };
+    reg.register_type(test_instance(), typeid(RegistryTestType), "RegistryTestType");
+    (reg / "sub").register_type(test_instance(), typeid(RegistryTestSubType), "RegistryTestSubType");
+    (reg / "sub").register_type(test_instance(), typeid(RegistryTestType), "TestAlias");
+
+    BOOST_CHECK_EQUAL(3u, reg.get_all().size());
+    BOOST_CHECK_EQUAL(2u, reg.get_all(typeid(RegistryTestType)).size());
+    BOOST_CHECK_EQUAL(2u, (reg / "sub").get_all().size());
+    BOOST_CHECK_EQUAL(1u, (reg / "sub").get_all(typeid(RegistryTestSubType)).size());
+    BOOST_CHECK_EQUAL("tmx/test/registry/all", (reg / "sub").get_parent().get_namespace());
+
+    // A namespace that is only a prefix of the name is not included
+    BOOST_CHECK(TmxTypeRegistry("tmx.test.registry.al").get_all().empty());
+    BOOST_CHECK_GE(TmxTypeRegistry("tmx.test").get_all().size(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(registry_unregister) {
+    TmxTypeRegistry reg { "tmx.test.registry.unregister" };
+    reg.register_type(test_instance(), typeid(RegistryTestType), "RegistryTestType");
+    reg.register_type(test_instance(), typeid(RegistryTestType), "TestAlias");
+
+    reg.unregister("TestAlias");
+    BOOST_CHECK(!reg.get("TestAlias"));
+    BOOST_CHECK(reg.get("RegistryTestType"));
+
+    reg.unregister(typeid(RegistryTestType));
+    BOOST_CHECK(!reg.get("RegistryTestType"));
+    BOOST_CHECK(!reg.get(typeid(RegistryTestType)));
+    BOOST_CHECK(reg.get_all().empty());
+
+    // And can be registered again
+    reg.register_type(test_instance(), typeid(RegistryTestType), "TestAlias");
+    BOOST_CHECK(reg.get("TestAlias"));
+}
+
+BOOST_AUTO_TEST_CASE(registry_churn_is_reclaimed) {
+    TmxTypeRegistry reg { "tmx.test.registry.churn" };
+    const auto initial = reg.capacity();
+
+    // Like a subscription that comes and goes, with its own instance each time
+    std::weak_ptr<const int> last;
+    for (int i = 0; i < 10000; i++) {
+        auto instance = std::make_shared<const int>(i);
+        last = instance;
+
+        reg.register_type(instance, typeid(RegistryChurnType), "Callback" + std::to_string(i % 7));
+        instance.reset();
+
+        BOOST_REQUIRE(!last.expired());
+        reg.unregister(typeid(RegistryChurnType));
+        BOOST_REQUIRE(last.expired());
+    }
+
+    BOOST_CHECK_EQUAL(initial, reg.capacity());
+    BOOST_CHECK(reg.get_all().empty());
+
+    // A lot of names grows the table, but it shrinks back once they are gone
+    for (int i = 0; i < 1000; i++)
+        reg.register_type(test_instance(), typeid(RegistryTestType), "Type" + std::to_string(i));
+    BOOST_CHECK_GT(reg.capacity(), initial);
+
+    for (int i = 0; i < 1000; i++)
+        reg.unregister("Type" + std::to_string(i));
+    for (int i = 0; i < 100; i++) {
+        reg.register_type(test_instance(), typeid(RegistryChurnType), "Callback");
+        reg.unregister("Callback");
+    }
+
+    BOOST_CHECK_EQUAL(initial, reg.capacity());
+    BOOST_CHECK(reg.get_all().empty());
+}
+
+BOOST_AUTO_TEST_CASE(registry_churn_with_readers) {
+    TmxTypeRegistry reg { "tmx.test.registry.churn.readers" };
+    reg.register_type(test_instance(), typeid(RegistryTestType), "RegistryTestType");
+
+    std::atomic<bool> done { false };
+    std::atomic<std::size_t> misses { 0 };
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; i++) {
+        readers.emplace_back([&]() {
+            TmxTypeRegistry _reg { "tmx.test.registry.churn.readers" };
+            while (!done) {
+                if (!_reg.get("RegistryTestType"))
+                    misses++;
+
+                // The churned name may or may not be there, but must always be complete
+                auto descr = _reg.get("Callback");
+                if (descr && descr.get_typeid() != typeid(RegistryTestSubType))
+                    misses++;
+            }
+        });
+    }
+
+    // Every removal frees memory that the readers may be looking at
+    for (int i = 0; i < 5000; i++) {
+        reg.register_type(std::make_shared<const int>(i), typeid(RegistryTestSubType), "Callback");
+        reg.unregister("Callback");
+    }
+
+    done = true;
+    for (auto &t: readers)
+        t.join();
+
+    BOOST_CHECK_EQUAL(0u, misses);
+    BOOST_CHECK_EQUAL(1u, reg.get_all().size());
+}
+
+BOOST_AUTO_TEST_CASE(registry_concurrent_lookup) {
+    TmxTypeRegistry reg { "tmx.test.registry.concurrent" };
+    reg.register_type(test_instance(), typeid(RegistryTestType), "RegistryTestType");
+
+    std::atomic<bool> done { false };
+    std::atomic<std::size_t> misses { 0 };
+    std::atomic<std::size_t> lookups { 0 };
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; i++) {
+        readers.emplace_back([&]() {
+            TmxTypeRegistry _reg { "tmx.test.registry.concurrent" };
+            while (!done) {
+                if (!_reg.get("RegistryTestType") || !_reg.get(typeid(RegistryTestType)))
+                    misses++;
+                lookups++;
+            }
+        });
+    }
+
+    // Force the tables to grow many times while the readers are running
+    for (int i = 0; i < 2000; i++) {
+        auto nm = "Type" + std::to_string(i);
+        reg.register_type(test_instance(), typeid(RegistryTestSubType), nm);
+        (reg / nm).register_type(test_instance(), typeid(RegistryTestSubType), nm);
+    }
+
+    done = true;
+    for (auto &t: readers)
+        t.join();
+
+    BOOST_TEST_MESSAGE(lookups << " concurrent lookups");
+    BOOST_CHECK_EQUAL(0u, misses);
+    BOOST_CHECK_EQUAL(4001u, reg.get_all().size());
+    for (int i = 0; i < 2000; i++)
+        BOOST_CHECK(reg.get("Type" + std::to_string(i)));
+}
+
+BOOST_AUTO_TEST_CASE(registry_lookup_is_faster) {
+    const std::string ns { TmxTypeRegistry().get_namespace() };
+    const std::vector<std::string> names { "Int32", "UInt64", "String8", "Boolean", "Properties", "Missing" };
+
+    // The original look-up, which used a map of the fully-qualified names
+    // and built up a path on each call
+    std::unordered_map<std::string, TmxTypeDescriptor> byName;
+    for (auto &descr: TmxTypeRegistry().get_all())
+        byName.emplace(descr.get_type_name(), descr);
+
+    std::size_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < BENCHMARK_RUNS; i++) {
+        filesystem::path _path { ns };
+        _path /= String8(names[i % names.size()]).trim();
+
+        auto iter = byName.find(_path.native());
+        if (iter != byName.end()) {
+            TmxTypeDescriptor descr { iter->second.get_instance(), iter->second.get_typeid(), iter->first };
+            found += (bool)descr;
+        }
+    }
+    auto before = std::chrono::steady_clock::now() - start;
+
+    std::size_t hashed = 0;
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < BENCHMARK_RUNS; i++)
+        hashed += (bool)TmxTypeRegistry().get(names[i % names.size()]);
+    auto after = std::chrono::steady_clock::now() - start;
+
+    BOOST_CHECK_EQUAL(found, hashed);
+    BOOST_TEST_MESSAGE("Path look-up took " <<
+                       std::chrono::duration_cast<std::chrono::nanoseconds>(before).count() / BENCHMARK_RUNS <<
+                       "ns, hashed look-up took " <<
+                       std::chrono::duration_cast<std::chrono::nanoseconds>(after).count() / BENCHMARK_RUNS << "ns");
+    BOOST_CHECK_LT(after.count(), before.count());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} /* End namespace test */
+} /* End namespace common */
+} /* End namespace tmx */
@@ -27,6 +27,8 @@
 namespace tmx {
 namespace plugin {
 
+class TmxPlugin;
+
 /*!
  * @brief A container class for a given TMX broker client
  *
@@ -78,6 +80,16 @@ public:
      */
     void write_message(message::TmxMessage const &) noexcept;
 
+    /*!
+     * @brief Write the shared TMX message to the channel
+     *
+     * A worker thread holds on to the same message instead of making
+     * its own copy, so the message must not change after it is written.
+     *
+     * @param[in] message The message to write
+     */
+    void write_message(std::shared_ptr<const message::TmxMessage> const &) noexcept;
+
     /*!
      * @brief Set up the channel to receive messages at the given topic
      *
@@ -85,6 +97,17 @@ public:
      */
     void read_messages(common::const_string) noexcept;
 
+    /*!
+     * @brief Check if the message should be automatically published on this channel
+     *
+     * This uses the "auto-publish" and "topics" parameters of the channel,
+     * which are resolved only once when the channel is configured.
+     *
+     * @param[in] message The message to check
+     * @return True if the message topic should be broadcast to this channel
+     */
+    bool is_auto_publish(message::TmxMessage const &) const noexcept;
+
     /*!
      * @brief Execute a messaging operation on this channel
      *
@@ -116,10 +139,49 @@ public:
     broker::TmxBrokerContext const &get_context() const noexcept;
 
 private:
+    struct TmxChannelPlan;
+
+    /*!
+     * @brief Resolve the dispatch plan for this channel
+     *
+     * The plan caches everything needed to send or receive a message on
+     * this channel, such as the broker client, the worker threads and the
+     * channel flags, so that none of it has to be looked up per message.
+     * Since the channels are rebuilt on every configuration update, the
+     * plan only needs to be compiled when the channel is constructed.
+     *
+     * @param[in] plugin The plugin to which this channel belongs
+     */
+    void compile(TmxPlugin *) noexcept;
+
+    /*!
+     * @brief Execute a messaging operation on this channel
+     *
+     * @param[in] callback The call-back descriptor
+     * @param[in] message The message to handle
+     * @param[in] shared The same message, if already shared, or null to copy it for a worker thread
+     */
+    common::TmxError execute(common::TmxTypeDescriptor const &, message::TmxMessage const &,
+                             std::shared_ptr<const message::TmxMessage>);
+
+    /*!
+     * @brief Invoke the call-back on the current thread
+     *
+     * @param[in] callback The call-back descriptor
+     * @param[in] message The message to handle
+     * @return The result of the call-back
+     */
+    common::TmxError dispatch(common::TmxTypeDescriptor const &, message::TmxMessage const &);
+
     /*!
      * @brief The context data for this channel
      */
     common::types::Any _data;
+
+    /*!
+     * @brief The compiled dispatch plan for this channel
+     */
+    std::unique_ptr<TmxChannelPlan> _plan;
 };
 
 } /* End namespace plugin */
@@ -26,12 +26,55 @@
 #include <tmx/plugin/TmxMessageHandler.hpp>
 #include <tmx/plugin/utils/async/TmxRunnable.hpp>
 
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace tmx {
 namespace plugin {
 
+/*!
+ * @brief A typed, read-only view of the plugin configuration
+ *
+ * The view holds an immutable value of the given type that is rebuilt
+ * from the configuration by the plugin whenever the bound configuration
+ * changes. Reading the current value is a single atomic load, thus it
+ * is safe to use from any thread in the data path without locking.
+ *
+ * @see TmxPlugin#bind_config()
+ */
+template <typename _T>
+class TmxPluginConfigView {
+public:
+    typedef _T value_type;
+
+    TmxPluginConfigView() noexcept = default;
+    TmxPluginConfigView(TmxPluginConfigView const &) = delete;
+    TmxPluginConfigView &operator=(TmxPluginConfigView const &) = delete;
+
+    /*!
+     * @return The current value, which stays valid even if the config changes
+     */
+    std::shared_ptr<value_type const> get() const noexcept {
+        return std::atomic_load(&this->_value);
+    }
+
+    /*!
+     * @param[in] value The new value to publish
+     */
+    void set(value_type &&value) noexcept {
+        std::atomic_store(&this->_value, std::shared_ptr<value_type const>(
+                std::make_shared<value_type const>(std::forward<value_type>(value))));
+    }
+
+private:
+    std::shared_ptr<value_type const> _value { std::make_shared<value_type const>() };
+};
+
 class TmxPlugin: public utils::async::TmxRunnable {
 public:
     /*!
@@ -163,6 +206,67 @@ public:
      */
     void set_config(common::const_string, const char *, std::mutex * = nullptr);
 
+    /*!
+     * @brief Get the current configuration
+     *
+     * The snapshot is immutable and is replaced as a whole each time
+     * a config property changes, so the returned pointer can be read
+     * without a lock for as long as it is held.
+     *
+     * @return The current configuration snapshot
+     */
+    std::shared_ptr<message::TmxData const> get_config_snapshot() const noexcept;
+
+    /*!
+     * @brief Bind a function to a configuration property
+     *
+     * The function is invoked immediately with the current value, then
+     * again only when the value changes. An empty key binds to the entire
+     * configuration, which is invoked whenever any property changes.
+     *
+     * Note that the bindings are invoked while the configuration is being
+     * updated, so they should be short and must not set a config property.
+     *
+     * @param[in] key The key or name of the config property
+     * @param[in] fn The function to invoke with the new value
+     */
+    void bind_config(common::const_string, std::function<void(message::TmxData const &)>);
+
+    /*!
+     * @brief Bind an atomic field to a configuration property
+     *
+     * This allows for the data path to read a single config property
+     * without any lock, look up or copy of the configuration. The field
+     * keeps its value if the config property is empty.
+     *
+     * @param[in] key The key or name of the config property
+     * @param[in] field The field to keep up to date
+     */
+    template <typename _T>
+    void bind_config(common::const_string key, std::atomic<_T> &field) {
+        this->bind_config(key, [&field](message::TmxData const &value) {
+            if (!value.is_empty())
+                field.store(static_cast<_T>(value));
+        });
+    }
+
+    /*!
+     * @brief Bind a typed view to the plugin configuration
+     *
+     * The view is rebuilt from the entire configuration each time any
+     * config property changes, which allows for a structure of related
+     * properties to be read consistently in the data path.
+     *
+     * @param[in] view The view to keep up to date
+     * @param[in] make The function to build a view value from the configuration
+     */
+    template <typename _T>
+    void bind_config(TmxPluginConfigView<_T> &view, std::function<_T(message::TmxData const &)> make) {
+        this->bind_config(common::empty_string(), [&view, make](message::TmxData const &config) {
+            view.set(make(config));
+        });
+    }
+
     /*!
      * @brief Get a status property from cache
      *
@@ -405,6 +509,17 @@ public:
      */
     virtual void broadcast(message::TmxMessage const &);
 
+    /*!
+     * @brief Asynchronously send a shared message across every channel
+     *
+     * Every channel, and every worker thread, uses this same message
+     * instead of its own copy. Therefore, the message must not be
+     * changed after it is broadcast.
+     *
+     * @param[in] message The TMX message to send
+     */
+    void broadcast(std::shared_ptr<const message::TmxMessage> const &);
+
     /*!
      * @brief Asynchronously send a message across every channel
      *
@@ -505,10 +620,24 @@ protected:
     virtual common::types::Array<common::types::Any> get_config_description() const noexcept;
 
 private:
+    /*!
+     * @brief Publish a new snapshot of the configuration cache
+     *
+     * This is used after the cache is written directly, such as when
+     * loading the default values. Only the bindings whose value actually
+     * changed are invoked.
+     */
+    void publish_config();
+
     // Config and status property caches
 	message::TmxData _config;
 	message::TmxData _status;
 
+    // The published config, and the properties bound to it
+    std::shared_ptr<message::TmxData const> _configSnapshot { std::make_shared<message::TmxData const>() };
+    std::vector<std::pair<std::string, std::function<void(message::TmxData const &)> > > _configBindings;
+    std::mutex _configLock;
+
     // The channels for this plugin
     common::types::Array<std::shared_ptr<TmxChannel> > _channels;
  };
@@ -31,8 +31,11 @@
 #include <boost/asio.hpp>
 #include <deque>
 #include <memory>
+#include <optional>
+#include <regex>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #ifndef TMX_MAX_WORKER_THREADS
 #define TMX_MAX_WORKER_THREADS 256
@@ -162,6 +165,23 @@ static typename types::Properties_::key_t _group   { "worker-group" };
 
 } /* End namespace channels */
 
+/*!
+ * @brief The resolved dispatch information for a channel
+ */
+struct TmxChannel::TmxChannelPlan {
+    TmxPlugin *plugin = nullptr;
+    std::shared_ptr<TmxBrokerClient> broker;
+    channels::_channel_id_type id;
+
+    bool readOnly = false;
+    bool writeOnly = false;
+    bool autoPublish = true;
+    std::optional<std::regex> topics;
+
+    std::vector<channels::worker_t> *workers = nullptr;
+    std::shared_ptr<channels::group_t> group;
+};
+
 TmxChannel::TmxChannel(TmxTypeDescriptor const &descriptor, Any const &config) noexcept {
     static const TmxTypeRegistry &_reg = channels::_channel_registry.get_registry();
 
@@ -201,12 +221,9 @@ TmxChannel::TmxChannel(TmxTypeDescriptor const &descriptor, Any const &config) n
             workers.emplace_back(new boost::asio::io_context(1));
         }
 
-        for (std::size_t i = 0; i < workers.size(); i++) {
+        // Each worker is ready to accept tasks once started
+        for (std::size_t i = 0; i < workers.size(); i++)
             workers[i].start();
-
-            std::this_thread::yield();
-            std::this_thread::sleep_for(std::chrono::milliseconds(50));
-        }
     }
 
     TLOG(DEBUG) << "Channel context " << ctx.get_id() << ": " <<
@@ -214,9 +231,13 @@ TmxChannel::TmxChannel(TmxTypeDescriptor const &descriptor, Any const &config) n
 
     // Assign the plugin type to the context ID
     (_reg / ctx.get_id()).register_type(descriptor.get_instance(), descriptor.get_typeid(), "plugin");
+
+    this->compile(plugin.get());
 }
 
-TmxChannel::TmxChannel(tmx::plugin::TmxChannel &&moved) noexcept: _data(moved._data)  { }
+TmxChannel::TmxChannel(tmx::plugin::TmxChannel &&moved) noexcept: _data(moved._data)  {
+    this->compile(moved._plan ? moved._plan->plugin : nullptr);
+}
 
 TmxChannel::~TmxChannel() {
     TmxBrokerContext &ctx = this->get_context();
@@ -234,7 +255,7 @@ TmxChannel::~TmxChannel() {
         }
     }
 
-    auto client = TmxBrokerClient::get_broker(ctx);
+    auto client = this->_plan ? this->_plan->broker : TmxBrokerClient::get_broker(ctx);
     if (client) {
         TLOG(NOTICE) << "Destroying the broker context for channel " << ctx.get_id();
 
@@ -242,6 +263,45 @@ TmxChannel::~TmxChannel() {
     }
 }
 
+void TmxChannel::compile(TmxPlugin *plugin) noexcept {
+    auto plan = std::make_unique<TmxChannelPlan>();
+    plan->plugin = plugin;
+
+    TmxBrokerContext &ctx = this->get_context();
+    if (ctx) {
+        plan->id = ctx.get_id().data();
+        plan->broker = TmxBrokerClient::get_broker(ctx);
+
+        const message::TmxData params { ctx.get_parameters() };
+        plan->readOnly = params["read-only"].to_bool();
+        plan->writeOnly = params["write-only"].to_bool();
+        if (!params["auto-publish"].is_empty())
+            plan->autoPublish = params["auto-publish"];
+
+        // No topics means every topic, so the expression is only needed to filter
+        if (params["topics"]) {
+            try {
+                plan->topics.emplace(params["topics"].to_string());
+            } catch (std::regex_error &ex) {
+                TLOG(ERR) << "Invalid topics expression " << params["topics"].to_string()
+                          << " for channel " << ctx.get_id() << ": " << ex.what();
+                plan->autoPublish = false;
+            }
+        }
+
+        if (ctx.count(channels::_workers)) {
+            auto workers = types::as<std::vector<channels::worker_t> >(ctx.at(channels::_workers));
+            if (workers && workers->size())
+                plan->workers = workers.get();
+        }
+
+        if (ctx.count(channels::_group))
+            plan->group = types::as<channels::group_t>(ctx.at(channels::_group));
+    }
+
+    this->_plan = std::move(plan);
+}
+
 TmxBrokerContext &TmxChannel::get_context() noexcept {
     auto ctx = tmx::common::types::as<TmxBrokerContext>(this->_data);
     return ctx ? *ctx : channels::_empty_context;
@@ -256,57 +316,61 @@ void TmxChannel::disconnect() noexcept {
     // Asynchronously disconnect
 
     TmxBrokerContext &ctx = this->get_context();
-    if (ctx) {
-        auto client = TmxBrokerClient::get_broker(ctx);
-        if (client)
-            client->disconnect(ctx);
-    }
+    if (ctx && this->_plan->broker)
+        this->_plan->broker->disconnect(ctx);
 }
 
 void TmxChannel::connect(common::types::Any const &params) noexcept {
     TmxBrokerContext &ctx = this->get_context();
-    if (ctx) {
-        auto client = TmxBrokerClient::get_broker(ctx);
-        if (client) {
-            if (ctx.get_state() == broker::TmxBrokerState::uninitialized)
-                client->initialize(ctx);
+    auto &client = this->_plan->broker;
+    if (ctx && client) {
+        if (ctx.get_state() == broker::TmxBrokerState::uninitialized)
+            client->initialize(ctx);
 
-            if (!client->is_connected(ctx))
-                client->connect(ctx, params);
-        }
+        if (!client->is_connected(ctx))
+            client->connect(ctx, params);
     }
 }
 
 void TmxChannel::write_message(message::TmxMessage const &msg) noexcept {
-    TmxBrokerContext &ctx = this->get_context();
-    if (ctx) {
-        // Check to see if this context is read-only
-        const message::TmxData parameters { ctx.get_parameters() };
-        if (parameters["read-only"].to_bool())
-                return;
-
-        auto client = TmxBrokerClient::get_broker(ctx);
-        if (client)
-             this->execute(channels::_outgoing.descriptor(), msg);
-    }
+    // Check to see if this context is read-only
+    if (this->_plan->readOnly || !this->_plan->broker)
+        return;
+
+    if (this->get_context())
+        this->execute(channels::_outgoing.descriptor(), msg);
+}
+
+void TmxChannel::write_message(std::shared_ptr<const message::TmxMessage> const &msg) noexcept {
+    // Check to see if this context is read-only
+    if (!msg || this->_plan->readOnly || !this->_plan->broker)
+        return;
+
+    if (this->get_context())
+        this->execute(channels::_outgoing.descriptor(), *msg, msg);
 }
 
 void TmxChannel::read_messages(common::const_string topic) noexcept {
+    // Check to see if this context is write-only
+    if (this->_plan->writeOnly)
+        return;
+
     TmxBrokerContext &ctx = this->get_context();
     if (ctx) {
-        // Check to see if this context is write-only
-        const message::TmxData parameters { ctx.get_parameters() };
-        if (parameters["write-only"].to_bool())
-            return;
-
         this->connect();
 
-        auto client = TmxBrokerClient::get_broker(ctx);
-        if (client)
-            client->subscribe(ctx, topic, channels::_msg_receiver.descriptor());
+        if (this->_plan->broker)
+            this->_plan->broker->subscribe(ctx, topic, channels::_msg_receiver.descriptor());
     }
 }
 
+bool TmxChannel::is_auto_publish(message::TmxMessage const &msg) const noexcept {
+    if (!this->_plan->autoPublish)
+        return false;
+
+    return !this->_plan->topics || std::regex_search(msg.get_topic().c_str(), this->_plan->topics.value());
+}
+
 class TmxDeferredWorkExecutor: public TmxTaskExecutor {
     future<TmxError> exec_async(Functor<TmxError> &&function) {
         return std::async(std::launch::deferred, function);
@@ -316,6 +380,11 @@ class TmxDeferredWorkExecutor: public TmxTaskExecutor {
 static TmxDeferredWorkExecutor _executor;
 
 common::TmxError TmxChannel::execute(common::TmxTypeDescriptor const &functor, channels::_msg_type const &msg) {
+    return this->execute(functor, msg, nullptr);
+}
+
+common::TmxError TmxChannel::execute(common::TmxTypeDescriptor const &functor, channels::_msg_type const &msg,
+                                     std::shared_ptr<const message::TmxMessage> shared) {
     if (!functor)
         return { EINVAL, "Invalid functor " + functor.get_type_name() };
 
@@ -323,31 +392,29 @@ common::TmxError TmxChannel::execute(common::TmxTypeDescriptor const &functor, c
     auto &ctx = this->get_context();
     auto exec = ctx.get_executor();
 
-    if (ctx.count(channels::_workers)) {
-        auto workers = types::as<std::vector<channels::worker_t> >(ctx.at(channels::_workers));
-        if (workers && workers->size()) {
-            // Default to the first
-            auto ptr = &(workers->front());
-            if (ctx.count(channels::_group)) {
-                auto group = types::as<channels::group_t>(ctx.at(channels::_group));
-                if (group)
-                    ptr = &(group->assign(workers->begin(), workers->end(),
-                                          msg.get_assignment_group(), msg.get_assignment_id()));
-            }
+    auto workers = this->_plan->workers;
+    if (workers) {
+        // Default to the first
+        auto ptr = &(workers->front());
+        if (this->_plan->group)
+            ptr = &(this->_plan->group->assign(workers->begin(), workers->end(),
+                                               msg.get_assignment_group(), msg.get_assignment_id()));
 
-            TLOG(DEBUG3) << ctx.get_id() << ": Assigning " << functor.get_type_name()
-                         << " execution to worker " << ptr->get_id();
+        TLOG(DEBUG3) << this->_plan->id << ": Assigning " << functor.get_type_name()
+                     << " execution to worker " << ptr->get_id();
 
-            exec.reset(ptr, [](auto *) { });
-        }
+        exec.reset(ptr, [](auto *) { });
     }
 
     if (exec) {
-        auto future = exec->schedule([this, functor, &ctx, copy = message::TmxMessage(msg)]() -> void {
-            TLOG(DEBUG3) << ctx.get_id() << ": Running " << functor.get_type_name()
+        // The worker needs its own reference to the message, which is only copied if not already shared
+        if (!shared)
+            shared = std::make_shared<const message::TmxMessage>(msg);
+
+        auto future = exec->schedule([this, functor, shared = std::move(shared)]() -> void {
+            TLOG(DEBUG3) << this->_plan->id << ": Running " << functor.get_type_name()
                          << " execution within thread " << std::this_thread::get_id();
-            const message::TmxMessage &msg = copy;
-            common::dispatch(functor, channels::_channel_id_type(this->get_context().get_id().data()), msg);
+            this->dispatch(functor, *shared);
         });
 
         exec->exec_callback(future);
@@ -355,7 +422,34 @@ common::TmxError TmxChannel::execute(common::TmxTypeDescriptor const &functor, c
     }
 
     // No asynchronous context to run in, so use current execution
-    return common::dispatch(functor, channels::_channel_id_type(this->get_context().get_id().data()), msg);
+    return this->dispatch(functor, msg);
+}
+
+common::TmxError TmxChannel::dispatch(common::TmxTypeDescriptor const &functor, channels::_msg_type const &msg) {
+    auto &plan = *(this->_plan);
+
+    // The channel messaging operations already have everything they need in the plan
+    if (functor.get_typeid() == typeid(channels::TmxChannelOutgoingMessage)) {
+        this->connect();
+
+        if (!plan.broker)
+            return { EINVAL, "Unable to find messaging broker for channel " + plan.id };
+
+        plan.broker->publish(this->get_context(), msg);
+        return { };
+    }
+
+    if (functor.get_typeid() == typeid(channels::TmxChannelIncomingMessage)) {
+        this->connect();
+
+        if (!plan.plugin)
+            return { EINVAL, "Unable to find plugin for channel " + plan.id };
+
+        plan.plugin->on_message_received(msg);
+        return { };
+    }
+
+    return common::dispatch(functor, channels::_channel_id_type(plan.id), msg);
 }
 
 } /* End namespace plugin */
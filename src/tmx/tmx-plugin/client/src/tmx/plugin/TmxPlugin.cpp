@@ -24,7 +24,6 @@
 #include <cstdlib>
 #include <chrono>
 #include <fstream>
-#include <regex>
 #include <thread>
 
 using namespace tmx::common;
@@ -84,17 +83,7 @@ void TmxPlugin::broadcast(message::TmxMessage const &msg) {
     for (auto channel: this->_channels) {
         if (channel) {
             // Check to see if this channel should auto publish messages
-            const message::TmxData params { channel->get_context().get_parameters() };
-
-            bool autoPub = true;
-            if (!params["auto-publish"].is_empty())
-                autoPub = params["auto-publish"];
-
-            std::string topicRegex { ".*" };
-            if (params["topics"])
-                topicRegex = params["topics"].to_string();
-
-            if (autoPub && std::regex_search(msg.get_topic().c_str(), std::regex(topicRegex))) {
+            if (channel->is_auto_publish(msg)) {
                 TLOG(DEBUG1) << "Broadcasting: " << msg.to_string()
                              << " to channel " << channel->get_context().get_id();
                 channel->write_message(msg);
@@ -105,6 +94,20 @@ void TmxPlugin::broadcast(message::TmxMessage const &msg) {
     TLOG(DEBUG3) << "Exit " << TMX_PRETTY_FUNCTION;
 }
 
+void TmxPlugin::broadcast(std::shared_ptr<const message::TmxMessage> const &msg) {
+    TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION;
+
+    for (auto channel: this->_channels) {
+        if (msg && channel && channel->is_auto_publish(*msg)) {
+            TLOG(DEBUG1) << "Broadcasting: " << msg->to_string()
+                         << " to channel " << channel->get_context().get_id();
+            channel->write_message(msg);
+        }
+    }
+
+    TLOG(DEBUG3) << "Exit " << TMX_PRETTY_FUNCTION;
+}
+
 void TmxPlugin::broadcast(Any const &data, const_string topic, const_string source, const_string encoding) {
     message::codec::TmxCodec codec;
     TmxError ret = codec.encode(data, encoding);
@@ -253,6 +256,9 @@ TmxError TmxPlugin::process_args(TmxRunnableArgs const &args) {
         }
     }
 
+    // The defaults were written straight to the cache, so make them visible to the readers
+    this->publish_config();
+
     try {
         store(boost::program_options::command_line_parser(args).options(desc).run(), opts);
         boost::program_options::notify(opts);
@@ -28,11 +28,29 @@ void TmxPlugin::set_config(const_string key, types::Any const &value, std::mutex
     TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION << " for " << key << " with " << value;
 
     if (lock) lock->lock();
+    std::unique_lock<std::mutex> _lock { this->_configLock };
+
     // Save old value
     message::TmxData old { const_cast<types::Any const &>(this->_config[key].get_container()) };
 
     // Assign new value
     this->_config[key] = value;
+
+    // Publish a new snapshot for the readers, then refresh anything bound to the changed value
+    const TmxData current { const_cast<types::Any const &>(value) };
+    if (old.to_string() != current.to_string()) {
+        auto snapshot = std::make_shared<TmxData const>(const_cast<types::Any const &>(this->_config.get_container()));
+        std::atomic_store(&this->_configSnapshot, std::shared_ptr<TmxData const>(snapshot));
+
+        for (auto const &binding: this->_configBindings) {
+            if (binding.first.empty())
+                binding.second(*snapshot);
+            else if (binding.first == key)
+                binding.second(current);
+        }
+    }
+
+    _lock.unlock();
     if (lock) lock->unlock();
 
     // When we set the config programmatically, we should call the registered handlers
@@ -49,20 +67,59 @@ void TmxPlugin::set_config(common::const_string key, const char *str, std::mutex
     this->set_config(key, std::string(str), mutex);
 }
 
-message::TmxData TmxPlugin::get_config(const_string key, std::mutex *lock) const {
+message::TmxData TmxPlugin::get_config(const_string key, std::mutex *) const {
     TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION;
 
     message::TmxData _ret;
 
-    if (lock) lock->lock();
-    const TmxData _ro { this->_config };
-    if (!_ro[key].is_empty())
-        _ret = _ro[key].get_container();
-    if (lock) lock->unlock();
+    // The snapshot is never modified, so no lock is needed
+    auto snapshot = this->get_config_snapshot();
+    const auto _val = (*snapshot)[key];
+    if (!_val.is_empty())
+        _ret = _val.get_container();
 
     return std::move(_ret);
 }
 
+std::shared_ptr<message::TmxData const> TmxPlugin::get_config_snapshot() const noexcept {
+    return std::atomic_load(&this->_configSnapshot);
+}
+
+void TmxPlugin::publish_config() {
+    std::lock_guard<std::mutex> _lock { this->_configLock };
+
+    auto old = this->get_config_snapshot();
+    auto snapshot = std::make_shared<TmxData const>(const_cast<types::Any const &>(this->_config.get_container()));
+    if (old->to_string() == snapshot->to_string())
+        return;
+
+    std::atomic_store(&this->_configSnapshot, std::shared_ptr<TmxData const>(snapshot));
+
+    for (auto const &binding: this->_configBindings) {
+        if (binding.first.empty()) {
+            binding.second(*snapshot);
+        } else {
+            const auto current = (*snapshot)[binding.first];
+            if ((*old)[binding.first].to_string() != current.to_string())
+                binding.second(current);
+        }
+    }
+}
+
+void TmxPlugin::bind_config(const_string key, std::function<void(message::TmxData const &)> fn) {
+    if (!fn) return;
+
+    std::lock_guard<std::mutex> _lock { this->_configLock };
+
+    auto snapshot = this->get_config_snapshot();
+    if (key.empty())
+        fn(*snapshot);
+    else
+        fn((*snapshot)[key]);
+
+    this->_configBindings.emplace_back(std::string(key), std::move(fn));
+}
+
 struct on_channel_update { };
 
 template <>
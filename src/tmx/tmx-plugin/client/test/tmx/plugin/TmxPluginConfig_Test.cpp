@@ -0,0 +1,158 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxPluginConfig_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <tmx/plugin/TmxPlugin.hpp>
+
+#include <atomic>
+#include <string>
+
+using namespace tmx::common;
+using namespace tmx::message;
+using namespace tmx::plugin;
+
+/*!
+ * @brief A plugin with a couple of config parameters, which is never started
+ */
+class TestConfigPlugin: public TmxPlugin {
+public:
+    TmxTypeDescriptor get_descriptor() const noexcept override {
+        static auto const &descr = TmxPlugin::get_descriptor();
+        return { descr.get_instance(), typeid(*this), type_fqname(*this).data() };
+    }
+
+    types::Array<types::Any> get_config_description() const noexcept override {
+        TmxData cfg;
+        cfg[0]["key"] = std::string("rate");
+        cfg[0]["default"] = (std::uint64_t)5;
+        cfg[0]["description"] = std::string("The rate.");
+        cfg[1]["key"] = std::string("name");
+        cfg[1]["default"] = std::string("test");
+        cfg[1]["description"] = std::string("The name.");
+
+        return cfg.to_array();
+    }
+
+    /*!
+     * @brief Load the defaults the same way as the plugin executable
+     *
+     * There is no manifest file, so the arguments are rejected after the
+     * defaults have been loaded.
+     */
+    TmxError load_defaults() {
+        return this->process_args({ "test", "--manifest", "/nonexistent/manifest.json" });
+    }
+};
+
+struct TestConfigView {
+    std::uint64_t rate = 0;
+    std::string name;
+};
+
+static TestConfigView make_view(TmxData const &config) {
+    TestConfigView view;
+    if (!config["rate"].is_empty())
+        view.rate = config["rate"];
+    view.name = config["name"].to_string();
+    return view;
+}
+
+BOOST_AUTO_TEST_SUITE( tmx_plugin_config_test_suite )
+
+BOOST_AUTO_TEST_CASE( defaults_are_published ) {
+    TestConfigPlugin plugin;
+
+    std::atomic<std::uint64_t> rate { 0 };
+    int rateCalls = 0;
+    TmxPluginConfigView<TestConfigView> view;
+
+    plugin.bind_config("rate", rate);
+    plugin.bind_config("rate", [&rateCalls](TmxData const &) { rateCalls++; });
+    plugin.bind_config<TestConfigView>(view, make_view);
+
+    // Binding invokes the function once with the current, empty value
+    BOOST_CHECK_EQUAL(rateCalls, 1);
+    BOOST_CHECK_EQUAL(rate.load(), 0u);
+
+    BOOST_CHECK_EQUAL(plugin.load_defaults().get_code(), -2);
+
+    auto snapshot = plugin.get_config_snapshot();
+    BOOST_CHECK_EQUAL((std::uint64_t)(*snapshot)["rate"], 5u);
+    BOOST_CHECK_EQUAL((*snapshot)["name"].to_string(), "test");
+    BOOST_CHECK_EQUAL((std::uint64_t)plugin.get_config("rate"), 5u);
+
+    BOOST_CHECK_EQUAL(rate.load(), 5u);
+    BOOST_CHECK_EQUAL(rateCalls, 2);
+    BOOST_CHECK_EQUAL(view.get()->rate, 5u);
+    BOOST_CHECK_EQUAL(view.get()->name, "test");
+
+    // Loading the same defaults again changes nothing
+    plugin.load_defaults();
+    BOOST_CHECK_EQUAL(rateCalls, 2);
+    BOOST_CHECK(plugin.get_config_snapshot() == snapshot);
+}
+
+BOOST_AUTO_TEST_CASE( bindings_only_on_change ) {
+    TestConfigPlugin plugin;
+    plugin.load_defaults();
+
+    int rateCalls = 0;
+    int nameCalls = 0;
+    int allCalls = 0;
+    plugin.bind_config("rate", [&rateCalls](TmxData const &) { rateCalls++; });
+    plugin.bind_config("name", [&nameCalls](TmxData const &) { nameCalls++; });
+    plugin.bind_config("", [&allCalls](TmxData const &) { allCalls++; });
+
+    auto snapshot = plugin.get_config_snapshot();
+
+    // Setting the same value does not publish anything
+    plugin.set_config("rate", (std::uint64_t)5);
+    BOOST_CHECK_EQUAL(rateCalls, 1);
+    BOOST_CHECK_EQUAL(nameCalls, 1);
+    BOOST_CHECK_EQUAL(allCalls, 1);
+    BOOST_CHECK(plugin.get_config_snapshot() == snapshot);
+
+    // Only the changed key and the whole configuration are invoked
+    plugin.set_config("rate", (std::uint64_t)10);
+    BOOST_CHECK_EQUAL(rateCalls, 2);
+    BOOST_CHECK_EQUAL(nameCalls, 1);
+    BOOST_CHECK_EQUAL(allCalls, 2);
+
+    // The old snapshot is never modified
+    BOOST_CHECK(plugin.get_config_snapshot() != snapshot);
+    BOOST_CHECK_EQUAL((std::uint64_t)(*snapshot)["rate"], 5u);
+    BOOST_CHECK_EQUAL((std::uint64_t)(*plugin.get_config_snapshot())["rate"], 10u);
+}
+
+BOOST_AUTO_TEST_CASE( view_is_rebuilt ) {
+    TestConfigPlugin plugin;
+    plugin.load_defaults();
+
+    TmxPluginConfigView<TestConfigView> view;
+    plugin.bind_config<TestConfigView>(view, make_view);
+
+    auto before = view.get();
+    BOOST_CHECK_EQUAL(before->rate, 5u);
+    BOOST_CHECK_EQUAL(before->name, "test");
+
+    plugin.set_config("name", std::string("changed"));
+
+    auto after = view.get();
+    BOOST_CHECK(after != before);
+    BOOST_CHECK_EQUAL(after->rate, 5u);
+    BOOST_CHECK_EQUAL(after->name, "changed");
+
+    // A reader holding the old view still sees the old values
+    BOOST_CHECK_EQUAL(before->name, "test");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,97 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file XerJsonWriter.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#ifndef INCLUDE_TMX_PLUGIN_UTILS_XERJSONWRITER_HPP_
+#define INCLUDE_TMX_PLUGIN_UTILS_XERJSONWRITER_HPP_
+
+#include <tmx/message/j2735/202007/asn_application.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+
+/*!
+ * @brief Writes the JSON for a decoded ASN.1 structure as if it were read from XER
+ *
+ * The legacy TMX tools converted a decoded J2735 message to JSON by
+ * printing it as XER, reading that XML into a Boost property tree,
+ * repairing the tree and then writing the tree back out as JSON. This
+ * class produces the same JSON directly from the decoded structure in
+ * one pass over the asn1c type descriptors, with the repairs applied
+ * as each node is written.
+ *
+ * As in the property tree, every value is written as a string, and a
+ * list of elements is written as an object with repeated keys unless it
+ * is repaired into an array.
+ *
+ * Each repair applies to the nodes at a path of keys separated by '.',
+ * where an empty key matches the elements of a repaired array. As in
+ * the legacy code, the array repairs are applied first, and only the
+ * first of any nodes with the same key at the end of the path is repaired.
+ */
+class XerJsonWriter {
+public:
+    enum Repair: std::uint8_t {
+        /*!
+         * @brief Write the children of the node as a JSON array, dropping their keys
+         */
+        FixArrays = 0x01,
+        /*!
+         * @brief Replace the children of the node with their own children
+         */
+        DeleteNodes = 0x02,
+        /*!
+         * @brief Replace the node with the key of its first child
+         */
+        FlattenNode = 0x04
+    };
+
+    /*!
+     * @brief Add a repair for the nodes at the given path
+     *
+     * @param[in] repair The repair to make
+     * @param[in] path The '.' separated path from the root node
+     */
+    void add_repair(Repair repair, std::string const &path);
+
+    /*!
+     * @brief Write the JSON for the ASN.1 structure
+     *
+     * The structure is always written as a JSON object, followed by a
+     * new line, which matches the Boost property tree JSON writer.
+     *
+     * @param[out] out The string to append the JSON to
+     * @param[in] td The ASN.1 type descriptor
+     * @param[in] sptr A pointer to the ASN.1 structure
+     * @return True if the JSON was written, or false if the structure could not be encoded
+     */
+    bool write(std::string &out, asn_TYPE_descriptor_t const &td, void const *sptr) const;
+
+private:
+    struct RepairNode {
+        std::map<std::string, std::unique_ptr<RepairNode>, std::less<> > children;
+        std::uint8_t repairs = 0;
+    };
+
+    class Writer;
+
+    RepairNode _repairs;
+};
+
+}}} // namespace tmx::plugin::utils
+
+#endif /* INCLUDE_TMX_PLUGIN_UTILS_XERJSONWRITER_HPP_ */
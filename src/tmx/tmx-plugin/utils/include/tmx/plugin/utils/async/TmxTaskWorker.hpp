@@ -14,6 +14,7 @@
 #include <atomic>
 #include <boost/asio.hpp>
 #include <chrono>
+#include <future>
 #include <thread>
 
 namespace tmx {
@@ -76,23 +77,36 @@ private:
 
 template <>
 inline void TmxTaskWorker<boost::asio::io_context>::start() {
-    this->_future = std::async([this]() {
+    std::promise<void> started;
+    auto ready = started.get_future();
+
+    this->_future = std::async(std::launch::async, [this, &started]() {
         TmxRunnable::start();
         this->_id = std::this_thread::get_id();
 
         TLOG(NOTICE) << this->_id << ": " << common::type_short_name(*this) << " has started";
+        started.set_value();
 
+        // The work guard keeps the context running while idle, so each posted
+        // task is executed as soon as the thread wakes up. The run() call only
+        // returns when the context is stopped, or if a task throws an exception.
         while (this->is_running()) {
-            // Give a chance for more scheduling to occur
-            std::this_thread::yield();
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-
-            auto cnt = this->get_context().run();
-            this->get_context().reset();
+            try {
+                this->get_context().run();
+            } catch (std::exception &ex) {
+                TLOG(ERR) << this->_id << ": " << common::type_short_name(*this)
+                          << " task failed: " << ex.what();
+            }
+
+            if (this->is_running() && this->get_context().stopped())
+                this->get_context().restart();
         }
 
         TLOG(NOTICE) << this->_id << ": " << common::type_short_name(*this) << " has terminated";
     }).share();
+
+    // Wait for the thread to be ready for work
+    ready.wait();
 }
 
 template <>
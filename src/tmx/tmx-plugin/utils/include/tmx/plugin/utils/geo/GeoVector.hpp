@@ -50,6 +50,8 @@ public:
 	static GeoVector Unit(GeoVector vec);
 	static GeoVector Times(GeoVector vec, double value);
 	static double DistanceInMeters(GeoVector vec1, GeoVector vec2);
+	static double CrossTrackDistanceInMeters(GeoVector vec, GeoVector greatCircle);
+	static bool IsBetween(GeoVector vec, GeoVector pathV1, GeoVector pathV2);
 
 	//GPS coordinate interface
 	static double DistanceInMeters(WGS84Point point1, WGS84Point point2);
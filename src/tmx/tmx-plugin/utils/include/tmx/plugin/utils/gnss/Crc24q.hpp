@@ -0,0 +1,63 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file Crc24q.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#ifndef INCLUDE_TMX_PLUGIN_UTILS_GNSS_CRC24Q_HPP_
+#define INCLUDE_TMX_PLUGIN_UTILS_GNSS_CRC24Q_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace gnss {
+
+/*!
+ * @brief A 24-bit cyclic redundancy check, in the low bits
+ */
+typedef std::uint32_t crc24_t;
+
+/*!
+ * @brief The CRC-24Q generator polynomial, without the x^24 term
+ */
+static constexpr crc24_t CRC24Q_POLY = 0x864CFB;
+
+/*!
+ * @brief Calculate the CRC-24Q one byte at a time
+ *
+ * This is the classic table driven calculation, and is kept mainly as
+ * a reference.
+ *
+ * @param[in] data The bytes to check
+ * @param[in] length The number of bytes
+ * @param[in] crc The CRC of any previous bytes, or 0 to start
+ * @return The CRC-24Q of the bytes
+ */
+crc24_t crc24q_bytewise(void const *data, std::size_t length, crc24_t crc = 0) noexcept;
+
+/*!
+ * @brief Calculate the CRC-24Q, as used by RTCM 3 and SBAS
+ *
+ * This uses the slice-by-8 method, which looks up 8 bytes at a time
+ * in separate tables, so the lookups do not depend on each other.
+ * The CRC can be calculated in pieces, by passing the CRC of the
+ * previous bytes in.
+ *
+ * @param[in] data The bytes to check
+ * @param[in] length The number of bytes
+ * @param[in] crc The CRC of any previous bytes, or 0 to start
+ * @return The CRC-24Q of the bytes
+ */
+crc24_t crc24q(void const *data, std::size_t length, crc24_t crc = 0) noexcept;
+
+}}}} // namespace tmx::plugin::utils::gnss
+
+#endif /* INCLUDE_TMX_PLUGIN_UTILS_GNSS_CRC24Q_HPP_ */
@@ -0,0 +1,113 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file Rtcm3FrameParser.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#ifndef INCLUDE_TMX_PLUGIN_UTILS_GNSS_RTCM3FRAMEPARSER_HPP_
+#define INCLUDE_TMX_PLUGIN_UTILS_GNSS_RTCM3FRAMEPARSER_HPP_
+
+#include <tmx/common/platform/types/bytes.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace gnss {
+
+/*!
+ * @brief Finds the RTCM 3 frames in a stream of bytes
+ *
+ * An RTCM 3 frame is the 0xD3 preamble, 6 reserved zero bits and a 10 bit
+ * length, then that many bytes of message, then the CRC-24Q of all of it.
+ * The stream, such as from an NTRIP caster, may be read in any size pieces,
+ * so a frame can be split across reads.
+ *
+ * Each frame that is entirely within a piece is checked and handed back as a
+ * view into that piece, without being copied. Only the start of a frame at
+ * the end of a piece is held, in a fixed buffer, until the rest of it is read.
+ * Anything that does not check out, including a false preamble in the middle
+ * of the data, is skipped one byte at a time until the next good frame.
+ *
+ * A parser is not thread safe, and should be used for only one stream.
+ */
+class Rtcm3FrameParser {
+public:
+    static constexpr std::uint8_t PREAMBLE = 0xD3;
+    static constexpr std::size_t HEADER_SIZE = 3;
+    static constexpr std::size_t CRC_SIZE = 3;
+    static constexpr std::size_t MAX_MESSAGE_SIZE = 1023;
+    static constexpr std::size_t MAX_FRAME_SIZE = HEADER_SIZE + MAX_MESSAGE_SIZE + CRC_SIZE;
+
+    /*!
+     * @brief The handler for each good frame, including the header and CRC
+     *
+     * The bytes are only good until the handler returns.
+     */
+    typedef std::function<void(common::byte_sequence const &)> frame_handler;
+
+    /*!
+     * @brief Read the next piece of the stream
+     *
+     * @param[in] bytes The bytes read
+     * @param[in] handler The handler for each good frame that is finished
+     */
+    void parse(common::byte_sequence const &bytes, frame_handler const &handler);
+
+    /*!
+     * @brief Drop any partial frame, such as when the stream reconnects
+     */
+    void reset() noexcept;
+
+    /*!
+     * @return The number of good frames found
+     */
+    std::uint64_t get_frame_count() const noexcept;
+
+    /*!
+     * @return The number of bytes skipped because they were not in a good frame
+     */
+    std::uint64_t get_discarded_bytes() const noexcept;
+
+    /*!
+     * @return The number of frames that failed the CRC check
+     */
+    std::uint64_t get_crc_errors() const noexcept;
+
+    /*!
+     * @return The number of bytes held for a frame that is not finished
+     */
+    std::size_t get_pending_bytes() const noexcept;
+
+    /*!
+     * @param[in] frame The frame bytes
+     * @return The RTCM 3 message number of the frame, or 0 if it is too short
+     */
+    static std::uint16_t get_message_number(common::byte_sequence const &frame) noexcept;
+
+private:
+    void scan(common::byte_t const *data, std::size_t length, frame_handler const &handler);
+    void hold(common::byte_t const *data, std::size_t length) noexcept;
+    bool check(common::byte_t const *data, std::size_t length, frame_handler const &handler);
+    void resync(frame_handler const &handler);
+
+    std::array<common::byte_t, MAX_FRAME_SIZE> _pending;
+    std::size_t _pendingLength = 0;
+
+    std::uint64_t _frames = 0;
+    std::uint64_t _discarded = 0;
+    std::uint64_t _crcErrors = 0;
+};
+
+}}}} // namespace tmx::plugin::utils::gnss
+
+#endif /* INCLUDE_TMX_PLUGIN_UTILS_GNSS_RTCM3FRAMEPARSER_HPP_ */
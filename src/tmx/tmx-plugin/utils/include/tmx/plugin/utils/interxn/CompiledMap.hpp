@@ -0,0 +1,185 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file CompiledMap.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#ifndef INCLUDE_TMX_PLUGIN_UTILS_INTERXN_COMPILEDMAP_HPP_
+#define INCLUDE_TMX_PLUGIN_UTILS_INTERXN_COMPILEDMAP_HPP_
+
+#include <tmx/plugin/utils/geo/GeoVector.hpp>
+#include <tmx/plugin/utils/interxn/Intersection.hpp>
+#include <tmx/plugin/utils/interxn/MapSupport.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace interxn {
+
+/*!
+ * @brief An immutable, pre-computed form of a single MAP revision
+ *
+ * Parsing a MAP message into an Intersection is expensive, and the
+ * MapSupport lane matching walks every node of every lane on each
+ * call. This class does that parsing exactly once, and then flattens
+ * the lanes into contiguous segments with their n-vectors, great circle
+ * normals and cumulative distances from the stop bar already computed.
+ * A uniform grid over the segments, in a local plane at the reference
+ * point, limits each lookup to the segments near the location.
+ *
+ * The lookups return the same results as the MapSupport functions of
+ * the same name, but since the object is never modified once built, it
+ * can be shared between threads without any locking. A new instance
+ * should only be built when the MAP intersection or revision changes.
+ */
+class CompiledMap {
+public:
+    /*!
+     * @brief Compile the given MAP message
+     *
+     * @param[in] msg The MAP message to compile
+     */
+    explicit CompiledMap(std::shared_ptr<MapData> msg);
+
+    CompiledMap(CompiledMap const &) = delete;
+    CompiledMap &operator=(CompiledMap const &) = delete;
+
+    /*!
+     * @return True if the MAP message was successfully compiled
+     */
+    bool IsLoaded() const noexcept;
+
+    /*!
+     * @return The intersection identifier of the compiled MAP, or -1 if not loaded
+     */
+    int GetMapId() const noexcept;
+
+    /*!
+     * @return The message revision of the compiled MAP, or -1 if not loaded
+     */
+    int GetMapRevision() const noexcept;
+
+    /*!
+     * @return The MAP message that was compiled
+     */
+    std::shared_ptr<MapData> const &GetMapMessage() const noexcept;
+
+    /*!
+     * @return The parsed intersection for the compiled MAP
+     */
+    Intersection const &GetIntersection() const noexcept;
+
+    /*!
+     * @brief Find the vehicle lane for the point
+     *
+     * @see MapSupport::FindVehicleLaneForPoint(geo::WGS84Point, ParsedMap &)
+     * @param[in] point Current location point to evaluate
+     * @param[in] irExtent The percent of the intersection radius to extend
+     * @return The match result
+     */
+    MapMatchResult FindVehicleLaneForPoint(geo::WGS84Point point, double irExtent = 0.0) const;
+
+    /*!
+     * @brief Find the vehicle lane for the point, using heading to select the lane direction
+     *
+     * @see MapSupport::FindVehicleLaneForPoint(geo::WGS84Point, double, ParsedMap &)
+     * @param[in] point Current location point to evaluate
+     * @param[in] heading The vehicle heading, in degrees
+     * @param[in] irExtent The percent of the intersection radius to extend
+     * @return The match result
+     */
+    MapMatchResult FindApproachLaneForPoint(geo::WGS84Point point, double heading, double irExtent = 0.0) const;
+
+    /*!
+     * @see MapSupport::GetSignalGroupForVehicleLane(int, ParsedMap &)
+     * @param[in] laneId The vehicle lane identifier
+     * @return The signal group identifier for the lane, or -1 if not found
+     */
+    int GetSignalGroupForVehicleLane(int laneId) const noexcept;
+
+    /*!
+     * @brief Get the distance along the lane nodes to the point
+     *
+     * The distance is summed from the first node of the lane, through
+     * the nodes prior to the matched segment, and then to the point.
+     *
+     * @param[in] laneId The lane identifier
+     * @param[in] laneSegment The one-based lane segment that was matched
+     * @param[in] point The location point
+     * @return The distance in meters, or -1 if the lane is not known
+     */
+    double GetDistanceToCrossing(int laneId, int laneSegment, geo::WGS84Point point) const;
+
+private:
+    struct Segment {
+        std::uint32_t Lane;
+        int LaneSegment;
+        geo::WGS84Point P1;
+        geo::WGS84Point P2;
+        geo::GeoVector V1;
+        geo::GeoVector V2;
+        geo::GeoVector Normal;
+        geo::GeoVector ReverseNormal;
+        double LengthMeters;
+        double StopBarDistanceMeters;
+    };
+
+    struct Lane {
+        int LaneNumber;
+        double LaneWidthMeters;
+        bool IsEgress;
+        bool IsVehicle;
+        double StopBarElevation;
+        std::uint32_t FirstSegment;
+        std::uint32_t SegmentCount;
+        std::vector<geo::WGS84Point> CrossingNodes;
+        std::vector<double> CrossingDistances;
+    };
+
+    void Compile();
+    void BuildIndex();
+
+    double ToX(geo::WGS84Point const &) const noexcept;
+    double ToY(geo::WGS84Point const &) const noexcept;
+    bool GetCell(geo::WGS84Point const &, std::size_t &) const noexcept;
+
+    bool IsPointOnMap(geo::WGS84Point const &) const noexcept;
+    bool IsInCenterOfIntersection(geo::WGS84Point const &, double) const;
+
+    std::shared_ptr<MapData> _msg;
+    Intersection _intersection;
+    int _mapId = -1;
+    int _mapRevision = -1;
+    bool _loaded = false;
+
+    std::vector<Lane> _lanes;
+    std::vector<Segment> _segments;
+    std::unordered_map<int, std::uint32_t> _laneIndex;
+    std::unordered_map<int, int> _signalGroups;
+    double _centerRadius = 0.0;
+
+    // The grid index, stored as offsets into a flat list of segment indices per cell
+    double _metersPerLat = 0.0;
+    double _metersPerLong = 0.0;
+    double _gridMinX = 0.0;
+    double _gridMinY = 0.0;
+    double _cellSize = 1.0;
+    std::size_t _gridCols = 0;
+    std::size_t _gridRows = 0;
+    std::vector<std::uint32_t> _cellStart;
+    std::vector<std::uint32_t> _cellSegments;
+};
+
+}}}} // namespace tmx::plugin::utils::interxn
+
+#endif /* INCLUDE_TMX_PLUGIN_UTILS_INTERXN_COMPILEDMAP_HPP_ */
@@ -113,7 +113,7 @@ public:
 	/**
 	 * Compares the Intersection id of the passed in spat message to the object's active map intersection id.
 	 */
-	bool DoesSpatMatchMap(SPAT &msg);
+	bool DoesSpatMatchMap(SPAT &msg) const;
 	/**
 	 * Some applications do certain actions for all cases except a red light. This simplified
 	 * call examines the signal phase for the signalGroup provided and returns true for red
@@ -130,7 +130,7 @@ public:
 	double TimeRemainingForLocation_Sec(double lat, double lon);
 	double TimeRemainingForSignalGroup(int signalGroupId);
 
-	bool IsSignalForGroupRedLight(SPAT &msg, int signalGroup);
+	bool IsSignalForGroupRedLight(SPAT &msg, int signalGroup) const;
 
 	//bool LoadMap(ParsedMap& parsedMap);
 	/**
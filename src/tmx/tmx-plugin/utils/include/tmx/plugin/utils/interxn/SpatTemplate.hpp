@@ -0,0 +1,127 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file SpatTemplate.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#ifndef INCLUDE_TMX_PLUGIN_UTILS_INTERXN_SPATTEMPLATE_HPP_
+#define INCLUDE_TMX_PLUGIN_UTILS_INTERXN_SPATTEMPLATE_HPP_
+
+#include <tmx/message/j2735/202007/MessageFrame.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace interxn {
+
+/*!
+ * @brief A pre-encoded UPER SPAT message with patchable time and signal states
+ *
+ * A SPAT broadcast usually only changes the minute of the year, the
+ * millisecond time stamp, the intersection status and the movement
+ * event states from one message to the next. All of those are fixed
+ * width fields in UPER, so this class encodes the whole message frame
+ * once and locates the bits for each of those fields. Each new value
+ * is then written directly into the encoded bytes, which is identical
+ * to what a full encoding of the message frame would produce.
+ *
+ * The fields are located by encoding the message with the lowest and
+ * highest values allowed for each field and comparing the bits. A new
+ * template must be built whenever anything else in the message changes,
+ * such as the intersection name or signal groups.
+ */
+class SpatTemplate {
+public:
+    /*!
+     * @brief Build a template from the given SPAT message frame
+     *
+     * The frame is not modified, and is not needed after construction.
+     *
+     * @param[in] frame The SPAT message frame to encode
+     */
+    explicit SpatTemplate(MessageFrame const &frame);
+
+    /*!
+     * @return True if the message frame was encoded and every variable field was located
+     */
+    bool IsLoaded() const noexcept;
+
+    /*!
+     * @param[in] intersection The intersection index
+     * @param[in] value The minute of the year
+     * @return True if the value was written, or false if not in the template or out of range
+     */
+    bool SetMinuteOfTheYear(std::size_t intersection, MinuteOfTheYear_t value) noexcept;
+
+    /*!
+     * @param[in] intersection The intersection index
+     * @param[in] value The millisecond of the minute
+     * @return True if the value was written, or false if not in the template or out of range
+     */
+    bool SetTimeStamp(std::size_t intersection, DSecond_t value) noexcept;
+
+    /*!
+     * @brief Set the intersection status bits
+     *
+     * The value holds the 16 status bits in order, so the first byte
+     * of the bit string is the most significant byte.
+     *
+     * @param[in] intersection The intersection index
+     * @param[in] value The status bits
+     * @return True if the value was written, or false if not in the template
+     */
+    bool SetStatus(std::size_t intersection, std::uint16_t value) noexcept;
+
+    /*!
+     * @param[in] intersection The intersection index
+     * @param[in] movement The movement state index within the intersection
+     * @param[in] event The movement event index within the movement state
+     * @param[in] value The event state
+     * @return True if the value was written, or false if not in the template or out of range
+     */
+    bool SetEventState(std::size_t intersection, std::size_t movement, std::size_t event,
+                       MovementPhaseState_t value) noexcept;
+
+    /*!
+     * @return The UPER encoded message frame, with all the values written so far
+     */
+    std::basic_string<std::uint8_t> const &GetBytes() const noexcept;
+
+private:
+    // The location of a field in the encoded bits, which is written as an offset from the lower bound
+    struct Patch {
+        std::size_t Offset = 0;
+        std::size_t Width = 0;
+        long LowerBound = 0;
+        long UpperBound = 0;
+    };
+
+    struct IntersectionPatches {
+        Patch MinuteOfTheYear;
+        Patch TimeStamp;
+        Patch Status;
+        std::vector<std::vector<Patch> > EventStates;
+    };
+
+    template <typename _Setter>
+    bool Locate(MessageFrame *, _Setter, long, long, long, Patch &);
+
+    bool Write(Patch const &, long) noexcept;
+
+    std::basic_string<std::uint8_t> _bytes;
+    std::vector<IntersectionPatches> _intersections;
+    bool _loaded = false;
+};
+
+}}}} // namespace tmx::plugin::utils::interxn
+
+#endif /* INCLUDE_TMX_PLUGIN_UTILS_INTERXN_SPATTEMPLATE_HPP_ */
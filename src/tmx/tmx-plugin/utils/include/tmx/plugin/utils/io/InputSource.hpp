@@ -0,0 +1,195 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file InputSource.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#ifndef INCLUDE_TMX_PLUGIN_UTILS_IO_INPUTSOURCE_HPP_
+#define INCLUDE_TMX_PLUGIN_UTILS_IO_INPUTSOURCE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace io {
+
+/*!
+ * @brief The clock used to time stamp input
+ */
+typedef std::chrono::steady_clock input_clock;
+
+/*!
+ * @brief A source of input that can be waited on until it is ready
+ *
+ * Each source exposes a file descriptor that becomes readable when there
+ * is input to consume, so that any number of sources can be waited on
+ * together by an InputMonitor instead of sleeping and checking each one.
+ */
+class InputSource {
+public:
+    virtual ~InputSource() = default;
+
+    /*!
+     * @return The file descriptor that is readable when there is input, or -1 if closed
+     */
+    virtual int get_fd() const noexcept = 0;
+
+    /*!
+     * @brief Consume all the available input
+     *
+     * @param[in] when The time the input was found to be ready
+     * @return False if the source has closed, or true otherwise
+     */
+    virtual bool on_ready(input_clock::time_point when) = 0;
+};
+
+/*!
+ * @brief An input source that reads the bytes from a file descriptor, such as a serial port
+ *
+ * The descriptor is switched to non-blocking so that each time it becomes
+ * ready, all the bytes that have arrived can be read without waiting. The
+ * descriptor is not owned by the source, and is never closed by it.
+ */
+class FdInputSource: public InputSource {
+public:
+    /*!
+     * @brief The handler for bytes read from the descriptor, along with the time they were ready
+     */
+    typedef std::function<void(std::uint8_t const *, std::size_t, input_clock::time_point)> handler_type;
+
+    /*!
+     * @param[in] fd The file descriptor to read from
+     * @param[in] handler The handler for the bytes read
+     * @param[in] bufferSize The most bytes to read at once
+     */
+    FdInputSource(int fd, handler_type handler, std::size_t bufferSize = 1024);
+
+    int get_fd() const noexcept override;
+    bool on_ready(input_clock::time_point when) override;
+
+private:
+    int _fd;
+    handler_type _handler;
+    std::vector<std::uint8_t> _buffer;
+};
+
+/*!
+ * @brief An input source for a level that is sampled on another thread, such as a digital input
+ *
+ * Each time the level changes, the edge is time stamped and an event
+ * descriptor is signalled, so whoever waits on this source wakes up right
+ * away instead of at the next time it would have checked the level.
+ */
+class EdgeInputSource: public InputSource {
+public:
+    /*!
+     * @brief The handler for each edge, with the new level and the time it changed
+     */
+    typedef std::function<void(bool, input_clock::time_point)> handler_type;
+
+    /*!
+     * @param[in] handler The handler for the edges
+     * @param[in] level The initial level
+     */
+    explicit EdgeInputSource(handler_type handler, bool level = false);
+    ~EdgeInputSource();
+
+    EdgeInputSource(EdgeInputSource const &) = delete;
+    EdgeInputSource &operator=(EdgeInputSource const &) = delete;
+
+    /*!
+     * @brief Set the current level of the input
+     *
+     * This is safe to call from any thread.
+     *
+     * @param[in] level The level that was sampled
+     * @param[in] when The time the level was sampled
+     * @return True if this was an edge, or false if the level did not change
+     */
+    bool set_level(bool level, input_clock::time_point when = input_clock::now());
+
+    /*!
+     * @return The current level of the input
+     */
+    bool get_level() const noexcept;
+
+    int get_fd() const noexcept override;
+    bool on_ready(input_clock::time_point when) override;
+
+private:
+    int _fd;
+    handler_type _handler;
+    std::atomic<bool> _level;
+
+    std::mutex _lock;
+    std::vector<std::pair<bool, input_clock::time_point> > _edges;
+};
+
+/*!
+ * @brief Waits on a group of input sources at once
+ *
+ * The sources are polled together, and each one that is ready is handed
+ * the time the wait returned. The wait may also be interrupted from
+ * another thread, for example to pick up a new source or to shut down.
+ */
+class InputMonitor {
+public:
+    InputMonitor();
+    ~InputMonitor();
+
+    InputMonitor(InputMonitor const &) = delete;
+    InputMonitor &operator=(InputMonitor const &) = delete;
+
+    /*!
+     * @brief Add a source to wait on
+     *
+     * The source must outlive the monitor, or be removed first.
+     *
+     * @param[in] source The source to add
+     */
+    void add(InputSource &source);
+
+    /*!
+     * @brief Stop waiting on a source
+     *
+     * @param[in] source The source to remove
+     */
+    void remove(InputSource &source);
+
+    /*!
+     * @brief Wait for any of the sources to become ready, and consume their input
+     *
+     * A source that reports it has closed is removed from the monitor.
+     *
+     * @param[in] timeout The longest time to wait, or a negative value to wait forever
+     * @return The number of sources that were ready, which is zero on a time out or a wake up
+     */
+    std::size_t wait(std::chrono::milliseconds timeout);
+
+    /*!
+     * @brief Interrupt the current, or next, wait from another thread
+     */
+    void wake();
+
+private:
+    int _wakeFd;
+
+    std::mutex _lock;
+    std::vector<InputSource *> _sources;
+};
+
+}}}} // namespace tmx::plugin::utils::io
+
+#endif /* INCLUDE_TMX_PLUGIN_UTILS_IO_INPUTSOURCE_HPP_ */
@@ -0,0 +1,71 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file PseudoTerminal.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#ifndef INCLUDE_TMX_PLUGIN_UTILS_IO_PSEUDOTERMINAL_HPP_
+#define INCLUDE_TMX_PLUGIN_UTILS_IO_PSEUDOTERMINAL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace io {
+
+/*!
+ * @brief A pseudo-terminal that stands in for a serial device
+ *
+ * The device side may be opened by its name, and configured with termios,
+ * just like a real serial port. Whatever is written to the pseudo-terminal
+ * here arrives on the device side, which makes it possible to drive a
+ * serial reader without any hardware.
+ */
+class PseudoTerminal {
+public:
+    /*!
+     * @brief Open a new pseudo-terminal
+     *
+     * @throws std::system_error if the pseudo-terminal could not be opened
+     */
+    PseudoTerminal();
+    ~PseudoTerminal();
+
+    PseudoTerminal(PseudoTerminal const &) = delete;
+    PseudoTerminal &operator=(PseudoTerminal const &) = delete;
+
+    /*!
+     * @return The name of the device side, which may be opened in place of a serial port
+     */
+    std::string const &get_device_name() const noexcept;
+
+    /*!
+     * @return The file descriptor for this side of the pseudo-terminal
+     */
+    int get_fd() const noexcept;
+
+    /*!
+     * @brief Write the bytes to the device side
+     *
+     * @param[in] data The bytes to write
+     * @param[in] length The number of bytes to write
+     * @return The number of bytes written, or -1 on an error
+     */
+    long write(std::uint8_t const *data, std::size_t length);
+
+private:
+    int _fd;
+    std::string _deviceName;
+};
+
+}}}} // namespace tmx::plugin::utils::io
+
+#endif /* INCLUDE_TMX_PLUGIN_UTILS_IO_PSEUDOTERMINAL_HPP_ */
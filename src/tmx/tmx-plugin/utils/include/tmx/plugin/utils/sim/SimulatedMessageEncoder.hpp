@@ -0,0 +1,238 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file SimulatedMessageEncoder.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#ifndef INCLUDE_TMX_PLUGIN_UTILS_SIM_SIMULATEDMESSAGEENCODER_HPP_
+#define INCLUDE_TMX_PLUGIN_UTILS_SIM_SIMULATEDMESSAGEENCODER_HPP_
+
+#include <tmx/common/platform/types/bytes.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace sim {
+
+/*!
+ * @brief A simple bump allocator for the members of an ASN.1 structure
+ *
+ * All the memory is released at once by resetting the arena, so the
+ * structure must never be freed through its type descriptor.
+ */
+class EncodeArena {
+public:
+    /*!
+     * @param[in] size The number of bytes available
+     */
+    explicit EncodeArena(std::size_t size = 16384);
+
+    /*!
+     * @brief Allocate zeroed memory
+     *
+     * @param[in] size The number of bytes
+     * @param[in] align The alignment of the memory
+     * @return The memory, or nullptr if the arena is exhausted
+     */
+    void *allocate(std::size_t size, std::size_t align = alignof(std::max_align_t)) noexcept;
+
+    /*!
+     * @brief Allocate a zeroed object
+     *
+     * This only works for plain C structures, such as those from asn1c.
+     *
+     * @return The object, or nullptr if the arena is exhausted
+     */
+    template <typename _T>
+    _T *make() noexcept {
+        return static_cast<_T *>(this->allocate(sizeof(_T), alignof(_T)));
+    }
+
+    /*!
+     * @brief Release all the allocated memory, for re-use
+     */
+    void reset() noexcept;
+
+    /*!
+     * @return The number of bytes currently allocated
+     */
+    std::size_t get_used() const noexcept;
+
+private:
+    std::unique_ptr<std::max_align_t[]> _memory;
+    std::size_t _size;
+    std::size_t _used = 0;
+};
+
+/*!
+ * @brief The vehicle state sent by the V2X simulator
+ */
+struct SimulatedVehicle {
+    std::uint32_t id = 0;
+
+    /*!
+     * @brief The heading in degrees
+     */
+    double heading = 0.0;
+
+    /*!
+     * @brief The speed in meters per second
+     */
+    double speed = 0.0;
+
+    /*!
+     * @brief The latitude and longitude in degrees
+     */
+    double latitude = 0.0;
+    double longitude = 0.0;
+
+    /*!
+     * @brief The elevation in meters
+     */
+    double elevation = 0.0;
+
+    /*!
+     * @brief The basic vehicle role, for a signal request
+     */
+    std::uint32_t role = 0;
+};
+
+/*!
+ * @brief The vehicle basics sent by the V2X simulator
+ */
+struct SimulatedVehicleBasics {
+    std::uint32_t id = 0;
+
+    /*!
+     * @brief The speed in meters per second
+     */
+    double speed = 0.0;
+
+    std::uint8_t gearPosition = 0;
+    std::uint8_t turnSignalPosition = 0;
+    std::uint8_t flags = 0;
+
+    /*!
+     * @brief The acceleration in meters per second squared
+     */
+    double acceleration = 0.0;
+};
+
+/*!
+ * @brief Builds J2735 messages for the simulated vehicles
+ *
+ * The simulator can send hundreds of vehicles at a time, so every message
+ * is built from the same encoder state. The ASN.1 structure members come
+ * from an arena that is reset for each message, and the message is UPER
+ * encoded into the same buffer each time. The encoded bytes are returned
+ * as a view into that buffer, which is only good until the next message
+ * is encoded, and may be converted to hex text by the caller only if needed.
+ *
+ * An encoder is not thread safe, so use the one for the current thread.
+ */
+class SimulatedMessageEncoder {
+public:
+    /*!
+     * @brief The J2735 DSRC message ID of a BasicSafetyMessage
+     */
+    static constexpr long BSM_MESSAGE_ID = 20;
+
+    /*!
+     * @brief The J2735 DSRC message ID of a SignalRequestMessage
+     */
+    static constexpr long SRM_MESSAGE_ID = 29;
+
+    /*!
+     * @param[in] bufferSize The largest encoded message allowed
+     */
+    explicit SimulatedMessageEncoder(std::size_t bufferSize = 4096);
+
+    /*!
+     * @return The encoder for the current thread
+     */
+    static SimulatedMessageEncoder &get_thread_encoder();
+
+    /*!
+     * @brief Read the simulated BSM input
+     *
+     * This is, in network byte order, the 4 byte vehicle ID, then
+     * the heading times 10^6, speed times 10^3, latitude plus 180
+     * times 10^6, longitude plus 180 times 10^6 and elevation plus
+     * 500 times 10^3, each as 4 bytes.
+     *
+     * @param[in] bytes The input bytes
+     * @param[out] vehicle The vehicle state
+     * @return True if the input was the correct size
+     */
+    static bool parse_bsm(common::byte_sequence const &bytes, SimulatedVehicle &vehicle) noexcept;
+
+    /*!
+     * @brief Read the simulated SRM input
+     *
+     * This is the same as the BSM input, except the last 4 bytes
+     * are the basic vehicle role instead of the elevation.
+     *
+     * @param[in] bytes The input bytes
+     * @param[out] vehicle The vehicle state
+     * @return True if the input was the correct size
+     */
+    static bool parse_srm(common::byte_sequence const &bytes, SimulatedVehicle &vehicle) noexcept;
+
+    /*!
+     * @brief Read the simulated VBM input
+     *
+     * This is, in network byte order, the 4 byte vehicle ID, the speed
+     * times 10^3 as 4 bytes, the gear position, turn signal position and
+     * flags as 1 byte each, then the acceleration times 10^3 as 4 bytes.
+     *
+     * @param[in] bytes The input bytes
+     * @param[out] vehicle The vehicle state
+     * @return True if the input was the correct size
+     */
+    static bool parse_vbm(common::byte_sequence const &bytes, SimulatedVehicleBasics &vehicle) noexcept;
+
+    /*!
+     * @brief Encode a BasicSafetyMessage frame for the vehicle
+     *
+     * @param[in] vehicle The vehicle state
+     * @param[in] when The time of the vehicle state
+     * @param[in] messageId The DSRC message ID to use
+     * @return The UPER encoded bytes, or an empty sequence on an error
+     */
+    common::byte_sequence encode_bsm(SimulatedVehicle const &vehicle, std::chrono::system_clock::time_point when,
+                                     long messageId = BSM_MESSAGE_ID);
+
+    /*!
+     * @brief Encode a SignalRequestMessage frame for the vehicle
+     *
+     * @param[in] vehicle The vehicle state
+     * @param[in] when The time of the vehicle state
+     * @param[in] messageId The DSRC message ID to use
+     * @return The UPER encoded bytes, or an empty sequence on an error
+     */
+    common::byte_sequence encode_srm(SimulatedVehicle const &vehicle, std::chrono::system_clock::time_point when,
+                                     long messageId = SRM_MESSAGE_ID);
+
+private:
+    common::byte_sequence encode(void const *frame);
+
+    EncodeArena _arena;
+    std::vector<std::uint8_t> _buffer;
+};
+
+}}}} // namespace tmx::plugin::utils::sim
+
+#endif /* INCLUDE_TMX_PLUGIN_UTILS_SIM_SIMULATEDMESSAGEENCODER_HPP_ */
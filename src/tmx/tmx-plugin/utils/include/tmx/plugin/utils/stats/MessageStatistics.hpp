@@ -0,0 +1,177 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file MessageStatistics.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#ifndef INCLUDE_TMX_PLUGIN_UTILS_STATS_MESSAGESTATISTICS_HPP_
+#define INCLUDE_TMX_PLUGIN_UTILS_STATS_MESSAGESTATISTICS_HPP_
+
+#include <tmx/common/platform/types/bytes.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!
+ * @brief The size of a cache line, which separates the counters written by different threads
+ */
+#ifndef TMX_CACHE_LINE_SIZE
+#define TMX_CACHE_LINE_SIZE 64
+#endif
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace stats {
+
+/*!
+ * @brief Lock free counters for the messages received, by message ID and by source
+ *
+ * Any number of threads may count messages at once. Each message ID has
+ * its own fixed counters on a separate cache line, so counting a message
+ * is a couple of atomic increments and never takes a lock.
+ *
+ * Each source, such as the channel or radio a message came in on, is
+ * given one of a fixed number of slots the first time it is seen. The slot
+ * keeps the number of messages in each of the last few seconds, which
+ * gives the rate over a sliding window. Sources are matched by a hash of
+ * their name, and once all the slots are taken, new sources are no longer
+ * tracked by rate.
+ *
+ * The counts are read by a single thread that periodically takes a
+ * snapshot, for example to publish as the plugin status.
+ */
+class MessageStatistics {
+public:
+    typedef std::chrono::steady_clock clock_type;
+
+    /*!
+     * @brief The number of message IDs counted, which covers every J2735 DSRC message ID
+     */
+    static constexpr std::size_t MAX_MESSAGE_IDS = 256;
+
+    /*!
+     * @brief The number of sources whose rates can be tracked
+     */
+    static constexpr std::size_t MAX_SOURCES = 64;
+
+    /*!
+     * @brief The number of seconds in the sliding window for the source rates
+     */
+    static constexpr std::size_t RATE_WINDOW_SECONDS = 10;
+
+    /*!
+     * @brief The counts for one message ID
+     */
+    struct MessageCount {
+        std::uint16_t messageId;
+        std::uint64_t count;
+        std::uint64_t bytes;
+    };
+
+    /*!
+     * @brief The counts for one source
+     */
+    struct SourceCount {
+        std::string source;
+        std::uint64_t count;
+
+        /*!
+         * @brief The messages per second over the sliding window
+         */
+        double rate;
+    };
+
+    /*!
+     * @brief A copy of all the counts at one time
+     */
+    struct Snapshot {
+        clock_type::time_point time;
+        std::uint64_t totalBytes = 0;
+        std::vector<MessageCount> messages;
+        std::vector<SourceCount> sources;
+    };
+
+    MessageStatistics() noexcept;
+
+    MessageStatistics(MessageStatistics const &) = delete;
+    MessageStatistics &operator=(MessageStatistics const &) = delete;
+
+    /*!
+     * @brief Count a message that was received
+     *
+     * This is safe to call from any thread, and never blocks. The bytes
+     * are only added to the message ID, so the total bytes received must
+     * be counted separately with count_bytes().
+     *
+     * @param[in] messageId The message ID, which is not counted if it is out of range
+     * @param[in] bytes The number of bytes in the message
+     * @param[in] source The name of the source, which is not counted if empty
+     * @param[in] when The time the message was received
+     */
+    void count(std::uint16_t messageId, std::size_t bytes, common::const_string source = { },
+               clock_type::time_point when = clock_type::now()) noexcept;
+
+    /*!
+     * @brief Count the bytes received, without any message
+     *
+     * This is safe to call from any thread, and never blocks.
+     *
+     * @param[in] bytes The number of bytes received
+     */
+    void count_bytes(std::size_t bytes) noexcept;
+
+    /*!
+     * @brief Copy the current counts
+     *
+     * Only the message IDs and sources with a count are included. The
+     * snapshot vectors are re-used, so the same snapshot may be passed in
+     * each time without allocating.
+     *
+     * @param[out] out The snapshot to fill in
+     * @param[in] now The time of the snapshot
+     */
+    void snapshot(Snapshot &out, clock_type::time_point now = clock_type::now()) const;
+
+private:
+    // Each bucket packs the second it is for in the upper half, and the count in the lower half
+    static constexpr std::size_t RATE_BUCKETS = RATE_WINDOW_SECONDS + 1;
+
+    struct alignas(TMX_CACHE_LINE_SIZE) Counter {
+        std::atomic<std::uint64_t> count { 0 };
+        std::atomic<std::uint64_t> bytes { 0 };
+    };
+
+    struct alignas(TMX_CACHE_LINE_SIZE) Source {
+        std::atomic<std::uint64_t> key { 0 };
+        std::atomic<bool> named { false };
+        char name[64];
+        std::atomic<std::uint64_t> count { 0 };
+        std::atomic<std::uint64_t> buckets[RATE_BUCKETS];
+    };
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "The message counters must be lock free");
+
+    std::uint32_t get_second(clock_type::time_point when) const noexcept;
+
+    Source *get_source(common::const_string name) noexcept;
+
+    const clock_type::time_point _epoch;
+
+    Counter _messages[MAX_MESSAGE_IDS];
+    Counter _totals;
+    Source _sources[MAX_SOURCES];
+};
+
+}}}} // namespace tmx::plugin::utils::stats
+
+#endif /* INCLUDE_TMX_PLUGIN_UTILS_STATS_MESSAGESTATISTICS_HPP_ */
@@ -0,0 +1,426 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file XerJsonWriter.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/plugin/utils/XerJsonWriter.hpp>
+
+#include <tmx/message/j2735/202007/BOOLEAN.h>
+#include <tmx/message/j2735/202007/NativeEnumerated.h>
+#include <tmx/message/j2735/202007/NativeInteger.h>
+#include <tmx/message/j2735/202007/OPEN_TYPE.h>
+#include <tmx/message/j2735/202007/asn_SEQUENCE_OF.h>
+#include <tmx/message/j2735/202007/constr_CHOICE.h>
+#include <tmx/message/j2735/202007/constr_SEQUENCE.h>
+#include <tmx/message/j2735/202007/constr_SEQUENCE_OF.h>
+#include <tmx/message/j2735/202007/constr_SET_OF.h>
+
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+
+/*!
+ * @brief The state for writing one structure
+ *
+ * A node is either a value in the ASN.1 structure, or an empty XML
+ * element, such as an enumerated value, that has no type descriptor.
+ */
+class XerJsonWriter::Writer {
+public:
+    struct Node {
+        asn_TYPE_descriptor_t const *td;
+        void const *ptr;
+    };
+
+    // The repairs for a node, which track both the keys before and after any nodes are deleted
+    struct Cursor {
+        RepairNode const *fix;
+        RepairNode const *post;
+        bool array;
+        bool collapse;
+        bool flatten;
+    };
+
+    // A reference to the function called for each child, which keeps the recursion out of the templates
+    class Visitor {
+    public:
+        template <typename _Fn>
+        Visitor(_Fn &&fn) noexcept: _fn((void *)&fn),
+                _call([](void *f, std::string_view key, Node const &node, bool first) {
+                    return (*static_cast<std::remove_reference_t<_Fn> *>(f))(key, node, first);
+                }) { }
+
+        bool operator()(std::string_view key, Node const &node, bool first) const {
+            return _call(_fn, key, node, first);
+        }
+
+    private:
+        void *_fn;
+        bool (*_call)(void *, std::string_view, Node const &, bool);
+    };
+
+    explicit Writer(std::string &out) noexcept: _out(out) { }
+
+    static Cursor resolve(RepairNode const *fix, RepairNode const *post, bool first) noexcept {
+        return { fix, post,
+                 first && fix && (fix->repairs & FixArrays),
+                 first && post && (post->repairs & DeleteNodes),
+                 first && post && (post->repairs & FlattenNode) };
+    }
+
+    bool write_node(Node const &node, Cursor const &cursor, bool object = false) {
+        std::string text;
+
+        if (cursor.flatten) {
+            std::string key;
+            bool found = false;
+            auto cnt = for_each_entry(node, cursor, text, [&](std::string_view k, Node const &, Cursor const &) {
+                if (!found)
+                    key = k;
+
+                found = true;
+                return true;
+            });
+
+            if (cnt < 0)
+                return false;
+
+            write_string(found ? key : text);
+            return true;
+        }
+
+        bool open = false;
+        bool array = false;
+        auto cnt = for_each_entry(node, cursor, text, [&](std::string_view key, Node const &child, Cursor const &c) {
+            if (!open) {
+                // Like the property tree, only an object full of empty keys is an array
+                array = !object && key.empty();
+                _out += array ? '[' : '{';
+                open = true;
+            } else {
+                _out += ',';
+            }
+
+            if (!array) {
+                write_string(key);
+                _out += ':';
+            }
+
+            return write_node(child, c);
+        });
+
+        if (cnt < 0)
+            return false;
+
+        if (open)
+            _out += array ? ']' : '}';
+        else if (object)
+            _out += "{}";
+        else
+            write_string(text);
+
+        return true;
+    }
+
+private:
+    static RepairNode const *next(RepairNode const *node, std::string_view key) noexcept {
+        if (!node)
+            return nullptr;
+
+        auto iter = node->children.find(key);
+        return iter == node->children.end() ? nullptr : iter->second.get();
+    }
+
+    /*!
+     * Invoke the function for each child of the node after the repairs, which
+     * means the keys are removed from arrays and the children of any deleted
+     * nodes are brought up a level.
+     */
+    template <typename _Fn>
+    int for_each_entry(Node const &node, Cursor const &cursor, std::string &text, _Fn &&fn) {
+        int index = 0;
+        return for_each_child(node, text, [&](std::string_view key, Node const &child, bool first) {
+            if (cursor.array) {
+                key = std::string_view();
+                first = (index == 0);
+            }
+
+            index++;
+
+            auto const *fix = next(cursor.fix, key);
+            if (!cursor.collapse)
+                return fn(key, child, resolve(fix, next(cursor.post, key), first));
+
+            // The post-delete path skips over this child
+            Cursor lifted = resolve(fix, cursor.post, first);
+            lifted.collapse = lifted.flatten = false;
+
+            std::string ignored;
+            return for_each_entry(child, lifted, ignored, fn) >= 0;
+        });
+    }
+
+    /*!
+     * Invoke the function for each XML child element of the node, in the same
+     * order as the asn1c XER encoder. If there are no children, then any text
+     * is returned instead.
+     *
+     * @return The number of children, or -1 if the node could not be encoded
+     */
+    int for_each_child(Node const &node, std::string &text, Visitor const &fn) {
+        auto const *td = node.td;
+        if (!td)
+            return 0;
+        if (!node.ptr)
+            return -1;
+
+        int count = 0;
+        if (td->op == &asn_OP_SEQUENCE) {
+            for (unsigned int i = 0; i < td->elements_count; i++) {
+                auto const &elm = td->elements[i];
+                void const *memb = (char const *)node.ptr + elm.memb_offset;
+                void *def = nullptr;
+
+                if (elm.flags & ATF_POINTER) {
+                    memb = *(void const * const *)memb;
+                    if (!memb) {
+                        if (elm.default_value_set) {
+                            if (elm.default_value_set(&def))
+                                return -1;
+
+                            memb = def;
+                        } else if (elm.optional) {
+                            continue;
+                        } else {
+                            return -1;
+                        }
+                    }
+                }
+
+                bool ok = fn(elm.name, Node { elm.type, memb }, true);
+                if (def)
+                    ASN_STRUCT_FREE(*elm.type, def);
+                if (!ok)
+                    return -1;
+
+                count++;
+            }
+        } else if (td->op == &asn_OP_CHOICE || td->op == &asn_OP_OPEN_TYPE) {
+            auto present = CHOICE_variant_get_presence(td, node.ptr);
+            if (present == 0 || present > td->elements_count)
+                return -1;
+
+            auto const &elm = td->elements[present - 1];
+            void const *memb = (char const *)node.ptr + elm.memb_offset;
+            if (elm.flags & ATF_POINTER)
+                memb = *(void const * const *)memb;
+
+            if (!memb || !fn(elm.name, Node { elm.type, memb }, true))
+                return -1;
+
+            count++;
+        } else if (td->op == &asn_OP_SEQUENCE_OF || td->op == &asn_OP_SET_OF) {
+            auto const *specs = (asn_SET_OF_specifics_t const *)td->specifics;
+            auto const *elm = td->elements;
+            auto const *list = _A_CSEQUENCE_FROM_VOID(node.ptr);
+            char const *key = *elm->name ? elm->name : elm->type->xml_tag;
+
+            for (int i = 0; i < list->count; i++) {
+                if (!list->array[i])
+                    continue;
+
+                if (!specs->as_XMLValueList) {
+                    if (!fn(key, Node { elm->type, list->array[i] }, count++ == 0))
+                        return -1;
+
+                    continue;
+                }
+
+                // The element values are written directly into the list
+                std::string ignored;
+                auto cnt = for_each_child(Node { elm->type, list->array[i] }, ignored,
+                                          [&](std::string_view k, Node const &child, bool) {
+                    return fn(k, child, count++ == 0);
+                });
+
+                if (cnt < 0)
+                    return -1;
+                if (cnt == 0 && ignored.empty() && !fn(elm->type->xml_tag, Node { nullptr, nullptr }, count++ == 0))
+                    return -1;
+            }
+        } else if (td->op == &asn_OP_NativeInteger) {
+            auto const *specs = (asn_INTEGER_specifics_t const *)td->specifics;
+            auto value = *(long const *)node.ptr;
+            text = (specs && specs->field_unsigned) ? std::to_string((unsigned long)value) : std::to_string(value);
+        } else if (td->op == &asn_OP_NativeEnumerated) {
+            auto const *el = INTEGER_map_value2enum((asn_INTEGER_specifics_t const *)td->specifics,
+                                                   *(long const *)node.ptr);
+            if (!el || !fn(el->enum_name, Node { nullptr, nullptr }, true))
+                return -1;
+
+            count++;
+        } else if (td->op == &asn_OP_BOOLEAN) {
+            if (!fn(*(BOOLEAN_t const *)node.ptr ? "true" : "false", Node { nullptr, nullptr }, true))
+                return -1;
+
+            count++;
+        } else {
+            count = for_each_xer_child(node, text, fn);
+        }
+
+        return count;
+    }
+
+    static int append_xer(void const *buffer, size_t size, void *key) {
+        static_cast<std::string *>(key)->append(static_cast<char const *>(buffer), size);
+        return 0;
+    }
+
+    // Any other type is encoded as XER and split into the text and empty XML elements
+    int for_each_xer_child(Node const &node, std::string &text, Visitor const &fn) {
+        std::string xer;
+        auto ret = node.td->op->xer_encoder(node.td, node.ptr, 1, XER_F_BASIC, &XerJsonWriter::Writer::append_xer, &xer);
+        if (ret.encoded < 0)
+            return -1;
+
+        int count = 0;
+        std::string raw;
+        for (std::size_t i = 0; i < xer.length(); i++) {
+            if (xer[i] != '<') {
+                raw += xer[i];
+                continue;
+            }
+
+            auto end = xer.find('>', i);
+            if (end == std::string::npos)
+                return -1;
+
+            if (xer[end - 1] == '/' &&
+                    !fn(std::string_view(xer).substr(i + 1, end - i - 2), Node { nullptr, nullptr }, count++ == 0))
+                return -1;
+
+            i = end;
+        }
+
+        normalize(raw, text);
+        return count;
+    }
+
+    // Trim and collapse the white space, then replace the XML entities, like the property tree XML reader
+    static void normalize(std::string const &raw, std::string &text) {
+        static constexpr const char *_ws = " \t\n\r";
+
+        text.clear();
+        for (std::size_t i = 0; i < raw.length(); i++) {
+            if (raw[i] && std::strchr(_ws, raw[i])) {
+                auto n = raw.find_first_not_of(_ws, i);
+                if (n == std::string::npos)
+                    break;
+
+                if (!text.empty())
+                    text += ' ';
+
+                i = n;
+            }
+
+            if (raw[i] == '&') {
+                static constexpr std::pair<const char *, char> _entities[] = {
+                        { "&lt;", '<' }, { "&gt;", '>' }, { "&amp;", '&' }, { "&quot;", '"' }, { "&apos;", '\'' } };
+
+                bool replaced = false;
+                for (auto const &entity: _entities) {
+                    if (raw.compare(i, std::strlen(entity.first), entity.first) == 0) {
+                        text += entity.second;
+                        i += std::strlen(entity.first) - 1;
+                        replaced = true;
+                        break;
+                    }
+                }
+
+                if (replaced)
+                    continue;
+            }
+
+            text += raw[i];
+        }
+    }
+
+    // Escape the string the same as the property tree JSON writer
+    void write_string(std::string_view str) {
+        static constexpr const char *_hex = "0123456789ABCDEF";
+
+        _out += '"';
+        for (unsigned char c: str) {
+            if (c == 0x20 || c == 0x21 || (c >= 0x23 && c <= 0x2E) || (c >= 0x30 && c <= 0x5B) || c >= 0x5D) {
+                _out += (char)c;
+                continue;
+            }
+
+            _out += '\\';
+            switch (c) {
+                case '\b': _out += 'b'; break;
+                case '\f': _out += 'f'; break;
+                case '\n': _out += 'n'; break;
+                case '\r': _out += 'r'; break;
+                case '\t': _out += 't'; break;
+                case '/':
+                case '"':
+                case '\\':
+                    _out += (char)c;
+                    break;
+                default:
+                    _out += "u00";
+                    _out += _hex[c >> 4];
+                    _out += _hex[c & 0x0F];
+            }
+        }
+        _out += '"';
+    }
+
+    std::string &_out;
+};
+
+void XerJsonWriter::add_repair(Repair repair, std::string const &path) {
+    RepairNode *node = &_repairs;
+
+    std::size_t start = 0;
+    while (start <= path.length()) {
+        auto end = path.find('.', start);
+        if (end == std::string::npos)
+            end = path.length();
+
+        auto &child = node->children[path.substr(start, end - start)];
+        if (!child)
+            child = std::make_unique<RepairNode>();
+
+        node = child.get();
+        start = end + 1;
+    }
+
+    node->repairs |= repair;
+}
+
+bool XerJsonWriter::write(std::string &out, asn_TYPE_descriptor_t const &td, void const *sptr) const {
+    auto const length = out.length();
+
+    Writer writer { out };
+    if (!writer.write_node({ &td, sptr }, Writer::resolve(&_repairs, &_repairs, false), true)) {
+        out.resize(length);
+        return false;
+    }
+
+    out += '\n';
+    return true;
+}
+
+}}} // namespace tmx::plugin::utils
@@ -389,17 +389,23 @@ WGS84Point GeoVector::DestinationPoint(WGS84Point point, double bearing, double
  */
 double GeoVector::CrossTrackDistanceInMeters(WGS84Point point, WGS84Point pathP1, WGS84Point pathP2)
 {
-	GeoVector vec1 = WGS84PointToNVector(point);
 	GeoVector pv1 = WGS84PointToNVector(pathP1);
 	GeoVector pv2 = WGS84PointToNVector(pathP2);
-	GeoVector c1; //great circle through pathP1 and pathP2 surface normal
-	double angle;
 
 	// calculate great circle surface normal
-	c1 = Cross(pv1, pv2);
+	return CrossTrackDistanceInMeters(WGS84PointToNVector(point), Cross(pv1, pv2));
+}
 
+/*
+ * Calculate cross track distance, the distance in meters from a point to the great circle defined
+ * by its surface normal, distance is signed (negative to left of path, positive to right of path)
+ *
+ * return meters as double
+ */
+double GeoVector::CrossTrackDistanceInMeters(GeoVector vec, GeoVector greatCircle)
+{
 	// calculate angle between surface and point
-	angle = AngleBetweenInRadians(c1, vec1) - (M_PI / 2);
+	double angle = AngleBetweenInRadians(greatCircle, vec) - (M_PI / 2);
 
 	//return distance in meters
 	return angle * _earthRadiusInKM * 1000.0;
@@ -505,9 +511,17 @@ WGS84Point GeoVector::MidpointBetween(WGS84Point point1, WGS84Point point2)
  */
 bool GeoVector::IsBetween(WGS84Point point, WGS84Point pathP1, WGS84Point pathP2)
 {
-	GeoVector vec1 = WGS84PointToNVector(point);
-	GeoVector pv1 = WGS84PointToNVector(pathP1);
-	GeoVector pv2 = WGS84PointToNVector(pathP2);
+	return IsBetween(WGS84PointToNVector(point), WGS84PointToNVector(pathP1), WGS84PointToNVector(pathP2));
+}
+
+/*
+ * Test if n-vector is between two n-vectors of a path segment. If vector is not on path return true if
+ * vector is between perpendiculars from path segment vectors.
+ *
+ * return bool
+ */
+bool GeoVector::IsBetween(GeoVector vec1, GeoVector pv1, GeoVector pv2)
+{
 	GeoVector d10, d12, d20, d21;
 	double extent1, extent2;
 	d10 = Minus(vec1, pv1);
@@ -0,0 +1,90 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file Crc24q.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/plugin/utils/gnss/Crc24q.hpp>
+
+#include <array>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace gnss {
+
+static constexpr crc24_t CRC24_MASK = 0xFFFFFF;
+
+typedef std::array<std::array<crc24_t, 256>, 8> crc24q_tables;
+
+/*!
+ * @brief Build the slice-by-8 tables
+ *
+ * The first table is the CRC of each single byte. Each following table
+ * is the CRC of each byte followed by one more zero byte than the last.
+ */
+static constexpr crc24q_tables make_tables() {
+    crc24q_tables tables { };
+
+    for (crc24_t b = 0; b < 256; b++) {
+        crc24_t crc = b << 16;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc & 0x800000) ? ((crc << 1) ^ CRC24Q_POLY) : (crc << 1);
+
+        tables[0][b] = crc & CRC24_MASK;
+    }
+
+    for (std::size_t t = 1; t < tables.size(); t++) {
+        for (std::size_t b = 0; b < 256; b++) {
+            auto prev = tables[t - 1][b];
+            tables[t][b] = ((prev << 8) & CRC24_MASK) ^ tables[0][prev >> 16];
+        }
+    }
+
+    return tables;
+}
+
+static constexpr crc24q_tables _tables = make_tables();
+
+static inline crc24_t update(crc24_t crc, std::uint8_t byte) noexcept {
+    return ((crc << 8) & CRC24_MASK) ^ _tables[0][(crc >> 16) ^ byte];
+}
+
+crc24_t crc24q_bytewise(void const *data, std::size_t length, crc24_t crc) noexcept {
+    auto bytes = static_cast<std::uint8_t const *>(data);
+
+    crc &= CRC24_MASK;
+    for (std::size_t i = 0; i < length; i++)
+        crc = update(crc, bytes[i]);
+
+    return crc;
+}
+
+crc24_t crc24q(void const *data, std::size_t length, crc24_t crc) noexcept {
+    auto bytes = static_cast<std::uint8_t const *>(data);
+
+    crc &= CRC24_MASK;
+    for (; length >= 8; length -= 8, bytes += 8) {
+        // The 3 bytes of the current CRC fold into the first 3 bytes of the block
+        crc = _tables[7][bytes[0] ^ (crc >> 16)] ^
+              _tables[6][bytes[1] ^ ((crc >> 8) & 0xFF)] ^
+              _tables[5][bytes[2] ^ (crc & 0xFF)] ^
+              _tables[4][bytes[3]] ^
+              _tables[3][bytes[4]] ^
+              _tables[2][bytes[5]] ^
+              _tables[1][bytes[6]] ^
+              _tables[0][bytes[7]];
+    }
+
+    for (; length > 0; length--)
+        crc = update(crc, *bytes++);
+
+    return crc;
+}
+
+}}}} // namespace tmx::plugin::utils::gnss
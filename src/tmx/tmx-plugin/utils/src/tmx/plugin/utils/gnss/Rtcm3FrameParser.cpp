@@ -0,0 +1,171 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file Rtcm3FrameParser.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/plugin/utils/gnss/Rtcm3FrameParser.hpp>
+#include <tmx/plugin/utils/gnss/Crc24q.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace gnss {
+
+static inline std::uint8_t at(common::byte_t const *data, std::size_t i) noexcept {
+    return static_cast<std::uint8_t>(data[i]);
+}
+
+/*!
+ * @brief The reserved bits after the preamble must be zero, which rules out most false starts
+ */
+static inline bool is_header(common::byte_t const *data) noexcept {
+    return at(data, 0) == Rtcm3FrameParser::PREAMBLE && (at(data, 1) & 0xFC) == 0;
+}
+
+static inline std::size_t get_frame_size(common::byte_t const *data) noexcept {
+    return Rtcm3FrameParser::HEADER_SIZE + ((at(data, 1) & 0x03) << 8 | at(data, 2)) + Rtcm3FrameParser::CRC_SIZE;
+}
+
+void Rtcm3FrameParser::parse(common::byte_sequence const &bytes, frame_handler const &handler) {
+    auto data = bytes.data();
+    auto length = bytes.length();
+
+    // Finish any frame that was split by the last read
+    while (_pendingLength > 0 && length > 0) {
+        std::size_t need = HEADER_SIZE;
+        if (_pendingLength >= HEADER_SIZE)
+            need = get_frame_size(_pending.data());
+
+        auto n = std::min(need - _pendingLength, length);
+        std::memcpy(_pending.data() + _pendingLength, data, n);
+        _pendingLength += n;
+        data += n;
+        length -= n;
+
+        if (_pendingLength < HEADER_SIZE)
+            continue;
+
+        if (!is_header(_pending.data())) {
+            this->resync(handler);
+            continue;
+        }
+
+        auto size = get_frame_size(_pending.data());
+        if (_pendingLength < size)
+            continue;
+
+        if (this->check(_pending.data(), size, handler))
+            _pendingLength = 0;
+        else
+            this->resync(handler);
+    }
+
+    this->scan(data, length, handler);
+}
+
+void Rtcm3FrameParser::scan(common::byte_t const *data, std::size_t length, frame_handler const &handler) {
+    std::size_t i = 0;
+    while (i < length) {
+        auto next = static_cast<common::byte_t const *>(std::memchr(data + i, PREAMBLE, length - i));
+        if (!next) {
+            _discarded += length - i;
+            return;
+        }
+
+        _discarded += (next - data) - i;
+        i = next - data;
+
+        if (length - i < HEADER_SIZE) {
+            this->hold(data + i, length - i);
+            return;
+        }
+
+        if (!is_header(data + i)) {
+            _discarded++;
+            i++;
+            continue;
+        }
+
+        auto size = get_frame_size(data + i);
+        if (length - i < size) {
+            this->hold(data + i, length - i);
+            return;
+        }
+
+        if (this->check(data + i, size, handler)) {
+            i += size;
+        } else {
+            _discarded++;
+            i++;
+        }
+    }
+}
+
+void Rtcm3FrameParser::hold(common::byte_t const *data, std::size_t length) noexcept {
+    std::memcpy(_pending.data(), data, length);
+    _pendingLength = length;
+}
+
+bool Rtcm3FrameParser::check(common::byte_t const *data, std::size_t length, frame_handler const &handler) {
+    // The CRC of the whole frame, including its own CRC, is zero
+    if (crc24q(data, length)) {
+        _crcErrors++;
+        return false;
+    }
+
+    _frames++;
+    if (handler)
+        handler(common::byte_sequence(data, length));
+
+    return true;
+}
+
+void Rtcm3FrameParser::resync(frame_handler const &handler) {
+    // Skip the bad preamble and look again at what was held
+    std::array<common::byte_t, MAX_FRAME_SIZE> held;
+    auto length = _pendingLength - 1;
+    std::memcpy(held.data(), _pending.data() + 1, length);
+
+    _discarded++;
+    _pendingLength = 0;
+    this->scan(held.data(), length, handler);
+}
+
+void Rtcm3FrameParser::reset() noexcept {
+    _discarded += _pendingLength;
+    _pendingLength = 0;
+}
+
+std::uint64_t Rtcm3FrameParser::get_frame_count() const noexcept {
+    return _frames;
+}
+
+std::uint64_t Rtcm3FrameParser::get_discarded_bytes() const noexcept {
+    return _discarded;
+}
+
+std::uint64_t Rtcm3FrameParser::get_crc_errors() const noexcept {
+    return _crcErrors;
+}
+
+std::size_t Rtcm3FrameParser::get_pending_bytes() const noexcept {
+    return _pendingLength;
+}
+
+std::uint16_t Rtcm3FrameParser::get_message_number(common::byte_sequence const &frame) noexcept {
+    if (frame.length() < HEADER_SIZE + 2)
+        return 0;
+
+    return at(frame.data(), HEADER_SIZE) << 4 | at(frame.data(), HEADER_SIZE + 1) >> 4;
+}
+
+}}}} // namespace tmx::plugin::utils::gnss
@@ -0,0 +1,409 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file CompiledMap.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/plugin/utils/interxn/CompiledMap.hpp>
+
+#include <tmx/plugin/utils/geo/Conversions.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+using namespace tmx::plugin::utils::geo;
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace interxn {
+
+// Meters per degree of latitude on the same spherical earth used by GeoVector
+static constexpr double METERS_PER_DEGREE = 6371000.0 * M_PI / 180.0;
+
+// Smallest grid cell size, in meters
+static constexpr double MIN_CELL_METERS = 10.0;
+
+// Largest number of grid cells along either axis
+static constexpr double MAX_CELLS = 512;
+
+// The widest match considered in MapSupport is two lane widths from the center line
+static constexpr double LANE_WIDTH_FACTOR = 2.0;
+
+CompiledMap::CompiledMap(std::shared_ptr<MapData> msg): _msg(msg) {
+    if (this->_intersection.LoadMap(msg)) {
+        this->_mapId = this->_intersection.GetMapId();
+        this->_mapRevision = msg->msgIssueRevision;
+        this->Compile();
+        this->BuildIndex();
+        this->_loaded = true;
+    }
+}
+
+bool CompiledMap::IsLoaded() const noexcept {
+    return this->_loaded;
+}
+
+int CompiledMap::GetMapId() const noexcept {
+    return this->_mapId;
+}
+
+int CompiledMap::GetMapRevision() const noexcept {
+    return this->_mapRevision;
+}
+
+std::shared_ptr<MapData> const &CompiledMap::GetMapMessage() const noexcept {
+    return this->_msg;
+}
+
+Intersection const &CompiledMap::GetIntersection() const noexcept {
+    return this->_intersection;
+}
+
+/**
+ * Flatten the parsed lanes into segments, computing everything that
+ * MapSupport would otherwise compute on each lookup.
+ */
+void CompiledMap::Compile() {
+    auto &map = this->_intersection.Map;
+    MapSupport mapSupp;
+
+    for (auto &mapLane: map.Lanes) {
+        Lane lane;
+        lane.LaneNumber = mapLane.LaneNumber;
+        lane.LaneWidthMeters = mapLane.LaneWidthMeters;
+        lane.IsEgress = mapLane.Direction == Egress_Computed;
+        lane.IsVehicle = mapSupp.IsVehicleLane(mapLane.LaneNumber, map);
+        lane.StopBarElevation = mapLane.Nodes.empty() ? 0.0 : mapLane.Nodes.front().Point.Elevation;
+        lane.FirstSegment = this->_segments.size();
+
+        // Same accumulation order as MapSupport, so the stop bar distances are identical
+        double stopBarDistance = 0.0;
+        int laneSegment = 0;
+        for (auto it = mapLane.Nodes.begin(); it != mapLane.Nodes.end(); ++it) {
+            if (it == mapLane.Nodes.begin())
+                continue;
+
+            Segment segment;
+            segment.Lane = this->_lanes.size();
+            segment.LaneSegment = ++laneSegment;
+            segment.P1 = std::prev(it)->Point;
+            segment.P2 = it->Point;
+            segment.V1 = GeoVector::WGS84PointToNVector(segment.P1);
+            segment.V2 = GeoVector::WGS84PointToNVector(segment.P2);
+            segment.Normal = GeoVector::Cross(segment.V1, segment.V2);
+            segment.ReverseNormal = GeoVector::Cross(segment.V2, segment.V1);
+            segment.LengthMeters = GeoVector::DistanceInMeters(segment.P1, segment.P2);
+            segment.StopBarDistanceMeters = stopBarDistance;
+            stopBarDistance += segment.LengthMeters;
+
+            this->_segments.push_back(segment);
+        }
+
+        lane.SegmentCount = this->_segments.size() - lane.FirstSegment;
+
+        // The distance to the crossing uses the lane nodes directly from the message
+        if (!this->_laneIndex.count(lane.LaneNumber)) {
+            this->_laneIndex[lane.LaneNumber] = this->_lanes.size();
+
+            double distance = 0.0;
+            for (auto &node: this->_intersection.GetLaneNodes(*this->_msg, lane.LaneNumber, 0.0, 0.0)) {
+                if (!lane.CrossingNodes.empty())
+                    distance += Conversions::DistanceMeters(lane.CrossingNodes.back(), node.Point);
+
+                lane.CrossingNodes.push_back(node.Point);
+                lane.CrossingDistances.push_back(distance);
+            }
+
+            int signalGroup = mapSupp.GetSignalGroupForVehicleLane(lane.LaneNumber, map);
+            if (signalGroup >= 0)
+                this->_signalGroups[lane.LaneNumber] = signalGroup;
+        }
+
+        if (!mapLane.Nodes.empty())
+            this->_centerRadius = std::max(this->_centerRadius,
+                                           Conversions::DistanceMeters(map.ReferencePoint, mapLane.Nodes.front().Point));
+
+        this->_lanes.push_back(std::move(lane));
+    }
+}
+
+/**
+ * Build a uniform grid over the vehicle lane segments in a local plane
+ * at the reference point. Each segment is added to every cell touched by
+ * its bounding box, padded by the widest distance that MapSupport would
+ * still consider a match. Segments are added in lane order, so each cell
+ * lists its candidates in the same order that MapSupport checks them.
+ */
+void CompiledMap::BuildIndex() {
+    auto &ref = this->_intersection.Map.ReferencePoint;
+    this->_metersPerLat = METERS_PER_DEGREE;
+    this->_metersPerLong = METERS_PER_DEGREE * cos(ref.Latitude * M_PI / 180.0);
+
+    double minX = numeric_limits<double>::max();
+    double minY = numeric_limits<double>::max();
+    double maxX = numeric_limits<double>::lowest();
+    double maxY = numeric_limits<double>::lowest();
+    double extent = 0.0;
+
+    for (auto &segment: this->_segments) {
+        for (auto *p: { &segment.P1, &segment.P2 }) {
+            double x = this->ToX(*p);
+            double y = this->ToY(*p);
+            minX = std::min(minX, x);
+            minY = std::min(minY, y);
+            maxX = std::max(maxX, x);
+            maxY = std::max(maxY, y);
+            extent = std::max(extent, std::max(fabs(x), fabs(y)));
+        }
+    }
+
+    if (this->_segments.empty())
+        return;
+
+    // The local plane is not the sphere, so allow some slack that grows with the distance from the reference point
+    double slack = 1.0 + 0.005 * extent;
+    double maxWidth = 0.0;
+    for (auto &lane: this->_lanes)
+        maxWidth = std::max(maxWidth, lane.LaneWidthMeters);
+
+    double pad = LANE_WIDTH_FACTOR * maxWidth + slack;
+    this->_gridMinX = minX - pad;
+    this->_gridMinY = minY - pad;
+    this->_cellSize = std::max(MIN_CELL_METERS, std::max(maxX - minX, maxY - minY) / MAX_CELLS);
+    this->_gridCols = (std::size_t)((maxX + pad - this->_gridMinX) / this->_cellSize) + 1;
+    this->_gridRows = (std::size_t)((maxY + pad - this->_gridMinY) / this->_cellSize) + 1;
+
+    auto forEachCell = [this, slack](Segment const &segment, auto fn) {
+        double pad = LANE_WIDTH_FACTOR * this->_lanes[segment.Lane].LaneWidthMeters + slack;
+        double x1 = this->ToX(segment.P1), x2 = this->ToX(segment.P2);
+        double y1 = this->ToY(segment.P1), y2 = this->ToY(segment.P2);
+        auto c0 = (std::size_t)((std::min(x1, x2) - pad - this->_gridMinX) / this->_cellSize);
+        auto c1 = std::min(this->_gridCols - 1,
+                           (std::size_t)((std::max(x1, x2) + pad - this->_gridMinX) / this->_cellSize));
+        auto r0 = (std::size_t)((std::min(y1, y2) - pad - this->_gridMinY) / this->_cellSize);
+        auto r1 = std::min(this->_gridRows - 1,
+                           (std::size_t)((std::max(y1, y2) + pad - this->_gridMinY) / this->_cellSize));
+        for (auto r = r0; r <= r1; r++)
+            for (auto c = c0; c <= c1; c++)
+                fn(r * this->_gridCols + c);
+    };
+
+    // Count first, then fill, so that the cells are one contiguous array
+    this->_cellStart.assign(this->_gridCols * this->_gridRows + 1, 0);
+    for (auto &segment: this->_segments) {
+        if (this->_lanes[segment.Lane].IsVehicle)
+            forEachCell(segment, [this](std::size_t cell) { this->_cellStart[cell + 1]++; });
+    }
+
+    for (std::size_t i = 1; i < this->_cellStart.size(); i++)
+        this->_cellStart[i] += this->_cellStart[i - 1];
+
+    std::vector<std::uint32_t> next(this->_cellStart.begin(), this->_cellStart.end() - 1);
+    this->_cellSegments.resize(this->_cellStart.back());
+    for (std::uint32_t i = 0; i < this->_segments.size(); i++) {
+        if (this->_lanes[this->_segments[i].Lane].IsVehicle)
+            forEachCell(this->_segments[i], [this, &next, i](std::size_t cell) {
+                this->_cellSegments[next[cell]++] = i;
+            });
+    }
+}
+
+double CompiledMap::ToX(WGS84Point const &point) const noexcept {
+    return (point.Longitude - this->_intersection.Map.ReferencePoint.Longitude) * this->_metersPerLong;
+}
+
+double CompiledMap::ToY(WGS84Point const &point) const noexcept {
+    return (point.Latitude - this->_intersection.Map.ReferencePoint.Latitude) * this->_metersPerLat;
+}
+
+bool CompiledMap::GetCell(WGS84Point const &point, std::size_t &cell) const noexcept {
+    if (this->_cellStart.empty())
+        return false;
+
+    double col = floor((this->ToX(point) - this->_gridMinX) / this->_cellSize);
+    double row = floor((this->ToY(point) - this->_gridMinY) / this->_cellSize);
+    if (col < 0 || row < 0 || col >= this->_gridCols || row >= this->_gridRows)
+        return false;
+
+    cell = (std::size_t)row * this->_gridCols + (std::size_t)col;
+    return true;
+}
+
+bool CompiledMap::IsPointOnMap(WGS84Point const &point) const noexcept {
+    auto &map = this->_intersection.Map;
+    return !(point.Latitude > map.MaxLat || point.Latitude < map.MinLat ||
+             point.Longitude > map.MaxLong || point.Longitude < map.MinLong);
+}
+
+bool CompiledMap::IsInCenterOfIntersection(WGS84Point const &point, double irExtent) const {
+    double dist = Conversions::DistanceMeters(this->_intersection.Map.ReferencePoint, point);
+    return dist < this->_centerRadius * (1 + irExtent);
+}
+
+MapMatchResult CompiledMap::FindVehicleLaneForPoint(WGS84Point point, double irExtent) const {
+    MapMatchResult r;
+    r.PerpDistanceMeters = 0;
+    r.StopDistanceMeters = 0;
+
+    if (!this->_loaded || !this->IsPointOnMap(point)) {
+        r.LaneNumber = -2; //Not on the map.
+        return r;
+    }
+
+    std::size_t cell;
+    if (this->GetCell(point, cell)) {
+        GeoVector vec = GeoVector::WGS84PointToNVector(point);
+
+        for (auto i = this->_cellStart[cell]; i < this->_cellStart[cell + 1]; i++) {
+            auto &segment = this->_segments[this->_cellSegments[i]];
+            auto &lane = this->_lanes[segment.Lane];
+
+            double crossTrackDistance = GeoVector::CrossTrackDistanceInMeters(vec, segment.Normal);
+            if (fabs(crossTrackDistance) > lane.LaneWidthMeters / 2.0)
+                continue;
+
+            bool between = GeoVector::IsBetween(vec, segment.V1, segment.V2);
+            if (between ||
+                (segment.LaneSegment > 1 && GeoVector::DistanceInMeters(segment.V1, vec) <= lane.LaneWidthMeters / 2.0)) {
+                MapMatchResult res;
+                res.IsInLane = true;
+                res.PerpDistanceMeters = fabs(crossTrackDistance);
+                res.LaneNumber = lane.LaneNumber;
+                res.IsEgress = lane.IsEgress;
+                res.LaneSegment = segment.LaneSegment;
+                res.StopDistanceMeters = segment.StopBarDistanceMeters;
+                if (between)
+                    res.StopDistanceMeters += GeoVector::DistanceInMeters(segment.P1,
+                                                GeoVector::NearestPointOnSegment(point, segment.P1, segment.P2));
+                return res;
+            }
+        }
+    }
+
+    //We have not matched to a lane. See if we are actually within the intersection
+    r.LaneNumber = this->IsInCenterOfIntersection(point, irExtent) ? 0 : -1;
+    return r;
+}
+
+MapMatchResult CompiledMap::FindApproachLaneForPoint(WGS84Point point, double heading, double irExtent) const {
+    MapMatchResult r;
+    r.PerpDistanceMeters = 0;
+    r.StopDistanceMeters = 0;
+    MapMatchResult nearResult;
+
+    if (!this->_loaded || !this->IsPointOnMap(point)) {
+        r.LaneNumber = -2; //Not on the map.
+        return r;
+    }
+
+    std::size_t cell;
+    if (this->GetCell(point, cell)) {
+        GeoVector vec = GeoVector::WGS84PointToNVector(point);
+        GeoVector path = GeoVector::GreatCircle(vec, heading);
+
+        // Only the first qualifying segment of any lane is considered
+        auto matchedLane = numeric_limits<std::uint32_t>::max();
+
+        for (auto i = this->_cellStart[cell]; i < this->_cellStart[cell + 1]; i++) {
+            auto &segment = this->_segments[this->_cellSegments[i]];
+            if (segment.Lane == matchedLane)
+                continue;
+
+            auto &lane = this->_lanes[segment.Lane];
+
+            double crossTrackDistance = GeoVector::CrossTrackDistanceInMeters(vec, segment.Normal);
+            if (fabs(crossTrackDistance) > lane.LaneWidthMeters * 2.0)
+                continue;
+
+            double angleBetween = GeoVector::AngleBetweenInRadians(
+                    lane.IsEgress ? segment.Normal : segment.ReverseNormal, path, vec) * 180.0 / M_PI;
+            if (angleBetween > 45.0 || angleBetween < -45.0)
+                continue;
+
+            MapMatchResult res;
+            if (GeoVector::IsBetween(vec, segment.V1, segment.V2)) {
+                double inLaneDistance = GeoVector::DistanceInMeters(segment.P1,
+                                            GeoVector::NearestPointOnSegment(point, segment.P1, segment.P2));
+                res.StopDistanceMeters = segment.StopBarDistanceMeters + inLaneDistance;
+                if (segment.LengthMeters > 0.0 && res.StopDistanceMeters != 0.0) {
+                    double pointElevation = segment.P1.Elevation +
+                            ((segment.P2.Elevation - segment.P1.Elevation) * inLaneDistance / segment.LengthMeters);
+                    res.Grade = (lane.StopBarElevation - pointElevation) / res.StopDistanceMeters;
+                }
+            } else if (segment.LaneSegment > 1 &&
+                       GeoVector::DistanceInMeters(segment.V1, vec) <= lane.LaneWidthMeters * 2.0) {
+                //point is in dead space between this lane segment and previous lane segment
+                res.StopDistanceMeters = segment.StopBarDistanceMeters;
+                if (res.StopDistanceMeters != 0.0)
+                    res.Grade = (lane.StopBarElevation - segment.P1.Elevation) / res.StopDistanceMeters;
+            } else {
+                continue;
+            }
+
+            res.PerpDistanceMeters = fabs(crossTrackDistance);
+            res.LaneNumber = lane.LaneNumber;
+            res.IsEgress = lane.IsEgress;
+            res.LaneSegment = segment.LaneSegment;
+            res.IsInLane = fabs(crossTrackDistance) <= lane.LaneWidthMeters / 2.0;
+            res.IsNearLane = !res.IsInLane;
+
+            if (res.IsInLane)
+                return res;
+
+            if (!nearResult.IsNearLane || res.PerpDistanceMeters < nearResult.PerpDistanceMeters)
+                nearResult = res;
+
+            matchedLane = segment.Lane;
+        }
+    }
+
+    //We have not matched to a lane. See if we are actually within the intersection
+    if (this->IsInCenterOfIntersection(point, irExtent)) {
+        r.LaneNumber = 0;
+        return r;
+    }
+
+    //snap to lane if close enough
+    if (nearResult.IsNearLane)
+        return nearResult;
+
+    r.LaneNumber = -1;
+    return r;
+}
+
+int CompiledMap::GetSignalGroupForVehicleLane(int laneId) const noexcept {
+    auto iter = this->_signalGroups.find(laneId);
+    if (iter == this->_signalGroups.end())
+        return -1;
+
+    return iter->second;
+}
+
+double CompiledMap::GetDistanceToCrossing(int laneId, int laneSegment, WGS84Point point) const {
+    auto iter = this->_laneIndex.find(laneId);
+    if (iter == this->_laneIndex.end())
+        return -1;
+
+    auto &lane = this->_lanes[iter->second];
+
+    // Sum up to the first node of the matched segment, then to the point
+    WGS84Point node;
+    double distance = 0.0;
+    auto count = std::min<std::size_t>(std::max(laneSegment, 0), lane.CrossingNodes.size());
+    if (count > 0) {
+        node = lane.CrossingNodes[count - 1];
+        distance = lane.CrossingDistances[count - 1];
+    }
+
+    return distance + Conversions::DistanceMeters(node, point);
+}
+
+}}}} // namespace tmx::plugin::utils::interxn
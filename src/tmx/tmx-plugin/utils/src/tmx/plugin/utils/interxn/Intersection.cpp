@@ -186,7 +186,7 @@ bool Intersection::IsPedestrianReportedForConnectionId(int connectionId) {
 	return false;
 }
 
-bool Intersection::DoesSpatMatchMap(SPAT &msg) {
+bool Intersection::DoesSpatMatchMap(SPAT &msg) const {
 	//Verify that this spat message data matches the intersection that we have mapped out.
 
 	if(!_isMapLoaded)
@@ -207,7 +207,7 @@ bool Intersection::DoesSpatMatchMap(SPAT &msg) {
 	return false;
 }
 
-bool Intersection::IsSignalForGroupRedLight(SPAT &msg, int signalGroup) {
+bool Intersection::IsSignalForGroupRedLight(SPAT &msg, int signalGroup) const {
 
 	auto interX = FindIntersections(msg);
 	for (int i = 0; interX && i < interX->list.count; i++)
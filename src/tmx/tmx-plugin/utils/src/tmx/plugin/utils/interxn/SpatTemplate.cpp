@@ -0,0 +1,217 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file SpatTemplate.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/plugin/utils/interxn/SpatTemplate.hpp>
+
+#include <tmx/common/TmxLogger.hpp>
+
+#include <cstdlib>
+#include <memory>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace interxn {
+
+typedef std::basic_string<std::uint8_t> bytes_t;
+
+static bool encode(MessageFrame const *frame, bytes_t &bytes) {
+    void *buffer = nullptr;
+    auto length = uper_encode_to_new_buffer(&asn_DEF_MessageFrame, nullptr, frame, &buffer);
+    if (length >= 0)
+        bytes.assign(static_cast<const std::uint8_t *>(buffer), length);
+
+    std::free(buffer);
+    return length >= 0;
+}
+
+static inline bool get_bit(bytes_t const &bytes, std::size_t bit) noexcept {
+    return bytes[bit / 8] & (0x80 >> (bit % 8));
+}
+
+// Find the first and last bits that differ, which must be the same length
+static bool compare(bytes_t const &a, bytes_t const &b, std::size_t &first, std::size_t &last) noexcept {
+    bool found = false;
+    for (std::size_t i = 0; i < a.length(); i++) {
+        unsigned int diff = a[i] ^ b[i];
+        if (!diff)
+            continue;
+
+        if (!found)
+            first = i * 8 + __builtin_clz(diff) - (8 * (sizeof(unsigned int) - 1));
+
+        last = i * 8 + 7 - __builtin_ctz(diff);
+        found = true;
+    }
+
+    return found;
+}
+
+static long read(bytes_t const &bytes, std::size_t offset, std::size_t width) noexcept {
+    long value = 0;
+    for (std::size_t i = 0; i < width; i++)
+        value = (value << 1) | get_bit(bytes, offset + i);
+
+    return value;
+}
+
+static asn_per_constraint_t const &get_range(asn_TYPE_descriptor_t const &td) noexcept {
+    return td.encoding_constraints.per_constraints->value;
+}
+
+SpatTemplate::SpatTemplate(MessageFrame const &frame) {
+    if (frame.value.present != MessageFrame__value_PR_SPAT || !encode(&frame, _bytes))
+        return;
+
+    // Work from a decoded copy, so the values can be changed without touching the original
+    MessageFrame *tmp = nullptr;
+    auto ret = uper_decode_complete(nullptr, &asn_DEF_MessageFrame, (void **)&tmp, _bytes.data(), _bytes.length());
+    std::unique_ptr<MessageFrame, void (*)(MessageFrame *)> copy {
+            tmp, [](MessageFrame *ptr) { ASN_STRUCT_FREE(asn_DEF_MessageFrame, ptr); } };
+    if (ret.code != RC_OK || !copy)
+        return;
+
+    static auto const &_moy = get_range(asn_DEF_MinuteOfTheYear);
+    static auto const &_dsec = get_range(asn_DEF_DSecond);
+    static auto const &_state = get_range(asn_DEF_MovementPhaseState);
+
+    auto &spat = copy->value.choice.SPAT;
+    _intersections.resize(spat.intersections.list.count);
+    for (std::size_t i = 0; i < _intersections.size(); i++) {
+        auto *intxn = spat.intersections.list.array[i];
+        auto &patches = _intersections[i];
+
+        if (intxn->moy && !Locate(copy.get(), [intxn](long v) { *(intxn->moy) = v; },
+                                  _moy.lower_bound, _moy.upper_bound, *(intxn->moy), patches.MinuteOfTheYear))
+            return;
+
+        if (intxn->timeStamp && !Locate(copy.get(), [intxn](long v) { *(intxn->timeStamp) = v; },
+                                        _dsec.lower_bound, _dsec.upper_bound, *(intxn->timeStamp), patches.TimeStamp))
+            return;
+
+        if (intxn->status.size != 2 || intxn->status.bits_unused)
+            return;
+
+        long status = (intxn->status.buf[0] << 8) | intxn->status.buf[1];
+        if (!Locate(copy.get(), [intxn](long v) { intxn->status.buf[0] = v >> 8; intxn->status.buf[1] = v & 0xFF; },
+                    0, 0xFFFF, status, patches.Status))
+            return;
+
+        patches.EventStates.resize(intxn->states.list.count);
+        for (std::size_t j = 0; j < patches.EventStates.size(); j++) {
+            auto &events = intxn->states.list.array[j]->state_time_speed.list;
+
+            patches.EventStates[j].resize(events.count);
+            for (std::size_t k = 0; k < patches.EventStates[j].size(); k++) {
+                auto *event = events.array[k];
+                if (!Locate(copy.get(), [event](long v) { event->eventState = v; },
+                            _state.lower_bound, _state.upper_bound, event->eventState, patches.EventStates[j][k]))
+                    return;
+            }
+        }
+    }
+
+    _loaded = true;
+}
+
+template <typename _Setter>
+bool SpatTemplate::Locate(MessageFrame *frame, _Setter set, long lb, long ub, long current, Patch &patch) {
+    bytes_t low, next, high;
+
+    set(lb);
+    bool ok = encode(frame, low);
+    set(lb + 1);
+    ok = ok && encode(frame, next);
+    set(ub);
+    ok = ok && encode(frame, high);
+    set(current);
+
+    // Any change in the length means the field is not a fixed width
+    if (!ok || low.length() != _bytes.length() || next.length() != _bytes.length() ||
+            high.length() != _bytes.length()) {
+        TLOG(DEBUG) << "SPAT template field is not fixed width";
+        return false;
+    }
+
+    // The upper bound sets the most significant bit, and the next value sets the least significant bit
+    std::size_t first, last, lsb, tmp;
+    if (!compare(low, high, first, last) || !compare(low, next, lsb, tmp) || lsb != tmp || last > lsb)
+        return false;
+
+    patch.Offset = first;
+    patch.Width = lsb - first + 1;
+    patch.LowerBound = lb;
+    patch.UpperBound = ub;
+
+    // Make sure the field is encoded as a plain offset from the lower bound
+    if (patch.Width >= 8 * sizeof(long) || read(high, patch.Offset, patch.Width) != ub - lb ||
+            read(low, patch.Offset, patch.Width) != 0) {
+        TLOG(DEBUG) << "SPAT template field at bit " << patch.Offset << " is not a constrained whole number";
+        patch.Width = 0;
+        return false;
+    }
+
+    return true;
+}
+
+bool SpatTemplate::Write(Patch const &patch, long value) noexcept {
+    if (!patch.Width || value < patch.LowerBound || value > patch.UpperBound)
+        return false;
+
+    std::uint64_t bits = value - patch.LowerBound;
+    for (std::size_t i = 0; i < patch.Width; i++) {
+        std::size_t bit = patch.Offset + i;
+        std::uint8_t mask = 0x80 >> (bit % 8);
+        if ((bits >> (patch.Width - i - 1)) & 0x01)
+            _bytes[bit / 8] |= mask;
+        else
+            _bytes[bit / 8] &= ~mask;
+    }
+
+    return true;
+}
+
+bool SpatTemplate::IsLoaded() const noexcept {
+    return _loaded;
+}
+
+bool SpatTemplate::SetMinuteOfTheYear(std::size_t intersection, MinuteOfTheYear_t value) noexcept {
+    return _loaded && intersection < _intersections.size() &&
+           Write(_intersections[intersection].MinuteOfTheYear, value);
+}
+
+bool SpatTemplate::SetTimeStamp(std::size_t intersection, DSecond_t value) noexcept {
+    return _loaded && intersection < _intersections.size() &&
+           Write(_intersections[intersection].TimeStamp, value);
+}
+
+bool SpatTemplate::SetStatus(std::size_t intersection, std::uint16_t value) noexcept {
+    return _loaded && intersection < _intersections.size() &&
+           Write(_intersections[intersection].Status, value);
+}
+
+bool SpatTemplate::SetEventState(std::size_t intersection, std::size_t movement, std::size_t event,
+                                 MovementPhaseState_t value) noexcept {
+    if (!_loaded || intersection >= _intersections.size())
+        return false;
+
+    auto &states = _intersections[intersection].EventStates;
+    if (movement >= states.size() || event >= states[movement].size())
+        return false;
+
+    return Write(states[movement][event], value);
+}
+
+std::basic_string<std::uint8_t> const &SpatTemplate::GetBytes() const noexcept {
+    return _bytes;
+}
+
+}}}} // namespace tmx::plugin::utils::interxn
@@ -0,0 +1,176 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file InputSource.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/plugin/utils/io/InputSource.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <system_error>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace io {
+
+static int open_eventfd() {
+    int fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd < 0)
+        throw std::system_error(errno, std::generic_category(), "Unable to open event descriptor");
+
+    return fd;
+}
+
+static void signal_eventfd(int fd) {
+    std::uint64_t one = 1;
+    while (::write(fd, &one, sizeof(one)) < 0 && errno == EINTR);
+}
+
+static void drain_eventfd(int fd) {
+    std::uint64_t count;
+    while (::read(fd, &count, sizeof(count)) < 0 && errno == EINTR);
+}
+
+FdInputSource::FdInputSource(int fd, handler_type handler, std::size_t bufferSize):
+        _fd(fd), _handler(std::move(handler)), _buffer(bufferSize ? bufferSize : 1) {
+    int flags = ::fcntl(_fd, F_GETFL);
+    if (flags >= 0)
+        ::fcntl(_fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+int FdInputSource::get_fd() const noexcept {
+    return _fd;
+}
+
+bool FdInputSource::on_ready(input_clock::time_point when) {
+    while (true) {
+        auto n = ::read(_fd, _buffer.data(), _buffer.size());
+        if (n > 0) {
+            if (_handler)
+                _handler(_buffer.data(), (std::size_t) n, when);
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return true;
+        } else {
+            // End of file, or a read error
+            _fd = -1;
+            return false;
+        }
+    }
+}
+
+EdgeInputSource::EdgeInputSource(handler_type handler, bool level):
+        _fd(open_eventfd()), _handler(std::move(handler)), _level(level) { }
+
+EdgeInputSource::~EdgeInputSource() {
+    ::close(_fd);
+}
+
+bool EdgeInputSource::set_level(bool level, input_clock::time_point when) {
+    std::lock_guard<std::mutex> lock(_lock);
+    if (_level.exchange(level) == level)
+        return false;
+
+    _edges.emplace_back(level, when);
+    signal_eventfd(_fd);
+    return true;
+}
+
+bool EdgeInputSource::get_level() const noexcept {
+    return _level;
+}
+
+int EdgeInputSource::get_fd() const noexcept {
+    return _fd;
+}
+
+bool EdgeInputSource::on_ready(input_clock::time_point) {
+    decltype(_edges) edges;
+
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        drain_eventfd(_fd);
+        edges.swap(_edges);
+    }
+
+    // The edges carry the time they were sampled, not the time they were seen here
+    if (_handler) {
+        for (auto const &edge: edges)
+            _handler(edge.first, edge.second);
+    }
+
+    return true;
+}
+
+InputMonitor::InputMonitor(): _wakeFd(open_eventfd()) { }
+
+InputMonitor::~InputMonitor() {
+    ::close(_wakeFd);
+}
+
+void InputMonitor::add(InputSource &source) {
+    std::lock_guard<std::mutex> lock(_lock);
+    if (std::find(_sources.begin(), _sources.end(), &source) == _sources.end())
+        _sources.push_back(&source);
+}
+
+void InputMonitor::remove(InputSource &source) {
+    std::lock_guard<std::mutex> lock(_lock);
+    _sources.erase(std::remove(_sources.begin(), _sources.end(), &source), _sources.end());
+}
+
+std::size_t InputMonitor::wait(std::chrono::milliseconds timeout) {
+    std::vector<InputSource *> sources;
+    std::vector<struct pollfd> fds;
+
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        sources = _sources;
+    }
+
+    fds.reserve(sources.size() + 1);
+    fds.push_back({ _wakeFd, POLLIN, 0 });
+    for (auto src: sources)
+        fds.push_back({ src->get_fd(), POLLIN, 0 });
+
+    int ms = timeout.count() < 0 ? -1 : (int) std::min<std::chrono::milliseconds::rep>(timeout.count(), INT32_MAX);
+    int rc = ::poll(fds.data(), fds.size(), ms);
+    auto now = input_clock::now();
+
+    if (rc <= 0)
+        return 0;
+
+    if (fds[0].revents)
+        drain_eventfd(_wakeFd);
+
+    std::size_t ready = 0;
+    for (std::size_t i = 1; i < fds.size(); i++) {
+        if (!fds[i].revents)
+            continue;
+
+        ready++;
+        if (fds[i].revents & POLLNVAL || !sources[i - 1]->on_ready(now))
+            this->remove(*sources[i - 1]);
+    }
+
+    return ready;
+}
+
+void InputMonitor::wake() {
+    signal_eventfd(_wakeFd);
+}
+
+}}}} // namespace tmx::plugin::utils::io
@@ -0,0 +1,75 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file PseudoTerminal.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/plugin/utils/io/PseudoTerminal.hpp>
+
+#include <cerrno>
+#include <cstdlib>
+#include <system_error>
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace io {
+
+PseudoTerminal::PseudoTerminal(): _fd(::posix_openpt(O_RDWR | O_NOCTTY | O_CLOEXEC)) {
+    if (_fd < 0)
+        throw std::system_error(errno, std::generic_category(), "Unable to open pseudo-terminal");
+
+    char name[128];
+    if (::grantpt(_fd) || ::unlockpt(_fd) || ::ptsname_r(_fd, name, sizeof(name))) {
+        int err = errno;
+        ::close(_fd);
+        throw std::system_error(err, std::generic_category(), "Unable to unlock pseudo-terminal");
+    }
+
+    _deviceName = name;
+
+    // Pass the bytes through untouched, like a serial line
+    struct termios tty;
+    if (::tcgetattr(_fd, &tty) == 0) {
+        ::cfmakeraw(&tty);
+        ::tcsetattr(_fd, TCSANOW, &tty);
+    }
+}
+
+PseudoTerminal::~PseudoTerminal() {
+    ::close(_fd);
+}
+
+std::string const &PseudoTerminal::get_device_name() const noexcept {
+    return _deviceName;
+}
+
+int PseudoTerminal::get_fd() const noexcept {
+    return _fd;
+}
+
+long PseudoTerminal::write(std::uint8_t const *data, std::size_t length) {
+    std::size_t total = 0;
+    while (total < length) {
+        auto n = ::write(_fd, data + total, length - total);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0)
+            return -1;
+
+        total += n;
+    }
+
+    return (long) total;
+}
+
+}}}} // namespace tmx::plugin::utils::io
@@ -0,0 +1,217 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file SimulatedMessageEncoder.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/plugin/utils/sim/SimulatedMessageEncoder.hpp>
+
+#include <tmx/common/platform/iteration/cursor.hpp>
+#include <tmx/message/j2735/202007/MessageFrame.h>
+#include <tmx/message/j2735/202007/RequestorPositionVector.h>
+#include <tmx/message/j2735/202007/RequestorType.h>
+#include <tmx/message/j2735/202007/TransmissionAndSpeed.h>
+
+#include <algorithm>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace sim {
+
+EncodeArena::EncodeArena(std::size_t size):
+        _memory(new std::max_align_t[(size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)]),
+        _size(size) { }
+
+void *EncodeArena::allocate(std::size_t size, std::size_t align) noexcept {
+    std::size_t start = (_used + align - 1) / align * align;
+    if (start + size > _size)
+        return nullptr;
+
+    auto ptr = reinterpret_cast<std::uint8_t *>(_memory.get()) + start;
+    std::memset(ptr, 0, size);
+    _used = start + size;
+    return ptr;
+}
+
+void EncodeArena::reset() noexcept {
+    _used = 0;
+}
+
+std::size_t EncodeArena::get_used() const noexcept {
+    return _used;
+}
+
+/*!
+ * @brief Read the next 4 byte network order value, moving past it
+ */
+static inline std::uint32_t read_uint32(common::byte_sequence const &bytes, std::size_t &i) noexcept {
+    auto val = common::get_value<std::uint32_t>(bytes.substr(i, 4));
+    i += 4;
+    return val;
+}
+
+SimulatedMessageEncoder::SimulatedMessageEncoder(std::size_t bufferSize): _buffer(bufferSize) { }
+
+SimulatedMessageEncoder &SimulatedMessageEncoder::get_thread_encoder() {
+    static thread_local SimulatedMessageEncoder _encoder;
+    return _encoder;
+}
+
+bool SimulatedMessageEncoder::parse_bsm(common::byte_sequence const &bytes, SimulatedVehicle &vehicle) noexcept {
+    if (bytes.length() != 24)
+        return false;
+
+    std::size_t i = 0;
+    vehicle.id = read_uint32(bytes, i);
+    vehicle.heading = read_uint32(bytes, i) / 1000000.0;
+    vehicle.speed = read_uint32(bytes, i) / 1000.0;
+    vehicle.latitude = read_uint32(bytes, i) / 1000000.0 - 180.0;
+    vehicle.longitude = read_uint32(bytes, i) / 1000000.0 - 180.0;
+    vehicle.elevation = read_uint32(bytes, i) / 1000.0 - 500.0;
+    return true;
+}
+
+bool SimulatedMessageEncoder::parse_srm(common::byte_sequence const &bytes, SimulatedVehicle &vehicle) noexcept {
+    if (bytes.length() != 24)
+        return false;
+
+    std::size_t i = 0;
+    vehicle.id = read_uint32(bytes, i);
+    vehicle.heading = read_uint32(bytes, i) / 1000000.0;
+    vehicle.speed = read_uint32(bytes, i) / 1000.0;
+    vehicle.latitude = read_uint32(bytes, i) / 1000000.0 - 180.0;
+    vehicle.longitude = read_uint32(bytes, i) / 1000000.0 - 180.0;
+    vehicle.role = read_uint32(bytes, i);
+    return true;
+}
+
+bool SimulatedMessageEncoder::parse_vbm(common::byte_sequence const &bytes,
+                                        SimulatedVehicleBasics &vehicle) noexcept {
+    if (bytes.length() != 15)
+        return false;
+
+    std::size_t i = 0;
+    vehicle.id = read_uint32(bytes, i);
+    vehicle.speed = read_uint32(bytes, i) / 1000.0;
+    vehicle.gearPosition = static_cast<std::uint8_t>(bytes[i++]);
+    vehicle.turnSignalPosition = static_cast<std::uint8_t>(bytes[i++]);
+    vehicle.flags = static_cast<std::uint8_t>(bytes[i++]);
+    vehicle.acceleration = static_cast<std::int32_t>(read_uint32(bytes, i)) / 1000.0;
+    return true;
+}
+
+common::byte_sequence SimulatedMessageEncoder::encode(void const *frame) {
+    auto ret = uper_encode_to_buffer(&asn_DEF_MessageFrame, nullptr, frame, _buffer.data(), _buffer.size());
+    if (ret.encoded <= 0)
+        return { };
+
+    return { reinterpret_cast<common::byte_t const *>(_buffer.data()), (std::size_t) (ret.encoded + 7) / 8 };
+}
+
+common::byte_sequence SimulatedMessageEncoder::encode_bsm(SimulatedVehicle const &vehicle,
+                                                          std::chrono::system_clock::time_point when,
+                                                          long messageId) {
+    _arena.reset();
+
+    auto frame = _arena.make<MessageFrame>();
+    auto id = static_cast<std::uint8_t *>(_arena.allocate(4, 1));
+    auto wheelBrakes = static_cast<std::uint8_t *>(_arena.allocate(1, 1));
+    if (!frame || !id || !wheelBrakes)
+        return { };
+
+    frame->messageId = messageId;
+    frame->value.present = MessageFrame__value_PR_BasicSafetyMessage;
+    auto &core = frame->value.choice.BasicSafetyMessage.coreData;
+
+    core.msgCnt = 0;
+
+    std::memcpy(id, &vehicle.id, 4);
+    core.id.size = 4;
+    core.id.buf = id;
+
+    core.secMark = (std::chrono::duration_cast<std::chrono::milliseconds>(when.time_since_epoch()) -
+                    std::chrono::duration_cast<std::chrono::minutes>(when.time_since_epoch())).count();
+
+    // Latitude and Longitude are expressed in 1/10th integer microdegrees, as a 31 bit value.
+    core.lat = (Latitude_t) (10000000.0 * vehicle.latitude);
+    core.Long = (Longitude_t) (10000000.0 * vehicle.longitude);
+
+    // Elevation is in units of 10 cm steps.
+    core.elev = std::clamp<Elevation_t>(10.0 * vehicle.elevation, -4095, 61439);
+
+    // Convert from mps to .02 meters/sec.
+    core.speed = 50.0 * vehicle.speed;
+
+    // Heading units are 0.0125 degrees.
+    core.heading = std::clamp<Heading_t>(80.0 * vehicle.heading, 0, 28799);
+
+    // Steering Wheel Angle units are 1.5 degrees (-126 to 127).
+    core.angle = 127;
+    core.transmission = TransmissionState_unavailable;
+
+    core.brakes.wheelBrakes.buf = wheelBrakes;
+    core.brakes.wheelBrakes.size = 1;
+    core.brakes.wheelBrakes.bits_unused = 3;
+
+    core.brakes.traction = TractionControlStatus_unavailable;
+    core.brakes.abs = AntiLockBrakeStatus_unavailable;
+    core.brakes.scs = StabilityControlStatus_unavailable;
+    core.brakes.brakeBoost = BrakeBoostApplied_unavailable;
+    core.brakes.auxBrakes = AuxiliaryBrakeStatus_unavailable;
+
+    return this->encode(frame);
+}
+
+common::byte_sequence SimulatedMessageEncoder::encode_srm(SimulatedVehicle const &vehicle,
+                                                          std::chrono::system_clock::time_point when,
+                                                          long messageId) {
+    _arena.reset();
+
+    auto frame = _arena.make<MessageFrame>();
+    auto id = static_cast<std::uint8_t *>(_arena.allocate(4, 1));
+    auto type = _arena.make<RequestorType>();
+    auto position = _arena.make<RequestorPositionVector>();
+    auto heading = _arena.make<Angle_t>();
+    auto speed = _arena.make<TransmissionAndSpeed>();
+    if (!frame || !id || !type || !position || !heading || !speed)
+        return { };
+
+    frame->messageId = messageId;
+    frame->value.present = MessageFrame__value_PR_SignalRequestMessage;
+    auto &srm = frame->value.choice.SignalRequestMessage;
+
+    srm.second = (std::chrono::duration_cast<std::chrono::milliseconds>(when.time_since_epoch()) -
+                  std::chrono::duration_cast<std::chrono::minutes>(when.time_since_epoch())).count();
+
+    std::memcpy(id, &vehicle.id, 4);
+    srm.requestor.id.present = VehicleID_PR_entityID;
+    srm.requestor.id.choice.entityID.size = 4;
+    srm.requestor.id.choice.entityID.buf = id;
+
+    type->role = (BasicVehicleRole_t) vehicle.role;
+    srm.requestor.type = type;
+
+    position->position.lat = (Latitude_t) (10000000.0 * vehicle.latitude);
+    position->position.Long = (Longitude_t) (10000000.0 * vehicle.longitude);
+
+    // Heading units are 0.0125 degrees.
+    *heading = std::clamp<Angle_t>(80.0 * vehicle.heading, 0, 28799);
+    position->heading = heading;
+
+    // Convert from mps to .02 meters/sec.
+    speed->transmisson = TransmissionState_unavailable;
+    speed->speed = 50.0 * vehicle.speed;
+    position->speed = speed;
+
+    srm.requestor.position = position;
+
+    return this->encode(frame);
+}
+
+}}}} // namespace tmx::plugin::utils::sim
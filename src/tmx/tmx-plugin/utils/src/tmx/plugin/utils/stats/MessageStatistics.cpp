@@ -0,0 +1,149 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file MessageStatistics.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <tmx/plugin/utils/stats/MessageStatistics.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace stats {
+
+static constexpr std::uint64_t COUNT_MASK = 0xFFFFFFFF;
+
+/*!
+ * @brief The FNV-1a hash of the source name, which is never zero
+ */
+static std::uint64_t hash_source(common::const_string name) noexcept {
+    std::uint64_t h = 0xcbf29ce484222325ULL;
+    for (auto c: name) {
+        h ^= static_cast<std::uint8_t>(c);
+        h *= 0x100000001b3ULL;
+    }
+
+    return h ? h : 1;
+}
+
+MessageStatistics::MessageStatistics() noexcept: _epoch(clock_type::now()) {
+    for (auto &src: _sources) {
+        src.name[0] = '\0';
+        for (auto &bucket: src.buckets)
+            bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::uint32_t MessageStatistics::get_second(clock_type::time_point when) const noexcept {
+    if (when < _epoch)
+        return 0;
+
+    return static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::seconds>(when - _epoch).count());
+}
+
+MessageStatistics::Source *MessageStatistics::get_source(common::const_string name) noexcept {
+    const auto key = hash_source(name);
+
+    // Open addressing, so a source always lands in the same slot once it has one
+    for (std::size_t i = 0; i < MAX_SOURCES; i++) {
+        auto &src = _sources[(key + i) % MAX_SOURCES];
+
+        auto k = src.key.load(std::memory_order_acquire);
+        if (k == key)
+            return &src;
+
+        if (k == 0 && src.key.compare_exchange_strong(k, key, std::memory_order_acq_rel)) {
+            // This thread claimed the slot, so the name is only written once
+            auto len = std::min(name.length(), sizeof(src.name) - 1);
+            std::memcpy(src.name, name.data(), len);
+            src.name[len] = '\0';
+            src.named.store(true, std::memory_order_release);
+            return &src;
+        }
+
+        // Another thread may have just claimed the slot for the same source
+        if (k == key)
+            return &src;
+    }
+
+    return nullptr;
+}
+
+void MessageStatistics::count(std::uint16_t messageId, std::size_t bytes, common::const_string source,
+                              clock_type::time_point when) noexcept {
+    if (messageId < MAX_MESSAGE_IDS) {
+        _messages[messageId].count.fetch_add(1, std::memory_order_relaxed);
+        _messages[messageId].bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    if (source.empty())
+        return;
+
+    auto src = this->get_source(source);
+    if (!src)
+        return;
+
+    src->count.fetch_add(1, std::memory_order_relaxed);
+
+    // Start the bucket over if it is left from an older second
+    const std::uint64_t sec = this->get_second(when);
+    auto &bucket = src->buckets[sec % RATE_BUCKETS];
+    auto val = bucket.load(std::memory_order_relaxed);
+    while (!bucket.compare_exchange_weak(val, (val >> 32) == sec ? val + 1 : (sec << 32) | 1,
+                                         std::memory_order_relaxed));
+}
+
+void MessageStatistics::count_bytes(std::size_t bytes) noexcept {
+    _totals.bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void MessageStatistics::snapshot(Snapshot &out, clock_type::time_point now) const {
+    out.time = now;
+    out.totalBytes = _totals.bytes.load(std::memory_order_relaxed);
+
+    out.messages.clear();
+    for (std::size_t i = 0; i < MAX_MESSAGE_IDS; i++) {
+        auto cnt = _messages[i].count.load(std::memory_order_relaxed);
+        if (cnt)
+            out.messages.push_back({ static_cast<std::uint16_t>(i), cnt,
+                                     _messages[i].bytes.load(std::memory_order_relaxed) });
+    }
+
+    // The rate only uses whole seconds, so the one in progress is left out
+    const std::uint64_t sec = this->get_second(now);
+    const std::uint64_t secs = std::min<std::uint64_t>(sec, RATE_WINDOW_SECONDS);
+
+    std::size_t n = 0;
+    for (auto const &src: _sources) {
+        if (!src.named.load(std::memory_order_acquire))
+            continue;
+
+        std::uint64_t inWindow = 0;
+        for (auto const &bucket: src.buckets) {
+            auto val = bucket.load(std::memory_order_relaxed);
+            auto bucketSec = val >> 32;
+            if (bucketSec < sec && bucketSec + secs >= sec)
+                inWindow += val & COUNT_MASK;
+        }
+
+        if (n == out.sources.size())
+            out.sources.emplace_back();
+
+        auto &cnt = out.sources[n++];
+        cnt.source.assign(src.name);
+        cnt.count = src.count.load(std::memory_order_relaxed);
+        cnt.rate = secs ? (double) inWindow / secs : 0.0;
+    }
+
+    out.sources.resize(n);
+}
+
+}}}} // namespace tmx::plugin::utils::stats
@@ -0,0 +1,298 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file XerJsonWriter_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <tmx/plugin/utils/XerJsonWriter.hpp>
+#include <tmx/message/j2735/202007/MessageFrame.h>
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace test {
+
+typedef boost::property_tree::ptree tree_type;
+
+static const tree_type _empty;
+
+// A MAP message for the 5th and Perry intersection, taken from the MapPlugin manifest
+static const char *TEST_MAP_BYTES =
+        "0012810B380130002073BE054D75DCBE9CAAC13A198C02DC0AC814657CBCFA20C3C3872DF871E8140000003124C5B9014140179B"
+        "608AA6EE20A365F21998DA91042363E886BC34DA43765A3411E5AF9844424E51732C0814143352B02064A75CB0C4E2AE00D85C00"
+        "0E77C04059078C8B879F44187870E5BF0E3D06800000010B1EAD349E424FB2BD42CC7C0A0A0E26A3A1B1F8001CEF80808805D900"
+        "0000042CF88FB17784D90B88A6983EDE83880FE900000004918F55C0A0A006CB604D0B2719F99BE6E85054EDFCBA6841D3961C7A"
+        "C89804004000B4EF6457503A0480C94C000E77C09C0A4AA7BFAF4D083A72C38F5A230080080A0C282E0E430600ECC650E9949C2C"
+        "917C71E7962DA4CF262460";
+
+static const char *TEST_SPAT_XER =
+        "<SPAT><timeStamp>412312</timeStamp><intersections><IntersectionState>"
+        "<name>5th &amp; Perry  &lt;N/S&gt; \"A\"</name><id><id>1301</id></id><revision>7</revision>"
+        "<status>0010000000000000</status><moy>412312</moy><timeStamp>35176</timeStamp><states>"
+        "<MovementState><signalGroup>1</signalGroup><state-time-speed>"
+        "<MovementEvent><eventState><protected-Movement-Allowed/></eventState>"
+        "<timing><minEndTime>22010</minEndTime><maxEndTime>22510</maxEndTime></timing></MovementEvent>"
+        "<MovementEvent><eventState><stop-And-Remain/></eventState>"
+        "<timing><minEndTime>22310</minEndTime></timing></MovementEvent>"
+        "</state-time-speed></MovementState>"
+        "<MovementState><signalGroup>2</signalGroup><state-time-speed>"
+        "<MovementEvent><eventState><stop-And-Remain/></eventState>"
+        "<timing><minEndTime>22020</minEndTime></timing></MovementEvent>"
+        "</state-time-speed></MovementState>"
+        "</states></IntersectionState></intersections></SPAT>";
+
+static const char *TEST_BSM_XER =
+        "<BasicSafetyMessage><coreData>"
+        "<msgCnt>12</msgCnt><id>A1B2C3D4</id><secMark>35176</secMark>"
+        "<lat>399652654</lat><long>-830296342</long><elev>2140</elev>"
+        "<accuracy><semiMajor>40</semiMajor><semiMinor>30</semiMinor><orientation>12000</orientation></accuracy>"
+        "<transmission><forwardGears/></transmission><speed>650</speed><heading>4520</heading><angle>5</angle>"
+        "<accelSet><long>20</long><lat>-3</lat><vert>0</vert><yaw>12</yaw></accelSet>"
+        "<brakes><wheelBrakes>00100</wheelBrakes><traction><off/></traction><abs><on/></abs><scs><on/></scs>"
+        "<brakeBoost><unavailable/></brakeBoost><auxBrakes><unavailable/></auxBrakes></brakes>"
+        "<size><width>190</width><length>480</length></size>"
+        "</coreData></BasicSafetyMessage>";
+
+// The repairs from the CV inspector plugin
+static const char *TEST_REPAIRS =
+        "<TreeRepair>"
+        "<MapData><fix_xml_arrays>"
+        "<path>MapData.intersections</path>"
+        "<path>MapData.intersections..laneSet</path>"
+        "<path>MapData.intersections..laneSet..nodeList.nodes</path>"
+        "<path>MapData.intersections..laneSet..connectsTo</path>"
+        "</fix_xml_arrays><del_unnecessary_nodes>"
+        "<path>MapData.intersections..laneSet..nodeList.nodes..delta</path>"
+        "</del_unnecessary_nodes><flatten_node>"
+        "<path>MapData.intersections..laneSet..laneAttributes.laneType</path>"
+        "</flatten_node></MapData>"
+        "<SPAT><fix_xml_arrays>"
+        "<path>SPAT.intersections</path>"
+        "<path>SPAT.intersections..states</path>"
+        "</fix_xml_arrays><flatten_node>"
+        "<path>SPAT.intersections..states..state-time-speed.MovementEvent.eventState</path>"
+        "</flatten_node></SPAT>"
+        "</TreeRepair>";
+
+typedef decltype(MessageFrame::value.choice) MessageFrame_value_t;
+
+std::shared_ptr<MessageFrame> decode_hex(std::string const &hex) {
+    std::vector<std::uint8_t> bytes;
+    for (std::size_t i = 0; i + 1 < hex.length(); i += 2)
+        bytes.push_back(std::stoi(hex.substr(i, 2), nullptr, 16));
+
+    MessageFrame *frame = nullptr;
+    auto ret = asn_decode(nullptr, ATS_UNALIGNED_BASIC_PER, &asn_DEF_MessageFrame, (void **)&frame,
+                          bytes.data(), bytes.size());
+    std::shared_ptr<MessageFrame> _frame { frame, [](auto *ptr) { ASN_STRUCT_FREE(asn_DEF_MessageFrame, ptr); } };
+    BOOST_REQUIRE_EQUAL(RC_OK, ret.code);
+    return _frame;
+}
+
+// The XER decoder skips over the open type value, so the message is decoded on its own and then framed
+template <typename _T>
+std::shared_ptr<MessageFrame> decode_xer(std::string const &xer, asn_TYPE_descriptor_t *td, DSRCmsgID_t id,
+                                         MessageFrame__value_PR present, _T MessageFrame_value_t::*member) {
+    _T *value = nullptr;
+    auto ret = asn_decode(nullptr, ATS_BASIC_XER, td, (void **)&value, xer.data(), xer.length());
+    if (ret.code != RC_OK)
+        ASN_STRUCT_FREE(*td, value);
+    BOOST_REQUIRE_EQUAL(RC_OK, ret.code);
+
+    std::shared_ptr<MessageFrame> frame { static_cast<MessageFrame *>(std::calloc(1, sizeof(MessageFrame))),
+                                          [](auto *ptr) { ASN_STRUCT_FREE(asn_DEF_MessageFrame, ptr); } };
+    frame->messageId = id;
+    frame->value.present = present;
+    frame->value.choice.*member = *value;
+    std::free(value);
+    return frame;
+}
+
+/*!
+ * The legacy conversion, which prints the XER, reads it into a property tree,
+ * repairs the tree and writes it back out
+ */
+struct legacy_converter {
+    template <typename _Fn>
+    static void repair(_Fn fn, tree_type &pt, tree_type::path_type path) {
+        if (path.empty())
+            return;
+
+        if (path.single()) {
+            auto child = pt.get_child_optional(path);
+            if (child)
+                fn(child.get());
+        } else {
+            auto head = path.reduce();
+            for (auto &child: pt) {
+                if (child.first == head)
+                    repair(fn, child.second, path);
+            }
+        }
+    }
+
+    static std::string convert(MessageFrame const &frame, tree_type const &repairs) {
+        char *buffer = nullptr;
+        size_t size = 0;
+        FILE *stream = open_memstream(&buffer, &size);
+        BOOST_REQUIRE(stream);
+        BOOST_REQUIRE_EQUAL(0, xer_fprint(stream, &asn_DEF_MessageFrame, &frame));
+        fclose(stream);
+
+        std::istringstream is { std::string(buffer, size) };
+        std::free(buffer);
+
+        tree_type msgTree;
+        boost::property_tree::read_xml(is, msgTree, boost::property_tree::xml_parser::trim_whitespace);
+        auto &value = msgTree.get_child("MessageFrame.value");
+        auto root = "TreeRepair." + value.front().first + ".";
+
+        for (auto &path: repairs.get_child(root + "fix_xml_arrays", _empty))
+            repair([](tree_type &pt) {
+                tree_type copy { pt };
+                pt.clear();
+                for (auto &child: copy)
+                    pt.push_back({ "", child.second });
+            }, value, path.second.data());
+
+        for (auto &path: repairs.get_child(root + "del_unnecessary_nodes", _empty))
+            repair([](tree_type &pt) {
+                tree_type copy { pt };
+                pt.clear();
+                for (auto &child: copy)
+                    for (auto &grandchild: child.second)
+                        pt.push_back(grandchild);
+            }, value, path.second.data());
+
+        for (auto &path: repairs.get_child(root + "flatten_node", _empty))
+            repair([](tree_type &pt) {
+                tree_type copy { pt };
+                pt.clear();
+                pt.put_value(copy.begin()->first);
+            }, value, path.second.data());
+
+        std::ostringstream os;
+        boost::property_tree::write_json(os, value, false);
+        return os.str();
+    }
+};
+
+struct writer_fixture {
+    tree_type repairs;
+    XerJsonWriter writer;
+
+    writer_fixture() {
+        std::istringstream is { TEST_REPAIRS };
+        boost::property_tree::read_xml(is, repairs, boost::property_tree::xml_parser::trim_whitespace);
+
+        for (auto &msg: repairs.get_child("TreeRepair")) {
+            for (auto &path: msg.second.get_child("fix_xml_arrays", _empty))
+                writer.add_repair(XerJsonWriter::FixArrays, path.second.data());
+            for (auto &path: msg.second.get_child("del_unnecessary_nodes", _empty))
+                writer.add_repair(XerJsonWriter::DeleteNodes, path.second.data());
+            for (auto &path: msg.second.get_child("flatten_node", _empty))
+                writer.add_repair(XerJsonWriter::FlattenNode, path.second.data());
+        }
+    }
+
+    std::string write(MessageFrame const &frame) {
+        auto const &member = asn_DEF_MessageFrame.elements[1];
+        BOOST_REQUIRE_EQUAL(std::string("value"), member.name);
+
+        std::string json;
+        BOOST_REQUIRE(writer.write(json, *member.type, (char const *)&frame + member.memb_offset));
+        return json;
+    }
+
+    void check(MessageFrame const &frame) {
+        auto expected = legacy_converter::convert(frame, repairs);
+        BOOST_CHECK_EQUAL(expected, write(frame));
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(xer_json_writer_test_suite, writer_fixture)
+
+BOOST_AUTO_TEST_CASE(TestMap) {
+    auto frame = decode_hex(TEST_MAP_BYTES);
+    BOOST_REQUIRE_EQUAL(MessageFrame__value_PR_MapData, frame->value.present);
+    check(*frame);
+
+    auto json = write(*frame);
+    BOOST_CHECK_EQUAL(0, json.find("{\"MapData\":{"));
+    BOOST_CHECK_NE(std::string::npos, json.find("\"intersections\":[{"));
+    BOOST_CHECK_NE(std::string::npos, json.find("\"laneType\":\"vehicle\""));
+}
+
+BOOST_AUTO_TEST_CASE(TestSpat) {
+    auto frame = decode_xer(TEST_SPAT_XER, &asn_DEF_SPAT, 19, MessageFrame__value_PR_SPAT,
+                            &MessageFrame_value_t::SPAT);
+    check(*frame);
+
+    auto json = write(*frame);
+    BOOST_CHECK_NE(std::string::npos, json.find("\"name\":\"5th & Perry <N\\/S> \\\"A\\\"\""));
+    BOOST_CHECK_NE(std::string::npos, json.find("\"status\":\"0010000000000000\""));
+
+    // Every movement event is flattened, but the movement events are still repeated keys
+    BOOST_CHECK_NE(std::string::npos, json.find("{\"MovementEvent\":{\"eventState\":\"protected-Movement-Allowed\","));
+    BOOST_CHECK_NE(std::string::npos, json.find(",\"MovementEvent\":{\"eventState\":\"stop-And-Remain\","));
+}
+
+BOOST_AUTO_TEST_CASE(TestBsm) {
+    auto frame = decode_xer(TEST_BSM_XER, &asn_DEF_BasicSafetyMessage, 20,
+                            MessageFrame__value_PR_BasicSafetyMessage, &MessageFrame_value_t::BasicSafetyMessage);
+    check(*frame);
+
+    auto json = write(*frame);
+    BOOST_CHECK_NE(std::string::npos, json.find("\"id\":\"A1 B2 C3 D4\""));
+    BOOST_CHECK_NE(std::string::npos, json.find("\"lat\":\"399652654\""));
+    BOOST_CHECK_NE(std::string::npos, json.find("\"traction\":{\"off\":\"\"}"));
+}
+
+BOOST_AUTO_TEST_CASE(TestNoRepairs) {
+    auto frame = decode_xer(TEST_SPAT_XER, &asn_DEF_SPAT, 19, MessageFrame__value_PR_SPAT,
+                            &MessageFrame_value_t::SPAT);
+
+    repairs.clear();
+    writer = XerJsonWriter();
+    check(*frame);
+
+    // Without the repair, each movement state is a repeated key
+    auto json = write(*frame);
+    BOOST_CHECK_NE(std::string::npos, json.find("\"states\":{\"MovementState\":{"));
+}
+
+BOOST_AUTO_TEST_CASE(TestEncodingFailure) {
+    auto frame = decode_xer(TEST_BSM_XER, &asn_DEF_BasicSafetyMessage, 20,
+                            MessageFrame__value_PR_BasicSafetyMessage, &MessageFrame_value_t::BasicSafetyMessage);
+
+    // An unknown enumerated value cannot be written
+    frame->value.choice.BasicSafetyMessage.coreData.transmission = 99;
+
+    std::string json { "unchanged" };
+    auto const &member = asn_DEF_MessageFrame.elements[1];
+    BOOST_CHECK(!writer.write(json, *member.type, (char const *)frame.get() + member.memb_offset));
+    BOOST_CHECK_EQUAL("unchanged", json);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} /* End namespace test */
+}}} // namespace tmx::plugin::utils
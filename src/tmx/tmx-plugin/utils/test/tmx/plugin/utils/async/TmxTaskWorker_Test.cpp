@@ -0,0 +1,84 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file TmxTaskWorker_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <tmx/plugin/utils/async/TmxTaskWorker.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#ifndef TMX_WORKER_TEST_SAMPLES
+#define TMX_WORKER_TEST_SAMPLES 2000
+#endif
+
+using namespace std;
+using namespace tmx::common;
+using namespace tmx::plugin::utils::async;
+
+typedef TmxTaskWorker<boost::asio::io_context> worker_t;
+
+BOOST_AUTO_TEST_CASE( tmxtest_worker_dispatch_order ) {
+    worker_t worker { new boost::asio::io_context(1) };
+    worker.start();
+
+    BOOST_CHECK(worker.is_running());
+    BOOST_CHECK(worker.get_id() != std::thread::id());
+
+    // The tasks are posted in a burst, so they must all run on the worker, in the order posted
+    std::vector<std::size_t> order;
+    std::atomic<std::size_t> count { 0 };
+    bool sameThread = true;
+    order.reserve(TMX_WORKER_TEST_SAMPLES);
+
+    std::vector<std::shared_future<void> > results;
+    results.reserve(TMX_WORKER_TEST_SAMPLES);
+    for (std::size_t i = 0; i < TMX_WORKER_TEST_SAMPLES; i++)
+        results.push_back(worker.schedule([&, i]() -> void {
+            order.push_back(i);
+            sameThread &= (std::this_thread::get_id() == worker.get_id());
+            count++;
+        }));
+
+    for (auto &result: results) {
+        BOOST_REQUIRE(result.valid());
+        BOOST_CHECK(result.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+    }
+
+    worker.stop();
+
+    BOOST_CHECK_EQUAL(TMX_WORKER_TEST_SAMPLES, count.load());
+    BOOST_CHECK(sameThread);
+    BOOST_REQUIRE_EQUAL(TMX_WORKER_TEST_SAMPLES, order.size());
+    for (std::size_t i = 0; i < order.size(); i++)
+        BOOST_CHECK_EQUAL(i, order[i]);
+}
+
+BOOST_AUTO_TEST_CASE( tmxtest_worker_task_exception ) {
+    worker_t worker { new boost::asio::io_context(1) };
+    worker.start();
+
+    // A failing task must not terminate the worker
+    boost::asio::post(worker.get_context(), []() { throw std::runtime_error("Task failure"); });
+
+    std::atomic<int> count { 0 };
+    for (int i = 0; i < 10; i++)
+        worker.schedule([&count]() -> void { count++; }).wait();
+
+    BOOST_CHECK_EQUAL(10, count);
+    BOOST_CHECK(worker.is_running());
+
+    worker.stop();
+    BOOST_CHECK(!worker.is_running());
+}
@@ -0,0 +1,71 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file Crc24q_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <tmx/plugin/utils/gnss/Crc24q.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace tmx::plugin::utils::gnss;
+
+namespace {
+
+// One bit at a time, straight from the polynomial
+crc24_t crc24q_bitwise(std::vector<std::uint8_t> const &bytes) {
+    crc24_t crc = 0;
+    for (auto b: bytes) {
+        crc ^= (crc24_t) b << 16;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc & 0x800000) ? ((crc << 1) ^ CRC24Q_POLY) : (crc << 1);
+    }
+
+    return crc & 0xFFFFFF;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( crc24q_test_suite )
+
+BOOST_AUTO_TEST_CASE( check_values ) {
+    const std::string check { "123456789" };
+    BOOST_CHECK_EQUAL(crc24q(check.data(), check.length()), 0xCDE703u);
+    BOOST_CHECK_EQUAL(crc24q_bytewise(check.data(), check.length()), 0xCDE703u);
+    BOOST_CHECK_EQUAL(crc24q(check.data(), 0), 0u);
+
+    // RTCM 3 station coordinates (1005), with the CRC in the last 3 bytes
+    const std::vector<std::uint8_t> frame { 0xD3, 0x00, 0x13, 0x3E, 0xD7, 0xD3, 0x02, 0x02, 0x98, 0x0E, 0xDE, 0xEF, 0x34,
+                                            0xB4, 0xBD, 0x62, 0xAC, 0x09, 0x41, 0x98, 0x6F, 0x33, 0x36, 0x0B, 0x98 };
+    BOOST_CHECK_EQUAL(crc24q(frame.data(), frame.size() - 3), 0x360B98u);
+    BOOST_CHECK_EQUAL(crc24q(frame.data(), frame.size()), 0u);
+}
+
+BOOST_AUTO_TEST_CASE( matches_bitwise ) {
+    std::mt19937 rng { 24 };
+    std::uniform_int_distribution<int> byte { 0, 255 };
+
+    std::vector<std::uint8_t> bytes;
+    for (std::size_t length = 0; length < 300; length++) {
+        auto expected = crc24q_bitwise(bytes);
+        BOOST_REQUIRE_EQUAL(crc24q_bytewise(bytes.data(), bytes.size()), expected);
+        BOOST_REQUIRE_EQUAL(crc24q(bytes.data(), bytes.size()), expected);
+
+        // Any split gives the same answer
+        auto split = length / 3;
+        BOOST_REQUIRE_EQUAL(crc24q(bytes.data() + split, length - split, crc24q(bytes.data(), split)), expected);
+
+        bytes.push_back(byte(rng));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,171 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file Rtcm3FrameParser_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <tmx/plugin/utils/gnss/Crc24q.hpp>
+#include <tmx/plugin/utils/gnss/Rtcm3FrameParser.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#ifndef TMX_RTCM_TEST_FRAMES
+#define TMX_RTCM_TEST_FRAMES 2000
+#endif
+
+using namespace tmx::common;
+using namespace tmx::plugin::utils::gnss;
+
+typedef std::basic_string<byte_t> frame_bytes;
+
+namespace {
+
+// The MSM7 messages for GPS, GLONASS, Galileo and BeiDou, plus the station coordinates
+const std::uint16_t MESSAGE_NUMBERS[] = { 1077, 1087, 1097, 1127, 1005 };
+
+frame_bytes make_frame(std::mt19937 &rng, std::uint16_t messageNumber, std::size_t length) {
+    std::uniform_int_distribution<int> byte { 0, 255 };
+
+    frame_bytes frame;
+    frame.push_back(static_cast<byte_t>(Rtcm3FrameParser::PREAMBLE));
+    frame.push_back(static_cast<byte_t>(length >> 8));
+    frame.push_back(static_cast<byte_t>(length & 0xFF));
+    frame.push_back(static_cast<byte_t>(messageNumber >> 4));
+    frame.push_back(static_cast<byte_t>((messageNumber & 0x0F) << 4));
+    while (frame.length() < Rtcm3FrameParser::HEADER_SIZE + length)
+        frame.push_back(static_cast<byte_t>(byte(rng)));
+
+    auto crc = crc24q(frame.data(), frame.length());
+    frame.push_back(static_cast<byte_t>(crc >> 16));
+    frame.push_back(static_cast<byte_t>(crc >> 8));
+    frame.push_back(static_cast<byte_t>(crc));
+    return frame;
+}
+
+/*!
+ * A correction stream of mostly large MSM7 frames, with some noise in between
+ * that often looks like a preamble. Some frames are corrupted, which are
+ * not expected back.
+ */
+frame_bytes make_stream(std::mt19937 &rng, std::vector<frame_bytes> &expected, std::size_t &corrupted) {
+    std::uniform_int_distribution<std::size_t> msg { 0, std::size(MESSAGE_NUMBERS) - 1 };
+    std::uniform_int_distribution<std::size_t> length { 2, Rtcm3FrameParser::MAX_MESSAGE_SIZE };
+    std::uniform_int_distribution<int> noise { 0, 20 };
+    std::uniform_int_distribution<int> byte { 0, 255 };
+    std::uniform_int_distribution<int> percent { 0, 99 };
+
+    frame_bytes stream;
+    corrupted = 0;
+
+    for (std::size_t i = 0; i < TMX_RTCM_TEST_FRAMES; i++) {
+        for (int n = noise(rng); n > 0; n--) {
+            if (percent(rng) < 20) {
+                stream.push_back(static_cast<byte_t>(Rtcm3FrameParser::PREAMBLE));
+                stream.push_back(static_cast<byte_t>(byte(rng) & 0x03));
+            } else {
+                stream.push_back(static_cast<byte_t>(byte(rng)));
+            }
+        }
+
+        auto frame = make_frame(rng, MESSAGE_NUMBERS[msg(rng)], length(rng));
+        if (percent(rng) < 5) {
+            frame[Rtcm3FrameParser::HEADER_SIZE + 2] ^= static_cast<byte_t>(0x10);
+            corrupted++;
+        } else {
+            expected.push_back(frame);
+        }
+
+        stream.append(frame);
+    }
+
+    // Noise that looked like a preamble holds the frames after it until that many bytes are read
+    stream.append(Rtcm3FrameParser::MAX_FRAME_SIZE, static_cast<byte_t>(0x00));
+    return stream;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( rtcm3_frame_parser_test_suite )
+
+BOOST_AUTO_TEST_CASE( whole_frame_is_not_copied ) {
+    std::mt19937 rng { 3 };
+    auto frame = make_frame(rng, 1077, 500);
+    auto chunk = frame_bytes { static_cast<byte_t>(0x00) } + frame + frame.substr(0, 10);
+
+    Rtcm3FrameParser parser;
+    std::vector<byte_t const *> found;
+    parser.parse({ chunk.data(), chunk.length() }, [&found](byte_sequence const &bytes) {
+        BOOST_CHECK_EQUAL(Rtcm3FrameParser::get_message_number(bytes), 1077);
+        found.push_back(bytes.data());
+    });
+
+    BOOST_REQUIRE_EQUAL(found.size(), 1u);
+    BOOST_CHECK(found[0] == chunk.data() + 1);
+    BOOST_CHECK_EQUAL(parser.get_discarded_bytes(), 1u);
+    BOOST_CHECK_EQUAL(parser.get_pending_bytes(), 10u);
+
+    parser.reset();
+    BOOST_CHECK_EQUAL(parser.get_pending_bytes(), 0u);
+    BOOST_CHECK_EQUAL(parser.get_discarded_bytes(), 11u);
+}
+
+BOOST_AUTO_TEST_CASE( frame_split_one_byte_at_a_time ) {
+    std::mt19937 rng { 5 };
+    auto frame = make_frame(rng, 1005, 19);
+
+    Rtcm3FrameParser parser;
+    std::vector<frame_bytes> found;
+    for (auto b: frame) {
+        parser.parse({ &b, 1 }, [&found](byte_sequence const &bytes) {
+            found.emplace_back(bytes.data(), bytes.length());
+        });
+    }
+
+    BOOST_REQUIRE_EQUAL(found.size(), 1u);
+    BOOST_CHECK(found[0] == frame);
+    BOOST_CHECK_EQUAL(parser.get_discarded_bytes(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE( fuzz_random_chunks ) {
+    for (unsigned seed = 1; seed <= 4; seed++) {
+        std::mt19937 rng { seed };
+
+        std::vector<frame_bytes> expected;
+        std::size_t corrupted;
+        auto stream = make_stream(rng, expected, corrupted);
+
+        // Reads from a TCP socket can be anywhere from 1 byte to many frames
+        std::uniform_int_distribution<std::size_t> chunk { 1, seed * 1500 };
+
+        Rtcm3FrameParser parser;
+        std::vector<frame_bytes> found;
+        auto handler = [&found](byte_sequence const &bytes) { found.emplace_back(bytes.data(), bytes.length()); };
+
+        for (std::size_t i = 0; i < stream.length(); ) {
+            auto n = std::min(chunk(rng), stream.length() - i);
+            parser.parse({ stream.data() + i, n }, handler);
+            i += n;
+        }
+
+        BOOST_TEST_CONTEXT("seed " << seed) {
+            BOOST_REQUIRE_EQUAL(found.size(), expected.size());
+            for (std::size_t i = 0; i < found.size(); i++)
+                BOOST_REQUIRE(found[i] == expected[i]);
+
+            BOOST_CHECK_EQUAL(parser.get_frame_count(), expected.size());
+            BOOST_CHECK_GE(parser.get_crc_errors(), corrupted);
+            BOOST_CHECK_EQUAL(parser.get_pending_bytes(), 0u);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,199 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file CompiledMap_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <tmx/plugin/utils/interxn/CompiledMap.hpp>
+#include <tmx/message/j2735/202007/MessageFrame.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace tmx::plugin::utils::geo;
+using namespace tmx::plugin::utils::interxn;
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace interxn {
+namespace test {
+
+// A MAP message for the 5th and Perry intersection, taken from the MapPlugin manifest
+static const char *TEST_MAP_BYTES =
+        "0012810B380130002073BE054D75DCBE9CAAC13A198C02DC0AC814657CBCFA20C3C3872DF871E8140000003124C5B9014140179B"
+        "608AA6EE20A365F21998DA91042363E886BC34DA43765A3411E5AF9844424E51732C0814143352B02064A75CB0C4E2AE00D85C00"
+        "0E77C04059078C8B879F44187870E5BF0E3D06800000010B1EAD349E424FB2BD42CC7C0A0A0E26A3A1B1F8001CEF80808805D900"
+        "0000042CF88FB17784D90B88A6983EDE83880FE900000004918F55C0A0A006CB604D0B2719F99BE6E85054EDFCBA6841D3961C7A"
+        "C89804004000B4EF6457503A0480C94C000E77C09C0A4AA7BFAF4D083A72C38F5A230080080A0C282E0E430600ECC650E9949C2C"
+        "917C71E7962DA4CF262460";
+
+std::shared_ptr<MapData> decode_map() {
+    std::string hex { TEST_MAP_BYTES };
+    std::vector<std::uint8_t> bytes;
+    for (std::size_t i = 0; i + 1 < hex.length(); i += 2)
+        bytes.push_back(std::stoi(hex.substr(i, 2), nullptr, 16));
+
+    MessageFrame *frame = nullptr;
+    auto ret = asn_decode(nullptr, ATS_UNALIGNED_BASIC_PER, &asn_DEF_MessageFrame, (void **)&frame,
+                          bytes.data(), bytes.size());
+    BOOST_REQUIRE_EQUAL(RC_OK, ret.code);
+    BOOST_REQUIRE(frame);
+    BOOST_REQUIRE_EQUAL(MessageFrame__value_PR_MapData, frame->value.present);
+
+    return { &frame->value.choice.MapData, [frame](auto *) { ASN_STRUCT_FREE(asn_DEF_MessageFrame, frame); } };
+}
+
+void check_equal(MapMatchResult const &expected, MapMatchResult const &actual) {
+    BOOST_CHECK_EQUAL(expected.LaneNumber, actual.LaneNumber);
+    BOOST_CHECK_EQUAL(expected.IsEgress, actual.IsEgress);
+    BOOST_CHECK_EQUAL(expected.IsInLane, actual.IsInLane);
+    BOOST_CHECK_EQUAL(expected.IsNearLane, actual.IsNearLane);
+    BOOST_CHECK_EQUAL(expected.LaneSegment, actual.LaneSegment);
+    BOOST_CHECK_EQUAL(expected.PerpDistanceMeters, actual.PerpDistanceMeters);
+    BOOST_CHECK_EQUAL(expected.StopDistanceMeters, actual.StopDistanceMeters);
+    BOOST_CHECK_EQUAL(expected.Grade, actual.Grade);
+}
+
+// Sample points over the whole MAP bounding box, plus some just outside
+std::vector<WGS84Point> sample_points(ParsedMap const &map) {
+    std::vector<WGS84Point> points;
+
+    double dLat = (map.MaxLat - map.MinLat) * 1.2;
+    double dLong = (map.MaxLong - map.MinLong) * 1.2;
+    for (int i = 0; i <= 120; i++) {
+        for (int j = 0; j <= 120; j++)
+            points.emplace_back(map.MinLat - dLat * 0.1 + dLat * i / 120, map.MinLong - dLong * 0.1 + dLong * j / 120);
+    }
+
+    // And on or near every lane node
+    for (auto &lane: map.Lanes) {
+        for (auto &node: lane.Nodes) {
+            points.push_back(node.Point);
+            points.emplace_back(node.Point.Latitude + 0.00001, node.Point.Longitude - 0.00001);
+        }
+    }
+
+    return points;
+}
+
+BOOST_AUTO_TEST_SUITE(compiled_map_test_suite)
+
+BOOST_AUTO_TEST_CASE(compiled_map_matches_map_support) {
+    auto msg = decode_map();
+
+    Intersection intersection;
+    BOOST_REQUIRE(intersection.LoadMap(msg));
+
+    CompiledMap compiled { msg };
+    BOOST_REQUIRE(compiled.IsLoaded());
+    BOOST_CHECK_EQUAL(intersection.GetMapId(), compiled.GetMapId());
+    BOOST_CHECK_EQUAL(msg->msgIssueRevision, compiled.GetMapRevision());
+
+    MapSupport mapSupp;
+    mapSupp.SetExtendedIntersectionPercentage(0.15);
+
+    MapSupport mapSuppHeading;
+
+    std::size_t inLane = 0;
+    std::size_t nearLane = 0;
+    for (auto &point: sample_points(intersection.Map)) {
+        auto expected = mapSupp.FindVehicleLaneForPoint(point, intersection.Map);
+        auto actual = compiled.FindVehicleLaneForPoint(point, 0.15);
+        check_equal(expected, actual);
+        if (expected.IsInLane)
+            inLane++;
+
+        for (double heading = 0.0; heading < 360.0; heading += 22.5) {
+            expected = mapSuppHeading.FindVehicleLaneForPoint(point, heading, intersection.Map);
+            actual = compiled.FindApproachLaneForPoint(point, heading);
+            check_equal(expected, actual);
+            if (expected.IsNearLane)
+                nearLane++;
+
+            if (expected.LaneNumber > 0 && expected.LaneSegment > 0) {
+                BOOST_CHECK_EQUAL(mapSuppHeading.GetSignalGroupForVehicleLane(expected.LaneNumber, intersection.Map),
+                                  compiled.GetSignalGroupForVehicleLane(expected.LaneNumber));
+
+                // The same calculation from the RCVW plugin
+                double distance = 0.0;
+                int nodeIndex = 0;
+                WGS84Point point1;
+                WGS84Point point2;
+                auto nodes = intersection.GetLaneNodes(*msg, expected.LaneNumber, 0.0, 0.0);
+                for (auto it = nodes.begin(); it != nodes.end() && nodeIndex < expected.LaneSegment; ++it) {
+                    point1 = point2;
+                    point2 = it->Point;
+                    if (nodeIndex > 0)
+                        distance += Conversions::DistanceMeters(point1, point2);
+                    nodeIndex++;
+                }
+                distance += Conversions::DistanceMeters(point2, point);
+
+                BOOST_CHECK_EQUAL(distance,
+                                  compiled.GetDistanceToCrossing(expected.LaneNumber, expected.LaneSegment, point));
+            }
+        }
+    }
+
+    // Make sure the samples actually hit some lanes
+    BOOST_TEST_MESSAGE("Matched " << inLane << " points in lane and " << nearLane << " near lane");
+    BOOST_CHECK_GT(inLane, 0u);
+    BOOST_CHECK_GT(nearLane, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(compiled_map_lookup_is_faster) {
+    auto msg = decode_map();
+
+    Intersection intersection;
+    BOOST_REQUIRE(intersection.LoadMap(msg));
+
+    CompiledMap compiled { msg };
+    BOOST_REQUIRE(compiled.IsLoaded());
+
+    auto points = sample_points(intersection.Map);
+
+    // Time the old way, which parses the MAP for every fix
+    auto start = std::chrono::steady_clock::now();
+    for (auto &point: points) {
+        Intersection perFix;
+        perFix.LoadMap(msg);
+
+        MapSupport mapSupp;
+        mapSupp.FindVehicleLaneForPoint(point, 90.0, perFix.Map);
+    }
+    auto parsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (auto &point: points)
+        compiled.FindApproachLaneForPoint(point, 90.0);
+    auto precompiled = std::chrono::steady_clock::now() - start;
+
+    BOOST_TEST_MESSAGE("Per-fix parsing took " << std::chrono::duration_cast<std::chrono::microseconds>(parsed).count() <<
+                       "us, compiled lookups took " <<
+                       std::chrono::duration_cast<std::chrono::microseconds>(precompiled).count() << "us");
+    BOOST_CHECK_LT(precompiled.count(), parsed.count());
+}
+
+BOOST_AUTO_TEST_CASE(compiled_map_not_loaded) {
+    CompiledMap compiled { nullptr };
+    BOOST_CHECK(!compiled.IsLoaded());
+    BOOST_CHECK_EQUAL(-1, compiled.GetMapId());
+    BOOST_CHECK_EQUAL(-2, compiled.FindVehicleLaneForPoint(WGS84Point(42.0, -83.0)).LaneNumber);
+    BOOST_CHECK_EQUAL(-2, compiled.FindApproachLaneForPoint(WGS84Point(42.0, -83.0), 0.0).LaneNumber);
+    BOOST_CHECK_EQUAL(-1, compiled.GetSignalGroupForVehicleLane(1));
+    BOOST_CHECK_EQUAL(-1, compiled.GetDistanceToCrossing(1, 1, WGS84Point(42.0, -83.0)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} /* End namespace test */
+}}}} // namespace tmx::plugin::utils::interxn
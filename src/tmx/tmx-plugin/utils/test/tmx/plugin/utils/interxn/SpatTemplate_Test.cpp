@@ -0,0 +1,241 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file SpatTemplate_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <tmx/plugin/utils/interxn/SpatTemplate.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+
+namespace tmx {
+namespace plugin {
+namespace utils {
+namespace interxn {
+namespace test {
+
+/*!
+ * @brief A SPAT with a named intersection and two movements, like the HRI status broadcast
+ */
+struct TestSpat {
+    MessageFrame frame;
+    IntersectionState intxn;
+    IntersectionState *intxnList[1];
+    OCTET_STRING name;
+    std::string nameStr { "5th and Perry" };
+    std::uint8_t status[2] { 0, 0 };
+    MinuteOfTheYear_t moy = 412312;
+    DSecond_t timeStamp = 35176;
+    MovementState states[2];
+    MovementState *stateList[2];
+    MovementEvent events[2];
+    MovementEvent *eventList[2][1];
+    TimeChangeDetails timing;
+    TimeMark_t maxEndTime = 32850;
+
+    TestSpat() {
+        std::memset(&frame, 0, sizeof(frame));
+        std::memset(&intxn, 0, sizeof(intxn));
+        std::memset(&name, 0, sizeof(name));
+        std::memset(states, 0, sizeof(states));
+        std::memset(events, 0, sizeof(events));
+        std::memset(&timing, 0, sizeof(timing));
+
+        frame.messageId = 19;
+        frame.value.present = MessageFrame__value_PR_SPAT;
+
+        intxnList[0] = &intxn;
+        frame.value.choice.SPAT.intersections.list.array = intxnList;
+        frame.value.choice.SPAT.intersections.list.count = 1;
+        frame.value.choice.SPAT.intersections.list.size = 1;
+
+        name.buf = (std::uint8_t *)nameStr.data();
+        name.size = nameStr.length();
+        intxn.name = &name;
+        intxn.id.id = 1500;
+        intxn.revision = 1;
+        intxn.status.buf = status;
+        intxn.status.size = 2;
+        intxn.moy = &moy;
+        intxn.timeStamp = &timeStamp;
+
+        timing.minEndTime = 32850;
+        timing.maxEndTime = &maxEndTime;
+
+        for (int i = 0; i < 2; i++) {
+            events[i].eventState = MovementPhaseState_unavailable;
+            events[i].timing = &timing;
+            eventList[i][0] = &events[i];
+
+            states[i].signalGroup = i + 1;
+            states[i].state_time_speed.list.array = eventList[i];
+            states[i].state_time_speed.list.count = 1;
+            states[i].state_time_speed.list.size = 1;
+            stateList[i] = &states[i];
+        }
+
+        intxn.states.list.array = stateList;
+        intxn.states.list.count = 2;
+        intxn.states.list.size = 2;
+    }
+
+    std::basic_string<std::uint8_t> encode() {
+        void *buffer = nullptr;
+        auto length = uper_encode_to_new_buffer(&asn_DEF_MessageFrame, nullptr, &frame, &buffer);
+        BOOST_REQUIRE_GT(length, 0);
+
+        std::basic_string<std::uint8_t> bytes { static_cast<const std::uint8_t *>(buffer), (std::size_t)length };
+        std::free(buffer);
+        return bytes;
+    }
+
+    std::uint16_t get_status() const {
+        return (status[0] << 8) | status[1];
+    }
+};
+
+void check_patch(TestSpat &spat, SpatTemplate &tmpl) {
+    BOOST_REQUIRE(tmpl.SetMinuteOfTheYear(0, spat.moy));
+    BOOST_REQUIRE(tmpl.SetTimeStamp(0, spat.timeStamp));
+    BOOST_REQUIRE(tmpl.SetStatus(0, spat.get_status()));
+    BOOST_REQUIRE(tmpl.SetEventState(0, 0, 0, spat.events[0].eventState));
+    BOOST_REQUIRE(tmpl.SetEventState(0, 1, 0, spat.events[1].eventState));
+
+    auto expected = spat.encode();
+    auto const &actual = tmpl.GetBytes();
+    BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), actual.begin(), actual.end());
+}
+
+BOOST_AUTO_TEST_SUITE(spat_template_test_suite)
+
+BOOST_AUTO_TEST_CASE(TestMatchesInitialEncoding) {
+    TestSpat spat;
+    SpatTemplate tmpl { spat.frame };
+    BOOST_REQUIRE(tmpl.IsLoaded());
+
+    auto expected = spat.encode();
+    BOOST_CHECK(expected == tmpl.GetBytes());
+}
+
+BOOST_AUTO_TEST_CASE(TestFrameIsNotModified) {
+    TestSpat spat;
+    auto before = spat.encode();
+
+    SpatTemplate tmpl { spat.frame };
+    BOOST_REQUIRE(tmpl.IsLoaded());
+    BOOST_CHECK(before == spat.encode());
+}
+
+BOOST_AUTO_TEST_CASE(TestBoundaryValues) {
+    TestSpat spat;
+    SpatTemplate tmpl { spat.frame };
+    BOOST_REQUIRE(tmpl.IsLoaded());
+
+    for (auto moy: { 0L, 1L, 262144L, 527039L, 527040L }) {
+        for (auto ts: { 0L, 1L, 32768L, 59999L, 65535L }) {
+            spat.moy = moy;
+            spat.timeStamp = ts;
+            check_patch(spat, tmpl);
+        }
+    }
+
+    for (long state = MovementPhaseState_unavailable; state <= MovementPhaseState_caution_Conflicting_Traffic; state++) {
+        spat.events[0].eventState = state;
+        spat.events[1].eventState = MovementPhaseState_caution_Conflicting_Traffic - state;
+        check_patch(spat, tmpl);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestRandomValues) {
+    TestSpat spat;
+    SpatTemplate tmpl { spat.frame };
+    BOOST_REQUIRE(tmpl.IsLoaded());
+
+    std::mt19937 gen { 4907 };
+    std::uniform_int_distribution<long> moy { 0, 527040 };
+    std::uniform_int_distribution<long> ts { 0, 65535 };
+    std::uniform_int_distribution<long> state { 0, 9 };
+
+    for (int i = 0; i < 1000; i++) {
+        spat.moy = moy(gen);
+        spat.timeStamp = ts(gen);
+        spat.status[0] = ts(gen) & 0xFF;
+        spat.status[1] = ts(gen) & 0xFF;
+        spat.events[0].eventState = state(gen);
+        spat.events[1].eventState = state(gen);
+        check_patch(spat, tmpl);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestHRIStatusStates) {
+    TestSpat spat;
+    SpatTemplate tmpl { spat.frame };
+    BOOST_REQUIRE(tmpl.IsLoaded());
+
+    for (bool trainComing: { true, false, true }) {
+        spat.status[1] = trainComing ? (1 << IntersectionStatusObject_preemptIsActive) : 0;
+        spat.events[0].eventState = trainComing ? MovementPhaseState_protected_Movement_Allowed
+                                                : MovementPhaseState_stop_And_Remain;
+        spat.events[1].eventState = trainComing ? MovementPhaseState_stop_And_Remain
+                                                : MovementPhaseState_permissive_Movement_Allowed;
+        check_patch(spat, tmpl);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestOutOfRange) {
+    TestSpat spat;
+    SpatTemplate tmpl { spat.frame };
+    BOOST_REQUIRE(tmpl.IsLoaded());
+
+    auto before = tmpl.GetBytes();
+    BOOST_CHECK(!tmpl.SetMinuteOfTheYear(0, 527041));
+    BOOST_CHECK(!tmpl.SetTimeStamp(0, -1));
+    BOOST_CHECK(!tmpl.SetEventState(0, 0, 0, 10));
+    BOOST_CHECK(!tmpl.SetEventState(0, 2, 0, 0));
+    BOOST_CHECK(!tmpl.SetStatus(1, 0));
+    BOOST_CHECK(before == tmpl.GetBytes());
+}
+
+BOOST_AUTO_TEST_CASE(TestOptionalFields) {
+    TestSpat spat;
+    spat.intxn.moy = nullptr;
+    spat.intxn.name = nullptr;
+
+    SpatTemplate tmpl { spat.frame };
+    BOOST_REQUIRE(tmpl.IsLoaded());
+    BOOST_CHECK(!tmpl.SetMinuteOfTheYear(0, 0));
+
+    spat.timeStamp = 12345;
+    spat.events[1].eventState = MovementPhaseState_protected_clearance;
+    BOOST_REQUIRE(tmpl.SetTimeStamp(0, spat.timeStamp));
+    BOOST_REQUIRE(tmpl.SetEventState(0, 1, 0, spat.events[1].eventState));
+
+    auto expected = spat.encode();
+    BOOST_CHECK(expected == tmpl.GetBytes());
+}
+
+BOOST_AUTO_TEST_CASE(TestNotSpat) {
+    MessageFrame frame;
+    std::memset(&frame, 0, sizeof(frame));
+    frame.messageId = 20;
+    frame.value.present = MessageFrame__value_PR_BasicSafetyMessage;
+
+    SpatTemplate tmpl { frame };
+    BOOST_CHECK(!tmpl.IsLoaded());
+    BOOST_CHECK(!tmpl.SetTimeStamp(0, 0));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} /* End namespace test */
+}}}} // namespace tmx::plugin::utils::interxn
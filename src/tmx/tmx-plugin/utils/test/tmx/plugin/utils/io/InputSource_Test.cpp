@@ -0,0 +1,171 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file InputSource_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <tmx/plugin/utils/io/InputSource.hpp>
+#include <tmx/plugin/utils/io/PseudoTerminal.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifndef TMX_INPUT_TEST_SAMPLES
+#define TMX_INPUT_TEST_SAMPLES 200
+#endif
+
+// The old readers slept for 100 ms between checks, so any edge could wait up to 200 ms to be seen
+#ifndef TMX_INPUT_TEST_MAX_P99_MS
+#define TMX_INPUT_TEST_MAX_P99_MS 20
+#endif
+
+using namespace tmx::plugin::utils::io;
+
+BOOST_AUTO_TEST_SUITE( input_source_test_suite )
+
+BOOST_AUTO_TEST_CASE( edge_source_signals_each_edge ) {
+    std::vector<std::pair<bool, input_clock::time_point> > edges;
+    EdgeInputSource source { [&edges](bool level, input_clock::time_point when) {
+        edges.emplace_back(level, when);
+    } };
+
+    InputMonitor monitor;
+    monitor.add(source);
+
+    // Nothing to do yet
+    BOOST_CHECK_EQUAL(monitor.wait(std::chrono::milliseconds(0)), 0u);
+
+    auto t1 = input_clock::now();
+    BOOST_CHECK(source.set_level(true, t1));
+    BOOST_CHECK(!source.set_level(true));
+    auto t2 = input_clock::now();
+    BOOST_CHECK(source.set_level(false, t2));
+    BOOST_CHECK(!source.get_level());
+
+    BOOST_CHECK_EQUAL(monitor.wait(std::chrono::milliseconds(1000)), 1u);
+    BOOST_REQUIRE_EQUAL(edges.size(), 2u);
+    BOOST_CHECK(edges[0].first);
+    BOOST_CHECK(edges[0].second == t1);
+    BOOST_CHECK(!edges[1].first);
+    BOOST_CHECK(edges[1].second == t2);
+
+    // The event is consumed
+    BOOST_CHECK_EQUAL(monitor.wait(std::chrono::milliseconds(0)), 0u);
+}
+
+BOOST_AUTO_TEST_CASE( monitor_wakes_from_other_thread ) {
+    InputMonitor monitor;
+
+    auto start = input_clock::now();
+    std::thread waker([&monitor]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        monitor.wake();
+    });
+
+    BOOST_CHECK_EQUAL(monitor.wait(std::chrono::milliseconds(5000)), 0u);
+    waker.join();
+
+    BOOST_CHECK(input_clock::now() - start < std::chrono::milliseconds(1000));
+}
+
+BOOST_AUTO_TEST_CASE( fd_source_reads_pseudo_terminal ) {
+    std::unique_ptr<PseudoTerminal> pty { new PseudoTerminal() };
+    int fd = ::open(pty->get_device_name().c_str(), O_RDWR | O_NOCTTY);
+    BOOST_REQUIRE(fd >= 0);
+
+    std::string received;
+    FdInputSource source { fd, [&received](std::uint8_t const *data, std::size_t len, input_clock::time_point) {
+        received.append((char const *) data, len);
+    }, 4 };
+
+    InputMonitor monitor;
+    monitor.add(source);
+
+    std::string const msg { "\xff\xff\xf5\xff hello" };
+    BOOST_CHECK_EQUAL(pty->write((std::uint8_t const *) msg.data(), msg.length()), (long) msg.length());
+    while (received.length() < msg.length() && monitor.wait(std::chrono::milliseconds(1000)));
+
+    BOOST_CHECK_EQUAL(received, msg);
+
+    // Closing the other side hangs up the device, which closes the source
+    pty.reset();
+    BOOST_CHECK_EQUAL(monitor.wait(std::chrono::milliseconds(1000)), 1u);
+    BOOST_CHECK_EQUAL(source.get_fd(), -1);
+    BOOST_CHECK_EQUAL(monitor.wait(std::chrono::milliseconds(0)), 0u);
+
+    ::close(fd);
+}
+
+// Only the input sources, from a byte written to the pseudo-terminal to the wake up of
+// another monitor by the edge, without the HRI message parsing and the SPAT publish
+BOOST_AUTO_TEST_CASE( pty_byte_to_edge_wakeup_latency ) {
+    PseudoTerminal pty;
+    int fd = ::open(pty.get_device_name().c_str(), O_RDWR | O_NOCTTY);
+    BOOST_REQUIRE(fd >= 0);
+
+    std::atomic<bool> stop { false };
+    std::vector<input_clock::time_point> sent, woken;
+    std::vector<std::chrono::nanoseconds::rep> latency;
+    sent.reserve(TMX_INPUT_TEST_SAMPLES);
+    woken.reserve(TMX_INPUT_TEST_SAMPLES);
+
+    // A second monitor thread that is woken up by each edge
+    InputMonitor edgeLoop;
+    EdgeInputSource crossing { [&woken](bool, input_clock::time_point) {
+        woken.push_back(input_clock::now());
+    } };
+    edgeLoop.add(crossing);
+
+    // Reads the pseudo-terminal, and turns each byte into a level
+    InputMonitor ptyLoop;
+    FdInputSource serial { fd, [&crossing](std::uint8_t const *data, std::size_t len, input_clock::time_point when) {
+        for (std::size_t i = 0; i < len; i++)
+            crossing.set_level(data[i] == '1', when);
+    } };
+    ptyLoop.add(serial);
+
+    std::thread reader([&]() {
+        while (!stop)
+            ptyLoop.wait(std::chrono::milliseconds(-1));
+    });
+
+    for (std::size_t i = 0; i < TMX_INPUT_TEST_SAMPLES; i++) {
+        std::uint8_t level = (i % 2) ? '0' : '1';
+
+        sent.push_back(input_clock::now());
+        BOOST_REQUIRE_EQUAL(pty.write(&level, 1), 1);
+
+        while (woken.size() <= i && edgeLoop.wait(std::chrono::milliseconds(1000)));
+        BOOST_REQUIRE_EQUAL(woken.size(), i + 1);
+
+        latency.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(woken[i] - sent[i]).count());
+    }
+
+    stop = true;
+    ptyLoop.wake();
+    reader.join();
+    ::close(fd);
+
+    std::sort(latency.begin(), latency.end());
+    auto p50 = latency[latency.size() / 2];
+    auto p99 = latency[(latency.size() * 99) / 100];
+
+    BOOST_TEST_MESSAGE("Pseudo-terminal byte to edge wake up latency: p50=" << p50 / 1000 << "us, p99=" << p99 / 1000 << "us");
+    BOOST_CHECK_LT(p99, std::chrono::nanoseconds(std::chrono::milliseconds(TMX_INPUT_TEST_MAX_P99_MS)).count());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,170 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file SimulatedMessageEncoder_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <tmx/plugin/utils/sim/SimulatedMessageEncoder.hpp>
+
+#include <tmx/message/j2735/202007/MessageFrame.h>
+#include <tmx/message/j2735/202007/RequestorPositionVector.h>
+#include <tmx/message/j2735/202007/RequestorType.h>
+#include <tmx/message/j2735/202007/TransmissionAndSpeed.h>
+
+#include <string>
+
+using namespace tmx::common;
+using namespace tmx::plugin::utils::sim;
+
+namespace {
+
+std::basic_string<byte_t> to_input(std::initializer_list<std::uint32_t> values) {
+    std::basic_string<byte_t> bytes;
+    for (auto v: values) {
+        for (int shift = 24; shift >= 0; shift -= 8)
+            bytes.push_back(static_cast<byte_t>((v >> shift) & 0xFF));
+    }
+
+    return bytes;
+}
+
+MessageFrame *decode(byte_sequence const &bytes) {
+    MessageFrame *frame = nullptr;
+    auto ret = uper_decode_complete(nullptr, &asn_DEF_MessageFrame, (void **) &frame, bytes.data(), bytes.length());
+    BOOST_REQUIRE_EQUAL(ret.code, RC_OK);
+    return frame;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( simulated_message_encoder_test_suite )
+
+BOOST_AUTO_TEST_CASE( parse_simulator_input ) {
+    // Vehicle 42, heading 90.5, speed 12.25 m/s, at 38.95, -77.15 and 120.5 m
+    auto input = to_input({ 42, 90500000, 12250, 218950000, 102850000, 620500 });
+
+    SimulatedVehicle vehicle;
+    BOOST_REQUIRE(SimulatedMessageEncoder::parse_bsm({ input.data(), input.length() }, vehicle));
+    BOOST_CHECK_EQUAL(vehicle.id, 42u);
+    BOOST_CHECK_CLOSE(vehicle.heading, 90.5, 0.0001);
+    BOOST_CHECK_CLOSE(vehicle.speed, 12.25, 0.0001);
+    BOOST_CHECK_CLOSE(vehicle.latitude, 38.95, 0.0001);
+    BOOST_CHECK_CLOSE(vehicle.longitude, -77.15, 0.0001);
+    BOOST_CHECK_CLOSE(vehicle.elevation, 120.5, 0.0001);
+
+    BOOST_REQUIRE(SimulatedMessageEncoder::parse_srm({ input.data(), input.length() }, vehicle));
+    BOOST_CHECK_EQUAL(vehicle.role, 620500u);
+
+    BOOST_CHECK(!SimulatedMessageEncoder::parse_bsm({ input.data(), input.length() - 1 }, vehicle));
+
+    SimulatedVehicleBasics basics;
+    auto vbm = to_input({ 7, 5000 });
+    vbm.push_back(static_cast<byte_t>(3));
+    vbm.push_back(static_cast<byte_t>(1));
+    vbm.push_back(static_cast<byte_t>(0x80));
+    vbm += to_input({ (std::uint32_t) -1500 });
+
+    BOOST_REQUIRE(SimulatedMessageEncoder::parse_vbm({ vbm.data(), vbm.length() }, basics));
+    BOOST_CHECK_EQUAL(basics.id, 7u);
+    BOOST_CHECK_CLOSE(basics.speed, 5.0, 0.0001);
+    BOOST_CHECK_EQUAL(basics.gearPosition, 3);
+    BOOST_CHECK_EQUAL(basics.turnSignalPosition, 1);
+    BOOST_CHECK_EQUAL(basics.flags, 0x80);
+    BOOST_CHECK_CLOSE(basics.acceleration, -1.5, 0.0001);
+}
+
+BOOST_AUTO_TEST_CASE( encode_bsm ) {
+    SimulatedVehicle vehicle;
+    vehicle.id = 0x01020304;
+    vehicle.heading = 90.5;
+    vehicle.speed = 12.25;
+    vehicle.latitude = 38.95;
+    vehicle.longitude = -77.15;
+    vehicle.elevation = 120.5;
+
+    auto &encoder = SimulatedMessageEncoder::get_thread_encoder();
+    auto when = std::chrono::system_clock::time_point(std::chrono::milliseconds(1700000012345));
+
+    auto bytes = encoder.encode_bsm(vehicle, when);
+    BOOST_REQUIRE(!bytes.empty());
+    BOOST_CHECK_EQUAL(static_cast<std::uint8_t>(bytes[0]), 0x00);
+    BOOST_CHECK_EQUAL(static_cast<std::uint8_t>(bytes[1]), 0x14);
+
+    auto frame = decode(bytes);
+    BOOST_CHECK_EQUAL(frame->messageId, SimulatedMessageEncoder::BSM_MESSAGE_ID);
+    BOOST_REQUIRE_EQUAL(frame->value.present, MessageFrame__value_PR_BasicSafetyMessage);
+
+    auto const &core = frame->value.choice.BasicSafetyMessage.coreData;
+    BOOST_CHECK_EQUAL(core.secMark, 32345);
+    BOOST_CHECK_EQUAL(core.lat, 389500000);
+    BOOST_CHECK_EQUAL(core.Long, -771500000);
+    BOOST_CHECK_EQUAL(core.elev, 1205);
+    BOOST_CHECK_EQUAL(core.speed, 612);
+    BOOST_CHECK_EQUAL(core.heading, 7240);
+    BOOST_REQUIRE_EQUAL(core.id.size, 4u);
+    BOOST_CHECK_EQUAL(std::memcmp(core.id.buf, &vehicle.id, 4), 0);
+
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, frame);
+
+    // The same buffer is used again
+    auto again = encoder.encode_bsm(vehicle, when);
+    BOOST_CHECK(again.data() == bytes.data());
+    BOOST_CHECK(again == bytes);
+}
+
+BOOST_AUTO_TEST_CASE( encode_srm ) {
+    SimulatedVehicle vehicle;
+    vehicle.id = 99;
+    vehicle.heading = 180.0;
+    vehicle.speed = 10.0;
+    vehicle.latitude = 38.95;
+    vehicle.longitude = -77.15;
+    vehicle.role = 13;
+
+    auto &encoder = SimulatedMessageEncoder::get_thread_encoder();
+    auto bytes = encoder.encode_srm(vehicle, std::chrono::system_clock::time_point(std::chrono::seconds(60)));
+    BOOST_REQUIRE(!bytes.empty());
+
+    auto frame = decode(bytes);
+    BOOST_CHECK_EQUAL(frame->messageId, SimulatedMessageEncoder::SRM_MESSAGE_ID);
+    BOOST_REQUIRE_EQUAL(frame->value.present, MessageFrame__value_PR_SignalRequestMessage);
+
+    auto const &srm = frame->value.choice.SignalRequestMessage;
+    BOOST_CHECK_EQUAL(srm.second, 0);
+    BOOST_REQUIRE_EQUAL(srm.requestor.id.present, VehicleID_PR_entityID);
+    BOOST_REQUIRE(srm.requestor.type);
+    BOOST_CHECK_EQUAL(srm.requestor.type->role, 13);
+    BOOST_REQUIRE(srm.requestor.position);
+    BOOST_CHECK_EQUAL(srm.requestor.position->position.lat, 389500000);
+    BOOST_CHECK_EQUAL(srm.requestor.position->position.Long, -771500000);
+    BOOST_REQUIRE(srm.requestor.position->heading);
+    BOOST_CHECK_EQUAL(*srm.requestor.position->heading, 14400);
+    BOOST_REQUIRE(srm.requestor.position->speed);
+    BOOST_CHECK_EQUAL(srm.requestor.position->speed->speed, 500);
+
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, frame);
+}
+
+BOOST_AUTO_TEST_CASE( arena_is_reset_for_each_message ) {
+    EncodeArena arena(64);
+
+    BOOST_CHECK(arena.allocate(60, 1));
+    BOOST_CHECK(!arena.allocate(8, 1));
+
+    arena.reset();
+    BOOST_CHECK_EQUAL(arena.get_used(), 0u);
+
+    auto p = static_cast<std::uint64_t *>(arena.allocate(sizeof(std::uint64_t) * 2, alignof(std::uint64_t)));
+    BOOST_REQUIRE(p);
+    BOOST_CHECK_EQUAL(p[0], 0u);
+    BOOST_CHECK_EQUAL(p[1], 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,160 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file MessageStatistics_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <tmx/plugin/utils/stats/MessageStatistics.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef TMX_STATS_TEST_THREADS
+#define TMX_STATS_TEST_THREADS 8
+#endif
+
+#ifndef TMX_STATS_TEST_COUNT
+#define TMX_STATS_TEST_COUNT 100000
+#endif
+
+using namespace tmx::plugin::utils::stats;
+
+typedef MessageStatistics::clock_type clock_type;
+
+BOOST_AUTO_TEST_SUITE( message_statistics_test_suite )
+
+BOOST_AUTO_TEST_CASE( counts_by_message_id ) {
+    MessageStatistics stats;
+    stats.count(20, 40);
+    stats.count(20, 42);
+    stats.count(19, 100);
+    stats.count(1000, 8);
+    stats.count_bytes(10);
+
+    MessageStatistics::Snapshot snap;
+    stats.snapshot(snap);
+
+    // Only the bytes counted on their own go toward the total
+    BOOST_CHECK_EQUAL(snap.totalBytes, 10u);
+    BOOST_REQUIRE_EQUAL(snap.messages.size(), 2u);
+    BOOST_CHECK_EQUAL(snap.messages[0].messageId, 19);
+    BOOST_CHECK_EQUAL(snap.messages[0].count, 1u);
+    BOOST_CHECK_EQUAL(snap.messages[0].bytes, 100u);
+    BOOST_CHECK_EQUAL(snap.messages[1].messageId, 20);
+    BOOST_CHECK_EQUAL(snap.messages[1].count, 2u);
+    BOOST_CHECK_EQUAL(snap.messages[1].bytes, 82u);
+    BOOST_CHECK(snap.sources.empty());
+}
+
+BOOST_AUTO_TEST_CASE( packet_bytes_counted_once ) {
+    MessageStatistics stats;
+
+    // A packet is counted like the message receiver does: the incoming handler
+    // counts the whole packet, then the J2735 handler counts the frame inside it
+    const std::size_t packetBytes = 64;
+    const std::size_t frameBytes = 56;
+    stats.count_bytes(packetBytes);
+    stats.count(20, frameBytes, "radio1");
+
+    MessageStatistics::Snapshot snap;
+    stats.snapshot(snap);
+
+    BOOST_CHECK_EQUAL(snap.totalBytes, packetBytes);
+    BOOST_REQUIRE_EQUAL(snap.messages.size(), 1u);
+    BOOST_CHECK_EQUAL(snap.messages[0].count, 1u);
+    BOOST_CHECK_EQUAL(snap.messages[0].bytes, frameBytes);
+    BOOST_REQUIRE_EQUAL(snap.sources.size(), 1u);
+    BOOST_CHECK_EQUAL(snap.sources[0].count, 1u);
+}
+
+BOOST_AUTO_TEST_CASE( source_rate_over_window ) {
+    MessageStatistics stats;
+    auto start = clock_type::now();
+
+    // 10 messages a second from one radio, and 1 a second from another, for 20 seconds
+    for (int s = 0; s < 20; s++) {
+        auto when = start + std::chrono::seconds(s);
+        for (int i = 0; i < 10; i++)
+            stats.count(20, 40, "radio1", when);
+        stats.count(19, 100, "radio2", when);
+    }
+
+    MessageStatistics::Snapshot snap;
+    stats.snapshot(snap, start + std::chrono::seconds(20));
+
+    BOOST_REQUIRE_EQUAL(snap.sources.size(), 2u);
+    for (auto const &src: snap.sources) {
+        if (src.source == "radio1") {
+            BOOST_CHECK_EQUAL(src.count, 200u);
+            BOOST_CHECK_CLOSE(src.rate, 10.0, 0.001);
+        } else {
+            BOOST_CHECK_EQUAL(src.source, "radio2");
+            BOOST_CHECK_EQUAL(src.count, 20u);
+            BOOST_CHECK_CLOSE(src.rate, 1.0, 0.001);
+        }
+    }
+
+    // Once the messages stop, the rate falls off as the window slides
+    stats.snapshot(snap, start + std::chrono::seconds(25));
+    for (auto const &src: snap.sources)
+        BOOST_CHECK_CLOSE(src.rate, src.source == "radio1" ? 5.0 : 0.5, 0.001);
+
+    stats.snapshot(snap, start + std::chrono::seconds(40));
+    for (auto const &src: snap.sources)
+        BOOST_CHECK_EQUAL(src.rate, 0.0);
+}
+
+BOOST_AUTO_TEST_CASE( source_slots_fill_up ) {
+    MessageStatistics stats;
+    for (std::size_t i = 0; i < MessageStatistics::MAX_SOURCES + 10; i++)
+        stats.count(20, 1, "source" + std::to_string(i));
+
+    MessageStatistics::Snapshot snap;
+    stats.snapshot(snap);
+
+    BOOST_CHECK_EQUAL(snap.sources.size(), MessageStatistics::MAX_SOURCES);
+    BOOST_REQUIRE_EQUAL(snap.messages.size(), 1u);
+    BOOST_CHECK_EQUAL(snap.messages[0].count, MessageStatistics::MAX_SOURCES + 10);
+}
+
+BOOST_AUTO_TEST_CASE( concurrent_counts_are_exact ) {
+    MessageStatistics stats;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < TMX_STATS_TEST_THREADS; t++) {
+        threads.emplace_back([&stats, t]() {
+            const std::string src = "radio" + std::to_string(t % 2);
+            for (int i = 0; i < TMX_STATS_TEST_COUNT; i++) {
+                stats.count_bytes(10);
+                stats.count(20 + (i % 2), 10, src);
+            }
+        });
+    }
+
+    // Read while the counts are being written
+    MessageStatistics::Snapshot snap;
+    for (int i = 0; i < 100; i++)
+        stats.snapshot(snap);
+
+    for (auto &t: threads)
+        t.join();
+
+    stats.snapshot(snap);
+
+    const std::uint64_t total = (std::uint64_t) TMX_STATS_TEST_THREADS * TMX_STATS_TEST_COUNT;
+    BOOST_CHECK_EQUAL(snap.totalBytes, total * 10);
+    BOOST_REQUIRE_EQUAL(snap.messages.size(), 2u);
+    BOOST_CHECK_EQUAL(snap.messages[0].count + snap.messages[1].count, total);
+    BOOST_REQUIRE_EQUAL(snap.sources.size(), 2u);
+    BOOST_CHECK_EQUAL(snap.sources[0].count + snap.sources[1].count, total);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
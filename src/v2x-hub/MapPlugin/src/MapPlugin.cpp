@@ -1,6 +1,8 @@
 
 #include <atomic>
 #include <bitset>
+#include <chrono>
+#include <condition_variable>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -23,8 +25,9 @@
 #include <tmx/message/codec/thirdparty/pugixml.hpp>
 #include <tmx/plugin/TmxPlugin.hpp>
 #include <tmx/plugin/TmxPluginDataUpdate.hpp>
-#include <tmx/plugin/utils/FrequencyThrottle.hpp>
 
+#include <IntersectionGeometry.h>
+#include <IntersectionGeometryList.h>
 #include <MapData.h>
 #include <MessageFrame.h>
 
@@ -60,15 +63,25 @@ protected:
     common::types::Array<common::types::Any> get_config_description() const noexcept override;
 
 private:
+    /*!
+     * @brief The ready to send MAP messages, keyed by the TSC action
+     *
+     * Each message is built once when the map files are loaded, and only
+     * its time point is updated before each broadcast.
+     */
+    typedef std::map<int, std::shared_ptr<const message::TmxMessage> > compiled_maps;
+
     std::atomic<int> _mapAction{ -1 };
     std::atomic<bool> _isMapFileNew{ false };
+    std::atomic<std::chrono::milliseconds::rep> _frequency{ 1000 };
 
     message::TmxData _mapFiles;
     std::mutex _dataLock;
 
-    FrequencyThrottle<int> throttle;
+    // Wakes up the broadcast timer early when the action or the configuration changes
+    std::condition_variable _timerWake;
 
-    void LoadMapFiles(message::TmxData &);
+    void LoadMapFiles(compiled_maps &);
 
     // A private tag for the handler
     struct on_config_update { };
@@ -107,7 +120,12 @@ void MapPlugin::handle_config_update(TmxPluginDataUpdate const &data, message::T
     const message::TmxData newVal { data.get_value() };
     // Handle the action status change
     if (msg.get_topic() == "TSC/Action") {
-        this->_mapAction = newVal.to_int();
+        {
+            std::lock_guard<std::mutex> _lock(this->_dataLock);
+            this->_mapAction = newVal.to_int();
+        }
+
+        this->_timerWake.notify_all();
         return;
     }
 
@@ -126,76 +144,73 @@ void MapPlugin::handle_config_update(TmxPluginDataUpdate const &data, message::T
 
     if (strcmp("Frequency", str.c_str()) == 0) {
         std::lock_guard<std::mutex> _lock(this->_dataLock);
-        throttle.set_Frequency(chrono::milliseconds(newVal.to_uint()));
+        this->_frequency = newVal.to_uint();
 
-        TLOG(DEBUG) << "Message frequency set to " <<
-                    chrono::duration_cast<chrono::milliseconds>(throttle.get_Frequency()).count() << " ms";
+        TLOG(DEBUG) << "Message frequency set to " << this->_frequency << " ms";
     } else if (strcmp("MapFiles", str.c_str()) == 0) {
-        std::lock_guard<std::mutex> _lock(this->_dataLock);
-        this->_mapFiles = data.get_value();
-        this->_isMapFileNew = true;
+        {
+            std::lock_guard<std::mutex> _lock(this->_dataLock);
+            this->_mapFiles = data.get_value();
+            this->_isMapFileNew = true;
+        }
+
+        this->_timerWake.notify_all();
     }
 }
 
 TmxError MapPlugin::main() {
     this->set_status("State", "Running");
 
-    bool mapFilesOk = false;
-
     int activeAction = -1;
-    message::TmxMessage _msg;
-    message::TmxData _maps;
+    compiled_maps maps;
+    std::shared_ptr<const message::TmxMessage> activeMap;
+
+    // The next time the active MAP is due to be sent
+    auto nextSend = std::chrono::steady_clock::now();
 
     while (this->is_running()) {
-        if (this->_isMapFileNew) {
-            _maps.get_container().reset();
-            _msg.get_source().clear();
+        if (this->_isMapFileNew.exchange(false)) {
+            maps.clear();
+            this->LoadMapFiles(maps);
 
-            this->LoadMapFiles(_maps);
-            this->_isMapFileNew = false;
+            // Send the new map right away
+            activeAction = -1;
         }
 
-        activeAction = this->_mapAction;
-
-        if (activeAction < 0) {
+        if (this->_mapAction < 0) {
             // No action set yet, so just wait
             sleep(1);
             continue;
         }
 
-        for (std::size_t i = 0; _msg.get_source().empty() && _maps.is_array() && i < (std::size_t) _maps; i++) {
-            message::TmxData mapInfo { _maps[i] };
-            if (mapInfo["Action"].to_int() == activeAction) {
-                TLOG(INFO) << "Building MAP message for action " << activeAction;
-
-                _msg.set_id(type_fqname<MapData>().data());
-                _msg.set_topic("J2735/MAP");
-                _msg.set_timepoint();
-                _msg.set_payload(mapInfo["Bytes"].to_string());
-                _msg.set_encoding("asn.1-uper");
+        if (activeAction != this->_mapAction) {
+            activeAction = this->_mapAction;
 
-                if (_msg.get_length()) {
-                    const message::TmxData intxn { mapInfo["Decoded"]["MapData"]["intersections"] };
+            auto it = maps.find(activeAction);
+            activeMap = (it == maps.end() ? nullptr : it->second);
+            if (activeMap)
+                this->set_status("ActiveMap", activeMap->get_source().c_str());
 
-                    // The IntersectionGeometry value may be an array. If so, use the first vale
-                    enum class _IG: std::uint8_t { IntersectionGeometry = 0 };
-                    if (intxn[_IG::IntersectionGeometry]["name"])
-                        _msg.set_source(intxn[_IG::IntersectionGeometry]["name"].to_string());
-                    else
-                        _msg.set_source(intxn[_IG::IntersectionGeometry]["id"]["id"].to_string());
-
-                }
-            }
+            nextSend = std::chrono::steady_clock::now();
         }
 
-        if (!_msg.get_source().empty() && this->throttle.Monitor(activeAction)) {
-            _msg.set_timepoint();
-            this->broadcast(_msg);
-
-            this->set_status("ActiveMap", _msg.get_source().c_str());
+        if (activeMap) {
+            // Stamp a copy for this send, which every channel then shares
+            auto msg = std::make_shared<message::TmxMessage>(*activeMap);
+            msg->set_timepoint();
+            this->broadcast(std::shared_ptr<const message::TmxMessage>(std::move(msg)));
         }
 
-        std::this_thread::sleep_for(this->throttle.get_Frequency() / 100);
+        // Sleep until the next period, unless the action or the map files change first
+        nextSend += std::chrono::milliseconds(this->_frequency);
+        auto now = std::chrono::steady_clock::now();
+        if (nextSend < now)
+            nextSend = now;
+
+        std::unique_lock<std::mutex> lock(this->_dataLock);
+        this->_timerWake.wait_until(lock, nextSend, [this, activeAction]() {
+            return !this->is_running() || this->_isMapFileNew || this->_mapAction != activeAction;
+        });
     }
 
     this->set_status("State", "Terminated");
@@ -203,7 +218,7 @@ TmxError MapPlugin::main() {
     return { };
 }
 
-void MapPlugin::LoadMapFiles(message::TmxData &_maps) {
+void MapPlugin::LoadMapFiles(compiled_maps &_maps) {
     TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION << " with " << _mapFiles.to_int()
                  << (_mapFiles.is_array() ? " array" : " non-array");
 
@@ -286,41 +301,59 @@ void MapPlugin::LoadMapFiles(message::TmxData &_maps) {
             }
         }
 
-        _maps[i]["Action"] = _mapFiles[i]["Action"];
+        const int action = _mapFiles[i]["Action"].to_int();
+
+        // The MAP is identified by its intersection, so one without any is never sent
+        if (!mapData->intersections || mapData->intersections->list.count <= 0) {
+            TLOG(ERR) << "Skipping MAP for action " << action << " with no IntersectionGeometry";
+            ASN_STRUCT_FREE(asn_DEF_MessageFrame, msg);
+            continue;
+        }
 
         // Serialize the Map for status printout
-        char *buffer;
+        char *buffer = nullptr;
         size_t bufSize;
         FILE *mStream = open_memstream(&buffer, &bufSize);
         if (mStream) {
             if (xer_fprint(mStream, &asn_DEF_MapData, mapData) == 0) {
-                const_string tmp { buffer, bufSize };
-                TLOG(INFO) << "Map for action " << _mapFiles[i]["Action"].to_int() <<
-                           " is: " << endl << tmp;
-
-                auto decoder = message::codec::TmxDecoder::get_decoder("xml");
-                if (decoder)
-                    decoder->decode(_maps[i]["Decoded"].get_container(), tmp);
+                fflush(mStream);
+                TLOG(INFO) << "Map for action " << action << " is: " << endl << const_string(buffer, bufSize);
             }
             fclose(mStream);
-
-            unsigned char *bytes;
-            auto result = uper_encode_to_new_buffer(&asn_DEF_MessageFrame, nullptr, msg, (void **) &bytes);
-            if (result > 0) {
-                _maps[i]["Bytes"] = byte_string_encode(to_byte_sequence(bytes, result));
-
-                if (this->_mapAction < 0)
-                    this->_mapAction = _maps[i]["Action"];
-            } else {
-                TLOG(ERR) << "Unable to encode MAP";
-            }
-
-            free(bytes);
         }
 
         free(buffer);
         buffer = nullptr;
 
+        // Build the message to send once, since it never changes
+        unsigned char *bytes = nullptr;
+        auto result = uper_encode_to_new_buffer(&asn_DEF_MessageFrame, nullptr, msg, (void **) &bytes);
+        if (result > 0) {
+            auto _msg = std::make_shared<message::TmxMessage>();
+            _msg->set_id(type_fqname<MapData>().data());
+            _msg->set_topic("J2735/MAP");
+            _msg->set_timepoint();
+            _msg->set_payload(byte_string_encode(to_byte_sequence(bytes, result)));
+            _msg->set_encoding("asn.1-uper");
+
+            // The IntersectionGeometry value may be a list. If so, use the first value
+            const IntersectionGeometry *intxn = mapData->intersections->list.array[0];
+            if (intxn->name && intxn->name->size)
+                _msg->set_source(std::string((const char *) intxn->name->buf, intxn->name->size));
+            else
+                _msg->set_source(std::to_string(intxn->id.id));
+
+            TLOG(INFO) << "Built MAP message for action " << action;
+
+            _maps[action] = _msg;
+            if (this->_mapAction < 0)
+                this->_mapAction = action;
+        } else {
+            TLOG(ERR) << "Unable to encode MAP";
+        }
+
+        free(bytes);
+
         ASN_STRUCT_FREE(asn_DEF_MessageFrame, msg);
     }
 
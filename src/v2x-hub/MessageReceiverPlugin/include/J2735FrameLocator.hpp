@@ -0,0 +1,181 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file J2735FrameLocator.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#ifndef INCLUDE_J2735FRAMELOCATOR_HPP_
+#define INCLUDE_J2735FRAMELOCATOR_HPP_
+
+#include <tmx/common/platform/types/bytes.hpp>
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+namespace tmx {
+namespace plugin {
+namespace v2x {
+namespace MessageReceiver {
+
+/*!
+ * @brief The location of a J2735 MessageFrame within a received packet
+ */
+struct J2735FrameLocation {
+    /*!
+     * @brief The offset of the first byte of the frame
+     */
+    std::size_t offset = 0;
+
+    /*!
+     * @brief The number of bytes in the frame
+     */
+    std::size_t length = 0;
+
+    /*!
+     * @brief The DSRC message ID of the frame, or zero if no frame was found
+     */
+    std::uint16_t messageId = 0;
+
+    /*!
+     * @brief True if the whole frame, according to its encoded length, is in the packet
+     */
+    bool complete = false;
+
+    operator bool() const noexcept {
+        return messageId > 0;
+    }
+};
+
+/*!
+ * @brief Finds a UPER encoded J2735 MessageFrame inside a packet from a radio
+ *
+ * A MessageFrame starts with the 2 byte DSRC message ID, such as 0x0014 for
+ * a BSM or 0x0013 for a SPAT, followed by the length determinant for the
+ * open type value. Radios may add their own headers, an IEEE 1609.2
+ * wrapper or padding around the frame, so the packet is scanned once, from
+ * the front, for the first known message ID whose encoded length fits in
+ * what remains. For an unsecured 1609.2 payload, the frame must also fit
+ * inside the opaque data. If no frame fits, the first known message ID is
+ * assumed to run to the end of the packet.
+ *
+ * The scan never copies the packet, and each byte is examined a fixed
+ * number of times, so a malformed packet costs no more than a valid one.
+ */
+class J2735FrameLocator {
+public:
+    /*!
+     * @param[in] ids The DSRC message IDs that may start a frame
+     */
+    explicit J2735FrameLocator(std::bitset<256> const &ids) noexcept: _ids(ids) { }
+
+    /*!
+     * @brief Locate the frame in the packet
+     *
+     * @param[in] bytes The packet bytes
+     * @return The location of the frame
+     */
+    J2735FrameLocation locate(common::byte_sequence const &bytes) const noexcept {
+        J2735FrameLocation fallback;
+
+        const std::size_t n = bytes.length();
+        for (std::size_t i = 0; i + 2 < n; i++) {
+            // An unsecured IEEE 1609.2 data, which is protocol version 3 and the unsecured data choice
+            if (get_byte(bytes, i) == 0x03 && get_byte(bytes, i + 1) == 0x80) {
+                std::size_t start = i + 2;
+                std::size_t len = 0;
+                if (read_oer_length(bytes, start, len) && start + len <= n) {
+                    auto loc = this->at(bytes, start, start + len);
+                    if (loc && loc.complete)
+                        return loc;
+                }
+            }
+
+            auto loc = this->at(bytes, i, n);
+            if (loc && loc.complete)
+                return loc;
+
+            if (loc && !fallback)
+                fallback = loc;
+        }
+
+        return fallback;
+    }
+
+private:
+    std::bitset<256> _ids;
+
+    static std::uint8_t get_byte(common::byte_sequence const &bytes, std::size_t i) noexcept {
+        return static_cast<std::uint8_t>(bytes[i]);
+    }
+
+    /*!
+     * @brief Read an OER length determinant, moving the offset past it
+     */
+    static bool read_oer_length(common::byte_sequence const &bytes, std::size_t &i, std::size_t &len) noexcept {
+        if (i >= bytes.length())
+            return false;
+
+        std::uint8_t b = get_byte(bytes, i++);
+        if (b < 0x80) {
+            len = b;
+            return true;
+        }
+
+        // The long form gives the number of length bytes to follow
+        std::size_t cnt = b & 0x7F;
+        if (cnt == 0 || cnt > 2 || i + cnt > bytes.length())
+            return false;
+
+        len = 0;
+        for (; cnt > 0; cnt--)
+            len = (len << 8) | get_byte(bytes, i++);
+
+        return true;
+    }
+
+    /*!
+     * @brief Check for a frame at the given offset, which must end by the given limit
+     */
+    J2735FrameLocation at(common::byte_sequence const &bytes, std::size_t i, std::size_t end) const noexcept {
+        J2735FrameLocation loc;
+
+        // V2X message IDs are 0x00-0xFF, but the encoding of the frame uses 2 bytes (0x0000-0x00FF)
+        if (i + 2 >= end || get_byte(bytes, i) != 0x00 || !get_byte(bytes, i + 1) || !_ids[get_byte(bytes, i + 1)])
+            return loc;
+
+        loc.offset = i;
+        loc.length = end - i;
+        loc.messageId = get_byte(bytes, i + 1);
+
+        // The UPER length determinant of the value, in bytes
+        std::size_t hdr = 3;
+        std::size_t len = get_byte(bytes, i + 2);
+        if (len & 0x80) {
+            if ((len & 0xC0) != 0x80 || i + 3 >= end)
+                return loc;
+
+            hdr = 4;
+            len = ((len & 0x3F) << 8) | get_byte(bytes, i + 3);
+        }
+
+        if (i + hdr + len <= end) {
+            loc.length = hdr + len;
+            loc.complete = true;
+        }
+
+        return loc;
+    }
+};
+
+} /* End namespace MessageReceiver */
+} /* End namespace v2x */
+} /* End namespace plugin */
+} /* End namespace tmx */
+
+#endif /* INCLUDE_J2735FRAMELOCATOR_HPP_ */
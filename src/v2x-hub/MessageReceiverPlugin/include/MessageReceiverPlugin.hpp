@@ -17,6 +17,7 @@
 #include <tmx/plugin/TmxPlugin.hpp>
 #include <tmx/plugin/TmxPluginDataUpdate.hpp>
 #include <tmx/plugin/utils/FrequencyThrottle.hpp>
+#include <tmx/plugin/utils/stats/MessageStatistics.hpp>
 
 #include <boost/asio.hpp>
 #include <memory>
@@ -62,9 +63,7 @@ private:
 
     //Status variables
     static std::atomic<uint64_t> _startTime;
-    static std::atomic<uint64_t> _totalBytes; //increment in on_message_received
-    static std::map<std::string, std::atomic<uint32_t> > _totalCount; //count per message type
-    static std::mutex _mapMutex; // Mutex for protecting the map
+    utils::stats::MessageStatistics _statistics; //count in on_message_received, without locking
 
     std::string readFileAsByteString(const std::string& filePath) {
         std::ifstream file(filePath, std::ios::binary);
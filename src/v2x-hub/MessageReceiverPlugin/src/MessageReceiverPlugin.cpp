@@ -11,11 +11,13 @@
 
 #include "MessageReceiverPlugin.hpp"
 #include "MessageReceiver_Configuration.hpp"
+#include "J2735FrameLocator.hpp"
 
 #include <tmx/common/TmxLogger.hpp>
 #include <tmx/message/codec/TmxCodec.hpp>
 #include <tmx/message/codec/serializer/TmxDataSerializer.hpp>
 #include <tmx/plugin/utils/Clock.hpp>
+#include <tmx/plugin/utils/sim/SimulatedMessageEncoder.hpp>
 
 #include <mutex>
 #include <regex>
@@ -38,6 +40,7 @@ using namespace tmx::common;
 using namespace tmx::common::types;
 using namespace tmx::message;
 using namespace tmx::plugin::utils;
+using namespace tmx::plugin::utils::sim;
 using namespace tmx::message::codec::serializer;
 
 // BSMs may be 10 times a second, so only send errors at most every 2 minutes
@@ -90,6 +93,54 @@ asn_TYPE_descriptor_t *get_type_descriptor(const_string msgType) {
         return nullptr;
 }
 
+/*!
+ * @return The locator for frames with any of the registered J2735 message IDs
+ */
+J2735FrameLocator const &get_frame_locator() {
+    static const J2735FrameLocator _locator { []() {
+        std::bitset<256> ids;
+        for (std::size_t i = 1; i < ids.size(); i++)
+            ids[i] = get_message_id(std::to_string(i)) > 0;
+
+        return ids;
+    }() };
+
+    return _locator;
+}
+
+/*!
+ * @brief Set up the forwarded message for a UPER encoded J2735 frame
+ *
+ * @param[in,out] fwdMsg The message to forward
+ * @param[in] messageId The J2735 message ID of the frame
+ * @param[in] frame The frame bytes
+ * @return True if the message ID is registered, or false otherwise
+ */
+bool set_j2735_frame(TmxMessage &fwdMsg, long messageId, byte_sequence const &frame) {
+    DSRCmsgID_t id = get_message_id(std::to_string(messageId));
+    if (id <= 0)
+        return false;
+
+    auto msgType = std::to_string(id);
+
+    fwdMsg.set_id(get_message_type_name(msgType));
+    fwdMsg.set_topic("J2735/" + get_message_topic_name(msgType));
+    fwdMsg.get_payload_string().clear();
+    byte_string_encode(fwdMsg.get_payload_string(), frame, TMX_DEFAULT_BYTE_ENCODING);
+    fwdMsg.set_encoding("asn.1-uper");
+    return true;
+}
+
+/*!
+ * @return The time of the simulated message, or now if there is none
+ */
+std::chrono::system_clock::time_point get_simulated_time(TmxMessage const &msg) {
+    if (msg.get_timestamp() > 0)
+        return std::chrono::system_clock::time_point(std::chrono::system_clock::duration(msg.get_timestamp()));
+
+    return std::chrono::system_clock::now();
+}
+
 // Handler tags
 struct incoming { };
 struct j2735 { };
@@ -142,7 +193,7 @@ void TmxPlugin::on_message_received<TmxData const, v2x::MessageReceiver::incomin
     // Update things for the status messages
     auto plugin = dynamic_cast<v2x::MessageReceiver::MessageReceiverPlugin *>(this);
     if (plugin)
-        plugin->_totalBytes += payloadBytes.length();
+        plugin->_statistics.count_bytes(payloadBytes.length());
 
     types::Any const _id { channel->get_context().get_id() };
 
@@ -174,53 +225,52 @@ void TmxPlugin::on_message_received<types::String8 const, v2x::MessageReceiver::
     if (!this->get_config("enable-j2735"))
         return;
 
-    UInt<16> msgId;
-
     auto payloadBytes = byte_string_decode(msg.get_payload_string());
 
-    // Try up to the 10 times to find a message ID, in case there is a header
-    DSRCmsgID_t id = 0;
-    for (std::size_t i = 0; i < 10 && id <= 0; i++) {
-        // Skip ahead to a leading zero byte
-        // V2X message IDs are 0x00-0xFF, but the encoding of the frame uses 2 bytes (0x0000-0x00FF)
-        while (payloadBytes.length() > 1 && (std::uint8_t)payloadBytes.front())
-            payloadBytes = payloadBytes.substr(1);
+    // Skip past any header or padding to the start of the frame
+    auto frame = v2x::MessageReceiver::get_frame_locator().locate(payloadBytes);
 
-        if (payloadBytes.length() > decltype(msgId)::numBytes)   // Make sure this is a valid J2735 type
-            msgId = get_value<typename decltype(msgId)::value_type>(payloadBytes.substr(0, decltype(msgId)::numBytes));
+    // Compose the message
+    TmxMessage fwdMsg { msg };
 
-        if (msgId > 0)
-            id = v2x::MessageReceiver::get_message_id(std::to_string(msgId));
-    }
+    if (frame && v2x::MessageReceiver::set_j2735_frame(fwdMsg, frame.messageId,
+                                                       to_byte_sequence(payloadBytes.data() + frame.offset,
+                                                                        frame.length))) {
+        this->broadcast(fwdMsg);
 
-    if (id > 0) {
-        auto msgType = std::to_string(id);
+        // Count the message type and source, which is lock free
+        auto plugin = dynamic_cast<v2x::MessageReceiver::MessageReceiverPlugin *>(this);
+        if (plugin)
+            plugin->_statistics.count(frame.messageId, frame.length, msg.get_source());
+    } else {
+        if (v2x::MessageReceiver::_errThrottle.Monitor(std::to_string(frame.messageId)))
+            this->broadcast<TmxError>({ EINVAL, "Request for invalid J2735 message " + msg.get_payload_string() },
+                                      this->get_topic("error"), __FUNCTION__);
+    }
+}
 
-        // Compose the message
-        TmxMessage fwdMsg { msg };
+/*!
+ * @brief Forward the simulated J2735 frame
+ *
+ * The frame is already encoded, so this goes straight to the J2735 topic
+ * without decoding the bytes again to find the message.
+ */
+template <>
+void TmxPlugin::on_message_received<common::byte_sequence const, v2x::MessageReceiver::j2735>(
+        common::byte_sequence const &frame, TmxMessage const &msg) {
+    if (frame.empty() || !this->get_config("enable-j2735"))
+        return;
 
-        auto topic = v2x::MessageReceiver::get_message_topic_name(msgType);
-        fwdMsg.set_id(v2x::MessageReceiver::get_message_type_name(msgType));
-        fwdMsg.set_topic("J2735/" + topic);
-        fwdMsg.set_payload(byte_string_encode(payloadBytes));
-        fwdMsg.set_encoding("asn.1-uper");
+    TmxMessage fwdMsg { msg };
+    fwdMsg.set_source("/dev/v2x-sim");
 
+    auto messageId = get_value<std::uint16_t>(frame.substr(0, 2));
+    if (v2x::MessageReceiver::set_j2735_frame(fwdMsg, messageId, frame)) {
         this->broadcast(fwdMsg);
 
-        // Increment the totalCount map (thread-safe)
         auto plugin = dynamic_cast<v2x::MessageReceiver::MessageReceiverPlugin *>(this);
-        if (plugin) {
-            std::lock_guard<std::mutex> lock(plugin->_dataLock);
-            // Initialize the atomic count for this message type if not already present
-            if (!plugin->_totalCount.count(topic))
-                plugin->_totalCount[topic] = 0;
-
-            plugin->_totalCount[topic]++;
-        }
-    } else {
-        if (v2x::MessageReceiver::_errThrottle.Monitor(std::to_string(*msgId)))
-            this->broadcast<TmxError>({ EINVAL, "Request for invalid J2735 message " + msg.get_payload_string() },
-                                      this->get_topic("error"), __FUNCTION__);
+        if (plugin)
+            plugin->_statistics.count(messageId, frame.length(), fwdMsg.get_source());
     }
 }
 
@@ -229,129 +279,39 @@ void TmxPlugin::on_message_received<types::String8 const, v2x::MessageReceiver::
                                                                                         TmxMessage const &msg) {
     TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION << " with " << msg.to_string();
 
-    codec::TmxCodec codec { msg };
-    auto bytes = byte_string_decode(msg.get_payload_string());
-
     //extract data
     //vehicleId(4), heading*M(4), speed*K(4), (latitude+180)*M(4), (longitude+180)*M(4), elevation (4)
-    typedef UInt<32> vehicleId;
-    typedef UInt<32> heading;
-    typedef UInt<32> speed;
-    typedef UInt<32> lat;
-    typedef UInt<32> lon;
-    typedef UInt<32> alt;
-
-    typedef bit_count<vehicleId, heading, speed, lat, lon, alt> count;
+    auto bytes = byte_string_decode(msg.get_payload_string());
 
-    if (bytes.length() != count::value / TMX_BITS_PER_BYTE)
+    SimulatedVehicle vehicle;
+    if (!SimulatedMessageEncoder::parse_bsm(bytes, vehicle))
         return;
 
-    auto vehId = get_value<vehicleId::value_type>(bytes.substr(0, vehicleId::numBytes));
-    bytes = bytes.substr(vehicleId::numBytes);
-
-    auto now = std::chrono::system_clock::now();
-    if (msg.get_timestamp() > 0) {
-        std::chrono::system_clock::duration dur { msg.get_timestamp() };
-        now = std::chrono::system_clock::time_point(dur);
-    }
+    auto now = v2x::MessageReceiver::get_simulated_time(msg);
+
+    if (this->get_config("enable-sim-tpv")) {
+        TmxData pvt;
+        pvt["track"] = vehicle.heading;
+        pvt["speed"] = vehicle.speed;
+        pvt["lat"] = vehicle.latitude;
+        pvt["lon"] = vehicle.longitude;
+        pvt["altHAE"] = vehicle.elevation;
+        pvt["time"] = std::regex_replace(utils::Clock::ToUtcPreciseTimeString(now), std::regex("\\s"), "T");
+        pvt["mode"] = enums::enum_integer(message::v2x::FixTypes::ThreeD);
+        pvt["status"] = enums::enum_integer(message::v2x::SignalQualityTypes::SimulationMode);
+        pvt["device"] = std::string("/dev/v2x-sim");
+        pvt["class"] = std::string("TPV");
 
-    TmxData pvt;
-    pvt["track"] = get_value<heading::value_type>(bytes.substr(0, heading::numBytes)) / 1000000.0;
-    bytes = bytes.substr(heading::numBytes);
-    pvt["speed"] = get_value<speed::value_type>(bytes.substr(0, speed::numBytes)) / 1000.0;
-    bytes = bytes.substr(speed::numBytes);
-    pvt["lat"] = get_value<lat::value_type>(bytes.substr(0, lat::numBytes)) / 1000000.0 - 180.0;
-    bytes = bytes.substr(lat::numBytes);
-    pvt["lon"] = get_value<lon::value_type>(bytes.substr(0, lon::numBytes)) / 1000000.0 - 180.0;
-    bytes = bytes.substr(lon::numBytes);
-    pvt["altHAE"] = get_value<alt::value_type>(bytes.substr(0, alt::numBytes)) / 1000.0 - 500.0;
-    pvt["time"] = std::regex_replace(utils::Clock::ToUtcPreciseTimeString(now), std::regex("\\s"), "T");
-    pvt["mode"] = enums::enum_integer(message::v2x::FixTypes::ThreeD);
-    pvt["status"] = enums::enum_integer(message::v2x::SignalQualityTypes::SimulationMode);
-    pvt["device"] = std::string("/dev/v2x-sim");
-    pvt["class"] = std::string("TPV");
-
-    if (this->get_config("enable-sim-tpv"))
         this->broadcast(pvt.get_container(), "gpsd/TPV", __FUNCTION__);
+    }
 
     if (this->get_config("enable-sim-bsm")) {
-        MessageFrame frame;
-        auto &bsm = frame.value.choice.BasicSafetyMessage;
-        frame.value.present = MessageFrame__value_PR_BasicSafetyMessage;
-
-        auto nm = type_short_name(bsm).data();
-        frame.messageId = v2x::MessageReceiver::get_message_id(nm);
-
-        memset(&bsm, 0, sizeof(bsm));
-
-        bsm.coreData.msgCnt = 0;
-
-        std::uint8_t id[4];
-        memcpy(id, &vehId, 4);
-        bsm.coreData.id.size = 4;
-        bsm.coreData.id.buf = id;
-
-        bsm.coreData.secMark = (std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) -
-                                std::chrono::duration_cast<std::chrono::minutes>(now.time_since_epoch())).count();
-
-        // Latitude and Longitude are expressed in 1/10th integer microdegrees, as a 31 bit value.
-        // The value 900000001 indicates that latitude is not available.
-        // The value 1800000001 indicates that longitude is not available.
-        bsm.coreData.lat = (Latitude_t) (10000000.0 * (double)pvt["lat"]);
-        bsm.coreData.Long = (Longitude_t) (10000000.0 * (double)pvt["lon"]);
-
-        // Elevation is in units of 10 cm steps.
-        // max and min values are limited as set below.
-        bsm.coreData.elev = 10.0 * (double)pvt["altHAE"];
-        if (bsm.coreData.elev > 61439)
-            bsm.coreData.elev = 61439;
-        else if (bsm.coreData.elev < -4095)
-            bsm.coreData.elev = -4095;
-
-        // Convert from mps to .02 meters/sec.
-        bsm.coreData.speed = 50.0 * (double)pvt["speed"];
-
-        // Heading units are 0.0125 degrees.
-        bsm.coreData.heading = 80.0 * (double)pvt["track"];
-        if (bsm.coreData.heading > 28799)
-            bsm.coreData.heading = 28799;
-        else if (bsm.coreData.heading < 0)
-            bsm.coreData.heading = 0;
-
-        // Steering Wheel Angle units are 1.5 degrees (-126 to 127).
-        bsm.coreData.angle = 127;
-        bsm.coreData.accuracy.semiMajor = 0;
-        bsm.coreData.accuracy.semiMinor = 0;
-        bsm.coreData.accuracy.orientation = 0;
-
-        bsm.coreData.transmission = TransmissionState_unavailable;
-
-        bsm.coreData.accelSet.Long = 0;
-        bsm.coreData.accelSet.lat = 0;
-        bsm.coreData.accelSet.vert = 0;
-        bsm.coreData.accelSet.yaw = 0;
-
-        std::uint8_t wheelBrakes = 0;
-        bsm.coreData.brakes.wheelBrakes.buf = &wheelBrakes;
-        bsm.coreData.brakes.wheelBrakes.size = 1;
-        bsm.coreData.brakes.wheelBrakes.bits_unused = 3;
-
-        bsm.coreData.brakes.traction = TractionControlStatus_unavailable;
-        bsm.coreData.brakes.abs = AntiLockBrakeStatus_unavailable;
-        bsm.coreData.brakes.scs = StabilityControlStatus_unavailable;
-        bsm.coreData.brakes.brakeBoost = BrakeBoostApplied_unavailable;
-        bsm.coreData.brakes.auxBrakes = AuxiliaryBrakeStatus_unavailable;
-
-        // Encode the bytes
-        char buffer[4096];
-        auto ret = uper_encode_to_buffer(&asn_DEF_MessageFrame, nullptr, &frame, buffer, 4096);
-        if (ret.encoded > 0) {
-            codec.get_message().set_timepoint(now);
-            codec.get_message().set_source(std::string(pvt["device"].to_string().c_str()));
-            codec.get_message().set_encoding("asn.1-uper");
-            codec.get_message().set_payload(byte_string_encode(to_byte_sequence(buffer, ret.encoded / TMX_BITS_PER_BYTE)));
-            this->invoke_handlers(types::String8(), codec.get_message(), "J2735/UNKNOWN");
-        }
+        // The encoded bytes are only good until the next message on this thread
+        auto frame = SimulatedMessageEncoder::get_thread_encoder().encode_bsm(vehicle, now);
+
+        TmxMessage fwdMsg { msg };
+        fwdMsg.set_timepoint(now);
+        this->on_message_received<common::byte_sequence const, v2x::MessageReceiver::j2735>(frame, fwdMsg);
     }
 }
 
@@ -360,83 +320,24 @@ void TmxPlugin::on_message_received<types::String8 const, v2x::MessageReceiver::
                                                                                         TmxMessage const &msg) {
     TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION << " with " << msg.to_string();
 
-    auto bytes = byte_string_decode(msg.get_payload_string());
-
     // extract data
     // vehicleId(4), heading*M(4), speed*K(4), (latitude+180)*M(4), (longitude+180)*M(4), role (4)
-    typedef UInt<32> vehicleId;
-    typedef UInt<32> heading;
-    typedef UInt<32> speed;
-    typedef UInt<32> lat;
-    typedef UInt<32> lon;
-    typedef UInt<32> role;
-
-    typedef bit_count<vehicleId, heading, speed, lat, lon, role> count;
+    auto bytes = byte_string_decode(msg.get_payload_string());
 
-    if (bytes.length() != count::value / TMX_BITS_PER_BYTE)
+    SimulatedVehicle vehicle;
+    if (!SimulatedMessageEncoder::parse_srm(bytes, vehicle))
         return;
 
-    auto vehId = get_value<vehicleId::value_type>(bytes.substr(0, vehicleId::numBytes));
-    bytes = bytes.substr(vehicleId::numBytes);
-
-/*
-    auto now = std::chrono::system_clock::now();
-
-    auto track = get_value<heading::value_type>(bytes.substr(0, heading::numBytes));
-    bytes = bytes.substr(heading::numBytes);
-    auto spd = get_value<speed::value_type>(bytes.substr(0, speed::numBytes));
-    bytes = bytes.substr(speed::numBytes);
-    auto latitude = get_value<lat::value_type>(bytes.substr(0, lat::numBytes)) / 1000000.0 - 180.0;
-    bytes = bytes.substr(lat::numBytes);
-    auto longitude = get_value<lon::value_type>(bytes.substr(0, lon::numBytes)) / 1000000.0 - 180.0;
-    bytes = bytes.substr(lon::numBytes);
-    auto r = get_value<role::value_type>(bytes.substr(0, role::numBytes)) / 1000.0 - 500.0;
-
-    TLOG(DEBUG1) << pvt.to_string();
-
-*/
-    MessageFrame frame;
-    auto &srm = frame.value.choice.SignalRequestMessage;
-    frame.value.present = MessageFrame__value_PR_SignalRequestMessage;
-
-    auto nm = type_short_name(srm).data();
-    frame.messageId = v2x::MessageReceiver::get_message_id(nm);
-
-    memset(&srm, 0, sizeof(srm));
-
-//    srm.requestor.id.present = VehicleID_PR_entityID;
-//    srm.requestor.id.choice.entityID.size = s;
-//    srm.requestor.id.choice.entityID.buf = (uint8_t *)calloc(s, sizeof(uint8_t));
-//    if (srm->requestor.id.choice.entityID.buf)
-//        memcpy(srm->requestor.id.choice.entityID.buf, &vehicleId, s);
-//
-//        srm->requestor.type =
-//                (struct RequestorType *)calloc(1, sizeof(struct RequestorType));
-//        if (srm->requestor.type)
-//        {
-//            srm->requestor.type->role = (BasicVehicleRole_t)role;
-//            srm->requestor.position =
-//                    (struct RequestorPositionVector *)calloc(1, sizeof(struct RequestorPositionVector));
-//            if (srm->requestor.position)
-//            {
-//                srm->requestor.position->position.lat = (Latitude_t)(10.0 * latitude - 1800000000);
-//                srm->requestor.position->position.Long = (Longitude_t)(10.0 * longitude - 1800000000);
-//                srm->requestor.position->heading =
-//                        (DSRC_Angle_t *)calloc(1, sizeof(DSRC_Angle_t));
-//                if (srm->requestor.position->heading)
-//                    *(srm->requestor.position->heading) = (DSRC_Angle_t)(heading / 12500.0);
-//                srm->requestor.position->speed =
-//                        (TransmissionAndSpeed *)calloc(1, sizeof(TransmissionAndSpeed));
-//                if (srm->requestor.position->speed)
-//                {
-//                    srm->requestor.position->speed->transmisson = TransmissionState_unavailable;
-//                    srm->requestor.position->speed->speed = (Velocity_t)(speed / 20.0);
-//                }
-//            }
-//        }
-//    }
+    if (this->get_config("enable-sim-srm")) {
+        auto now = v2x::MessageReceiver::get_simulated_time(msg);
 
+        // The encoded bytes are only good until the next message on this thread
+        auto frame = SimulatedMessageEncoder::get_thread_encoder().encode_srm(vehicle, now);
 
+        TmxMessage fwdMsg { msg };
+        fwdMsg.set_timepoint(now);
+        this->on_message_received<common::byte_sequence const, v2x::MessageReceiver::j2735>(frame, fwdMsg);
+    }
 }
 
 template <>
@@ -444,34 +345,23 @@ void TmxPlugin::on_message_received<types::String8 const, v2x::MessageReceiver::
                                                                                         TmxMessage const &msg) {
     TLOG(DEBUG3) << "Enter " << TMX_PRETTY_FUNCTION << " with " << msg.to_string();
 
-    auto bytes = byte_string_decode(msg.get_payload_string());
-
     //extract data
     // vehicleId(4), speed*K(4), gearPosition(1), turnSignalPosition(1), flags1(1), acceleration*K(4)
-    typedef UInt<32> vehicleId;
-    typedef UInt<32> speed;
-    typedef UInt<8> gearPosition;
-    typedef UInt<8> turnSignalPosition;
-    typedef UInt<8> flags1;
-    typedef UInt<32> acceleration;
-
-    typedef bit_count<vehicleId, speed, gearPosition, turnSignalPosition, flags1, acceleration> count;
+    auto bytes = byte_string_decode(msg.get_payload_string());
 
-    if (bytes.length() != count::value / TMX_BITS_PER_BYTE)
+    SimulatedVehicleBasics vehicle;
+    if (!SimulatedMessageEncoder::parse_vbm(bytes, vehicle))
         return;
 
-    auto vehId = get_value<vehicleId::value_type>(bytes.substr(0, vehicleId::numBytes));
-    bytes = bytes.substr(vehicleId::numBytes);
-
+    TLOG(DEBUG1) << "Simulated vehicle " << vehicle.id << " basics: speed=" << vehicle.speed
+                 << ", gear=" << (int) vehicle.gearPosition << ", signal=" << (int) vehicle.turnSignalPosition
+                 << ", acceleration=" << vehicle.acceleration;
 }
 
 namespace v2x {
 namespace MessageReceiver {
 
 std::atomic<uint64_t> MessageReceiverPlugin::_startTime{0};
-std::atomic<uint64_t> MessageReceiverPlugin::_totalBytes{0};
-std::map<std::string, std::atomic<uint32_t>> MessageReceiverPlugin::_totalCount;
-std::mutex MessageReceiverPlugin::_mapMutex; // Define the mutex
 
 MessageReceiverPlugin::MessageReceiverPlugin() {
     // Register handlers
@@ -532,27 +422,42 @@ common::TmxError MessageReceiverPlugin::main() noexcept
     this->set_status("State", "Running");
     _startTime = Clock::GetMillisecondsSinceEpoch();
 
+    utils::stats::MessageStatistics::Snapshot snapshot;
+    std::map<std::uint16_t, std::string> topics;
+
     while(this->is_running()) {
         if (_statusThrottle.Monitor(1)) {
-            uint64_t b = _totalBytes;
+            _statistics.snapshot(snapshot);
             auto msCount = Clock::GetMillisecondsSinceEpoch() - _startTime;
 
-            this->set_status("Total KBytes Received", b / 1024.0);
+            this->set_status("Total KBytes Received", snapshot.totalBytes / 1024.0);
+
+            for (auto const &cnt: snapshot.messages) {
+                // Only look up the topic name the first time the message type is seen
+                auto &topic = topics[cnt.messageId];
+                if (topic.empty())
+                    topic = get_message_topic_name(std::to_string(get_message_id(std::to_string(cnt.messageId))));
 
-            for (auto iter = _totalCount.begin(); iter != _totalCount.end(); iter++) {
                 string param("Avg ");
-                param += iter->first;
+                param += topic;
                 param += " Message Interval (ms)";
 
-                uint32_t c = _totalCount[iter->first];
-                this->set_status(param.c_str(), c == 0 ? 0 : 1.0 * msCount / c);
+                this->set_status(param.c_str(), cnt.count == 0 ? 0 : 1.0 * msCount / cnt.count);
 
                 param = "Total ";
-                param += iter->first;
+                param += topic;
                 param += " Messages Received";
-                this->set_status(param.c_str(), c);
+                this->set_status(param.c_str(), cnt.count);
+            }
+
+            for (auto const &cnt: snapshot.sources) {
+                string param("Messages Per Second From ");
+                param += cnt.source;
+                this->set_status(param.c_str(), cnt.rate);
             }
         }
+
+        std::this_thread::sleep_for(_statusThrottle.get_Frequency() / 10);
     }
 
     this->set_status("State", "Terminated");
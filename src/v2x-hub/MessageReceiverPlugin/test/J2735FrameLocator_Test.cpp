@@ -0,0 +1,180 @@
+/*!
+ * Copyright (c) 2026 Battelle Memorial Institute
+ *
+ * All Rights Reserved.
+ *
+ * @file J2735FrameLocator_Test.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      @author: agent
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "J2735FrameLocator.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace tmx::common;
+using namespace tmx::plugin::v2x::MessageReceiver;
+
+typedef std::vector<std::uint8_t> packet_type;
+
+static constexpr std::uint16_t MAP = 0x12;
+static constexpr std::uint16_t SPAT = 0x13;
+static constexpr std::uint16_t BSM = 0x14;
+
+static J2735FrameLocator const &get_locator() {
+    static const J2735FrameLocator _locator { []() {
+        std::bitset<256> ids;
+        ids[MAP] = ids[SPAT] = ids[BSM] = true;
+        return ids;
+    }() };
+
+    return _locator;
+}
+
+static J2735FrameLocation locate(packet_type const &pkt) {
+    return get_locator().locate(to_byte_sequence(reinterpret_cast<const char *>(pkt.data()), pkt.size()));
+}
+
+/*!
+ * @return A UPER MessageFrame with the given ID and a value of len bytes
+ */
+static packet_type frame(std::uint8_t id, std::size_t len) {
+    packet_type pkt { 0x00, id };
+    if (len < 0x80) {
+        pkt.push_back(static_cast<std::uint8_t>(len));
+    } else {
+        pkt.push_back(static_cast<std::uint8_t>(0x80 | (len >> 8)));
+        pkt.push_back(static_cast<std::uint8_t>(len & 0xFF));
+    }
+
+    for (std::size_t i = 0; i < len; i++)
+        pkt.push_back(static_cast<std::uint8_t>(0xA0 + i % 16));
+
+    return pkt;
+}
+
+static packet_type concat(packet_type a, packet_type const &b) {
+    a.insert(a.end(), b.begin(), b.end());
+    return a;
+}
+
+BOOST_AUTO_TEST_SUITE( j2735_frame_locator_test_suite )
+
+BOOST_AUTO_TEST_CASE( bare_uper_frame ) {
+    auto loc = locate(frame(BSM, 38));
+    BOOST_TEST(static_cast<bool>(loc));
+    BOOST_TEST(loc.complete);
+    BOOST_TEST(loc.messageId == BSM);
+    BOOST_TEST(loc.offset == 0u);
+    BOOST_TEST(loc.length == 41u);
+
+    // A two byte length determinant
+    loc = locate(frame(MAP, 300));
+    BOOST_TEST(loc.complete);
+    BOOST_TEST(loc.messageId == MAP);
+    BOOST_TEST(loc.offset == 0u);
+    BOOST_TEST(loc.length == 304u);
+}
+
+BOOST_AUTO_TEST_CASE( frame_behind_header ) {
+    // The zero byte in the header does not start a known message ID
+    auto loc = locate(concat({ 0x47, 0x00, 0x7F, 0x1A, 0x2B, 0x3C }, frame(SPAT, 20)));
+    BOOST_TEST(loc.complete);
+    BOOST_TEST(loc.messageId == SPAT);
+    BOOST_TEST(loc.offset == 6u);
+    BOOST_TEST(loc.length == 23u);
+}
+
+BOOST_AUTO_TEST_CASE( zero_padded_frame ) {
+    auto loc = locate(concat(concat({ 0x00, 0x00, 0x00, 0x00 }, frame(BSM, 10)), { 0x00, 0x00, 0x00 }));
+    BOOST_TEST(loc.complete);
+    BOOST_TEST(loc.messageId == BSM);
+    BOOST_TEST(loc.offset == 4u);
+
+    // The padding is not part of the frame
+    BOOST_TEST(loc.length == 13u);
+}
+
+BOOST_AUTO_TEST_CASE( ieee1609dot2_wrapped_frame ) {
+    // Unsecured data, with a short form OER length for the opaque data
+    auto loc = locate(concat({ 0x03, 0x80, 0x0D }, frame(BSM, 10)));
+    BOOST_TEST(loc.complete);
+    BOOST_TEST(loc.messageId == BSM);
+    BOOST_TEST(loc.offset == 3u);
+    BOOST_TEST(loc.length == 13u);
+
+    // Behind a radio header, with a long form OER length
+    loc = locate(concat({ 0x11, 0x22, 0x03, 0x80, 0x82, 0x01, 0x30 }, frame(MAP, 300)));
+    BOOST_TEST(loc.complete);
+    BOOST_TEST(loc.messageId == MAP);
+    BOOST_TEST(loc.offset == 7u);
+    BOOST_TEST(loc.length == 304u);
+}
+
+BOOST_AUTO_TEST_CASE( truncated_length_determinant ) {
+    // The second byte of the long form length is missing
+    auto loc = locate({ 0x00, BSM, 0x81 });
+    BOOST_TEST(static_cast<bool>(loc));
+    BOOST_TEST(!loc.complete);
+    BOOST_TEST(loc.messageId == BSM);
+    BOOST_TEST(loc.offset == 0u);
+    BOOST_TEST(loc.length == 3u);
+
+    // No room for any length determinant
+    BOOST_TEST(!locate({ 0x00, BSM }));
+}
+
+BOOST_AUTO_TEST_CASE( oversize_length_determinant ) {
+    // The frame runs to the end of the packet
+    auto pkt = frame(BSM, 64);
+    pkt.resize(20);
+
+    auto loc = locate(concat({ 0x01, 0x02 }, pkt));
+    BOOST_TEST(static_cast<bool>(loc));
+    BOOST_TEST(!loc.complete);
+    BOOST_TEST(loc.messageId == BSM);
+    BOOST_TEST(loc.offset == 2u);
+    BOOST_TEST(loc.length == 20u);
+
+    // A fragmented length is never complete
+    loc = locate({ 0x00, SPAT, 0xC1, 0x00, 0x01, 0x02 });
+    BOOST_TEST(!loc.complete);
+    BOOST_TEST(loc.messageId == SPAT);
+    BOOST_TEST(loc.length == 6u);
+
+    // A later frame that fits is preferred
+    loc = locate(concat({ 0x00, BSM, 0x7F }, frame(SPAT, 5)));
+    BOOST_TEST(loc.complete);
+    BOOST_TEST(loc.messageId == SPAT);
+    BOOST_TEST(loc.offset == 3u);
+    BOOST_TEST(loc.length == 8u);
+
+    // The opaque data runs past the packet, so the frame is only bounded by the packet
+    loc = locate(concat({ 0x03, 0x80, 0x82, 0x7F, 0xFF }, frame(BSM, 10)));
+    BOOST_TEST(loc.complete);
+    BOOST_TEST(loc.messageId == BSM);
+    BOOST_TEST(loc.offset == 5u);
+    BOOST_TEST(loc.length == 13u);
+}
+
+BOOST_AUTO_TEST_CASE( garbage_has_no_frame ) {
+    BOOST_TEST(!locate({ }));
+    BOOST_TEST(!locate(packet_type(64, 0x00)));
+    BOOST_TEST(!locate(packet_type(64, 0xFF)));
+
+    std::string text { "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n" };
+    BOOST_TEST(!locate(packet_type(text.begin(), text.end())));
+
+    // Unknown message IDs, and a 1609.2 wrapper with no frame inside
+    auto loc = locate({ 0x00, 0x7F, 0x05, 0x00, 0xFE, 0x01, 0x03, 0x80, 0x03, 0x01, 0x02, 0x03 });
+    BOOST_TEST(!loc);
+    BOOST_TEST(loc.messageId == 0u);
+    BOOST_TEST(!loc.complete);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -13,6 +13,7 @@
 #include <tmx/message/TmxMessage.hpp>
 #include <tmx/plugin/TmxPlugin.hpp>
 #include <tmx/plugin/TmxPluginDataUpdate.hpp>
+#include <tmx/plugin/utils/gnss/Rtcm3FrameParser.hpp>
 
 #include <tmx/message/v2x/rtcm/RtcmMessage.hpp>
 
@@ -46,6 +47,7 @@ protected:
 #endif
 #ifndef IGNORE_RTCM3
     void on_rtcmmsg_received(message::v2x::rtcm::RTCM3Message const &, message::TmxMessage const &);
+    void on_rtcm_frame(common::byte_sequence const &, message::TmxMessage const &);
 #endif
 
 private:
@@ -53,6 +55,10 @@ private:
     std::string _gga;
     std::string _ntrip;
 
+    // Finds the RTCM3 frames in the NTRIP stream
+    std::mutex _framerLock;
+    utils::gnss::Rtcm3FrameParser _framer;
+
     std::atomic<typename common::types::UIntmax::value_type> _count;
 };
 
@@ -278,6 +278,19 @@ void RtcmPlugin::on_rtcm_received(message::TmxData const &data, message::TmxMess
 
     TLOG(DEBUG1) << "Received payload: " << byteStr;
 
+    if (std::strncmp("gpsd/RTCM3", msg.get_topic().c_str(), 10) == 0) {
+        this->on_rtcm_frame(to_byte_sequence(byteStr.data(), byteStr.length()), msg);
+    } else {
+        // The NTRIP stream may split a frame across reads, so find the whole frames first
+        std::lock_guard<std::mutex> lock(this->_framerLock);
+        this->_framer.parse(to_byte_sequence(byteStr.data(), byteStr.length()),
+                            [this, &msg](byte_sequence const &frame) { this->on_rtcm_frame(frame, msg); });
+    }
+#endif
+}
+
+#ifndef IGNORE_RTCM3
+void RtcmPlugin::on_rtcm_frame(common::byte_sequence const &frame, message::TmxMessage const &msg) {
     std::string nm = message::v2x::rtcm::RtcmVersionName<message::v2x::rtcm::RTCM_VERSION::SC10403_3>();
     auto decoder = message::codec::TmxDecoder::get_decoder(nm);
     if (!decoder) {
@@ -286,12 +299,13 @@ void RtcmPlugin::on_rtcm_received(message::TmxData const &data, message::TmxMess
     }
 
     message::v2x::rtcm::RTCM3Message rtcm3Msg;
-    auto err = decoder->decode(rtcm3Msg, to_byte_sequence(byteStr.data(), byteStr.length()));
+    auto err = decoder->decode(rtcm3Msg, frame);
     if (err) {
         this->broadcast<TmxError>(err, this->get_topic("error"), __FUNCTION__);
         return;
     }
 
+    message::codec::TmxCodec codec { msg };
     err = codec.encode(rtcm3Msg, rtcm3Msg.get_version_name());
     if (err) {
         this->broadcast<TmxError>(err, this->get_topic("error"), __FUNCTION__);
@@ -302,8 +316,8 @@ void RtcmPlugin::on_rtcm_received(message::TmxData const &data, message::TmxMess
     codec.get_message().set_topic("V2X/RTCM3");
     this->broadcast(codec.get_message());
     this->invoke_handlers(rtcm3Msg, codec.get_message());
-#endif
 }
+#endif
 
 common::TmxError RtcmPlugin::main() noexcept {
     utils::FrequencyThrottle<std::string> ggaChange { std::chrono::seconds(1) };
@@ -378,6 +392,14 @@ common::TmxError RtcmPlugin::main() noexcept {
 
             auto &topic = std::filesystem::path(channel->get_context().get_path()).filename().native();
 
+#ifndef IGNORE_RTCM3
+            {
+                // Any partial frame is from the old connection
+                std::lock_guard<std::mutex> lock(this->_framerLock);
+                this->_framer.reset();
+            }
+#endif
+
             this->register_handler<J2735>(topic, this, &RtcmPlugin::on_rtcm_received);
             channel->read_messages(topic);
             channel->get_context().get_receive_sem().wait_for(channel->get_context().get_receive_lock(),